@@ -0,0 +1,986 @@
+#pragma once
+
+// Generated by scripts/gzip_html.py from html_page.h, do not edit.
+// 22546 bytes of HTML, 15623 bytes gzipped
+
+#define INDEX_HTML_GZ_ETAG "\"46f6b920d10a21e0\""
+
+const uint8_t index_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8c, 0xbb, 0xd7, 0xb2, 0xec, 0xda,
+    0x91, 0x2d, 0xf6, 0xce, 0xaf, 0xd8, 0xe2, 0x0d, 0x45, 0xe8, 0x36, 0x9a, 0x0d, 0x14, 0x3c, 0xd8,
+    0x64, 0x47, 0xc0, 0x7b, 0x57, 0x05, 0xaf, 0xd0, 0x03, 0x3c, 0x50, 0xf0, 0xde, 0x28, 0xf4, 0xef,
+    0xc2, 0x3e, 0xe7, 0x90, 0x7d, 0xd8, 0xe6, 0x4a, 0x55, 0x7b, 0x57, 0x01, 0x98, 0x06, 0x39, 0x73,
+    0x66, 0x8e, 0x1c, 0x63, 0x61, 0xad, 0x3f, 0xfc, 0xe5, 0x7f, 0xe3, 0x4c, 0xd6, 0x09, 0x2d, 0xfe,
+    0x47, 0xb5, 0x76, 0xed, 0xbf, 0xfd, 0xe1, 0x2f, 0x7f, 0xfb, 0xca, 0xe3, 0xec, 0xdf, 0xfe, 0xf0,
+    0xe3, 0x79, 0xfd, 0xa5, 0xcb, 0xd7, 0xf8, 0x47, 0x5a, 0xc5, 0xf3, 0x92, 0xaf, 0x7f, 0xfd, 0xa3,
+    0xeb, 0x08, 0x7f, 0x22, 0xff, 0xf8, 0x5b, 0xd3, 0x5a, 0xaf, 0x6d, 0xfe, 0x6f, 0x7e, 0x2d, 0xd4,
+    0x3f, 0x3e, 0xf9, 0xba, 0x8d, 0x7f, 0x01, 0x7f, 0xbd, 0xf2, 0xfb, 0x81, 0x43, 0xbf, 0xe6, 0xfd,
+    0x33, 0xf0, 0xa8, 0xb3, 0xb5, 0xfa, 0x6b, 0x96, 0xef, 0x75, 0x9a, 0xff, 0xe9, 0x97, 0x93, 0x7f,
+    0xae, 0xfb, 0x7a, 0xad, 0xe3, 0xf6, 0x4f, 0x4b, 0x1a, 0xb7, 0xf9, 0x5f, 0x5f, 0x7f, 0xfc, 0xd1,
+    0xc7, 0x5d, 0xfe, 0xd7, 0x3f, 0xee, 0x75, 0x7e, 0x8c, 0xc3, 0xbc, 0xfe, 0xed, 0x2e, 0xcb, 0x7a,
+    0xfd, 0x6d, 0xce, 0x5f, 0x3e, 0xfe, 0xe9, 0x9f, 0x7f, 0xfc, 0xd3, 0x9f, 0xff, 0x9c, 0xe4, 0xc5,
+    0x30, 0xe7, 0xbf, 0x1c, 0xc6, 0xc5, 0x9a, 0xcf, 0x3f, 0xfe, 0xef, 0x5f, 0x1a, 0x93, 0xe1, 0xfc,
+    0xd3, 0x52, 0xdf, 0x75, 0x5f, 0xfe, 0xf9, 0x39, 0x9e, 0xb3, 0x7c, 0xfe, 0xd3, 0x73, 0xe9, 0x5f,
+    0xff, 0xf0, 0xff, 0xfc, 0xe1, 0xdf, 0x27, 0x48, 0x86, 0xec, 0xfa, 0xad, 0xfb, 0xcf, 0x57, 0xf1,
+    0x98, 0xf8, 0xa7, 0x22, 0xee, 0xea, 0xf6, 0xfa, 0xf3, 0x8f, 0x25, 0xee, 0x97, 0x3f, 0x2d, 0xf9,
+    0x5c, 0x17, 0xff, 0xfa, 0xf7, 0x0e, 0x5d, 0x3c, 0x97, 0x75, 0xff, 0xe7, 0x1f, 0xd0, 0xbf, 0x5f,
+    0x1a, 0xe3, 0x2c, 0xfb, 0xe5, 0x1e, 0x30, 0x34, 0x9e, 0xff, 0x7e, 0x39, 0x89, 0xd3, 0xa6, 0x9c,
+    0x87, 0xad, 0xcf, 0xfe, 0xfc, 0xe3, 0x7f, 0x14, 0xf0, 0xcf, 0xf7, 0x2f, 0x6d, 0xbf, 0xdd, 0xbd,
+    0x82, 0x7f, 0x77, 0xdb, 0xff, 0x62, 0xd6, 0x74, 0x68, 0x87, 0xf9, 0x19, 0xf9, 0x4a, 0x90, 0x17,
+    0x8a, 0xfe, 0xfb, 0xf5, 0x35, 0x3f, 0xd7, 0x3f, 0xc5, 0x6d, 0x5d, 0x3e, 0xdd, 0xd3, 0xc7, 0x9b,
+    0xf9, 0xfc, 0xdf, 0xdc, 0xf2, 0x3f, 0x0e, 0xfc, 0xdb, 0x84, 0x45, 0x52, 0x20, 0x05, 0xf2, 0x7b,
+    0x53, 0x1e, 0xe7, 0x75, 0xbf, 0x33, 0xe6, 0x1f, 0x0d, 0x2f, 0x8a, 0xff, 0x62, 0xa5, 0x2f, 0xec,
+    0x1f, 0x56, 0xfa, 0xab, 0x6f, 0xe7, 0x38, 0xab, 0xb7, 0xe5, 0xcf, 0x3f, 0xc8, 0x7f, 0x6c, 0x7b,
+    0xf6, 0xa0, 0x8a, 0xb3, 0xe1, 0x78, 0x56, 0xf7, 0xbc, 0x5f, 0x8f, 0x8f, 0x7e, 0xcc, 0x65, 0x12,
+    0xff, 0x1f, 0xd0, 0x3f, 0xff, 0xf8, 0xf5, 0xdf, 0xbf, 0xbc, 0xfe, 0xe7, 0xef, 0xad, 0x69, 0xe3,
+    0x24, 0x6f, 0x7f, 0x67, 0x4e, 0x56, 0x2f, 0x63, 0x1b, 0x3f, 0xdb, 0x91, 0xb4, 0x43, 0xda, 0xfc,
+    0xc7, 0x9d, 0xf8, 0xd3, 0x3a, 0x8c, 0x7f, 0xfe, 0x65, 0xd6, 0xff, 0xce, 0x75, 0xbf, 0x9b, 0x7b,
+    0xc9, 0xdb, 0x3c, 0x5d, 0xff, 0xf9, 0x47, 0xdd, 0x8f, 0xdb, 0xfa, 0x7f, 0xae, 0xd7, 0x98, 0xff,
+    0x75, 0x8c, 0x97, 0xe5, 0x78, 0xec, 0xff, 0xbf, 0xfe, 0xf9, 0x47, 0xb2, 0xad, 0xeb, 0xd0, 0xff,
+    0x76, 0xe7, 0x5f, 0xa2, 0xf2, 0xe7, 0xc4, 0xd0, 0xff, 0xfe, 0xaf, 0x3f, 0xc0, 0x7f, 0xfa, 0xc1,
+    0xf7, 0xcb, 0x36, 0xe7, 0x3f, 0x8a, 0xad, 0x6d, 0x7f, 0x6d, 0xfb, 0xe9, 0xb5, 0x1f, 0xf1, 0x73,
+    0xf6, 0xcc, 0xd9, 0x3d, 0xfb, 0xb0, 0xfc, 0xf8, 0x27, 0xf0, 0x0f, 0xff, 0xe8, 0xa4, 0xbf, 0x1b,
+    0xf5, 0x7b, 0x53, 0xff, 0xee, 0xb9, 0xff, 0xe0, 0x35, 0xf4, 0x1f, 0xaf, 0x3f, 0xc3, 0x1f, 0x47,
+    0x2d, 0x43, 0x5b, 0x67, 0x3f, 0xfe, 0x47, 0x9a, 0xa6, 0xff, 0xfa, 0x87, 0xbf, 0x87, 0xe7, 0x13,
+    0xd2, 0xf9, 0xd3, 0x8c, 0xff, 0x6d, 0xc0, 0x7f, 0x8c, 0x94, 0x67, 0xad, 0xff, 0xd5, 0x02, 0xff,
+    0x96, 0x14, 0xff, 0xb0, 0xbb, 0xd0, 0xcf, 0xf7, 0x7f, 0x6b, 0xcf, 0xcf, 0x85, 0x7f, 0x9e, 0x3c,
+    0xfc, 0x11, 0x2f, 0x3f, 0xd6, 0x2a, 0xff, 0x31, 0x3c, 0x1f, 0xf3, 0x73, 0x38, 0x3c, 0x2b, 0xaa,
+    0xfb, 0xf5, 0xf9, 0xff, 0x33, 0xa7, 0x97, 0x7a, 0xf9, 0x99, 0xd6, 0x3f, 0x7e, 0xe6, 0xe6, 0xb3,
+    0xf0, 0xbf, 0xf9, 0xa1, 0x8b, 0xcf, 0x3f, 0xfd, 0x47, 0x2f, 0xaa, 0x79, 0x3e, 0xfe, 0x3a, 0xd5,
+    0xaf, 0x3e, 0x8c, 0xd7, 0x5f, 0xda, 0x7e, 0x0c, 0xc5, 0x2f, 0x17, 0x7f, 0x02, 0xc4, 0x33, 0xe9,
+    0x93, 0xc0, 0xcf, 0x1c, 0xcf, 0x32, 0x7e, 0xb5, 0xeb, 0xf7, 0xdb, 0xf2, 0xff, 0x3f, 0xca, 0x7f,
+    0x1f, 0xb7, 0x7f, 0x73, 0x69, 0x3f, 0xf4, 0xf9, 0x7f, 0x13, 0x40, 0xff, 0x10, 0xd0, 0xe9, 0x36,
+    0x2f, 0x3f, 0x67, 0x19, 0x87, 0xfa, 0x67, 0x82, 0xfd, 0x3e, 0x3a, 0x7f, 0xb5, 0xe6, 0xcf, 0xd5,
+    0xb0, 0xff, 0x1d, 0x66, 0xfe, 0x93, 0x4d, 0x10, 0x84, 0xe1, 0xc9, 0x3f, 0x64, 0xd8, 0xf8, 0xbb,
+    0xae, 0xff, 0xab, 0x04, 0xfe, 0xfd, 0xfe, 0xfe, 0x43, 0x1a, 0xfd, 0xda, 0xf0, 0x13, 0xfc, 0xfe,
+    0xfc, 0xa3, 0x5e, 0x9f, 0xd1, 0xe9, 0xff, 0x47, 0xb8, 0xff, 0xad, 0xf1, 0x97, 0x83, 0x7f, 0xf9,
+    0x05, 0x8a, 0x7f, 0x82, 0xdf, 0x7f, 0x0a, 0x82, 0x3f, 0xfd, 0x57, 0x38, 0xf3, 0x8f, 0x50, 0xf1,
+    0x5f, 0x86, 0xc7, 0x0b, 0xfe, 0x9b, 0x79, 0xff, 0x05, 0x28, 0xfc, 0x77, 0x4b, 0xfc, 0xcd, 0xe3,
+    0xc9, 0xf0, 0xf8, 0xb0, 0xfb, 0x3d, 0x5e, 0xfe, 0x23, 0x4a, 0x3c, 0x53, 0xff, 0xc0, 0xff, 0x13,
+    0x4c, 0x40, 0xff, 0xf2, 0xc2, 0xfe, 0xe7, 0x2f, 0xd1, 0xfd, 0xbb, 0xe5, 0xfc, 0x1d, 0x45, 0xff,
+    0x03, 0x82, 0xfe, 0xce, 0x91, 0xf0, 0x2f, 0x99, 0xf5, 0x7b, 0xcc, 0xff, 0xb5, 0x94, 0x80, 0xbf,
+    0xd5, 0x92, 0xbf, 0x80, 0xbf, 0x16, 0xb8, 0xbf, 0x64, 0xf5, 0xfe, 0x23, 0x6d, 0x9f, 0x74, 0xf9,
+    0xeb, 0x1f, 0xff, 0x7e, 0x83, 0x5f, 0xea, 0xce, 0x5f, 0x2a, 0xf8, 0x1f, 0x0a, 0xdb, 0x73, 0xfa,
+    0x8c, 0x7a, 0xba, 0x3f, 0x5f, 0xbf, 0x60, 0x67, 0x9c, 0xae, 0xf5, 0xd0, 0xff, 0xf5, 0x8f, 0xe0,
+    0x12, 0xef, 0xf9, 0x1f, 0x7f, 0x3c, 0xc5, 0xae, 0x1a, 0xb2, 0xbf, 0xfe, 0xd1, 0x32, 0x3f, 0xce,
+    0x1f, 0xff, 0xed, 0x2f, 0xbf, 0x02, 0xda, 0xd3, 0xf1, 0xaf, 0x7f, 0x5c, 0x96, 0x3a, 0xfb, 0xe3,
+    0xbf, 0x7d, 0x7e, 0x81, 0xa1, 0x1f, 0x46, 0xbe, 0x3e, 0x89, 0xd9, 0xfc, 0xf9, 0x2f, 0xe0, 0x2f,
+    0x3d, 0xfe, 0xed, 0x2f, 0xbf, 0xc2, 0xd3, 0x8f, 0x3a, 0xfb, 0xad, 0xe3, 0x6f, 0x35, 0xf0, 0xd7,
+    0x41, 0xbf, 0x1a, 0x3d, 0x8c, 0x3f, 0xef, 0xf4, 0x13, 0x13, 0xe3, 0xa4, 0xcd, 0xb3, 0xdf, 0x10,
+    0x2d, 0xcf, 0xfe, 0xed, 0x93, 0xc6, 0x7d, 0xff, 0x6c, 0xc3, 0xbf, 0xfc, 0xcb, 0xbf, 0xfc, 0x05,
+    0xfc, 0xb5, 0xd7, 0x4f, 0x23, 0x7f, 0x6d, 0xff, 0x07, 0x1b, 0xfe, 0x06, 0x08, 0x7f, 0xfc, 0x37,
+    0xeb, 0xb7, 0xa3, 0x7f, 0xb7, 0xe0, 0x17, 0xdc, 0xf8, 0xc5, 0x80, 0xbf, 0xf7, 0xfa, 0xcd, 0x88,
+    0x7f, 0x3f, 0xff, 0x05, 0x55, 0x7e, 0x37, 0xcb, 0x1f, 0x7e, 0x1b, 0xf5, 0xeb, 0xf5, 0xaa, 0xce,
+    0xb2, 0xbc, 0xff, 0xdb, 0xa8, 0xb5, 0xee, 0x1e, 0x7f, 0xfc, 0x9c, 0xef, 0x97, 0xa3, 0xff, 0x75,
+    0xdf, 0xfb, 0xb7, 0x9e, 0xf7, 0xdf, 0x16, 0xfb, 0x73, 0x43, 0x7e, 0xd9, 0xa4, 0xe7, 0xe2, 0x7f,
+    0x8e, 0xa8, 0xdf, 0x7a, 0xfd, 0xd2, 0xb3, 0xee, 0xca, 0x07, 0x8b, 0x1f, 0x66, 0x21, 0x77, 0x71,
+    0x99, 0xff, 0xf1, 0xef, 0x0d, 0xbf, 0xbc, 0x96, 0x39, 0xfd, 0xeb, 0x1f, 0xb3, 0x78, 0x8d, 0xff,
+    0x5c, 0xff, 0x6c, 0x05, 0xc7, 0xbe, 0xfc, 0xd7, 0x24, 0x5e, 0x72, 0x1c, 0xfd, 0xe7, 0xda, 0x63,
+    0xcc, 0xf7, 0x01, 0xa9, 0x62, 0x39, 0xd0, 0xcf, 0xcb, 0xf8, 0xb8, 0x15, 0xef, 0x96, 0xcf, 0x91,
+    0xfc, 0xf3, 0x94, 0x7d, 0xde, 0xe1, 0xf3, 0xcd, 0x71, 0x56, 0x27, 0x69, 0x3f, 0xaf, 0xd0, 0x81,
+    0xf1, 0x79, 0x43, 0x32, 0x3d, 0x2f, 0x68, 0x8a, 0xdb, 0xcf, 0x39, 0xff, 0x6e, 0x7d, 0xbe, 0xed,
+    0x1c, 0x17, 0xa2, 0xd5, 0x9f, 0xe3, 0xe8, 0xe7, 0x23, 0xcc, 0x46, 0x9a, 0xfe, 0xd9, 0x48, 0x33,
+    0x3f, 0x3f, 0xc4, 0x5f, 0xae, 0x3f, 0x2f, 0xfc, 0xe7, 0xb9, 0xfe, 0xdb, 0x75, 0x9e, 0xa6, 0xd5,
+    0x67, 0xfa, 0xdf, 0xf5, 0x2b, 0x55, 0x9a, 0xfb, 0x87, 0xf3, 0x5f, 0x06, 0x31, 0xf2, 0xb7, 0x7c,
+    0x23, 0xcf, 0xc1, 0xe5, 0xbb, 0x2d, 0x6f, 0x7b, 0x6f, 0x94, 0xce, 0x5f, 0x19, 0x13, 0x33, 0xde,
+    0x99, 0x45, 0x39, 0x46, 0xa9, 0x65, 0x26, 0x65, 0x32, 0xcb, 0x4f, 0xdc, 0x2a, 0x7f, 0x68, 0x99,
+    0x2d, 0x5b, 0x7e, 0x52, 0xf9, 0x9a, 0x9e, 0x45, 0xe8, 0x2a, 0x70, 0xf1, 0xfa, 0x4e, 0x2e, 0x06,
+    0xbe, 0x1e, 0xe0, 0x0b, 0xcb, 0xbd, 0x74, 0xdf, 0xb6, 0xc7, 0xd8, 0xcc, 0x9b, 0xb1, 0xe9, 0x4f,
+    0xbb, 0x11, 0x1b, 0x81, 0xbf, 0x08, 0x13, 0x44, 0x5e, 0x33, 0xb5, 0x5d, 0xb7, 0x43, 0x21, 0xa5,
+    0xb2, 0x7d, 0x69, 0x2b, 0xd8, 0x61, 0x42, 0x6e, 0xbd, 0x05, 0x8e, 0x0c, 0x00, 0xb0, 0x3f, 0x29,
+    0x0e, 0x50, 0x26, 0x39, 0x80, 0x09, 0x28, 0x5c, 0x7e, 0x12, 0x4d, 0xf3, 0xfb, 0xa0, 0xb2, 0x46,
+    0x23, 0x8b, 0x1e, 0xb8, 0x74, 0xcb, 0xc1, 0x0a, 0x45, 0xfe, 0xe6, 0x77, 0x3c, 0x7a, 0xaa, 0xb8,
+    0xbc, 0xd4, 0xd3, 0xf7, 0xa3, 0xd9, 0x9d, 0xaf, 0x60, 0xf5, 0xbf, 0xc9, 0xa9, 0x7c, 0x76, 0x87,
+    0x53, 0x1c, 0x74, 0x68, 0xa2, 0x06, 0xc8, 0xc7, 0x17, 0x58, 0x15, 0x05, 0xd0, 0x32, 0x40, 0x40,
+    0x30, 0xba, 0x33, 0x42, 0x40, 0x73, 0x7d, 0x2e, 0x60, 0x71, 0xdf, 0x9c, 0x84, 0xa0, 0xa7, 0x9e,
+    0x21, 0x3a, 0xb7, 0x9d, 0x5a, 0xb3, 0xf9, 0xb7, 0xa0, 0xee, 0xef, 0x36, 0x18, 0x5f, 0xb9, 0x2b,
+    0xe2, 0xd9, 0xb5, 0x79, 0xb9, 0xec, 0x28, 0x73, 0x4c, 0x1b, 0xf2, 0x88, 0x40, 0x36, 0x0f, 0x44,
+    0xeb, 0xc9, 0x83, 0x04, 0x95, 0x83, 0x10, 0x6b, 0x4a, 0xdc, 0x92, 0xf7, 0xee, 0x67, 0xa0, 0xc2,
+    0x98, 0xe2, 0xfa, 0x11, 0x85, 0xf4, 0xf4, 0xe8, 0xc1, 0xb6, 0xa4, 0x17, 0xe5, 0xb2, 0xb9, 0x11,
+    0x94, 0x65, 0xd8, 0xb1, 0x57, 0x33, 0x9e, 0x94, 0x91, 0xf3, 0xd9, 0x41, 0xc4, 0xf4, 0xeb, 0x1d,
+    0x04, 0x73, 0xfe, 0xe2, 0xf1, 0x3c, 0xf7, 0x3f, 0x47, 0x03, 0x49, 0x7c, 0xcc, 0x34, 0x1b, 0xa9,
+    0xca, 0x34, 0x35, 0xec, 0xbb, 0xb2, 0xaf, 0x45, 0x6e, 0x19, 0x1c, 0x1c, 0x80, 0x47, 0xca, 0x94,
+    0xcc, 0xe5, 0xcf, 0x5c, 0x20, 0x98, 0xda, 0x54, 0x88, 0xe3, 0xda, 0x5a, 0x56, 0xf7, 0x56, 0x28,
+    0xb5, 0xb3, 0x07, 0x1d, 0x52, 0xde, 0x5b, 0xa0, 0x75, 0x8d, 0xb6, 0xe3, 0x99, 0xa2, 0x4b, 0x04,
+    0x31, 0x50, 0xc7, 0x5a, 0xb8, 0x25, 0x70, 0xb2, 0xe9, 0x42, 0xd8, 0xb4, 0x81, 0x5e, 0xb8, 0x28,
+    0x81, 0x84, 0xd5, 0x69, 0xc7, 0xce, 0xb3, 0xcd, 0x85, 0x7c, 0x9d, 0xc2, 0xd7, 0xbf, 0x43, 0x78,
+    0xd2, 0xe1, 0x65, 0xeb, 0x2a, 0xaa, 0xb2, 0x1c, 0x02, 0xc9, 0x70, 0x7a, 0x41, 0xc3, 0x27, 0xd1,
+    0x55, 0xbd, 0x6a, 0xb8, 0x35, 0xff, 0xc6, 0x46, 0x79, 0xe6, 0xfa, 0xa2, 0x29, 0x34, 0x7f, 0x7f,
+    0xc8, 0x26, 0xde, 0x9b, 0x4b, 0xc9, 0x83, 0x68, 0x08, 0xcd, 0x36, 0x8f, 0x0d, 0x9c, 0xf4, 0x43,
+    0xa7, 0xa9, 0x6f, 0x23, 0xf8, 0xea, 0x8d, 0x2b, 0x05, 0x09, 0xb5, 0x73, 0x3b, 0x3c, 0x2f, 0x60,
+    0x45, 0x57, 0x2a, 0xee, 0x32, 0x14, 0x87, 0xb7, 0xb8, 0x5a, 0xd1, 0xf1, 0xe9, 0xa8, 0x3a, 0x21,
+    0xd3, 0x5a, 0xed, 0xa7, 0xac, 0x06, 0x30, 0xc1, 0x42, 0xea, 0x96, 0xaa, 0x86, 0x17, 0x7f, 0xb5,
+    0x85, 0x16, 0x81, 0xec, 0x7b, 0x96, 0xaf, 0x64, 0x60, 0x49, 0x33, 0xe6, 0xbd, 0xa0, 0xff, 0x42,
+    0xc1, 0xd6, 0xfb, 0x8b, 0x0b, 0x95, 0x24, 0xad, 0xd1, 0x1f, 0xb3, 0x69, 0x44, 0x7b, 0x0a, 0xe1,
+    0x0e, 0xc6, 0x01, 0xb0, 0x58, 0xcc, 0xb3, 0xe6, 0x65, 0xa0, 0xdf, 0x1a, 0xc1, 0x2c, 0xa8, 0xda,
+    0x5c, 0xf3, 0x57, 0xf0, 0x12, 0x17, 0x49, 0x5c, 0x5a, 0xd0, 0xc1, 0xb7, 0x7e, 0x90, 0xed, 0x4d,
+    0x1b, 0x5f, 0x65, 0x60, 0x35, 0x64, 0xb8, 0x7b, 0x6d, 0x65, 0x71, 0x18, 0xf0, 0xec, 0x0d, 0x36,
+    0x20, 0x45, 0xc0, 0xf1, 0x12, 0xc1, 0xd1, 0x02, 0xbf, 0xe7, 0x2b, 0x01, 0xf4, 0xc5, 0x06, 0xe7,
+    0xf9, 0xa7, 0xfe, 0xfa, 0x3a, 0xc2, 0x25, 0x93, 0x69, 0xbf, 0xf9, 0x62, 0xd6, 0x37, 0x4c, 0xd1,
+    0x0d, 0x67, 0x02, 0xfa, 0xec, 0xdb, 0xbe, 0x71, 0xc8, 0x62, 0xdc, 0x8e, 0x2f, 0x5d, 0x06, 0x37,
+    0x1a, 0xd6, 0x90, 0x8c, 0xbe, 0x47, 0x10, 0x08, 0x54, 0x33, 0x17, 0x4a, 0x2a, 0x3e, 0xb2, 0x5c,
+    0x90, 0x73, 0xd6, 0x82, 0x49, 0xaa, 0xfb, 0xee, 0x40, 0x38, 0x30, 0x41, 0x96, 0xe5, 0x83, 0x3c,
+    0x94, 0x2a, 0x4f, 0x5b, 0xe1, 0x3e, 0x24, 0x03, 0x97, 0x37, 0xcb, 0xcf, 0xac, 0x4e, 0xb8, 0xe9,
+    0xc1, 0xaa, 0x75, 0x90, 0xcc, 0x65, 0xd0, 0x3d, 0x73, 0xb4, 0x51, 0xc0, 0x0c, 0xaf, 0xb9, 0x65,
+    0x77, 0xed, 0x2b, 0x5c, 0x96, 0xc3, 0xc5, 0x5d, 0xa8, 0xb2, 0xf5, 0xe3, 0x5f, 0xd6, 0xc5, 0x13,
+    0x8b, 0x1a, 0xf3, 0x09, 0x62, 0x7d, 0x15, 0x78, 0x55, 0xe8, 0x87, 0x55, 0x3f, 0xc7, 0x8b, 0x63,
+    0xaa, 0x84, 0x87, 0x1e, 0x88, 0x02, 0xda, 0x68, 0x1a, 0xd9, 0x4e, 0xbf, 0x75, 0xc1, 0xe6, 0x6b,
+    0xbb, 0x43, 0x9d, 0x7c, 0x32, 0x61, 0x8f, 0x4b, 0x69, 0x06, 0x78, 0x4d, 0x5d, 0xcd, 0x44, 0x8b,
+    0x1f, 0x73, 0xad, 0x5a, 0xbd, 0xfa, 0x02, 0x50, 0x84, 0x17, 0x86, 0xd8, 0xa3, 0x12, 0x65, 0x95,
+    0xea, 0xf8, 0xaf, 0xa1, 0xd7, 0xb3, 0x4e, 0x78, 0xc3, 0xa0, 0x3f, 0xc5, 0x14, 0x78, 0x60, 0xc9,
+    0x5a, 0xda, 0x17, 0xbd, 0x2e, 0x7b, 0x69, 0x9b, 0x65, 0x8b, 0xc5, 0x86, 0x1f, 0x9e, 0x00, 0x63,
+    0xd6, 0xa7, 0x5c, 0xed, 0x22, 0xb3, 0xdb, 0x48, 0x12, 0x3f, 0x69, 0xa6, 0xa2, 0xb9, 0x2e, 0x15,
+    0x9d, 0xfa, 0x52, 0x2b, 0xdf, 0x4c, 0x11, 0xb4, 0xe9, 0x42, 0xa1, 0x89, 0xcd, 0x36, 0x9e, 0x0b,
+    0xb8, 0x7f, 0xa5, 0xd9, 0xf7, 0x2c, 0x54, 0x13, 0x9e, 0x64, 0x0f, 0x82, 0x63, 0xb1, 0xa2, 0x58,
+    0x85, 0x8d, 0x49, 0x4f, 0x39, 0x55, 0xba, 0xa9, 0xb7, 0x8d, 0xd9, 0x9a, 0x59, 0x89, 0xbf, 0xf0,
+    0x6c, 0xb2, 0xa4, 0xf5, 0xa5, 0x32, 0xb2, 0xa4, 0x8a, 0x60, 0x6b, 0x58, 0x1f, 0xfc, 0x8c, 0x0a,
+    0xc7, 0x7c, 0x6f, 0x62, 0x07, 0x61, 0x62, 0xca, 0x94, 0xdc, 0x98, 0xe9, 0xc5, 0x2d, 0xbc, 0x25,
+    0xf9, 0xd0, 0x76, 0x4d, 0xa0, 0x19, 0xed, 0xb3, 0x2a, 0xda, 0x7c, 0x28, 0xc1, 0x39, 0x9c, 0xca,
+    0xc3, 0x7b, 0x3b, 0xd5, 0xcd, 0xcf, 0x34, 0xba, 0xd3, 0xa5, 0xd9, 0xbb, 0x4b, 0x91, 0xf0, 0x47,
+    0x72, 0x99, 0xc9, 0x40, 0x3a, 0xa1, 0x77, 0x56, 0xae, 0x2e, 0x93, 0xb5, 0x50, 0xef, 0x20, 0x7d,
+    0x83, 0x19, 0xf1, 0xac, 0xc6, 0x43, 0x5f, 0x39, 0xdb, 0x5f, 0xe6, 0x8d, 0xa7, 0x9e, 0x55, 0x67,
+    0xdd, 0xc6, 0xc9, 0x8c, 0xe7, 0x33, 0xe6, 0x82, 0x22, 0x05, 0x27, 0xd5, 0x8a, 0xdf, 0xda, 0x23,
+    0x32, 0x4d, 0xe4, 0xa7, 0xf7, 0xf4, 0x3a, 0x14, 0xc7, 0x7c, 0x83, 0xc9, 0xb4, 0x10, 0x7a, 0x2f,
+    0x6b, 0x66, 0x2b, 0x71, 0x04, 0xf0, 0x08, 0x4f, 0xab, 0xf3, 0xa7, 0x9a, 0x0b, 0xd1, 0xaf, 0x06,
+    0x35, 0xe7, 0xfc, 0x8e, 0xe0, 0x89, 0x39, 0xa6, 0x0e, 0xd2, 0x67, 0x8f, 0x47, 0x28, 0x0a, 0x00,
+    0xbf, 0xd2, 0xf8, 0x52, 0xb1, 0x76, 0xaa, 0xe8, 0xc9, 0x73, 0xe4, 0xf6, 0xa5, 0xbd, 0x17, 0x21,
+    0x98, 0x81, 0x45, 0x49, 0xbe, 0xa1, 0xbf, 0x51, 0x1e, 0x30, 0x67, 0xa6, 0x44, 0xbd, 0xbe, 0xb8,
+    0xef, 0x5f, 0x27, 0xcf, 0x3f, 0xb0, 0x51, 0x83, 0xdf, 0x15, 0xbf, 0x32, 0x8e, 0x01, 0x33, 0x78,
+    0x57, 0x5d, 0x7f, 0x13, 0x4c, 0x52, 0xbc, 0xf7, 0x7b, 0x75, 0x10, 0xd2, 0x26, 0x0f, 0x71, 0x8c,
+    0x1c, 0x42, 0x38, 0xac, 0xd1, 0x61, 0x07, 0xa9, 0xc1, 0x3a, 0x53, 0xd0, 0xe7, 0x1e, 0x53, 0xb8,
+    0x85, 0xf2, 0xdf, 0x3b, 0x1f, 0xac, 0xc6, 0x1e, 0x8a, 0x7e, 0x95, 0x83, 0x30, 0x77, 0xc3, 0xc1,
+    0xa0, 0x83, 0xe4, 0xa9, 0x9d, 0xd3, 0x47, 0xff, 0x52, 0xcc, 0xfb, 0x13, 0x22, 0x17, 0x91, 0x02,
+    0xc0, 0x08, 0x9a, 0x70, 0x19, 0x5c, 0x6e, 0x10, 0x13, 0xf3, 0xd9, 0x8d, 0x58, 0x9f, 0x93, 0xf3,
+    0xd0, 0xa7, 0xf0, 0x04, 0x53, 0x82, 0x3e, 0x15, 0x1e, 0x16, 0xd5, 0x64, 0x5a, 0x71, 0x07, 0x05,
+    0xd8, 0x9b, 0x65, 0x76, 0x5b, 0x20, 0x33, 0x4e, 0x03, 0x58, 0x9f, 0x7b, 0x74, 0xc5, 0xbd, 0x5e,
+    0x07, 0x2d, 0x9a, 0x21, 0xaf, 0x04, 0x72, 0xf1, 0x85, 0xd6, 0x3b, 0xbf, 0x9e, 0x8e, 0x82, 0x93,
+    0xa8, 0x65, 0x81, 0x1f, 0x00, 0x00, 0x23, 0xf1, 0x73, 0x33, 0x52, 0x5c, 0x2a, 0xbe, 0xe5, 0x32,
+    0x90, 0xf3, 0x49, 0xa4, 0x4f, 0xb3, 0xe4, 0x51, 0x71, 0x10, 0x93, 0x5a, 0xbc, 0xf0, 0x6c, 0x8c,
+    0x16, 0x38, 0x51, 0x39, 0x3c, 0x10, 0x3f, 0x9a, 0xbb, 0x74, 0x5d, 0xb1, 0x4b, 0xe1, 0xdc, 0xbf,
+    0xf6, 0xa9, 0x10, 0xe0, 0xfa, 0x56, 0xd4, 0x4b, 0xc2, 0xa6, 0xb8, 0x99, 0x93, 0x90, 0x1c, 0x5e,
+    0x02, 0x36, 0x21, 0x13, 0xbb, 0x7d, 0x99, 0xfe, 0x0c, 0x87, 0xd1, 0xd6, 0x21, 0xf7, 0x02, 0x7c,
+    0x4e, 0x37, 0x2d, 0xca, 0x99, 0xd1, 0xf3, 0x58, 0x6c, 0x7c, 0xc6, 0x63, 0x14, 0xda, 0x5e, 0xd2,
+    0xe7, 0x2e, 0x2c, 0xcb, 0x4e, 0xe0, 0xa6, 0x20, 0x29, 0xf3, 0x21, 0xc3, 0xba, 0x58, 0xb4, 0xed,
+    0xab, 0x3f, 0xb0, 0xdc, 0xac, 0xe5, 0xc0, 0xd8, 0xd0, 0xb9, 0xb5, 0x97, 0x00, 0x4a, 0x3a, 0x70,
+    0x6e, 0xc3, 0x64, 0x5e, 0xc1, 0x5c, 0x0f, 0xdf, 0xf4, 0x84, 0x60, 0xb4, 0x27, 0x47, 0x8e, 0xcf,
+    0xe5, 0x1b, 0x11, 0xed, 0xaa, 0x0f, 0x92, 0x38, 0x21, 0x34, 0xe4, 0xf5, 0xac, 0x22, 0x3e, 0xe3,
+    0x8d, 0x14, 0x40, 0xe4, 0x03, 0x73, 0x02, 0x3b, 0x79, 0x7e, 0xe7, 0xc3, 0x0f, 0x1e, 0x52, 0x89,
+    0xe5, 0xad, 0x15, 0x05, 0xd2, 0x7d, 0x87, 0x83, 0x36, 0x00, 0x6e, 0x5a, 0xf0, 0x22, 0x32, 0xe5,
+    0xc1, 0x7a, 0x88, 0x50, 0x26, 0x95, 0xec, 0xaf, 0x25, 0x2b, 0x9c, 0xd1, 0xe1, 0x7c, 0xa1, 0x85,
+    0x5c, 0x60, 0xeb, 0xf4, 0xe9, 0x5d, 0x64, 0x78, 0x9b, 0x2e, 0xf1, 0xad, 0x03, 0x01, 0xfc, 0xa6,
+    0x2c, 0x44, 0xd2, 0xcf, 0x6e, 0x30, 0xed, 0x6a, 0xa3, 0xe7, 0x07, 0x77, 0xe9, 0x1c, 0x82, 0x2d,
+    0xb6, 0xba, 0xbc, 0x8d, 0x69, 0xc5, 0x83, 0x61, 0x99, 0x8a, 0x0c, 0xb5, 0x4f, 0x00, 0xd8, 0xc4,
+    0x5e, 0x1e, 0x70, 0x92, 0x99, 0x26, 0x65, 0x71, 0x53, 0xf3, 0x05, 0x1f, 0x08, 0x99, 0xf4, 0xd4,
+    0x42, 0x5a, 0xd5, 0xda, 0x5f, 0x57, 0xd9, 0xdf, 0xe4, 0xcb, 0xa6, 0x2e, 0xcc, 0xac, 0xce, 0x3a,
+    0xec, 0xcf, 0x4f, 0x1c, 0x87, 0x8e, 0xa1, 0x6e, 0x6f, 0x57, 0x8f, 0x10, 0x26, 0x63, 0x53, 0xde,
+    0x1b, 0x3b, 0x07, 0x9b, 0xfb, 0xf2, 0xc4, 0x29, 0xd6, 0xc5, 0xfa, 0x97, 0xb0, 0xd0, 0xa3, 0xec,
+    0xf7, 0xf4, 0x70, 0x7c, 0x8e, 0x6e, 0x3d, 0xa5, 0x7b, 0xbc, 0x02, 0x4a, 0x26, 0x2e, 0x14, 0x61,
+    0x38, 0xb4, 0x6d, 0xd2, 0x67, 0x13, 0x4b, 0xef, 0x88, 0x8d, 0xdc, 0x1f, 0x01, 0x18, 0x90, 0x32,
+    0xae, 0xac, 0xd1, 0x69, 0x02, 0xa3, 0x09, 0xb8, 0x71, 0x01, 0xa1, 0x22, 0x29, 0x79, 0xe0, 0xd6,
+    0x45, 0xf1, 0x1b, 0x0b, 0x20, 0xd8, 0x85, 0x72, 0xb3, 0x53, 0x77, 0x4b, 0xc9, 0x15, 0x90, 0xb7,
+    0xcd, 0x40, 0xba, 0xf2, 0x77, 0x51, 0x8c, 0xe9, 0x7b, 0x20, 0x70, 0x9f, 0x8a, 0x36, 0xf8, 0x13,
+    0x2e, 0x1d, 0x97, 0x3b, 0x99, 0xf0, 0x60, 0x45, 0xca, 0x7e, 0x34, 0x8b, 0xed, 0x24, 0x43, 0xe9,
+    0x76, 0x85, 0x0b, 0x1a, 0x63, 0xb3, 0x5f, 0xe0, 0x24, 0x59, 0x60, 0x93, 0x77, 0xe0, 0x57, 0x93,
+    0x76, 0xe1, 0xa4, 0xeb, 0xa8, 0xd9, 0x64, 0x19, 0xea, 0xa6, 0xac, 0x1e, 0x4a, 0x10, 0x5c, 0x36,
+    0xaf, 0x44, 0xb6, 0xc4, 0xfb, 0x70, 0x1f, 0x3b, 0xc5, 0xe6, 0x57, 0x39, 0x04, 0xce, 0xed, 0xd0,
+    0x8d, 0xc5, 0x25, 0x38, 0x60, 0xf9, 0x80, 0x0b, 0xe1, 0x85, 0x55, 0xee, 0x7d, 0x71, 0x5d, 0xd9,
+    0xb7, 0xc0, 0x58, 0xee, 0x8d, 0x62, 0x2a, 0xb6, 0x5c, 0xd1, 0x5a, 0x24, 0xc4, 0x40, 0xf3, 0x32,
+    0x8e, 0x34, 0x61, 0x79, 0x6e, 0x30, 0xa1, 0xbc, 0xbf, 0x0a, 0x84, 0xc9, 0x63, 0x20, 0xb7, 0x63,
+    0x91, 0x78, 0x5e, 0xec, 0xc5, 0x63, 0x22, 0x5f, 0x78, 0x5e, 0x14, 0x99, 0x41, 0x4f, 0x8a, 0xcf,
+    0x28, 0x5e, 0x85, 0xba, 0xf4, 0x36, 0xd0, 0xe0, 0xa3, 0xf0, 0xc8, 0x88, 0x9a, 0xca, 0x8c, 0x38,
+    0x5d, 0xb8, 0x90, 0x97, 0xec, 0xc1, 0xef, 0x17, 0x25, 0x83, 0x55, 0xda, 0xd0, 0xcc, 0x6b, 0x17,
+    0x01, 0xad, 0xd8, 0x3a, 0x13, 0x51, 0x43, 0x32, 0x55, 0x6e, 0x06, 0xfa, 0x7e, 0x01, 0x8e, 0x14,
+    0x08, 0x20, 0xf7, 0x53, 0xeb, 0xb9, 0xaf, 0xd5, 0x7f, 0x37, 0xc9, 0xdf, 0x49, 0xae, 0xe3, 0x28,
+    0x85, 0xab, 0x20, 0x8c, 0x99, 0x34, 0xe1, 0xa3, 0x11, 0xe9, 0x16, 0xbf, 0x99, 0xf9, 0x29, 0x8a,
+    0xec, 0x74, 0x47, 0xe8, 0x31, 0x7f, 0x9b, 0xab, 0xb0, 0x2e, 0xa9, 0x05, 0x7b, 0xf5, 0x4e, 0x76,
+    0x01, 0x36, 0xa5, 0x9b, 0x1c, 0x3d, 0xcc, 0x5e, 0x99, 0x8f, 0x88, 0xea, 0x8b, 0xae, 0x94, 0x9e,
+    0xb8, 0xe0, 0x2c, 0x8f, 0xbe, 0xcd, 0x68, 0xa0, 0x63, 0xbf, 0x0c, 0x14, 0x2f, 0x76, 0x9e, 0xcc,
+    0xda, 0xd9, 0x59, 0xb1, 0x47, 0xa6, 0x91, 0x8a, 0x02, 0x33, 0x30, 0x8b, 0x64, 0xb1, 0xfc, 0xc9,
+    0xf6, 0xd3, 0xaf, 0x76, 0x4b, 0x22, 0x39, 0x1c, 0xed, 0x33, 0xad, 0xcc, 0xac, 0x15, 0xc3, 0x75,
+    0x22, 0xbf, 0xf6, 0xe3, 0x8e, 0x48, 0x60, 0x84, 0x77, 0x92, 0x67, 0x56, 0x90, 0x39, 0xf0, 0x2f,
+    0xd6, 0x39, 0xca, 0x08, 0xbf, 0xf0, 0xc1, 0x95, 0x88, 0x11, 0x89, 0x61, 0x0e, 0xe1, 0xf2, 0xb2,
+    0x7d, 0x7d, 0xb0, 0x61, 0xba, 0xf9, 0x70, 0x29, 0x71, 0xfe, 0xb0, 0xbf, 0xc6, 0x37, 0xf2, 0xf7,
+    0x7d, 0x3f, 0x3d, 0xa4, 0xef, 0x21, 0x9c, 0x6a, 0x20, 0x2a, 0xcc, 0xa0, 0x69, 0x56, 0x0c, 0xbf,
+    0x34, 0xab, 0x2e, 0x0e, 0xb1, 0x81, 0x21, 0xd7, 0xd3, 0x46, 0x8a, 0xe1, 0x61, 0x7b, 0x25, 0x9a,
+    0x9a, 0x1f, 0x8d, 0x92, 0xfa, 0x2f, 0x5b, 0xf0, 0x03, 0xfb, 0x8a, 0xf4, 0x85, 0xa6, 0x81, 0xef,
+    0xed, 0x88, 0x66, 0x54, 0x88, 0xd6, 0xeb, 0x89, 0x76, 0x50, 0xcb, 0xd5, 0x43, 0x3a, 0xad, 0x9d,
+    0x02, 0x24, 0x66, 0xc5, 0xd9, 0x79, 0xc5, 0x0d, 0x7b, 0x8b, 0xad, 0xf7, 0xb8, 0x83, 0x7c, 0x54,
+    0x83, 0x12, 0x05, 0x51, 0xfa, 0x4a, 0xe2, 0x55, 0xe6, 0x9f, 0x2e, 0x7e, 0xaa, 0xd1, 0x07, 0x14,
+    0xd9, 0x45, 0x42, 0xe3, 0xc4, 0x48, 0x65, 0xbf, 0x54, 0x3a, 0x98, 0xe3, 0xc9, 0xb3, 0x55, 0x58,
+    0xfa, 0x76, 0xea, 0x70, 0x99, 0xe8, 0xa1, 0x38, 0x2c, 0x92, 0x20, 0x83, 0x80, 0x40, 0xf3, 0x77,
+    0x1c, 0x35, 0x5d, 0x1d, 0x28, 0xb4, 0x38, 0x20, 0x5a, 0xfd, 0xed, 0x88, 0xfe, 0xe3, 0x34, 0x8b,
+    0x44, 0x60, 0x30, 0xac, 0x1a, 0x62, 0x3b, 0x76, 0x0a, 0x1f, 0x05, 0xf8, 0xae, 0x0d, 0x09, 0x86,
+    0x9b, 0x23, 0x45, 0xae, 0x6e, 0x33, 0x17, 0x6d, 0x64, 0xe9, 0x67, 0x4f, 0x86, 0x4e, 0x61, 0x4a,
+    0xdf, 0x63, 0x28, 0x0d, 0x8f, 0xd3, 0x73, 0x50, 0xe4, 0x53, 0xc7, 0x91, 0x69, 0x1b, 0xe2, 0xb8,
+    0xd4, 0xe1, 0x11, 0xfb, 0x2b, 0x47, 0xd5, 0xbb, 0xd2, 0xd9, 0x12, 0x7d, 0xfb, 0xb6, 0x9d, 0x17,
+    0xe6, 0x49, 0x01, 0x67, 0xad, 0xfa, 0x93, 0x98, 0xd7, 0x4c, 0xce, 0xe5, 0xe7, 0x0b, 0x84, 0x96,
+    0x63, 0x15, 0x84, 0xdb, 0xb1, 0x4b, 0x54, 0xce, 0x4c, 0xb7, 0x72, 0xcb, 0xb8, 0x89, 0xf0, 0x94,
+    0x27, 0x92, 0x31, 0x02, 0x42, 0x8b, 0x18, 0xf5, 0x9b, 0x43, 0xcf, 0x1e, 0xdd, 0x25, 0x5c, 0x32,
+    0xd6, 0x3b, 0x28, 0x86, 0x90, 0x9a, 0xd4, 0xb7, 0xa2, 0xab, 0x07, 0x44, 0x8f, 0x17, 0x6b, 0xe3,
+    0xb6, 0xd0, 0x4f, 0x95, 0x29, 0xa0, 0xca, 0xd5, 0x9b, 0x31, 0x6d, 0x4f, 0x6c, 0x22, 0xbb, 0xbc,
+    0x52, 0xe6, 0xbc, 0x14, 0x16, 0x11, 0x53, 0x82, 0x76, 0xce, 0xcf, 0x1b, 0x84, 0x1f, 0xf2, 0x6a,
+    0xd3, 0x9a, 0x2b, 0xef, 0x8d, 0xad, 0x1d, 0x5c, 0x0a, 0x82, 0xaa, 0xa3, 0xd0, 0xb7, 0x2f, 0x55,
+    0x91, 0x81, 0x8a, 0xa9, 0x45, 0xd1, 0xe4, 0xbd, 0x23, 0xf8, 0x32, 0xcf, 0x16, 0x74, 0xc7, 0xdb,
+    0x0b, 0x74, 0xc4, 0x05, 0x2c, 0x1f, 0xcd, 0xbf, 0x5b, 0xc7, 0x9d, 0x30, 0x49, 0x48, 0x23, 0x28,
+    0x26, 0xc1, 0x99, 0x60, 0x9b, 0xaf, 0x45, 0xb8, 0xc4, 0x99, 0xcd, 0xca, 0xf4, 0xcb, 0x94, 0x2f,
+    0x67, 0x7e, 0xb0, 0xf8, 0xe8, 0x92, 0x41, 0x16, 0x1f, 0x53, 0x99, 0xec, 0x2d, 0x32, 0xcc, 0x5b,
+    0xb1, 0x15, 0xd2, 0x64, 0x14, 0xc7, 0x88, 0x76, 0x84, 0xd5, 0x0a, 0x07, 0xdb, 0xc6, 0xe1, 0x83,
+    0x5e, 0xae, 0x73, 0x29, 0xcf, 0x16, 0xcf, 0x7e, 0xff, 0x3e, 0x75, 0xd8, 0xc0, 0xce, 0x52, 0x11,
+    0x78, 0x7d, 0xed, 0x6d, 0x6e, 0x22, 0x18, 0xf0, 0x71, 0xf0, 0x48, 0xb1, 0x77, 0x41, 0x41, 0x1a,
+    0x1d, 0x61, 0xfb, 0xfc, 0xce, 0xf6, 0x9c, 0x86, 0x7b, 0xa8, 0x0c, 0x53, 0x16, 0xe1, 0x6c, 0x87,
+    0x09, 0xc1, 0x9e, 0x00, 0x81, 0x0f, 0x4d, 0xee, 0x6c, 0x3d, 0x2a, 0x0d, 0x83, 0x64, 0xe0, 0x05,
+    0x3d, 0xf1, 0x58, 0x53, 0x46, 0x7e, 0x45, 0xc5, 0x43, 0x76, 0xb3, 0x7e, 0x11, 0xab, 0x1e, 0x23,
+    0xa0, 0xf4, 0xae, 0x44, 0x61, 0xd8, 0xd0, 0xa8, 0x29, 0x73, 0x28, 0x82, 0x24, 0x70, 0x0f, 0x2f,
+    0xf0, 0x68, 0x62, 0x46, 0x73, 0x69, 0x16, 0xe8, 0x9d, 0x3b, 0x2b, 0x8e, 0x87, 0x8c, 0x61, 0x2f,
+    0xb5, 0x74, 0xb7, 0x0c, 0x35, 0xa6, 0x4f, 0xc8, 0x77, 0xa3, 0x60, 0x4a, 0x00, 0xed, 0xbc, 0x1a,
+    0xdb, 0x04, 0xb6, 0x74, 0x0b, 0xf5, 0x59, 0x82, 0x07, 0xd0, 0x05, 0x80, 0xae, 0x3e, 0xa5, 0x6f,
+    0x05, 0x04, 0x0f, 0x56, 0xdc, 0x1f, 0x93, 0xd0, 0xd2, 0xb9, 0x79, 0x21, 0x91, 0x57, 0x56, 0xb6,
+    0x21, 0x6f, 0x56, 0xa8, 0xad, 0x32, 0xfb, 0x7d, 0xd5, 0xe7, 0xe4, 0xb5, 0x1c, 0xda, 0x7f, 0x3d,
+    0x4d, 0x58, 0x3a, 0x93, 0xc8, 0x85, 0x07, 0x5d, 0x13, 0x25, 0x7b, 0x19, 0x60, 0x1b, 0x3d, 0x04,
+    0x42, 0x58, 0x2a, 0x86, 0x47, 0xa6, 0x0b, 0x59, 0xa2, 0x37, 0x5d, 0xcb, 0x4d, 0xbd, 0x7f, 0x16,
+    0x3d, 0x95, 0x2d, 0x6c, 0xdb, 0x2b, 0x8c, 0xc2, 0x8c, 0x77, 0xb5, 0xbe, 0xcb, 0xf3, 0x2c, 0x3f,
+    0xc3, 0x87, 0x5c, 0x44, 0xe0, 0x6e, 0x61, 0x0a, 0x7f, 0x88, 0x28, 0x50, 0x5c, 0x81, 0xee, 0x55,
+    0x9b, 0xfc, 0x36, 0x30, 0x72, 0xc7, 0x80, 0xb4, 0xda, 0xc4, 0xec, 0x20, 0x33, 0xab, 0xd6, 0xf6,
+    0xc2, 0x89, 0x4c, 0x6b, 0x5f, 0xe1, 0xa9, 0x3a, 0x05, 0x09, 0xc4, 0x63, 0xbf, 0x2d, 0xd4, 0xf2,
+    0x30, 0x88, 0xeb, 0x0c, 0xda, 0xcf, 0xd2, 0x4d, 0x5c, 0xb4, 0xb7, 0x80, 0xda, 0x3a, 0xba, 0x79,
+    0xb0, 0x90, 0x9e, 0x31, 0xc4, 0x3b, 0x7d, 0xb8, 0x6c, 0x1a, 0xbf, 0xf0, 0xa5, 0x85, 0x13, 0xa3,
+    0x6d, 0x9c, 0x2e, 0x64, 0xb3, 0x0b, 0x48, 0x71, 0x32, 0x12, 0x25, 0xe5, 0x89, 0x1a, 0x14, 0x15,
+    0xc8, 0xb7, 0x9b, 0xc6, 0x94, 0x39, 0xc7, 0xde, 0x89, 0xbc, 0xa7, 0x4b, 0x20, 0xf7, 0x78, 0xe3,
+    0xda, 0xd7, 0x1d, 0x87, 0xeb, 0xf2, 0x44, 0x43, 0x51, 0xb7, 0xd1, 0xae, 0x71, 0xee, 0x8c, 0x74,
+    0x9e, 0xa1, 0x9e, 0x19, 0x67, 0xeb, 0xe7, 0x4e, 0x8c, 0xac, 0x20, 0xd3, 0xdb, 0x37, 0x78, 0x3d,
+    0x34, 0xe4, 0x9c, 0x22, 0x7a, 0xde, 0x97, 0x35, 0x98, 0xf9, 0xf3, 0x28, 0xeb, 0x36, 0xe5, 0x2c,
+    0xab, 0xff, 0xc0, 0x20, 0x21, 0xa7, 0x80, 0xad, 0xb0, 0x6d, 0x3c, 0x85, 0x20, 0x18, 0xd2, 0x20,
+    0xdc, 0xbc, 0xf1, 0x0c, 0x4e, 0x77, 0x67, 0x70, 0xdf, 0x3d, 0x45, 0x7d, 0x1c, 0x0c, 0x18, 0xd2,
+    0xa8, 0x33, 0x4a, 0x4c, 0x7e, 0xbb, 0x67, 0xfd, 0x88, 0x5d, 0xf7, 0xb5, 0x3e, 0xfa, 0x0a, 0x78,
+    0xb4, 0x4b, 0xed, 0x73, 0x1e, 0x0c, 0xde, 0x3c, 0xef, 0xef, 0x83, 0x9b, 0xea, 0x13, 0x6b, 0x1e,
+    0x0b, 0x74, 0x16, 0x84, 0xfe, 0x39, 0x0c, 0x3b, 0x6f, 0x6d, 0x91, 0x5f, 0xa8, 0x35, 0x9c, 0x78,
+    0x9a, 0xc1, 0x33, 0x15, 0x60, 0xc2, 0xf8, 0x03, 0x43, 0x7b, 0xd4, 0x34, 0x41, 0x8b, 0x68, 0x0d,
+    0x0a, 0x04, 0x92, 0x2f, 0x9d, 0x2c, 0x9a, 0xc0, 0x81, 0x00, 0xef, 0xde, 0x67, 0x85, 0xc3, 0x97,
+    0x58, 0x20, 0x62, 0xaa, 0x77, 0xae, 0xea, 0x61, 0x9f, 0xf1, 0x3b, 0x50, 0x9a, 0x69, 0x44, 0xbc,
+    0xd2, 0xee, 0x64, 0x72, 0x57, 0xaf, 0x45, 0xf2, 0xc5, 0x53, 0x14, 0x73, 0x55, 0x02, 0x70, 0x09,
+    0x2c, 0xe2, 0x5a, 0x75, 0xca, 0x97, 0x6f, 0x73, 0x96, 0x86, 0xcb, 0x40, 0x9c, 0x4c, 0x83, 0x60,
+    0x95, 0x56, 0x87, 0x64, 0xf3, 0x90, 0x0f, 0xc8, 0x28, 0x61, 0x82, 0x05, 0x91, 0x64, 0x66, 0x82,
+    0x42, 0xfb, 0x04, 0xd0, 0xdc, 0x6c, 0xaf, 0x03, 0x0f, 0x8c, 0x34, 0x34, 0x92, 0x05, 0x1e, 0xfb,
+    0x38, 0xb8, 0xaa, 0xd4, 0x29, 0x86, 0xb7, 0x68, 0xca, 0xa8, 0xd2, 0x7f, 0x95, 0xcf, 0xd0, 0x55,
+    0x15, 0x99, 0xf7, 0xe1, 0xde, 0xe8, 0xd6, 0x3b, 0x94, 0xf4, 0xf1, 0x84, 0xe8, 0xaf, 0xc5, 0x7e,
+    0x2b, 0x5d, 0xbf, 0x0b, 0x8c, 0xd0, 0x46, 0x7b, 0xea, 0x2a, 0x88, 0xaa, 0xaf, 0x47, 0x9f, 0x6c,
+    0x7c, 0x73, 0x09, 0x47, 0x66, 0xaf, 0x62, 0x9f, 0xbb, 0xda, 0xf4, 0x4a, 0x2e, 0x57, 0x20, 0x01,
+    0xff, 0x9d, 0x9e, 0x55, 0x01, 0xf0, 0x9d, 0x80, 0x72, 0x6b, 0xb4, 0x05, 0x31, 0xf7, 0x52, 0xdb,
+    0xc8, 0x73, 0x08, 0xe0, 0x26, 0x18, 0x48, 0x38, 0x34, 0x87, 0xe7, 0xbe, 0xa9, 0xdc, 0x6a, 0xe8,
+    0x8e, 0x7c, 0x05, 0xb1, 0xed, 0x5e, 0xc9, 0xa4, 0x2b, 0x5f, 0x9d, 0xf5, 0x26, 0x1e, 0xa1, 0x65,
+    0x12, 0xa0, 0xb0, 0x16, 0xc0, 0xe3, 0x11, 0x4e, 0xde, 0x72, 0xcf, 0x19, 0xb0, 0xd3, 0xb6, 0x4e,
+    0x88, 0xd8, 0xd5, 0x88, 0x49, 0x33, 0x00, 0xce, 0xa0, 0xb3, 0x21, 0x3c, 0x41, 0x50, 0x93, 0x65,
+    0x9f, 0x20, 0x75, 0x1d, 0x0d, 0x89, 0xaf, 0x23, 0x39, 0x36, 0x10, 0xf9, 0xc4, 0x4e, 0x67, 0x26,
+    0x00, 0xd2, 0x2a, 0x82, 0x03, 0x00, 0xb0, 0x09, 0x34, 0xa1, 0x3b, 0xbf, 0xa0, 0x5e, 0xab, 0xfa,
+    0xa0, 0x41, 0xe6, 0x87, 0xc6, 0xe8, 0x60, 0xbb, 0x25, 0xb4, 0x16, 0xe1, 0x66, 0xca, 0xec, 0x46,
+    0x88, 0x1f, 0x4b, 0x70, 0xd1, 0x85, 0x17, 0xb4, 0xe6, 0x15, 0x2d, 0x50, 0x8d, 0xc8, 0x2a, 0xf0,
+    0x54, 0x4d, 0xe0, 0x65, 0x95, 0xa1, 0x97, 0x7b, 0x06, 0x4e, 0xe5, 0x76, 0x31, 0x67, 0xd0, 0xeb,
+    0x11, 0x84, 0xe4, 0x19, 0xaf, 0x82, 0x88, 0x85, 0xb3, 0x37, 0x9d, 0xbd, 0xf1, 0x21, 0xa7, 0x59,
+    0x5b, 0xe0, 0x60, 0xa5, 0x5f, 0x1d, 0x98, 0x71, 0x0d, 0x64, 0xab, 0xd8, 0x53, 0x8b, 0xa9, 0x48,
+    0x79, 0x6a, 0x6f, 0x5b, 0x37, 0xad, 0xc1, 0x31, 0x7b, 0x30, 0xbd, 0x30, 0x41, 0xe9, 0x68, 0xb7,
+    0x29, 0xba, 0xbe, 0x22, 0x4c, 0xa3, 0xe7, 0x08, 0xe6, 0xe1, 0xb1, 0xd7, 0x86, 0xcc, 0x99, 0xd2,
+    0x76, 0x14, 0x60, 0x15, 0x55, 0xf3, 0x10, 0xfc, 0xa9, 0xe4, 0x01, 0x11, 0xcc, 0xb9, 0xf2, 0xf0,
+    0xe6, 0x6a, 0x17, 0x26, 0x2d, 0x13, 0x63, 0xfe, 0xea, 0xe6, 0x17, 0x4d, 0x11, 0xe8, 0x20, 0x01,
+    0x50, 0xb9, 0xeb, 0x16, 0xca, 0x6d, 0x48, 0x9c, 0x7d, 0x95, 0x6b, 0xbe, 0x39, 0x58, 0xa8, 0x2b,
+    0xd8, 0x22, 0x98, 0x42, 0xeb, 0x8e, 0xa2, 0xa1, 0x8c, 0xd8, 0x43, 0x9b, 0xe2, 0xbe, 0x74, 0x3c,
+    0xba, 0xb1, 0xeb, 0x31, 0x22, 0xf3, 0x6c, 0x12, 0x59, 0xe1, 0xb8, 0x36, 0x02, 0x0f, 0x7f, 0x35,
+    0x99, 0x12, 0x47, 0x6e, 0xb9, 0xb0, 0xad, 0xf1, 0xa2, 0xf5, 0xe1, 0x64, 0xe7, 0x20, 0x34, 0x47,
+    0xb4, 0x78, 0x27, 0x82, 0x3d, 0x78, 0x50, 0xfc, 0x44, 0xfa, 0x65, 0x18, 0x3b, 0x3a, 0xf9, 0x36,
+    0xe6, 0x59, 0x48, 0x8f, 0x6b, 0xca, 0xc1, 0x36, 0xcd, 0x2b, 0x36, 0x26, 0xb4, 0x1f, 0xc3, 0xc1,
+    0x77, 0x87, 0x99, 0x0f, 0x07, 0xa2, 0x7a, 0x6a, 0x42, 0x3f, 0x11, 0xec, 0x93, 0x3d, 0x0f, 0x94,
+    0xae, 0x9f, 0x47, 0x60, 0x02, 0xcd, 0x72, 0x25, 0xc7, 0xb2, 0x14, 0x57, 0xe2, 0x10, 0xa6, 0x23,
+    0xcf, 0x9d, 0x5c, 0xce, 0x74, 0x74, 0xd7, 0x22, 0x63, 0x37, 0x90, 0x76, 0x59, 0xba, 0xd2, 0x6e,
+    0x5f, 0x45, 0x35, 0xda, 0x36, 0x99, 0x2b, 0xe7, 0x46, 0x51, 0x5a, 0xbf, 0x40, 0xa9, 0x47, 0x88,
+    0x01, 0xe6, 0x00, 0x85, 0x79, 0x40, 0xd3, 0xa5, 0x6c, 0x00, 0x4a, 0x5b, 0x66, 0x83, 0x20, 0xd1,
+    0xab, 0xc7, 0x82, 0xed, 0xc6, 0xea, 0x3d, 0xe1, 0x71, 0xb6, 0x6e, 0x40, 0x10, 0x00, 0x61, 0x17,
+    0xd8, 0xd4, 0x07, 0x8a, 0x3f, 0x96, 0x3b, 0xab, 0x90, 0x5c, 0x82, 0x23, 0xad, 0x40, 0x70, 0xa2,
+    0x2d, 0x91, 0xd9, 0x2b, 0x8e, 0xe5, 0xc3, 0xd5, 0xea, 0x4f, 0xb7, 0x7c, 0x17, 0xa3, 0xb7, 0xb3,
+    0xa5, 0x74, 0x52, 0x7a, 0xbb, 0xb3, 0x58, 0xa2, 0x56, 0x6a, 0x73, 0x8f, 0xfc, 0xe7, 0xb4, 0xbf,
+    0x5f, 0x70, 0x24, 0x1a, 0x57, 0x1b, 0xab, 0x87, 0xbf, 0xc1, 0x88, 0xc7, 0x84, 0x8b, 0xff, 0x79,
+    0xfc, 0xf2, 0x69, 0xf6, 0x57, 0xbc, 0x7a, 0x27, 0x33, 0xb0, 0x90, 0x4f, 0x94, 0x0f, 0xe6, 0xf4,
+    0x51, 0x3a, 0xea, 0x2c, 0xfd, 0xf0, 0xc8, 0x6a, 0x4a, 0x7d, 0x5d, 0xdf, 0x7b, 0xf0, 0x46, 0x54,
+    0xc7, 0xc5, 0x5d, 0x2c, 0xad, 0xa1, 0x40, 0x96, 0x60, 0xe8, 0x45, 0x79, 0xde, 0xb5, 0x50, 0x18,
+    0x26, 0x81, 0xb0, 0x4f, 0xd9, 0x76, 0xf3, 0x65, 0x4b, 0xd6, 0xb0, 0x4e, 0x53, 0xd3, 0xa4, 0xac,
+    0xb9, 0xa6, 0xa6, 0xb5, 0xe3, 0xde, 0xc1, 0x55, 0x0f, 0x9c, 0x51, 0xe2, 0x43, 0x92, 0xc9, 0x1c,
+    0x15, 0x00, 0x63, 0x53, 0xb3, 0x25, 0xdd, 0xcb, 0xfb, 0xe6, 0x28, 0x9c, 0xe3, 0x5c, 0x4f, 0x7b,
+    0x7f, 0xcb, 0xab, 0x8c, 0xb4, 0xbd, 0x9d, 0x5b, 0xb2, 0x55, 0xa7, 0x9c, 0x15, 0xc2, 0x7d, 0x5b,
+    0x1b, 0x29, 0x4f, 0xa0, 0x19, 0x1f, 0x5d, 0xee, 0xeb, 0x5f, 0x55, 0x77, 0x27, 0xeb, 0x4f, 0x7c,
+    0xbf, 0xcf, 0x2c, 0xdb, 0x38, 0xba, 0xce, 0x1e, 0xb8, 0x81, 0x26, 0x8f, 0xed, 0xdc, 0x96, 0xc7,
+    0x63, 0x16, 0x71, 0xa2, 0x22, 0x75, 0xb8, 0x41, 0xa8, 0x5f, 0xa9, 0x2d, 0x8e, 0x69, 0x6e, 0xbb,
+    0xbc, 0xfc, 0x36, 0xbb, 0xd2, 0x2f, 0x34, 0x09, 0x5d, 0x83, 0x0f, 0xf8, 0x8a, 0x5f, 0xb1, 0x1d,
+    0x75, 0x83, 0x93, 0x7d, 0x2c, 0xb0, 0x87, 0x3a, 0xff, 0xa3, 0x23, 0xab, 0xcf, 0x0a, 0x6e, 0x6b,
+    0xb0, 0x5d, 0x10, 0x52, 0xae, 0x8d, 0x95, 0x58, 0xe9, 0x9d, 0x65, 0xd5, 0xb1, 0x69, 0xf1, 0xb5,
+    0x5a, 0xdf, 0x9b, 0x00, 0x89, 0x37, 0x3e, 0x80, 0x3f, 0x62, 0x04, 0xa6, 0xa2, 0xd0, 0xd0, 0xe0,
+    0x7c, 0xd8, 0xbf, 0x53, 0x18, 0x60, 0x9b, 0xa0, 0xb1, 0x23, 0x0b, 0xf4, 0x03, 0x96, 0xe1, 0xab,
+    0x53, 0x15, 0x2b, 0x58, 0x45, 0x26, 0x0b, 0xd9, 0xe1, 0x40, 0xe5, 0x60, 0x1f, 0x44, 0x89, 0x9b,
+    0xe2, 0xd0, 0xa9, 0x78, 0x01, 0x3e, 0x55, 0xc0, 0x64, 0xc9, 0x74, 0x84, 0x15, 0x66, 0x26, 0x5b,
+    0x17, 0x85, 0xd5, 0x51, 0x85, 0xd5, 0x53, 0x19, 0xd7, 0xea, 0x58, 0xa7, 0x9f, 0xcc, 0x09, 0xad,
+    0x80, 0x74, 0x61, 0x1a, 0x5a, 0xbc, 0x02, 0x68, 0xae, 0x43, 0xf5, 0x91, 0x7e, 0xce, 0xfa, 0xb0,
+    0xb6, 0xdb, 0xdd, 0xe6, 0xe9, 0xd3, 0x3e, 0xa4, 0x8f, 0xa7, 0x93, 0x07, 0x1f, 0x3a, 0x34, 0x1c,
+    0x5f, 0xee, 0xec, 0x31, 0x22, 0xb1, 0x21, 0x85, 0xfd, 0x93, 0xd2, 0xb1, 0x1e, 0xa6, 0xbf, 0x03,
+    0x3d, 0x28, 0xb9, 0x80, 0x6e, 0x59, 0x1a, 0xa6, 0x2f, 0xbb, 0x89, 0xe1, 0x12, 0x19, 0x0a, 0xe6,
+    0xec, 0xbe, 0xce, 0xcc, 0xa0, 0x7c, 0x74, 0x93, 0xfa, 0xe5, 0xfe, 0xdc, 0x61, 0xbd, 0x9b, 0x42,
+    0x0b, 0xb6, 0x9c, 0x6c, 0xa9, 0x45, 0x6f, 0x36, 0x96, 0x1e, 0xb6, 0xc2, 0xfc, 0x08, 0x26, 0x56,
+    0xcf, 0x4a, 0x23, 0x7a, 0xce, 0x17, 0xb6, 0xe4, 0xfd, 0x36, 0x39, 0x24, 0x18, 0xb6, 0x5e, 0xdb,
+    0x82, 0x7c, 0x88, 0x30, 0xf2, 0x71, 0x79, 0xce, 0x87, 0x2f, 0xdb, 0x51, 0x36, 0x39, 0xcf, 0xf1,
+    0xb6, 0x0a, 0xae, 0xfb, 0xe5, 0x2c, 0x32, 0x02, 0xe2, 0xfe, 0xcc, 0x69, 0x5a, 0xe5, 0x51, 0x9a,
+    0x90, 0xfa, 0xf9, 0xc9, 0xcf, 0x9e, 0xce, 0xbc, 0xd4, 0xc9, 0x19, 0xb5, 0x5f, 0xf7, 0x22, 0x66,
+    0xbe, 0x41, 0x0b, 0x0e, 0x3c, 0x95, 0x29, 0x52, 0x77, 0xbe, 0x00, 0xb3, 0xc5, 0xc9, 0xce, 0x59,
+    0x73, 0x2c, 0x27, 0x0d, 0xb2, 0x2c, 0xfb, 0xae, 0x0c, 0xf9, 0x94, 0x62, 0xdb, 0xcf, 0x24, 0x7f,
+    0x17, 0xb3, 0xa7, 0x79, 0x27, 0xa5, 0xb7, 0xed, 0x7d, 0xeb, 0x53, 0x59, 0x76, 0x7d, 0xc8, 0xa9,
+    0x01, 0xa1, 0xd4, 0x96, 0x1d, 0x09, 0xe8, 0xf4, 0x8e, 0xca, 0xd7, 0x6c, 0xf3, 0x5b, 0xd0, 0x60,
+    0x66, 0xef, 0x5c, 0x33, 0xfb, 0x79, 0xdb, 0x3b, 0x9b, 0x2c, 0xb5, 0xb1, 0x71, 0x9d, 0x60, 0x44,
+    0x94, 0xb4, 0x89, 0x8e, 0x29, 0xb1, 0x46, 0xfb, 0xc1, 0x32, 0x9e, 0x4b, 0x30, 0x95, 0xdc, 0x7c,
+    0xcc, 0x11, 0x62, 0xb6, 0xf1, 0x56, 0x98, 0x18, 0x8d, 0x8f, 0x12, 0x8e, 0x5a, 0xea, 0xd8, 0x92,
+    0x89, 0x24, 0x7b, 0x83, 0x3d, 0xb0, 0x04, 0x95, 0x27, 0xcc, 0x34, 0x6d, 0x5d, 0xbd, 0xa1, 0x4c,
+    0x35, 0x99, 0x12, 0x52, 0x8e, 0x6a, 0x41, 0x18, 0x0d, 0xb4, 0x1a, 0x30, 0x05, 0xc0, 0xd6, 0x7e,
+    0x98, 0x22, 0xd9, 0x3d, 0xfb, 0xf5, 0x9d, 0x1e, 0x1e, 0x93, 0xb9, 0xe3, 0xaa, 0x37, 0x85, 0x2e,
+    0xf9, 0x2a, 0x7a, 0xe2, 0x33, 0x73, 0x2a, 0x7a, 0xa4, 0xda, 0x2d, 0x1c, 0xd2, 0xe2, 0x9d, 0x2d,
+    0xe9, 0xce, 0xdb, 0x76, 0xc8, 0xc4, 0x18, 0x25, 0x8f, 0x13, 0x3c, 0xd7, 0xab, 0x8b, 0x6a, 0xf7,
+    0x09, 0x6b, 0xc7, 0x6c, 0x28, 0x06, 0x65, 0x82, 0x6d, 0x07, 0xf4, 0x7b, 0xa9, 0xbd, 0xf7, 0xca,
+    0xfc, 0x88, 0xa1, 0x6d, 0xd6, 0xac, 0xef, 0x0f, 0x12, 0x33, 0xeb, 0x9b, 0x17, 0xda, 0xa9, 0x29,
+    0x8d, 0x02, 0x05, 0xb0, 0x8b, 0x7c, 0xce, 0x1a, 0xb8, 0xf7, 0xd6, 0x1e, 0x66, 0x1d, 0x5e, 0x44,
+    0xa9, 0xab, 0x46, 0x55, 0x30, 0x2f, 0xef, 0xee, 0x22, 0x10, 0x82, 0x23, 0xb7, 0x25, 0x0f, 0xb7,
+    0x87, 0x0d, 0x62, 0xa4, 0xc8, 0x1b, 0x83, 0xfc, 0xca, 0x3c, 0xad, 0x36, 0xbc, 0xf9, 0xaa, 0x05,
+    0xab, 0x47, 0x09, 0x4b, 0xdf, 0xd5, 0x42, 0xf8, 0x92, 0x2a, 0x15, 0xad, 0x4d, 0x26, 0xb7, 0x1f,
+    0x54, 0x1b, 0xdf, 0xbe, 0x83, 0x80, 0x83, 0x35, 0xd0, 0xf9, 0x1d, 0xd8, 0xb1, 0x51, 0x57, 0xf6,
+    0x2c, 0xb3, 0xf6, 0x71, 0x49, 0xce, 0x09, 0xf9, 0x2c, 0x0e, 0x6a, 0xdc, 0x7e, 0x5d, 0x2a, 0x92,
+    0x59, 0x8b, 0x01, 0x84, 0x30, 0x76, 0xb2, 0xef, 0x2e, 0x29, 0xc9, 0xe6, 0xc1, 0x8d, 0x74, 0x3f,
+    0x21, 0x8a, 0xe1, 0x00, 0x91, 0xe7, 0xb4, 0x99, 0x8a, 0x66, 0xf7, 0x0b, 0x8d, 0x11, 0xce, 0x6d,
+    0x64, 0xca, 0xb4, 0x23, 0x2e, 0xd9, 0x16, 0x39, 0x7c, 0x30, 0x99, 0xd6, 0x23, 0x00, 0xbc, 0xac,
+    0x13, 0x2a, 0x6a, 0xa8, 0x36, 0x5b, 0xfb, 0xf0, 0xbe, 0x6f, 0x68, 0xbd, 0xb3, 0xd7, 0xee, 0x8a,
+    0x6a, 0x44, 0x83, 0x3b, 0x79, 0xc5, 0x00, 0x9a, 0x3f, 0xa5, 0x56, 0x08, 0x1e, 0xde, 0xc0, 0x7f,
+    0x7c, 0x1f, 0xa0, 0x3f, 0x36, 0xcd, 0x4b, 0x92, 0xfe, 0x2d, 0xf9, 0xa2, 0xdf, 0x22, 0x4c, 0x9c,
+    0x03, 0x42, 0xb0, 0xf0, 0x81, 0xfe, 0x3c, 0xf6, 0xb0, 0x39, 0x74, 0xda, 0x0d, 0xc6, 0xa9, 0xcf,
+    0x2a, 0x53, 0x52, 0x52, 0xb6, 0x48, 0xe2, 0x32, 0xdc, 0x5a, 0xf7, 0x83, 0x86, 0xf7, 0xfe, 0x72,
+    0xab, 0x45, 0x0c, 0x89, 0x68, 0xe9, 0x32, 0xde, 0xb8, 0xd9, 0xf7, 0x93, 0xcc, 0x1f, 0x91, 0xf4,
+    0x42, 0x03, 0x49, 0xdb, 0xaf, 0xc8, 0x48, 0xa9, 0x16, 0x06, 0x17, 0x16, 0xa9, 0x35, 0x53, 0x58,
+    0x4a, 0xec, 0xd8, 0xed, 0x09, 0x01, 0x79, 0x2b, 0x5c, 0xd8, 0xd2, 0xcc, 0xf9, 0x75, 0x01, 0x8e,
+    0xcf, 0x1e, 0x89, 0x89, 0x63, 0x07, 0x60, 0x7e, 0xae, 0x80, 0xeb, 0x5e, 0x30, 0xf4, 0x8d, 0x45,
+    0x5a, 0x4e, 0xc6, 0x78, 0x37, 0xe8, 0x3c, 0x6c, 0xde, 0xfd, 0x43, 0x3d, 0xa6, 0xc4, 0x00, 0x69,
+    0xa8, 0xd0, 0xe1, 0x67, 0x8d, 0xbc, 0x1f, 0x43, 0x10, 0xa9, 0x79, 0x66, 0xf2, 0x7e, 0x93, 0x96,
+    0x0d, 0x89, 0x77, 0xf8, 0x81, 0x49, 0xa1, 0x96, 0xd3, 0xdd, 0xb6, 0xe5, 0x03, 0x54, 0xdc, 0x37,
+    0x56, 0x1b, 0x20, 0xe7, 0x25, 0x1d, 0xef, 0xd1, 0xc2, 0xcd, 0xbe, 0x8c, 0x87, 0xf5, 0xa7, 0xdf,
+    0x79, 0x5e, 0x4d, 0xa4, 0xb2, 0x5f, 0x0e, 0x16, 0x10, 0x47, 0xc4, 0xcc, 0x2d, 0x1d, 0xca, 0x5c,
+    0xa3, 0xbe, 0x4f, 0xe6, 0xe5, 0x30, 0xc0, 0x1b, 0xe6, 0xf4, 0x52, 0x26, 0x3e, 0x06, 0xb6, 0x84,
+    0x16, 0x65, 0x79, 0x98, 0xc9, 0xe8, 0x48, 0x19, 0xd5, 0x9b, 0xb4, 0x1d, 0x12, 0xf1, 0x96, 0xeb,
+    0x1b, 0x34, 0x42, 0x0e, 0xfd, 0x46, 0x36, 0xab, 0x90, 0xd2, 0xb4, 0xb1, 0x61, 0x67, 0x59, 0x6a,
+    0xeb, 0x85, 0x1d, 0xe6, 0x0d, 0xb1, 0x99, 0x29, 0x0a, 0x03, 0x1a, 0x45, 0xf3, 0xfe, 0x8a, 0x6c,
+    0x2e, 0x9b, 0xfc, 0x34, 0xe0, 0x47, 0xb3, 0x0e, 0xd9, 0xd1, 0x37, 0xa5, 0xe5, 0x0f, 0xf8, 0x97,
+    0x12, 0x6f, 0x26, 0x4f, 0x19, 0x85, 0x7d, 0x8b, 0x82, 0xc2, 0x91, 0x59, 0xfe, 0x8d, 0x5c, 0x06,
+    0x46, 0xdf, 0x20, 0xb5, 0x40, 0x96, 0x1d, 0xd3, 0x3c, 0x6b, 0xb3, 0xba, 0x8a, 0xfb, 0x83, 0xe8,
+    0xd2, 0xc7, 0xa9, 0xba, 0xa0, 0x95, 0x5d, 0x6e, 0x00, 0xc4, 0x6c, 0x1c, 0xf5, 0x0d, 0xdc, 0x24,
+    0xaf, 0x51, 0x44, 0x9c, 0x98, 0x70, 0xb4, 0x77, 0x2e, 0x27, 0x72, 0xc2, 0xd0, 0x62, 0x1a, 0x9d,
+    0xf7, 0x1b, 0x08, 0x32, 0x49, 0xaa, 0x95, 0x72, 0xff, 0xf4, 0x1c, 0xf6, 0xf2, 0xab, 0x9c, 0x09,
+    0x86, 0x08, 0xb6, 0xfc, 0xc2, 0xec, 0x25, 0x59, 0x8e, 0x41, 0xd4, 0x0c, 0x8f, 0x06, 0x3d, 0x8f,
+    0xf1, 0x1a, 0xae, 0xe8, 0x1b, 0xf1, 0x97, 0x3f, 0x53, 0x38, 0x6f, 0x7c, 0x57, 0x5f, 0x2b, 0x9a,
+    0x57, 0x47, 0x44, 0xdf, 0x9c, 0x2a, 0xf1, 0x51, 0x87, 0x74, 0xfa, 0x16, 0x77, 0x89, 0x1b, 0x21,
+    0x7a, 0x41, 0x04, 0x39, 0xed, 0x3e, 0xc6, 0x43, 0x7e, 0xcb, 0x59, 0xfe, 0x3e, 0xf2, 0xf3, 0x91,
+    0xc9, 0x1d, 0x2f, 0x32, 0x10, 0x1a, 0x4e, 0x6d, 0xdf, 0x44, 0x89, 0x28, 0x5f, 0xfc, 0xa9, 0x33,
+    0xcd, 0xc4, 0xbb, 0xf2, 0xd6, 0xa8, 0x6d, 0x81, 0x42, 0xe3, 0x08, 0x11, 0x76, 0xa5, 0x4c, 0xef,
+    0xeb, 0x12, 0x6f, 0xdd, 0x88, 0x3f, 0x41, 0x7a, 0x75, 0x2d, 0x5d, 0x03, 0xa1, 0xc1, 0x2d, 0x73,
+    0x8d, 0xe5, 0x7b, 0xd6, 0x08, 0x30, 0xe3, 0x73, 0xf0, 0x4e, 0x7b, 0xdb, 0xa0, 0xac, 0xf2, 0xdb,
+    0xc1, 0x28, 0xdb, 0xcc, 0xa6, 0x5e, 0x07, 0x25, 0x27, 0x7c, 0xbf, 0xbd, 0x46, 0x36, 0x8e, 0x68,
+    0x1e, 0x6e, 0x32, 0x2f, 0x85, 0x32, 0xe6, 0x0f, 0x5d, 0x6b, 0xcf, 0x4b, 0x33, 0x5d, 0x62, 0xb2,
+    0x1b, 0xf2, 0x36, 0xca, 0x1b, 0xd8, 0x80, 0x2f, 0x2c, 0xb3, 0xb1, 0xc6, 0x32, 0x85, 0x39, 0x2c,
+    0x49, 0xe8, 0x04, 0xa9, 0xf0, 0xea, 0xee, 0x48, 0x43, 0x5d, 0x05, 0x1b, 0x45, 0x2d, 0x6a, 0xaa,
+    0x1a, 0x40, 0x3e, 0x87, 0x33, 0x2e, 0x0f, 0x5b, 0x7a, 0x04, 0x97, 0xe8, 0x40, 0x4a, 0x94, 0xbe,
+    0x92, 0x95, 0x9f, 0x8c, 0x23, 0x56, 0x05, 0x96, 0x9c, 0xc5, 0x39, 0x59, 0x1b, 0x9d, 0x40, 0xbd,
+    0xe3, 0xb9, 0xe7, 0x60, 0xcb, 0x42, 0x93, 0x51, 0x27, 0xc5, 0xab, 0xe6, 0x87, 0x8b, 0x20, 0xba,
+    0xb0, 0xda, 0x2b, 0x86, 0xd9, 0x03, 0xc6, 0x06, 0x4d, 0x3e, 0x35, 0x9d, 0x12, 0xca, 0x8f, 0x98,
+    0x47, 0x01, 0x31, 0x36, 0x4f, 0x66, 0x48, 0x87, 0x82, 0x7d, 0x44, 0xc8, 0xe2, 0xe3, 0x3b, 0x5f,
+    0xda, 0x57, 0x26, 0x7e, 0x35, 0x89, 0x1e, 0xf7, 0xde, 0xf1, 0x3a, 0xce, 0xa3, 0x69, 0xec, 0x7b,
+    0x22, 0x28, 0x78, 0x87, 0x01, 0x27, 0x84, 0x1c, 0xed, 0x7f, 0x29, 0x75, 0xe5, 0x45, 0x99, 0xcc,
+    0x0c, 0x06, 0x20, 0x76, 0xda, 0x2a, 0xe0, 0x82, 0x03, 0xdc, 0x9b, 0xb3, 0xb2, 0xdc, 0x8d, 0x71,
+    0x88, 0x33, 0x67, 0xe7, 0x5d, 0xec, 0xc3, 0xa3, 0x80, 0x74, 0x45, 0xa5, 0x05, 0x9a, 0x6b, 0xae,
+    0xcd, 0x04, 0x4b, 0x39, 0x35, 0x8e, 0xaf, 0x21, 0x67, 0x96, 0x74, 0xa6, 0xeb, 0x46, 0x84, 0x65,
+    0x10, 0x82, 0xdf, 0xd7, 0x0c, 0x04, 0x6c, 0x7a, 0x60, 0x28, 0xd9, 0x2e, 0xfd, 0xbc, 0xbe, 0x9b,
+    0x17, 0x2c, 0x34, 0x88, 0xe6, 0x8f, 0xa7, 0xb3, 0x8a, 0x96, 0x45, 0xa7, 0xf7, 0x4e, 0x60, 0xae,
+    0x70, 0x51, 0xd9, 0xa4, 0x43, 0x06, 0xb9, 0x5e, 0x52, 0x06, 0xf2, 0x9e, 0x16, 0xa6, 0x6e, 0xd1,
+    0x7c, 0x96, 0xb9, 0x1d, 0xf9, 0x4b, 0xb1, 0xf7, 0xd1, 0x1e, 0xe9, 0xd5, 0xa7, 0x03, 0x03, 0xcd,
+    0xf5, 0x07, 0x77, 0xd6, 0xaa, 0xcd, 0x84, 0x13, 0x0e, 0x97, 0x93, 0x0d, 0x51, 0xae, 0x11, 0x14,
+    0x71, 0xcf, 0xb4, 0xbd, 0xb9, 0x7f, 0xf2, 0xc2, 0xb9, 0x78, 0x54, 0x93, 0x0d, 0xf4, 0xfe, 0xd6,
+    0x8e, 0xc1, 0x6c, 0x40, 0xb3, 0xf4, 0xf0, 0xec, 0x2c, 0xae, 0x26, 0x19, 0x02, 0xc7, 0x20, 0xf7,
+    0xf1, 0x79, 0xdd, 0xcd, 0xd4, 0xb2, 0x5e, 0x81, 0x70, 0x1c, 0x66, 0x8d, 0xf7, 0xc9, 0xde, 0x6d,
+    0x3b, 0xda, 0x69, 0x76, 0xca, 0x3b, 0x42, 0xd1, 0xdc, 0x12, 0x76, 0x5b, 0x20, 0xf8, 0x66, 0x26,
+    0x53, 0x5e, 0xa1, 0x3d, 0xe7, 0x71, 0x63, 0x61, 0xc2, 0x96, 0x13, 0xcc, 0x76, 0x3a, 0xe3, 0x2f,
+    0x11, 0x26, 0x18, 0x1d, 0x87, 0x9e, 0xbe, 0x13, 0x32, 0xcd, 0x26, 0x2b, 0x80, 0xd0, 0x8b, 0x09,
+    0x7b, 0xee, 0xdc, 0xb2, 0x71, 0xd1, 0xb6, 0x44, 0xad, 0x44, 0x4b, 0xaf, 0x52, 0xab, 0x48, 0xf8,
+    0x3c, 0xfd, 0x28, 0x4c, 0x3f, 0xe8, 0x10, 0x3d, 0xb8, 0x4c, 0x78, 0x46, 0x85, 0xe1, 0xf8, 0x40,
+    0x2b, 0xf7, 0x95, 0x4a, 0x6e, 0x75, 0x3e, 0xf4, 0x2a, 0xc5, 0xb9, 0x0a, 0x27, 0x5e, 0xba, 0xf7,
+    0xb1, 0xb3, 0x5b, 0x81, 0xf2, 0xba, 0xa7, 0xd9, 0xd7, 0x4e, 0xdb, 0xf6, 0x3b, 0x3e, 0xf6, 0x39,
+    0x53, 0x65, 0xb1, 0x6c, 0x77, 0xc3, 0xd7, 0xa3, 0x84, 0xbb, 0x36, 0x72, 0x18, 0xf5, 0x96, 0xfc,
+    0x85, 0x79, 0xc5, 0xa7, 0xc7, 0x2a, 0x6b, 0xd9, 0x03, 0x43, 0x3c, 0x79, 0x0f, 0x73, 0x00, 0xf7,
+    0x62, 0x31, 0x3a, 0xee, 0xb5, 0xa8, 0xde, 0xfa, 0xf6, 0xc6, 0x0c, 0x08, 0x35, 0x6c, 0xad, 0x0c,
+    0xf3, 0x5d, 0x95, 0x78, 0xd9, 0x0a, 0x36, 0xba, 0x03, 0x4a, 0x7d, 0x04, 0xfc, 0x8b, 0xa6, 0x8f,
+    0x0e, 0xf4, 0x1f, 0x2d, 0xdb, 0x1c, 0x7c, 0x89, 0xab, 0x46, 0x2f, 0x10, 0xd6, 0xf9, 0xc2, 0x48,
+    0x8f, 0x20, 0xc0, 0x34, 0x0a, 0xa1, 0xf3, 0x4a, 0x4c, 0x13, 0x99, 0xf3, 0x4a, 0x0b, 0x70, 0x2c,
+    0x73, 0x69, 0xfd, 0x88, 0x23, 0x07, 0xc5, 0xab, 0x9c, 0xa8, 0x6a, 0xca, 0x8e, 0x75, 0x6e, 0x24,
+    0x78, 0xd6, 0x5b, 0xbd, 0x43, 0xb5, 0xeb, 0xe5, 0x49, 0x5a, 0x71, 0x6f, 0xbf, 0xb8, 0x3b, 0x42,
+    0x54, 0x3a, 0x68, 0x15, 0xfa, 0xb9, 0x87, 0x01, 0x00, 0xf3, 0xcd, 0xf0, 0x5f, 0xe6, 0xcd, 0x9d,
+    0x23, 0x66, 0x47, 0xe2, 0xed, 0xe9, 0xca, 0xbc, 0x09, 0xe2, 0x25, 0x51, 0x4f, 0xdd, 0x64, 0xb9,
+    0x9c, 0x5c, 0xc5, 0x47, 0x80, 0xf1, 0xe9, 0xa7, 0xc5, 0x91, 0xbc, 0xa6, 0xc5, 0x0a, 0x73, 0x06,
+    0xcb, 0x55, 0x0b, 0xbc, 0x8d, 0xe4, 0x3e, 0x3b, 0x1e, 0xba, 0xdd, 0x54, 0x3a, 0xbb, 0x41, 0x88,
+    0xf3, 0x56, 0x23, 0xee, 0xe0, 0x27, 0xff, 0x18, 0x5e, 0xd2, 0x69, 0xc8, 0x81, 0x23, 0x7c, 0x37,
+    0xb1, 0x28, 0x64, 0xbf, 0x4f, 0x72, 0xe8, 0x2b, 0x86, 0x12, 0x1a, 0x42, 0xc7, 0x69, 0x61, 0x20,
+    0x8e, 0xbd, 0x15, 0x21, 0xa0, 0x8b, 0x2f, 0x5a, 0x03, 0x54, 0xfa, 0xa9, 0xe8, 0x68, 0x2b, 0x8f,
+    0x6a, 0x7b, 0x13, 0x25, 0x08, 0xf6, 0x0b, 0x8e, 0xd5, 0x36, 0xe0, 0xbe, 0xe2, 0xe3, 0x43, 0xa7,
+    0x99, 0xb8, 0xf6, 0x93, 0x97, 0xbc, 0x79, 0x5b, 0x5d, 0x0b, 0xef, 0x26, 0x17, 0x5e, 0x8c, 0x8a,
+    0xda, 0x85, 0x73, 0x2e, 0x5e, 0x83, 0xa7, 0xbc, 0xbe, 0x65, 0x42, 0xf9, 0xde, 0x56, 0xc7, 0x2e,
+    0x64, 0xfa, 0x6c, 0xec, 0x35, 0x39, 0xef, 0xdd, 0x67, 0x36, 0x8a, 0xce, 0x0f, 0xd1, 0xdd, 0x2f,
+    0x9d, 0xcc, 0x13, 0x45, 0x1a, 0x03, 0xce, 0x60, 0xb3, 0x25, 0xac, 0xc6, 0x1a, 0xd0, 0x32, 0xa7,
+    0x83, 0xc3, 0x43, 0xd3, 0x81, 0xea, 0x36, 0xba, 0x2b, 0x5f, 0x74, 0xff, 0x4b, 0x47, 0x7e, 0x13,
+    0x8c, 0x21, 0xad, 0x29, 0x2d, 0x70, 0x63, 0xd1, 0x26, 0x1e, 0x86, 0x30, 0x76, 0xa9, 0xfd, 0xc8,
+    0x07, 0xc1, 0x78, 0x03, 0x69, 0xf6, 0x26, 0x27, 0x09, 0xf1, 0x41, 0xda, 0x94, 0xb8, 0x66, 0x4e,
+    0x82, 0xee, 0x03, 0x18, 0x60, 0x06, 0x51, 0xa5, 0xee, 0x5f, 0x10, 0x48, 0xf4, 0x5a, 0x76, 0x74,
+    0xb6, 0xda, 0xd2, 0x3b, 0xd7, 0x3e, 0xfc, 0x9a, 0x61, 0x19, 0x44, 0x96, 0x9c, 0x46, 0xae, 0xc4,
+    0x94, 0x46, 0x0e, 0xc3, 0xda, 0xed, 0x58, 0xbc, 0x4d, 0xe9, 0x9c, 0x2a, 0x96, 0x75, 0xbe, 0x73,
+    0x7e, 0xdf, 0x3d, 0xe0, 0xd0, 0x0c, 0x6c, 0x42, 0xc9, 0x58, 0x8c, 0x0d, 0x25, 0xdd, 0x2b, 0xe9,
+    0x34, 0x0f, 0x79, 0x3a, 0xd7, 0x7a, 0xd7, 0x70, 0x16, 0xb4, 0x92, 0x5e, 0x2f, 0x8f, 0x12, 0xfc,
+    0xd8, 0xbd, 0x53, 0x21, 0xc1, 0xf1, 0x3e, 0x63, 0xc0, 0x8e, 0xa9, 0x54, 0x87, 0x45, 0xdd, 0xf5,
+    0xca, 0x9a, 0x45, 0x73, 0x51, 0x1f, 0x51, 0xe6, 0xe6, 0x4a, 0xf2, 0x0e, 0x7c, 0xd1, 0xbd, 0x22,
+    0xdd, 0x06, 0xbe, 0x5f, 0xda, 0x2f, 0xf9, 0xf7, 0xa8, 0x2d, 0xa9, 0x86, 0x45, 0x29, 0x41, 0x56,
+    0x5e, 0x29, 0x2f, 0xad, 0x98, 0x48, 0xf8, 0x4c, 0x41, 0x6d, 0x19, 0x65, 0xdc, 0x26, 0x4e, 0xf7,
+    0x23, 0x97, 0x50, 0xc1, 0xb3, 0xd1, 0xbc, 0x7d, 0x98, 0xb2, 0xee, 0x5b, 0x26, 0x33, 0xcf, 0x82,
+    0x33, 0x99, 0x0f, 0x4c, 0x8d, 0x14, 0x60, 0xb8, 0x3c, 0x36, 0x7d, 0x13, 0x7a, 0x6b, 0x5e, 0x89,
+    0x1a, 0x83, 0xf8, 0xe9, 0x46, 0xa5, 0x64, 0x37, 0xbd, 0x0b, 0x8e, 0xda, 0x11, 0x5a, 0x1c, 0x78,
+    0xac, 0x3f, 0x2b, 0xca, 0x0c, 0x69, 0xb8, 0xd3, 0xe5, 0x54, 0x45, 0x77, 0xa1, 0x50, 0x75, 0xe7,
+    0x77, 0x48, 0x22, 0xd0, 0x27, 0x98, 0x74, 0xea, 0x78, 0x77, 0xde, 0x37, 0x63, 0x0e, 0x02, 0xbd,
+    0xb8, 0x73, 0x3c, 0x5d, 0xa9, 0xaf, 0xd0, 0xd3, 0xd8, 0xab, 0x94, 0x96, 0xca, 0x9b, 0xbb, 0xba,
+    0x13, 0x4c, 0x29, 0xd3, 0x05, 0x75, 0xfa, 0x32, 0xd0, 0xa6, 0xa9, 0x54, 0x7f, 0xfb, 0xfb, 0xe3,
+    0xc6, 0x64, 0xd1, 0xe1, 0x8c, 0x01, 0xac, 0x29, 0x98, 0x77, 0x78, 0xc3, 0x62, 0x8d, 0x53, 0x47,
+    0xd5, 0xde, 0x82, 0x79, 0x14, 0x47, 0x1d, 0xc8, 0x2a, 0x81, 0x44, 0x4f, 0xc9, 0x4e, 0x4b, 0x92,
+    0x78, 0xb8, 0x22, 0x67, 0x89, 0x60, 0x91, 0x3e, 0xbc, 0x6c, 0x5c, 0xf3, 0x95, 0x78, 0xe0, 0xca,
+    0x81, 0xc6, 0x97, 0x7d, 0x30, 0x0a, 0xe3, 0x61, 0x9f, 0xe2, 0x94, 0xe1, 0x02, 0x39, 0xc2, 0xba,
+    0x75, 0xe1, 0xe9, 0x48, 0xa0, 0xaa, 0x7f, 0x85, 0xd6, 0xcf, 0x38, 0xd7, 0x01, 0xc3, 0x98, 0x2f,
+    0x8e, 0x8b, 0x56, 0xd1, 0x9f, 0x5f, 0xbb, 0x4d, 0xe4, 0x84, 0x8e, 0xa9, 0xf2, 0x3a, 0x22, 0xcd,
+    0x19, 0x2e, 0x48, 0xc6, 0x2b, 0x9d, 0xec, 0x27, 0x87, 0xe0, 0x66, 0x9c, 0xa9, 0x4b, 0xc8, 0x07,
+    0xdb, 0xe7, 0x66, 0xfb, 0x8e, 0x87, 0x76, 0x64, 0xb5, 0xca, 0x3b, 0x84, 0x56, 0xf0, 0xa3, 0x79,
+    0x18, 0xa1, 0x52, 0xd3, 0xca, 0x19, 0xd9, 0x41, 0x05, 0x0e, 0x99, 0xe7, 0x5b, 0xbb, 0xf4, 0x94,
+    0x70, 0xf8, 0x8e, 0x81, 0xf7, 0xdd, 0x7d, 0x03, 0x33, 0x3d, 0xc8, 0x64, 0x55, 0xac, 0x47, 0x66,
+    0xa5, 0x56, 0x6c, 0xbf, 0x76, 0xea, 0xc9, 0x73, 0xeb, 0xf3, 0xa4, 0x0c, 0x56, 0x46, 0x9e, 0x22,
+    0x46, 0x33, 0x1e, 0x54, 0xb0, 0x0d, 0xa8, 0x28, 0xd1, 0xae, 0xf6, 0x40, 0x07, 0xdd, 0x21, 0xa4,
+    0xa6, 0xd2, 0xbd, 0xac, 0x71, 0x3f, 0x58, 0xeb, 0x30, 0xa8, 0x1b, 0x68, 0xd4, 0xeb, 0xb6, 0x57,
+    0xb6, 0xd7, 0xb1, 0x89, 0x23, 0x47, 0x59, 0x80, 0x88, 0x2b, 0x3d, 0x98, 0x4e, 0x2a, 0x36, 0x02,
+    0x96, 0x82, 0x8d, 0x6f, 0x6f, 0xd7, 0xad, 0xb2, 0xb9, 0xfb, 0x54, 0x80, 0x79, 0x7f, 0xbb, 0x71,
+    0xfd, 0x4c, 0x87, 0x52, 0xda, 0x04, 0x80, 0xbd, 0xd8, 0x52, 0x0c, 0xe9, 0x38, 0x50, 0x4b, 0xe4,
+    0x45, 0x86, 0xb8, 0x0d, 0x54, 0xed, 0xcd, 0xab, 0xe1, 0xa9, 0x39, 0x50, 0xb2, 0x96, 0x2f, 0x9c,
+    0xd4, 0x67, 0xe9, 0x05, 0x53, 0xc9, 0x58, 0x47, 0xbd, 0x04, 0x1e, 0xb1, 0xf5, 0x19, 0xf6, 0xb5,
+    0x6c, 0x71, 0x8e, 0xc9, 0xfd, 0xb8, 0x34, 0x10, 0x2d, 0x4b, 0xdf, 0x89, 0xc3, 0xb8, 0x6b, 0x00,
+    0x7c, 0x2d, 0xab, 0x9f, 0x9f, 0xec, 0xbe, 0x5e, 0x08, 0x97, 0x04, 0xc5, 0x6d, 0x58, 0x53, 0x0d,
+    0x70, 0x36, 0x67, 0x79, 0xa2, 0x9c, 0x94, 0x0f, 0xbc, 0x73, 0x37, 0x2c, 0xa5, 0x47, 0x91, 0xad,
+    0x76, 0x0c, 0xbe, 0x65, 0x4d, 0x1f, 0xc3, 0x6a, 0x22, 0xd2, 0x5e, 0x0e, 0x34, 0xec, 0x7d, 0x89,
+    0x29, 0x27, 0xae, 0x5c, 0x6c, 0xac, 0xdf, 0x03, 0xd5, 0x4e, 0x6a, 0x2b, 0x55, 0x1f, 0x62, 0x19,
+    0x56, 0xad, 0x5f, 0x4c, 0x48, 0x3a, 0x30, 0x47, 0xb6, 0x42, 0x73, 0x85, 0x60, 0xc8, 0x72, 0xe6,
+    0xbe, 0x41, 0xf2, 0x36, 0x5e, 0xd6, 0x01, 0x74, 0x6a, 0x31, 0x20, 0x16, 0x8a, 0x13, 0x3c, 0x8d,
+    0xcb, 0x38, 0x74, 0x2f, 0xc6, 0x8c, 0xe8, 0xf5, 0xf1, 0x01, 0xd7, 0x9b, 0xec, 0xfa, 0xbe, 0x85,
+    0x87, 0x57, 0x94, 0xf0, 0x4e, 0x02, 0xae, 0x3b, 0xf2, 0xb5, 0xf0, 0x86, 0xd7, 0x9c, 0xa9, 0x18,
+    0x28, 0x1d, 0xb0, 0xde, 0x1e, 0x45, 0xa3, 0x31, 0xae, 0x39, 0x7b, 0xfe, 0xf3, 0xe7, 0x1b, 0xaf,
+    0x20, 0x14, 0x0b, 0xeb, 0x26, 0x38, 0x0a, 0xfa, 0xca, 0xf4, 0xd4, 0x07, 0xa5, 0xb0, 0x60, 0x99,
+    0xfa, 0xec, 0x1d, 0x57, 0xc2, 0xc1, 0x91, 0x81, 0x96, 0x98, 0x29, 0xdb, 0x21, 0xa2, 0xd5, 0xcd,
+    0x7e, 0x71, 0x9d, 0xc7, 0xec, 0xc9, 0x7b, 0x60, 0x31, 0xe4, 0xdb, 0xd8, 0x23, 0x1c, 0x0c, 0x91,
+    0x3c, 0x28, 0x08, 0x01, 0x1d, 0x06, 0x62, 0x89, 0x0c, 0x89, 0x81, 0xaf, 0x21, 0x0b, 0x6e, 0xcd,
+    0xe3, 0x66, 0x91, 0x6e, 0x02, 0x80, 0x1e, 0xb3, 0x6b, 0xad, 0x60, 0x78, 0xc1, 0xa5, 0xab, 0xad,
+    0x62, 0x93, 0xf0, 0xa9, 0x45, 0x48, 0x60, 0x00, 0x57, 0x93, 0xdd, 0x11, 0x7e, 0xc5, 0xd8, 0xd2,
+    0x9f, 0xe3, 0x6c, 0xcd, 0x4c, 0x24, 0x23, 0x5c, 0x21, 0x1b, 0x98, 0x2e, 0x2f, 0xab, 0xec, 0x2a,
+    0xac, 0x15, 0x95, 0xc9, 0x67, 0x96, 0x46, 0xd4, 0xd0, 0xae, 0x66, 0xfc, 0x82, 0x04, 0x05, 0xb7,
+    0x5a, 0x8c, 0x91, 0x76, 0x0a, 0x81, 0xdf, 0x88, 0x10, 0xcf, 0xf4, 0x4d, 0x0a, 0xd7, 0x22, 0xf9,
+    0x64, 0x4a, 0xa3, 0x5d, 0xd5, 0x39, 0xc6, 0x8d, 0xf9, 0x7a, 0xe0, 0x42, 0x90, 0x5d, 0xe6, 0xfd,
+    0xe7, 0xda, 0xa4, 0xb6, 0x95, 0x69, 0x40, 0x18, 0x44, 0x78, 0x07, 0x70, 0xb6, 0xcb, 0x20, 0x59,
+    0x16, 0x97, 0x9d, 0x0e, 0x46, 0xb8, 0x61, 0x87, 0xd8, 0x32, 0xbd, 0x5d, 0x4a, 0x0e, 0xf1, 0xe4,
+    0xc0, 0xca, 0xd8, 0x78, 0xb7, 0xe6, 0x67, 0x1c, 0xe2, 0x2b, 0xd6, 0x04, 0x81, 0x27, 0xa6, 0x8a,
+    0x86, 0x4a, 0xba, 0x69, 0x86, 0x37, 0x2e, 0x4e, 0xfa, 0x3c, 0xea, 0xdc, 0x3c, 0x01, 0x55, 0x05,
+    0x13, 0x27, 0x11, 0x56, 0x56, 0x72, 0xfa, 0x8a, 0x5f, 0x31, 0x31, 0x3a, 0xc0, 0x27, 0x36, 0x56,
+    0x38, 0x77, 0xc7, 0x86, 0xbb, 0xad, 0xdb, 0x58, 0xb8, 0x00, 0x4a, 0xb6, 0x91, 0x42, 0xbb, 0xfc,
+    0xae, 0x78, 0x86, 0x69, 0xaa, 0x40, 0xab, 0x13, 0xed, 0xa5, 0xf2, 0x8b, 0x8e, 0xe0, 0xe6, 0x9a,
+    0x13, 0x2e, 0x04, 0xd6, 0xa7, 0x91, 0x38, 0x6b, 0xac, 0x4f, 0xae, 0x53, 0x34, 0xd2, 0xfb, 0x11,
+    0x8c, 0xfa, 0x46, 0x23, 0x9e, 0xb2, 0x31, 0xfb, 0x19, 0xee, 0x36, 0x2a, 0x6e, 0x34, 0x49, 0x35,
+    0x6f, 0x96, 0x26, 0xd9, 0xa5, 0x2a, 0x4c, 0x18, 0xc4, 0x05, 0xaa, 0x1c, 0x16, 0xe1, 0x7d, 0x8c,
+    0xcc, 0x76, 0xa3, 0xd6, 0xc6, 0xcb, 0x07, 0xaf, 0xbf, 0x98, 0xe8, 0xa7, 0x36, 0xeb, 0x3e, 0xbd,
+    0x5d, 0xb1, 0x07, 0xf8, 0x69, 0xd4, 0x99, 0x06, 0x73, 0x9e, 0x05, 0xf2, 0x51, 0x10, 0xde, 0x1c,
+    0xcd, 0xbd, 0xb6, 0xa9, 0x31, 0xbc, 0x12, 0x78, 0xbd, 0xa2, 0x72, 0x4d, 0x08, 0x54, 0xab, 0x26,
+    0x6e, 0xd4, 0xfb, 0xfd, 0x1b, 0xd4, 0x37, 0xe0, 0x6a, 0x84, 0x18, 0xb6, 0xf2, 0x72, 0xd6, 0x3e,
+    0x5d, 0x0f, 0x22, 0x57, 0xaf, 0x19, 0xb8, 0xf8, 0x4c, 0x6f, 0x07, 0x39, 0x5f, 0x8a, 0x0b, 0x07,
+    0x13, 0xde, 0x24, 0x97, 0x06, 0x61, 0x1f, 0x75, 0xc9, 0x86, 0x87, 0x9d, 0x3f, 0xd4, 0x7d, 0x38,
+    0xa0, 0xec, 0x08, 0xb2, 0xbc, 0xe7, 0xce, 0x50, 0xb1, 0xa7, 0x2f, 0xb6, 0x17, 0xec, 0x32, 0xf3,
+    0x79, 0x90, 0x4d, 0x63, 0xa3, 0x7d, 0x50, 0xc0, 0x47, 0x53, 0x99, 0xf1, 0x81, 0xd1, 0x9c, 0x6a,
+    0x79, 0xa0, 0x7c, 0x7a, 0xe5, 0xe8, 0x26, 0x7c, 0x87, 0xbd, 0x8c, 0x8b, 0x6c, 0x90, 0x4c, 0x1f,
+    0x91, 0x32, 0x58, 0x23, 0x14, 0x85, 0xd3, 0x67, 0xb9, 0x99, 0x73, 0x19, 0xe6, 0xb5, 0xe7, 0x10,
+    0x03, 0x13, 0x6b, 0xaf, 0xd5, 0x18, 0x5a, 0x31, 0xea, 0xcf, 0xc7, 0x26, 0xcc, 0xf1, 0x7a, 0xd3,
+    0xa7, 0x35, 0x20, 0xd9, 0xc9, 0x6d, 0xe7, 0x15, 0x59, 0xda, 0x9e, 0x74, 0x61, 0x03, 0x4c, 0x74,
+    0xba, 0x00, 0xd0, 0x3b, 0xe1, 0xad, 0x81, 0xc9, 0x44, 0x1e, 0x59, 0xa1, 0x64, 0x5a, 0x4f, 0x1f,
+    0xd3, 0x30, 0x3e, 0x4b, 0x9c, 0xe0, 0xa9, 0x2c, 0x69, 0xea, 0xa7, 0xd2, 0x94, 0x7f, 0x22, 0x72,
+    0x7c, 0xb8, 0xc6, 0xed, 0xd8, 0xc2, 0xfc, 0x1a, 0x3c, 0x51, 0x7d, 0x57, 0xf5, 0x02, 0xc2, 0x0a,
+    0x07, 0x95, 0xfb, 0x8e, 0x4b, 0xa2, 0x93, 0xd9, 0x17, 0x68, 0x7d, 0xa3, 0x23, 0x1d, 0xfa, 0x48,
+    0xe8, 0x6a, 0x81, 0xa6, 0x2a, 0xfd, 0xd3, 0x61, 0x37, 0x36, 0x80, 0xc9, 0xae, 0x64, 0x55, 0xdc,
+    0xf7, 0xf3, 0xfd, 0x7d, 0x5d, 0xd8, 0x7a, 0x46, 0xc9, 0xfb, 0xa3, 0x86, 0xcc, 0x84, 0x0a, 0xe7,
+    0xb7, 0x60, 0x6f, 0xbf, 0xb8, 0xc8, 0x31, 0x3e, 0x4c, 0x96, 0x10, 0x94, 0x7a, 0xcf, 0x38, 0xe1,
+    0x15, 0x24, 0x2f, 0x97, 0x1e, 0x6d, 0x4e, 0x82, 0x08, 0x1c, 0x63, 0x4f, 0x19, 0x62, 0x3c, 0x4a,
+    0xa0, 0xb1, 0xc0, 0xff, 0x3a, 0xf8, 0x59, 0xac, 0xdc, 0x93, 0x13, 0xc1, 0x0c, 0x15, 0xc3, 0xb0,
+    0xd2, 0x85, 0xae, 0x59, 0xc8, 0x11, 0x7d, 0xcf, 0xa5, 0x4c, 0x9c, 0x63, 0xba, 0x47, 0xef, 0x81,
+    0xaa, 0x88, 0xfb, 0xbc, 0x6c, 0x4a, 0x64, 0x75, 0xab, 0x2e, 0xa9, 0x7e, 0x99, 0x48, 0x04, 0x42,
+    0xe3, 0x2e, 0xb0, 0xc7, 0xd4, 0x20, 0xe5, 0x72, 0x4a, 0xbd, 0xd8, 0x1f, 0x5b, 0x6c, 0xb0, 0x4f,
+    0xd8, 0x9e, 0xc8, 0xfd, 0x08, 0x45, 0xe6, 0x02, 0x23, 0xa5, 0xb2, 0x56, 0xfd, 0x3b, 0x08, 0x2b,
+    0xb2, 0xb5, 0xc3, 0x2b, 0x94, 0x16, 0xfc, 0xfb, 0x2a, 0x8b, 0x92, 0xe2, 0x98, 0x4d, 0xde, 0x04,
+    0x39, 0x80, 0x63, 0x5d, 0x28, 0x58, 0x0b, 0x9c, 0x94, 0xd0, 0x88, 0x6f, 0xbd, 0x22, 0x7d, 0xcb,
+    0xf5, 0x99, 0xb1, 0x98, 0x9a, 0x33, 0x40, 0x9e, 0x9b, 0x64, 0xb1, 0x69, 0x2c, 0x5c, 0xfd, 0x82,
+    0xae, 0xce, 0x08, 0xb8, 0x98, 0xd1, 0xe3, 0x9b, 0x08, 0x2d, 0x5c, 0x43, 0xf9, 0x82, 0x6d, 0x04,
+    0x89, 0xa2, 0x31, 0x38, 0xd4, 0xd8, 0xc1, 0xb2, 0x6f, 0x8e, 0x76, 0x20, 0x02, 0xad, 0x39, 0x99,
+    0x1f, 0x86, 0xce, 0x84, 0x44, 0x81, 0x05, 0x02, 0x4e, 0x69, 0x35, 0x88, 0x24, 0x5b, 0x92, 0xe0,
+    0x94, 0x0d, 0xd9, 0xdd, 0xcd, 0xf2, 0xbf, 0x35, 0xdf, 0xd0, 0x94, 0x48, 0x7b, 0x13, 0xad, 0x17,
+    0x11, 0x30, 0xa2, 0x63, 0x42, 0x76, 0xea, 0x71, 0x73, 0x2e, 0x6b, 0x07, 0x83, 0x41, 0x4f, 0xf2,
+    0xa1, 0xe0, 0xcc, 0xfa, 0x5a, 0x07, 0xfe, 0x85, 0x2c, 0x37, 0x09, 0x00, 0xdd, 0x67, 0x5e, 0x53,
+    0x4f, 0xe0, 0xf7, 0xf7, 0xe8, 0x65, 0x61, 0x60, 0x39, 0xd3, 0x51, 0x5d, 0xb2, 0xe0, 0xed, 0x77,
+    0x86, 0xc4, 0x72, 0xc7, 0xf4, 0x7d, 0x8c, 0xa7, 0x91, 0xfd, 0xea, 0xf1, 0x5c, 0x0f, 0xe4, 0xc9,
+    0xa4, 0x66, 0xe2, 0x99, 0x7b, 0x62, 0x86, 0xe3, 0x24, 0xa3, 0x7c, 0x43, 0x8e, 0x8b, 0xe8, 0xd3,
+    0x17, 0xcd, 0x95, 0xef, 0x96, 0x9e, 0x41, 0xea, 0x23, 0x1f, 0xb6, 0x90, 0x03, 0xda, 0x00, 0x02,
+    0x13, 0x0a, 0x56, 0xf2, 0x22, 0x02, 0xe6, 0x3b, 0x5d, 0x6f, 0xc4, 0xb9, 0x4d, 0xda, 0x49, 0xfd,
+    0xf6, 0xea, 0xef, 0x0b, 0x2a, 0xb4, 0x8c, 0x6c, 0xf3, 0x64, 0x47, 0xb4, 0x17, 0x4c, 0xe6, 0x99,
+    0x15, 0xa4, 0x70, 0xd5, 0xcd, 0x9f, 0xb9, 0xf0, 0x5c, 0xc1, 0x45, 0x93, 0x34, 0x6e, 0x14, 0xda,
+    0xe2, 0xab, 0x7e, 0xb3, 0xf2, 0xfc, 0x25, 0x4e, 0x9e, 0x76, 0xb2, 0x75, 0xa2, 0xb4, 0xf8, 0x1d,
+    0xe9, 0x1a, 0x48, 0x71, 0x44, 0xe8, 0x69, 0xbc, 0x47, 0x06, 0x0a, 0x94, 0xb2, 0x9a, 0xb4, 0xde,
+    0x98, 0x5e, 0x6e, 0xfb, 0xb6, 0xe1, 0x08, 0xd2, 0xc4, 0xe2, 0xe5, 0x5f, 0xb0, 0xcb, 0x1a, 0x92,
+    0xe5, 0xd4, 0xca, 0x0c, 0x36, 0x96, 0xd6, 0x1d, 0x69, 0xe8, 0xbc, 0xca, 0x71, 0x95, 0xc1, 0x53,
+    0xde, 0xde, 0x34, 0x8b, 0x16, 0x36, 0x3e, 0x0f, 0x88, 0x67, 0x7c, 0xf8, 0x5a, 0xa0, 0x5e, 0xb5,
+    0xd6, 0xde, 0x4c, 0xeb, 0x7c, 0xcb, 0xbe, 0x7f, 0x11, 0xac, 0x2a, 0xc7, 0x8f, 0x9c, 0xfd, 0xd0,
+    0x23, 0x3a, 0x7f, 0x58, 0xb6, 0x0a, 0x96, 0xc1, 0xe1, 0x57, 0x11, 0xc9, 0x01, 0x96, 0xac, 0xc1,
+    0x5a, 0x84, 0x00, 0x7e, 0x03, 0xcc, 0x2a, 0x48, 0x44, 0x7b, 0xda, 0xca, 0xde, 0xb4, 0xc2, 0x65,
+    0x72, 0xd5, 0x6e, 0x14, 0x6d, 0x88, 0xb6, 0xe1, 0x52, 0x00, 0x37, 0x68, 0x73, 0xe9, 0x81, 0xc0,
+    0x29, 0x58, 0x0b, 0x84, 0x3a, 0x2f, 0x26, 0xf7, 0xa1, 0x36, 0xa5, 0xb9, 0xca, 0xe1, 0x37, 0xcc,
+    0xa6, 0xdb, 0xee, 0x00, 0x65, 0x07, 0x21, 0x4f, 0x2b, 0x7d, 0xfa, 0x2b, 0xc1, 0x35, 0x4d, 0xde,
+    0x8b, 0x0f, 0x86, 0x8e, 0x81, 0x9f, 0x62, 0x06, 0xe7, 0x18, 0x34, 0x14, 0x3a, 0x83, 0xf0, 0x84,
+    0xc7, 0x28, 0xcb, 0x4d, 0xd1, 0x47, 0x81, 0x49, 0x24, 0x8b, 0x02, 0x58, 0x1a, 0x57, 0x88, 0xe2,
+    0xa5, 0x79, 0x64, 0xe9, 0xee, 0x01, 0x36, 0xd8, 0xc3, 0x99, 0x16, 0x74, 0xdc, 0x1e, 0xc1, 0x06,
+    0x80, 0x59, 0x51, 0xb4, 0x27, 0xcc, 0x9b, 0x14, 0xde, 0x06, 0xe7, 0xeb, 0x7d, 0x4b, 0xe1, 0xf8,
+    0x09, 0xcb, 0xcf, 0xe1, 0x7f, 0x08, 0x0f, 0x8d, 0xeb, 0x3c, 0x48, 0x22, 0x84, 0x6f, 0x36, 0x90,
+    0x37, 0x2b, 0x62, 0x3b, 0x54, 0x2f, 0xa3, 0x02, 0x49, 0x55, 0x0e, 0xc0, 0x40, 0x5b, 0x94, 0x45,
+    0xea, 0xe4, 0x12, 0x49, 0xd4, 0xa7, 0x04, 0x9c, 0xe3, 0xb1, 0xa1, 0x30, 0x30, 0x1f, 0x3a, 0x4c,
+    0xb4, 0xf9, 0x8e, 0xe8, 0xe7, 0x5b, 0x5b, 0x92, 0xd3, 0x69, 0x5a, 0x97, 0xb5, 0x65, 0x98, 0x5b,
+    0xfe, 0xf9, 0xae, 0x38, 0x39, 0x7f, 0x5b, 0x27, 0xda, 0xf5, 0x01, 0xc2, 0x97, 0x55, 0x90, 0xaa,
+    0xdb, 0xfb, 0xe3, 0x37, 0xbd, 0xd1, 0x37, 0x88, 0x07, 0xa2, 0x5f, 0xfb, 0xee, 0xbb, 0x32, 0xc7,
+    0x67, 0xa5, 0xac, 0x34, 0x25, 0x2a, 0xef, 0xa9, 0x64, 0x13, 0x10, 0x8d, 0x18, 0xdf, 0x5f, 0x37,
+    0x30, 0x5c, 0x2e, 0x12, 0xf2, 0x37, 0xad, 0xb0, 0x12, 0x08, 0x9f, 0x6f, 0xc5, 0xce, 0xc7, 0xf8,
+    0x41, 0xbb, 0x17, 0xd6, 0xb3, 0xaf, 0x39, 0x36, 0xd7, 0x06, 0x0f, 0x61, 0x17, 0x10, 0x14, 0xdd,
+    0x11, 0x1f, 0x8e, 0xb6, 0x13, 0x2d, 0x8c, 0xc9, 0x2f, 0x13, 0x3f, 0x17, 0xde, 0xe4, 0x8f, 0xb5,
+    0x3b, 0xb3, 0x57, 0xae, 0x75, 0xb5, 0xd1, 0x91, 0x20, 0xa8, 0x7d, 0x3b, 0x8d, 0x19, 0xab, 0xfe,
+    0xdb, 0x7b, 0xec, 0x30, 0x1b, 0x40, 0xe3, 0x47, 0x8a, 0x8b, 0x6c, 0x78, 0xec, 0x17, 0x1c, 0xf1,
+    0xac, 0xf8, 0xee, 0x5b, 0xda, 0xaf, 0xd8, 0xde, 0x03, 0xac, 0xc8, 0xe5, 0xf2, 0x73, 0x6f, 0x53,
+    0xff, 0xa8, 0xba, 0xdb, 0x03, 0x3f, 0x0f, 0xd5, 0xa4, 0xee, 0x87, 0x55, 0x3c, 0xc1, 0x55, 0x74,
+    0x66, 0xf8, 0x92, 0x23, 0x9a, 0x7c, 0xf6, 0xc6, 0xd5, 0x33, 0xe3, 0x61, 0xd9, 0x94, 0xfe, 0x9a,
+    0xc5, 0x50, 0xa7, 0x87, 0x66, 0xd3, 0x31, 0x1a, 0x5e, 0xbb, 0x22, 0x0c, 0xaa, 0x87, 0x90, 0x08,
+    0x11, 0x15, 0x95, 0x4c, 0xa0, 0xce, 0x3e, 0x80, 0x9a, 0xf5, 0x77, 0x3c, 0x5f, 0x12, 0xd0, 0x46,
+    0x73, 0xa0, 0xb2, 0xb2, 0x45, 0xd3, 0x5b, 0xd8, 0xf5, 0x76, 0x54, 0x87, 0xf1, 0x78, 0xef, 0x36,
+    0xc6, 0x26, 0x00, 0x12, 0x3b, 0x2d, 0x46, 0x26, 0x74, 0x45, 0x1e, 0xb4, 0x2f, 0xb9, 0x19, 0x84,
+    0x03, 0x74, 0x17, 0xe9, 0x41, 0xc6, 0xb8, 0x0c, 0x46, 0x4e, 0xa1, 0xfc, 0x25, 0x7a, 0x94, 0xe5,
+    0xb2, 0x00, 0x5b, 0x96, 0x6a, 0x96, 0xa1, 0x44, 0x89, 0x01, 0xaa, 0x00, 0x58, 0xec, 0x7b, 0x41,
+    0x24, 0xc1, 0x2c, 0xf4, 0x2d, 0x24, 0x09, 0x00, 0xc4, 0xe6, 0x7b, 0x86, 0xe6, 0xf6, 0x42, 0xea,
+    0x30, 0x41, 0xcb, 0x74, 0x1f, 0xee, 0xcf, 0xa1, 0xa8, 0x61, 0x00, 0x13, 0xa9, 0x25, 0x6f, 0x9c,
+    0xb0, 0x5f, 0x67, 0x44, 0xb0, 0xba, 0x59, 0xc5, 0x3c, 0x2d, 0x99, 0x5f, 0xd3, 0x20, 0xc2, 0x77,
+    0x9e, 0x48, 0xbd, 0x03, 0x68, 0xf7, 0x1b, 0x0e, 0xdb, 0x12, 0xa9, 0x96, 0x9c, 0x08, 0x8f, 0x24,
+    0x47, 0x4d, 0xd3, 0xf6, 0xce, 0xab, 0x00, 0x1a, 0x2b, 0xc3, 0xb8, 0xdc, 0x20, 0x66, 0x9a, 0x28,
+    0xda, 0x7a, 0xf5, 0x02, 0x3e, 0xa6, 0x80, 0xc4, 0x26, 0x8d, 0xdb, 0xb9, 0x70, 0xef, 0x20, 0x6d,
+    0xdf, 0x31, 0x01, 0x2b, 0x6f, 0xc3, 0x0c, 0x9e, 0x17, 0x17, 0xb4, 0xab, 0xfb, 0xb4, 0x95, 0x55,
+    0xb9, 0x86, 0xab, 0xaa, 0x30, 0x6e, 0xb7, 0x98, 0x60, 0x06, 0x1e, 0xef, 0x35, 0x2f, 0x66, 0xb5,
+    0xde, 0x83, 0xe0, 0x0b, 0x7a, 0x72, 0x97, 0xba, 0x00, 0x82, 0xd5, 0xfd, 0x39, 0x87, 0x44, 0x08,
+    0xa9, 0x0a, 0x43, 0x75, 0x1d, 0xc5, 0x48, 0x3c, 0x83, 0x5c, 0x78, 0x79, 0x84, 0x19, 0x1d, 0x9c,
+    0xf7, 0x87, 0x2f, 0x49, 0x86, 0xab, 0x3e, 0xee, 0x47, 0x46, 0x27, 0xf3, 0xc0, 0x12, 0xe8, 0xfe,
+    0xe4, 0x12, 0xd8, 0xc9, 0x31, 0x3e, 0x0a, 0xf5, 0x88, 0x95, 0x1d, 0x83, 0xe0, 0xab, 0x37, 0x51,
+    0x91, 0xc6, 0xd7, 0x5d, 0x13, 0x7a, 0x8e, 0x9e, 0xc3, 0x2f, 0x62, 0x88, 0x52, 0xee, 0xb2, 0xb5,
+    0xbd, 0x87, 0x07, 0x3e, 0xef, 0x90, 0x47, 0xf2, 0xe7, 0xc6, 0x39, 0x08, 0xb3, 0x2d, 0xff, 0x7c,
+    0xfa, 0x5d, 0xda, 0x3b, 0x2b, 0xbc, 0x77, 0x4d, 0xc9, 0xa8, 0x53, 0xe6, 0xec, 0x59, 0x6e, 0x48,
+    0x09, 0x75, 0x4e, 0x50, 0xd2, 0x62, 0x99, 0xf5, 0x92, 0x7d, 0x55, 0x22, 0x55, 0x70, 0x27, 0x21,
+    0x72, 0x34, 0x9c, 0xf2, 0xa5, 0x10, 0x1d, 0xdd, 0x80, 0x13, 0x25, 0xc3, 0xd0, 0x12, 0x13, 0x77,
+    0xcc, 0x3e, 0x4b, 0xac, 0xe1, 0xf3, 0x86, 0x24, 0xd4, 0x1a, 0x99, 0xd9, 0xc2, 0x84, 0xab, 0x4b,
+    0x5e, 0x31, 0xb4, 0xf6, 0x09, 0x3b, 0x2a, 0x6b, 0x63, 0x74, 0x72, 0xa1, 0x2d, 0x91, 0xd8, 0x1e,
+    0x1f, 0x6f, 0x06, 0x04, 0x4c, 0x13, 0x55, 0x5b, 0x78, 0xf4, 0x77, 0xe2, 0xc0, 0x79, 0xba, 0x9a,
+    0x52, 0x6c, 0x3d, 0x82, 0x8c, 0xce, 0xc1, 0x1d, 0x49, 0xa7, 0x5c, 0x20, 0x92, 0xeb, 0x30, 0xaf,
+    0x69, 0x80, 0x22, 0x8d, 0xe0, 0xcf, 0x17, 0xfa, 0xa4, 0x14, 0x78, 0x6e, 0xb8, 0xbc, 0x5e, 0x9f,
+    0xe1, 0xe6, 0x20, 0x89, 0xdb, 0xd8, 0x1c, 0xc1, 0x83, 0x58, 0xaa, 0x12, 0xb9, 0x7d, 0x0a, 0x52,
+    0xec, 0x74, 0x23, 0x2b, 0x27, 0x37, 0xc8, 0xa1, 0x6a, 0xe2, 0x45, 0x0b, 0x2d, 0x21, 0xf3, 0x16,
+    0xe6, 0xa7, 0x0b, 0xa4, 0x80, 0x71, 0x6d, 0x13, 0x31, 0x0d, 0xa8, 0x1c, 0x1e, 0xef, 0x55, 0x4c,
+    0xaa, 0x2d, 0x48, 0x28, 0x61, 0xec, 0x4f, 0x18, 0x92, 0x29, 0x20, 0xdc, 0x7b, 0xe6, 0xf6, 0x66,
+    0x97, 0x37, 0x27, 0x2f, 0xee, 0x4a, 0x11, 0x52, 0x86, 0x0d, 0xbc, 0x8b, 0x22, 0x29, 0xb4, 0x9c,
+    0xb9, 0x89, 0xab, 0x7e, 0xe2, 0x35, 0xc5, 0xeb, 0xf0, 0xf1, 0xa6, 0x2f, 0xbf, 0xe9, 0x52, 0x86,
+    0x62, 0x56, 0x13, 0x81, 0x87, 0xba, 0x2c, 0x5f, 0xe6, 0x4d, 0x0c, 0x75, 0x95, 0xec, 0x8f, 0x92,
+    0x03, 0x07, 0x91, 0x12, 0x6c, 0x2e, 0x60, 0xcd, 0x0f, 0xcd, 0x2b, 0xfc, 0xcf, 0xe7, 0x45, 0xa3,
+    0xf1, 0x69, 0x98, 0x49, 0x11, 0x81, 0x0f, 0x5d, 0x0a, 0x7b, 0xf9, 0x26, 0x9b, 0x5c, 0x3e, 0xbf,
+    0x86, 0x09, 0xe7, 0x08, 0x3b, 0x1c, 0x48, 0xe6, 0x44, 0x80, 0x46, 0xee, 0xa7, 0x8f, 0x5f, 0xaa,
+    0xde, 0x39, 0x1b, 0x4c, 0x4a, 0xc5, 0x7e, 0x8b, 0xab, 0x3f, 0x7f, 0x1f, 0x03, 0x2b, 0xc5, 0x9d,
+    0xf3, 0x5d, 0x1b, 0x9d, 0x9a, 0xe9, 0xb7, 0x8f, 0xd1, 0x81, 0xcd, 0x58, 0x93, 0xf5, 0xa3, 0x54,
+    0x46, 0x70, 0x06, 0xc0, 0xb4, 0xfe, 0x22, 0xbc, 0x13, 0x91, 0x65, 0x60, 0x8a, 0x08, 0xa4, 0x6a,
+    0xb1, 0x8f, 0x91, 0x2a, 0xcf, 0xd3, 0x00, 0x2d, 0xca, 0x76, 0xf6, 0x94, 0x9e, 0x13, 0xad, 0xcb,
+    0x97, 0xed, 0xf2, 0xa9, 0x25, 0xc0, 0xf8, 0x5b, 0x14, 0x53, 0xf3, 0x64, 0x86, 0x1d, 0xb7, 0x98,
+    0xec, 0x23, 0x55, 0x9f, 0xd8, 0x9b, 0xd2, 0x71, 0x6e, 0x42, 0xab, 0x66, 0x73, 0x7f, 0x12, 0xe9,
+    0xb7, 0xf8, 0x35, 0x79, 0xc2, 0x19, 0x27, 0x93, 0xf7, 0x39, 0xbf, 0x82, 0x26, 0xb6, 0x12, 0xc0,
+    0xda, 0x89, 0xd9, 0xc3, 0x89, 0x66, 0x8c, 0x2d, 0x95, 0x21, 0x61, 0x80, 0x38, 0xb5, 0x24, 0xcf,
+    0xd7, 0x90, 0x6f, 0xfa, 0x75, 0x2c, 0x72, 0x24, 0x41, 0xcc, 0x45, 0xa1, 0x21, 0x28, 0xcd, 0xf9,
+    0xc0, 0x3a, 0xb9, 0x39, 0x8c, 0x1e, 0xe8, 0x12, 0x2e, 0x77, 0x25, 0x1f, 0x4b, 0xaf, 0xb7, 0xfd,
+    0xe8, 0x85, 0xf3, 0x11, 0x2f, 0x2b, 0x0d, 0xcd, 0x25, 0x13, 0xaf, 0xbe, 0x8a, 0x48, 0x97, 0xca,
+    0x7d, 0xcb, 0xb7, 0x25, 0x3b, 0x1b, 0xe3, 0x36, 0x8c, 0x7f, 0x45, 0x8f, 0x24, 0x1a, 0xcf, 0x32,
+    0x15, 0x6c, 0x8a, 0x9b, 0x4f, 0xc1, 0x04, 0xe5, 0x7b, 0xd0, 0xb4, 0x2f, 0x2c, 0x3a, 0xe2, 0x87,
+    0x73, 0x4f, 0x57, 0x61, 0x16, 0x0c, 0xff, 0x1a, 0xd1, 0x96, 0x7d, 0x79, 0x60, 0x71, 0x58, 0xe1,
+    0x3a, 0xe1, 0x35, 0x45, 0xbd, 0xd2, 0xc0, 0x9f, 0x6c, 0xea, 0x97, 0xa5, 0x9b, 0x59, 0xee, 0x74,
+    0xa5, 0x7c, 0x8a, 0x27, 0x1d, 0x0d, 0x2e, 0xe3, 0xe4, 0x85, 0xd8, 0xff, 0x2c, 0x61, 0x29, 0xb9,
+    0x2f, 0xa1, 0x7c, 0x70, 0x61, 0xcf, 0xd6, 0x2f, 0x12, 0x32, 0xe9, 0x21, 0x74, 0xd4, 0xb8, 0xc8,
+    0xef, 0xe5, 0x81, 0xd3, 0x15, 0x59, 0x0f, 0xc2, 0xf8, 0x06, 0x34, 0x2a, 0xbf, 0x0f, 0x76, 0xac,
+    0xd8, 0x28, 0x1a, 0x08, 0xec, 0x8c, 0xe9, 0x24, 0x77, 0x27, 0x13, 0xfd, 0xd2, 0xa3, 0x7c, 0x7d,
+    0xf4, 0x6f, 0x09, 0x55, 0x31, 0x37, 0xd4, 0x66, 0x69, 0x40, 0x27, 0x0f, 0x56, 0xa5, 0xdb, 0xa9,
+    0x92, 0x42, 0xa4, 0xaf, 0x94, 0x0e, 0xda, 0x01, 0xe4, 0x52, 0xcc, 0xdc, 0x1b, 0xd2, 0xcf, 0xd6,
+    0x23, 0x34, 0x67, 0xc4, 0x16, 0x50, 0x8e, 0x70, 0x94, 0xae, 0x22, 0xaf, 0x63, 0xf0, 0x2a, 0x7a,
+    0x99, 0x5f, 0xe7, 0x7b, 0xd0, 0xd1, 0x87, 0x22, 0xf7, 0xb4, 0x2d, 0xd7, 0x61, 0x68, 0x9c, 0x74,
+    0x4f, 0x33, 0xb2, 0x83, 0x7e, 0x5e, 0xfc, 0x67, 0x01, 0x6b, 0x52, 0x8d, 0x6d, 0x59, 0x4d, 0xd1,
+    0x06, 0xd3, 0x8a, 0x98, 0x5e, 0xc2, 0x88, 0x3c, 0x73, 0x95, 0x09, 0x5f, 0xfc, 0xe3, 0xff, 0x87,
+    0x83, 0xf8, 0x0c, 0x9b, 0xd5, 0xa8, 0x29, 0x90, 0xeb, 0xdd, 0x3c, 0xc4, 0xd0, 0x21, 0xec, 0xcd,
+    0x0a, 0x1f, 0x26, 0xab, 0x3b, 0x27, 0x1f, 0x37, 0x7b, 0x1d, 0x0e, 0x9f, 0x1e, 0x4b, 0x16, 0xc8,
+    0x15, 0xfc, 0xa3, 0x9f, 0x20, 0x11, 0x41, 0xf2, 0xeb, 0x03, 0x31, 0x2e, 0xfd, 0x5e, 0x70, 0x4e,
+    0x47, 0x8a, 0xb1, 0xe3, 0x4b, 0xc7, 0x94, 0x50, 0x63, 0x57, 0xe8, 0x62, 0xc5, 0xbe, 0x43, 0x5d,
+    0x78, 0x8b, 0x05, 0x42, 0x69, 0x9b, 0x9d, 0x66, 0xd8, 0x7d, 0x3a, 0xe0, 0xdd, 0xcb, 0x30, 0x6d,
+    0x94, 0x22, 0x09, 0x02, 0x89, 0x80, 0xa7, 0x82, 0x32, 0xcc, 0x11, 0x12, 0x7e, 0x59, 0x81, 0x3b,
+    0xad, 0xa7, 0x62, 0x26, 0x7d, 0xdb, 0xa3, 0x1b, 0xd0, 0x81, 0xe6, 0xdc, 0xd8, 0xf6, 0x80, 0x16,
+    0xb8, 0x78, 0x54, 0x09, 0x4a, 0xa8, 0xb9, 0x42, 0xe4, 0x7a, 0xe4, 0xdb, 0x93, 0xdc, 0xf6, 0x42,
+    0xcf, 0x3e, 0x92, 0xdd, 0xaf, 0x43, 0x6a, 0x74, 0x91, 0xba, 0x38, 0x95, 0xc8, 0x6c, 0x51, 0xf9,
+    0xab, 0x52, 0x23, 0x1b, 0xfc, 0xfc, 0x9d, 0x29, 0x2b, 0x35, 0x70, 0xb1, 0x55, 0x51, 0x1c, 0x70,
+    0xdc, 0x8a, 0xda, 0x92, 0x82, 0xef, 0x9c, 0xe4, 0x2e, 0x82, 0x20, 0x0d, 0x65, 0xb7, 0xdd, 0xa4,
+    0x49, 0x93, 0x41, 0xc6, 0x14, 0x14, 0xd4, 0xe6, 0xdf, 0xd5, 0xb5, 0x66, 0x0a, 0x2a, 0x5d, 0x96,
+    0x41, 0xc5, 0x00, 0xcf, 0xa7, 0x0a, 0xb1, 0x76, 0x57, 0x81, 0x44, 0xde, 0x34, 0xfb, 0x89, 0x81,
+    0x55, 0x33, 0x25, 0xf4, 0x7c, 0x70, 0x31, 0xad, 0xb8, 0xbb, 0x2f, 0xe9, 0x7e, 0xaf, 0xac, 0xc5,
+    0xb3, 0x47, 0xd2, 0x3e, 0xce, 0xd6, 0xb6, 0xfc, 0xfb, 0x96, 0xec, 0xbb, 0x1e, 0x62, 0x5f, 0x4b,
+    0x4b, 0xcd, 0x73, 0x35, 0x60, 0x54, 0xd3, 0x13, 0xf1, 0x60, 0x67, 0xc6, 0x11, 0x9b, 0x86, 0xc1,
+    0x55, 0x6c, 0x3f, 0x36, 0x7c, 0xac, 0x25, 0x2e, 0xc0, 0x48, 0x66, 0x53, 0x10, 0x73, 0xc2, 0xe6,
+    0xa6, 0x95, 0xa2, 0xe2, 0xee, 0x3a, 0x7b, 0xd0, 0xdd, 0x2d, 0xd0, 0xbd, 0xa5, 0x6c, 0xbd, 0x06,
+    0x11, 0x56, 0xda, 0x80, 0x7e, 0x5a, 0xda, 0x4b, 0x01, 0x12, 0xe9, 0xa6, 0xe3, 0xad, 0x21, 0x0e,
+    0x17, 0xf3, 0x6d, 0x87, 0xe4, 0xfa, 0xb8, 0x5a, 0xf1, 0x86, 0xf8, 0xf7, 0x4d, 0xbd, 0x4a, 0x5e,
+    0x32, 0x35, 0x89, 0x38, 0x6f, 0x9d, 0x99, 0x00, 0xd9, 0x9e, 0x8c, 0x31, 0xf0, 0x52, 0xad, 0xe4,
+    0x5a, 0x86, 0x91, 0xc6, 0xed, 0x7c, 0x59, 0x1b, 0xf6, 0xba, 0x49, 0xf5, 0x1a, 0xfa, 0xcc, 0xa6,
+    0x31, 0xd3, 0x8f, 0x33, 0x31, 0x9c, 0xe3, 0xc5, 0x6c, 0x1d, 0xcd, 0x65, 0x5d, 0x97, 0xd1, 0x97,
+    0x85, 0xe7, 0x11, 0x1a, 0x19, 0x08, 0x36, 0xc5, 0x36, 0xc4, 0xaa, 0x10, 0xb2, 0x16, 0xd8, 0xd2,
+    0x63, 0xf4, 0xaf, 0x9e, 0x76, 0x1c, 0xd9, 0xcc, 0x66, 0x4d, 0xea, 0xe4, 0xd1, 0xb1, 0x04, 0xe5,
+    0x5a, 0x3b, 0xfe, 0x4e, 0x79, 0x7b, 0xa4, 0xe9, 0x45, 0x3d, 0x3e, 0xa6, 0x98, 0x5b, 0x23, 0xac,
+    0x25, 0xe3, 0x1a, 0x34, 0x7c, 0x64, 0x77, 0xcd, 0x87, 0xc6, 0x62, 0xef, 0x89, 0x5f, 0x69, 0x96,
+    0x96, 0x83, 0xb4, 0xde, 0x0a, 0xc6, 0xb0, 0x4b, 0xd1, 0xd0, 0x40, 0xf4, 0xd0, 0xfd, 0xb1, 0x96,
+    0x4c, 0x10, 0x45, 0x51, 0xde, 0xea, 0xb3, 0xb5, 0xa8, 0xcf, 0x9f, 0x4f, 0xe6, 0x0e, 0x75, 0xec,
+    0x52, 0x41, 0x46, 0x9b, 0x54, 0xa5, 0xe0, 0xcd, 0xb2, 0xf3, 0x96, 0x44, 0x19, 0x89, 0x52, 0x16,
+    0x64, 0x27, 0x75, 0x14, 0xaa, 0x5d, 0x7f, 0x40, 0x30, 0x3c, 0xbb, 0x39, 0xf5, 0x09, 0xd0, 0x02,
+    0xa9, 0x33, 0x7a, 0x02, 0xc9, 0x06, 0xab, 0xdb, 0x81, 0x51, 0xc2, 0xdd, 0xb3, 0x2f, 0xe9, 0xcd,
+    0xe4, 0xdf, 0x2c, 0xed, 0xe0, 0x33, 0x5a, 0x48, 0x98, 0xa7, 0xa6, 0x07, 0x0c, 0x85, 0xef, 0x45,
+    0xbe, 0x03, 0xe5, 0x5d, 0x1a, 0x57, 0x0c, 0x28, 0xa7, 0x23, 0x7c, 0xe3, 0x2d, 0x1f, 0x0d, 0xab,
+    0x50, 0x59, 0xd1, 0x1d, 0xca, 0xb3, 0x89, 0x1d, 0x42, 0xa9, 0x90, 0xce, 0x93, 0x52, 0x3e, 0xea,
+    0x50, 0xbe, 0x4c, 0xa8, 0xaf, 0xe6, 0xdc, 0x44, 0x83, 0xdf, 0x01, 0xea, 0x7e, 0x0a, 0x59, 0x31,
+    0x6d, 0x0d, 0x87, 0x33, 0x76, 0x4e, 0x6c, 0xa4, 0xbf, 0x68, 0x70, 0x59, 0xc5, 0x51, 0xa2, 0xf1,
+    0x6c, 0x2b, 0x69, 0x4c, 0xf7, 0x2a, 0x3e, 0xac, 0x90, 0x3a, 0x6d, 0xe4, 0x4e, 0x20, 0xc6, 0x57,
+    0x66, 0xc4, 0xb6, 0x7e, 0x07, 0xa1, 0x72, 0x1b, 0x60, 0x80, 0xb2, 0x1b, 0x92, 0x88, 0x07, 0xa2,
+    0x25, 0xf5, 0xaa, 0x30, 0x0f, 0x96, 0x41, 0x50, 0x40, 0x11, 0x5a, 0x99, 0x7a, 0x98, 0xea, 0x4d,
+    0x4d, 0x29, 0x39, 0x33, 0x44, 0xab, 0x92, 0x9b, 0x17, 0xc2, 0x67, 0x13, 0xa9, 0x85, 0xa1, 0x7e,
+    0xfe, 0x9e, 0xfb, 0xfb, 0x15, 0xb0, 0xf5, 0xc6, 0x69, 0x85, 0x2b, 0x93, 0x6d, 0x65, 0xfa, 0xde,
+    0x28, 0x33, 0x43, 0xc1, 0x9b, 0x28, 0x37, 0x97, 0xad, 0xf9, 0xb5, 0x58, 0xfe, 0x03, 0xdf, 0xaa,
+    0xd2, 0x1d, 0x9c, 0xb2, 0x8b, 0x1f, 0x87, 0xa8, 0xab, 0x34, 0x6f, 0xe2, 0xd0, 0xd8, 0xcb, 0x4a,
+    0xe5, 0xe3, 0x90, 0x99, 0x45, 0x2a, 0x78, 0xb5, 0x31, 0xf1, 0x2c, 0xe3, 0x16, 0x71, 0x19, 0xf1,
+    0x53, 0x46, 0x73, 0x74, 0xcd, 0xc1, 0x98, 0xdc, 0xb7, 0x51, 0x7a, 0xf9, 0x94, 0x5d, 0xa3, 0x72,
+    0x7c, 0x72, 0x95, 0xbb, 0x4e, 0xb7, 0x0c, 0xad, 0x5e, 0x64, 0xc9, 0x2f, 0xb0, 0xcc, 0x7b, 0x2d,
+    0x4d, 0xb6, 0xcc, 0xe1, 0x2a, 0x5b, 0x68, 0x54, 0xa3, 0xd0, 0xf7, 0xd9, 0x00, 0x9f, 0x70, 0x57,
+    0xfa, 0xc0, 0xfb, 0x7b, 0x9b, 0x27, 0x26, 0xf9, 0xe9, 0x57, 0xb5, 0x1d, 0x2c, 0x7d, 0x24, 0x42,
+    0x77, 0x68, 0x31, 0x47, 0x04, 0x76, 0x22, 0x38, 0x7c, 0xdf, 0x08, 0xb0, 0x84, 0xb4, 0xa7, 0xc7,
+    0x60, 0xa9, 0xbc, 0xf0, 0xda, 0x58, 0x99, 0x6c, 0xe5, 0xdb, 0x87, 0xbd, 0x1d, 0x0f, 0x1f, 0x1e,
+    0x0b, 0x19, 0x58, 0xad, 0x0f, 0xfd, 0x66, 0xe7, 0xb3, 0xe6, 0x2b, 0xbd, 0x40, 0xc4, 0xba, 0x2b,
+    0x2e, 0x4b, 0x7c, 0xe9, 0xbe, 0x07, 0x41, 0x65, 0xce, 0xcb, 0x1f, 0x03, 0xbb, 0x1b, 0xc9, 0x61,
+    0xfa, 0x80, 0x63, 0x4b, 0xc8, 0xa1, 0xc5, 0x24, 0xa2, 0xb0, 0x30, 0x29, 0xde, 0x60, 0x0d, 0x95,
+    0x3a, 0x8b, 0x67, 0x11, 0x19, 0xf1, 0x72, 0xad, 0x93, 0x0f, 0xb7, 0x75, 0xa3, 0xce, 0x61, 0xc8,
+    0xce, 0x35, 0xd5, 0xb2, 0xdf, 0x0b, 0x0d, 0x58, 0x60, 0xa2, 0x17, 0x62, 0x3a, 0xf7, 0x25, 0x9a,
+    0x79, 0xca, 0x69, 0x38, 0x37, 0x9f, 0x7c, 0xe3, 0xb9, 0xf3, 0x3c, 0x3e, 0xb3, 0xc4, 0xd0, 0x68,
+    0xc9, 0x98, 0x28, 0xa0, 0x0a, 0xb5, 0xb6, 0x9e, 0xcd, 0x2b, 0x7b, 0xc8, 0x13, 0xed, 0x1d, 0x90,
+    0x6b, 0xb6, 0x09, 0x27, 0x5a, 0x17, 0xa0, 0x1f, 0xcc, 0x15, 0xa2, 0xc1, 0x7e, 0x1d, 0xce, 0x0e,
+    0x8d, 0x26, 0x76, 0xba, 0x70, 0xf8, 0x20, 0x54, 0xbf, 0x60, 0x91, 0x74, 0xe1, 0xef, 0xdd, 0x1a,
+    0xf4, 0xdc, 0x66, 0x4f, 0xa5, 0x51, 0xda, 0xe8, 0x7a, 0x50, 0x46, 0x46, 0x44, 0x96, 0xb4, 0xaf,
+    0x3c, 0x73, 0x5e, 0x74, 0x8a, 0x44, 0x4e, 0x75, 0x29, 0x83, 0xed, 0x7e, 0xd3, 0xf7, 0xbd, 0xf0,
+    0xa0, 0x25, 0x86, 0x35, 0x84, 0xa6, 0xbd, 0x23, 0x1c, 0x72, 0xd5, 0xeb, 0x6b, 0x8f, 0xdf, 0x79,
+    0xd1, 0x3b, 0x32, 0xcd, 0xf4, 0xa9, 0x86, 0x30, 0xe2, 0xa2, 0x43, 0xc3, 0x50, 0xd2, 0x24, 0x09,
+    0x72, 0x65, 0xc9, 0x89, 0xc3, 0x87, 0x61, 0xca, 0x57, 0x27, 0xdd, 0xab, 0xdc, 0x7f, 0x8b, 0x4b,
+    0xad, 0xde, 0x7b, 0x51, 0x4d, 0x73, 0x14, 0xc6, 0x99, 0x86, 0xcd, 0xc3, 0xf7, 0x6d, 0x21, 0x20,
+    0xe1, 0xfb, 0x9d, 0xaa, 0x79, 0x5d, 0x1a, 0xb8, 0xbb, 0x0c, 0x24, 0x0c, 0x59, 0x3e, 0x40, 0xba,
+    0x9f, 0x5f, 0xb0, 0x21, 0xcf, 0x64, 0x17, 0x54, 0xc2, 0xd0, 0xfd, 0xb3, 0x06, 0x0b, 0x5c, 0x28,
+    0xe1, 0x36, 0x04, 0xb6, 0xce, 0x5c, 0x3b, 0x8e, 0x86, 0xa4, 0x16, 0x8f, 0x79, 0x2e, 0xcd, 0x8a,
+    0x5d, 0x93, 0x8a, 0x59, 0x00, 0x8d, 0xac, 0x12, 0x9f, 0x8a, 0xb3, 0x63, 0xe8, 0x6c, 0x3d, 0x0b,
+    0x7d, 0xf3, 0x89, 0x5d, 0xa8, 0xb5, 0x82, 0xf2, 0x37, 0x7d, 0x4a, 0xa6, 0x0c, 0xa8, 0x56, 0xa8,
+    0x91, 0x65, 0x85, 0xdc, 0xb7, 0xcd, 0x72, 0xea, 0xc1, 0x24, 0xe5, 0x56, 0x3a, 0x5f, 0xd1, 0xd4,
+    0x59, 0x49, 0xd1, 0x89, 0x8f, 0xff, 0x32, 0x8f, 0xa4, 0x0b, 0xeb, 0xca, 0x4d, 0xdb, 0x56, 0xd9,
+    0xc7, 0x25, 0x4e, 0x10, 0x5a, 0x03, 0x8e, 0xe2, 0x85, 0xbf, 0x69, 0xbb, 0x7d, 0xd6, 0x74, 0xa4,
+    0x69, 0xe1, 0xbf, 0xc0, 0xf1, 0xa0, 0x6f, 0x8f, 0xa4, 0x93, 0x64, 0x7e, 0x77, 0x72, 0x19, 0x4d,
+    0x81, 0x26, 0x28, 0x9a, 0xad, 0xc1, 0xc9, 0x84, 0x7e, 0xc5, 0x29, 0xb7, 0x00, 0x6b, 0xfd, 0xfa,
+    0xb0, 0x58, 0xc7, 0xb6, 0x64, 0x53, 0x38, 0x56, 0x8b, 0xa6, 0x20, 0xdb, 0x0b, 0x6a, 0x25, 0xa2,
+    0xe6, 0xac, 0x10, 0xe8, 0x72, 0x98, 0xbe, 0xb8, 0x15, 0x2d, 0xf9, 0x95, 0x9f, 0xab, 0x50, 0x46,
+    0xd2, 0x82, 0xea, 0x18, 0xc7, 0x34, 0x16, 0x01, 0xf9, 0x66, 0xc7, 0x19, 0xe1, 0x50, 0x14, 0x67,
+    0xf2, 0x3e, 0x76, 0x49, 0x83, 0xa6, 0xb0, 0x95, 0x69, 0xfa, 0x12, 0x05, 0xb1, 0x6c, 0xd6, 0x4c,
+    0xb8, 0xd0, 0x0f, 0xdc, 0xea, 0x1c, 0xab, 0x67, 0x23, 0x0c, 0x7a, 0xcd, 0x60, 0xd8, 0x38, 0x6c,
+    0x58, 0xf8, 0x35, 0x73, 0xac, 0xfb, 0xd0, 0xbc, 0x9d, 0xe3, 0x9d, 0x84, 0x86, 0x9d, 0x22, 0x74,
+    0xf5, 0xe0, 0x60, 0xd4, 0x9b, 0xfe, 0x6b, 0x2e, 0xb0, 0xa7, 0x5c, 0xe7, 0x8e, 0xf1, 0x76, 0x48,
+    0xe1, 0x4c, 0xf4, 0xdd, 0xb5, 0x83, 0x12, 0x89, 0xf2, 0x3c, 0xd3, 0x5c, 0x5a, 0x26, 0x96, 0x08,
+    0xa6, 0xce, 0x95, 0x2b, 0x1b, 0x60, 0xc0, 0x24, 0x5a, 0x79, 0x48, 0x61, 0xdf, 0x57, 0x52, 0xed,
+    0x3c, 0xe2, 0xd9, 0x92, 0x06, 0x83, 0x80, 0x7c, 0xa1, 0x4a, 0x18, 0xa7, 0xbb, 0x4f, 0x64, 0x08,
+    0x61, 0x69, 0x88, 0x35, 0x98, 0xfc, 0x1c, 0xe3, 0x90, 0xaa, 0xb4, 0xbe, 0x60, 0xb5, 0xbc, 0x1d,
+    0x01, 0xf2, 0xed, 0x21, 0xb4, 0x12, 0xfa, 0xc6, 0xb0, 0xec, 0x42, 0xd4, 0x19, 0xa8, 0xa0, 0x5a,
+    0xf6, 0xf1, 0xb8, 0x72, 0xbf, 0xd0, 0xa2, 0xe6, 0x3e, 0xeb, 0xdb, 0xf7, 0x87, 0x26, 0xc6, 0xfd,
+    0xd5, 0xf6, 0xac, 0xb4, 0x95, 0x26, 0x36, 0x35, 0x79, 0x7c, 0xc3, 0x86, 0xd7, 0x6a, 0x41, 0x2e,
+    0x03, 0x52, 0x14, 0x09, 0xee, 0x40, 0xad, 0x0c, 0x78, 0x00, 0x6c, 0xaf, 0xc4, 0x58, 0x45, 0x5e,
+    0xe9, 0x5d, 0xfa, 0x25, 0x73, 0x56, 0xf5, 0x41, 0x73, 0xee, 0x65, 0x48, 0x5a, 0x06, 0xde, 0xca,
+    0x5b, 0xc4, 0xde, 0x43, 0xc5, 0x9e, 0xa9, 0x90, 0x58, 0x5a, 0xd3, 0x7c, 0xad, 0x34, 0xf5, 0xf1,
+    0xf7, 0x88, 0x7a, 0x80, 0x5d, 0xbf, 0x58, 0xd1, 0x38, 0x41, 0x4a, 0x62, 0xa0, 0x8c, 0xa7, 0x82,
+    0xae, 0x0c, 0x4a, 0xf5, 0x7b, 0xa5, 0x1c, 0x40, 0x36, 0x22, 0xe3, 0x48, 0x06, 0xd3, 0x12, 0x47,
+    0x83, 0xbb, 0x11, 0x2a, 0xbc, 0x93, 0x83, 0xda, 0xce, 0x2c, 0x31, 0xd0, 0x14, 0x5d, 0x03, 0xda,
+    0xc0, 0x40, 0xca, 0x6f, 0x07, 0x0c, 0x61, 0x96, 0x03, 0xb2, 0x6a, 0xed, 0x63, 0xe5, 0xdf, 0x43,
+    0x64, 0x15, 0x85, 0x9e, 0xe7, 0x44, 0x3f, 0x22, 0xf2, 0x2b, 0xa1, 0xa1, 0xa7, 0xc7, 0x5a, 0x4e,
+    0x0d, 0x7a, 0x88, 0x00, 0x55, 0xed, 0x7f, 0x3f, 0x19, 0x4d, 0x22, 0x0c, 0x5d, 0x67, 0xef, 0xa7,
+    0xe4, 0xeb, 0x11, 0xfb, 0x89, 0x9a, 0xa8, 0xb6, 0x2a, 0xf1, 0x3d, 0x73, 0xe4, 0xd1, 0x9f, 0x74,
+    0x79, 0xdf, 0xa5, 0xca, 0xe4, 0x14, 0xba, 0x25, 0x65, 0xbe, 0x28, 0xdf, 0x78, 0xde, 0x83, 0x5d,
+    0x3e, 0x94, 0x47, 0x1c, 0x11, 0x14, 0x46, 0xc5, 0x51, 0xb9, 0xea, 0x9d, 0x8a, 0xe7, 0xb4, 0x4f,
+    0xab, 0x11, 0x86, 0xd2, 0xb4, 0x8e, 0xa6, 0xb4, 0x23, 0xb3, 0x90, 0xf6, 0x51, 0x8c, 0x3c, 0x71,
+    0x67, 0x53, 0x23, 0x15, 0x83, 0x96, 0x24, 0x45, 0x74, 0x73, 0x69, 0x92, 0xce, 0x6a, 0x0f, 0xb4,
+    0x85, 0x9e, 0xa5, 0x76, 0x7e, 0x3f, 0xda, 0x79, 0x2b, 0xec, 0x4e, 0xd7, 0x16, 0xb9, 0x8d, 0x5a,
+    0x42, 0xc0, 0x92, 0xab, 0xf7, 0x0a, 0xa6, 0x25, 0x05, 0x9a, 0xc3, 0xa9, 0x87, 0xcf, 0x4e, 0x48,
+    0x01, 0x45, 0x57, 0xa0, 0xdf, 0xaa, 0x61, 0x67, 0x7c, 0x2b, 0x2e, 0x6c, 0xae, 0x7a, 0xfa, 0x5b,
+    0x49, 0xe9, 0x89, 0x91, 0x1c, 0x53, 0xe6, 0xe1, 0x29, 0xe8, 0x71, 0x8a, 0x9e, 0x92, 0xcf, 0x83,
+    0x4d, 0xb1, 0xf7, 0x49, 0xb9, 0x82, 0x62, 0x2b, 0xc2, 0xe2, 0xa0, 0x89, 0x19, 0x23, 0xfe, 0x50,
+    0xcb, 0xea, 0xf5, 0xcd, 0xc5, 0x20, 0x2c, 0x61, 0xe9, 0x6d, 0x97, 0x66, 0x0d, 0x97, 0x34, 0x2c,
+    0x0f, 0xb9, 0xa4, 0xde, 0xc1, 0x86, 0x9b, 0xa9, 0x3b, 0x0d, 0x0a, 0x7b, 0x99, 0xd2, 0xfb, 0x18,
+    0xee, 0xe0, 0x3d, 0x20, 0xfd, 0xf4, 0xe9, 0xbf, 0x40, 0x88, 0x59, 0xed, 0x57, 0x3b, 0xcf, 0x46,
+    0x01, 0x85, 0xc6, 0xa9, 0x20, 0x49, 0x35, 0x13, 0xa3, 0x7f, 0xf9, 0xf1, 0xdb, 0xd6, 0xd6, 0xbb,
+    0xf7, 0xa1, 0x7c, 0xf2, 0x70, 0xb8, 0xbc, 0x2d, 0xf3, 0x5b, 0x93, 0x69, 0xae, 0x7c, 0x28, 0x92,
+    0x9a, 0x07, 0x45, 0x22, 0x80, 0x5a, 0x46, 0x20, 0x17, 0x11, 0x21, 0xf4, 0xa1, 0x64, 0x6f, 0xa1,
+    0xdb, 0xc4, 0xad, 0x21, 0x82, 0x00, 0x58, 0x53, 0xae, 0xf3, 0x4c, 0xb1, 0x40, 0x32, 0xd3, 0x93,
+    0x29, 0x43, 0xc0, 0x3e, 0x48, 0xa3, 0x9f, 0x18, 0x25, 0x3f, 0x62, 0xa4, 0x1c, 0x27, 0xf1, 0xbb,
+    0x78, 0x3b, 0x9a, 0x5b, 0x51, 0x64, 0xbf, 0x70, 0xe1, 0x25, 0x5f, 0xee, 0xa3, 0x39, 0x4b, 0x6c,
+    0x56, 0xbc, 0xb4, 0xbc, 0xac, 0x79, 0xb8, 0xc7, 0x87, 0xe2, 0x07, 0xee, 0x9b, 0x41, 0xa3, 0x00,
+    0x45, 0xb1, 0xb6, 0xc2, 0x73, 0xb5, 0xc0, 0x86, 0xf8, 0xad, 0xbb, 0x34, 0x9b, 0x90, 0xe4, 0x0a,
+    0x07, 0xa3, 0x6e, 0xac, 0xbb, 0x6e, 0x59, 0x68, 0xa4, 0xaf, 0xbc, 0xe8, 0x8d, 0x69, 0x2c, 0x84,
+    0xf1, 0x72, 0xf3, 0x60, 0x54, 0x37, 0x80, 0xea, 0x3f, 0x46, 0xdd, 0xdf, 0xd4, 0xbb, 0x2d, 0xef,
+    0x78, 0x13, 0x80, 0x4f, 0x2d, 0xd0, 0x69, 0xcf, 0x09, 0x89, 0xa0, 0x16, 0x09, 0x5e, 0x98, 0xd7,
+    0x03, 0x58, 0xc6, 0x50, 0x21, 0xfe, 0x6a, 0xad, 0x59, 0x08, 0x51, 0xae, 0xc7, 0xf1, 0xa7, 0xaa,
+    0x98, 0x85, 0x14, 0x7a, 0x60, 0x68, 0x5f, 0x34, 0xbb, 0x71, 0xc9, 0xc1, 0x9c, 0x04, 0x65, 0x01,
+    0x7d, 0x67, 0x8a, 0x68, 0x8a, 0xe4, 0x07, 0xc2, 0xfa, 0xae, 0xbc, 0x94, 0x84, 0xb7, 0x73, 0x00,
+    0x1a, 0x22, 0xb2, 0xef, 0xd9, 0xa7, 0x90, 0xd9, 0x7b, 0x75, 0xf9, 0x9e, 0xeb, 0x52, 0x40, 0x51,
+    0x7b, 0xde, 0x20, 0x8a, 0x6e, 0xfc, 0xa5, 0xa2, 0x01, 0xf7, 0x02, 0xcf, 0x8e, 0x2b, 0x71, 0x9b,
+    0x13, 0xd1, 0x7c, 0x51, 0xc5, 0xcf, 0x47, 0x57, 0x9f, 0xf6, 0xf5, 0xfa, 0x3c, 0xd9, 0xb6, 0xd8,
+    0x4e, 0x0a, 0x37, 0x93, 0x41, 0xbb, 0xf7, 0x36, 0x43, 0xc0, 0xb8, 0xef, 0xea, 0xda, 0x3b, 0x68,
+    0x69, 0x56, 0xec, 0xc3, 0xc5, 0xe8, 0x96, 0x9e, 0xe3, 0x6d, 0xa7, 0x0c, 0xe4, 0x84, 0x04, 0x03,
+    0xe8, 0xd7, 0x60, 0xc7, 0xde, 0x16, 0xa5, 0x96, 0x62, 0xce, 0xc9, 0x26, 0xc9, 0x96, 0x6a, 0x24,
+    0x8e, 0xf0, 0x89, 0x35, 0x3b, 0x99, 0xda, 0x0a, 0xd6, 0xf4, 0x3d, 0xa6, 0xe7, 0x5a, 0x20, 0xf0,
+    0x30, 0x2d, 0xbb, 0xc4, 0xc3, 0xc5, 0xda, 0x53, 0xad, 0xbf, 0x13, 0x1b, 0x3d, 0x60, 0x2f, 0x6f,
+    0xca, 0x15, 0x5e, 0x1b, 0xea, 0xa2, 0x3a, 0x7b, 0x91, 0xba, 0x22, 0x1b, 0x3b, 0x17, 0x62, 0x20,
+    0x46, 0xda, 0x8e, 0x9d, 0x2b, 0x79, 0xa9, 0xe5, 0x79, 0xf1, 0xe4, 0x1e, 0x91, 0x6f, 0xd2, 0xa6,
+    0x2d, 0x3f, 0x09, 0xbd, 0xa3, 0x8e, 0xf6, 0x58, 0xc6, 0xeb, 0x08, 0xd1, 0x4e, 0x69, 0x62, 0x9b,
+    0xd5, 0x25, 0xe4, 0xfe, 0x1a, 0x2d, 0xb1, 0xbc, 0x15, 0x85, 0x92, 0x77, 0xc1, 0x3b, 0x1a, 0xbb,
+    0x95, 0x67, 0x44, 0x1c, 0x49, 0x34, 0x7f, 0x47, 0xc1, 0x15, 0x88, 0x8a, 0x38, 0x01, 0xd4, 0xee,
+    0xde, 0xe2, 0xb7, 0x3f, 0x4d, 0xea, 0x09, 0x81, 0xf2, 0xf3, 0x0a, 0xa7, 0xf4, 0x4d, 0x7c, 0x97,
+    0xb9, 0x1a, 0xea, 0x8b, 0x62, 0x07, 0x30, 0x0a, 0x15, 0x65, 0x3a, 0x32, 0xf5, 0xc5, 0x17, 0xa9,
+    0xa9, 0x0a, 0x50, 0x74, 0xe2, 0xe2, 0xed, 0xa7, 0x44, 0x7f, 0x00, 0x6e, 0x48, 0xf9, 0x6f, 0xbd,
+    0x15, 0xb1, 0x82, 0xe7, 0x38, 0xdd, 0xfa, 0xda, 0x25, 0xbc, 0x2f, 0xd2, 0x7c, 0x10, 0x08, 0xe9,
+    0xbc, 0x37, 0xb3, 0x99, 0x76, 0xff, 0xd5, 0x3e, 0x07, 0x8f, 0x2d, 0x5c, 0x9d, 0xb2, 0x8c, 0xf8,
+    0xf5, 0x3f, 0x9d, 0x09, 0x1a, 0xbc, 0xc1, 0x38, 0x50, 0xc3, 0x42, 0x09, 0xb9, 0x74, 0x46, 0x6e,
+    0x9e, 0x0f, 0xf0, 0xf4, 0x5d, 0xca, 0x1e, 0xbd, 0xb2, 0x8e, 0xab, 0x73, 0x3a, 0xeb, 0x3b, 0x06,
+    0x40, 0x6c, 0xc7, 0x9e, 0x44, 0xbf, 0x20, 0xc7, 0x31, 0xb4, 0x6a, 0x46, 0x11, 0xde, 0xa0, 0x9e,
+    0xfc, 0xbe, 0x6b, 0xbe, 0xe6, 0xcd, 0xef, 0xe9, 0xd0, 0xe3, 0x8b, 0xf9, 0x7e, 0x19, 0x2f, 0xab,
+    0xf4, 0xb8, 0x6a, 0xad, 0xdd, 0x88, 0xea, 0xdb, 0xe4, 0xfb, 0x7e, 0x6c, 0x47, 0x61, 0xed, 0x3a,
+    0x36, 0x45, 0x71, 0x82, 0xb3, 0x68, 0xcf, 0xae, 0xdf, 0xc8, 0x39, 0x00, 0xe6, 0x62, 0x6b, 0x0f,
+    0x59, 0x35, 0x69, 0x4d, 0xc5, 0xfc, 0xa5, 0xfd, 0x9c, 0x91, 0xef, 0xb3, 0x73, 0x7d, 0x4f, 0x4f,
+    0x85, 0xd3, 0x22, 0xf3, 0xdc, 0xcb, 0xc3, 0xd7, 0x5c, 0xbf, 0xdc, 0xf7, 0x27, 0xd7, 0xb8, 0x33,
+    0x7f, 0x6d, 0xa5, 0xd7, 0xd7, 0x6b, 0x15, 0xc7, 0xaa, 0xfb, 0xb6, 0x0e, 0x7c, 0x3e, 0x4e, 0x82,
+    0xb8, 0x6c, 0x5f, 0x95, 0xfb, 0xa0, 0x64, 0x42, 0xdc, 0x0c, 0xc1, 0x71, 0x2e, 0xa3, 0xe5, 0xa6,
+    0x36, 0xc8, 0x33, 0xc1, 0xe2, 0x23, 0x95, 0xb5, 0xee, 0x69, 0x9d, 0x74, 0x0d, 0x5f, 0x87, 0x0f,
+    0x41, 0x20, 0x5b, 0x11, 0x43, 0x4c, 0xa7, 0x9a, 0x22, 0x23, 0xe2, 0x08, 0x65, 0xe6, 0xde, 0x1a,
+    0xa6, 0xbf, 0x8e, 0x96, 0x87, 0xfd, 0x79, 0xfd, 0xea, 0xcc, 0x2c, 0x5b, 0xb0, 0xfb, 0xe8, 0xfb,
+    0x18, 0xc7, 0xba, 0x32, 0x27, 0x8e, 0x19, 0x95, 0x82, 0x82, 0xc8, 0x98, 0xe6, 0xf0, 0x84, 0x78,
+    0x45, 0xce, 0xcb, 0xe7, 0x82, 0xa2, 0xa0, 0x24, 0xf0, 0x08, 0x1e, 0xfa, 0x48, 0x1e, 0x18, 0x24,
+    0x60, 0x7c, 0x6b, 0xb4, 0xab, 0xdd, 0xd0, 0xcd, 0xdc, 0x53, 0x76, 0x8a, 0xc1, 0x1a, 0x95, 0xef,
+    0x9e, 0xde, 0x83, 0x8f, 0x10, 0xe8, 0x87, 0x58, 0xe5, 0x53, 0xbb, 0x88, 0xca, 0x5b, 0xe6, 0xd1,
+    0xb4, 0xb3, 0xcf, 0x97, 0x52, 0xdd, 0x05, 0xcf, 0x83, 0xdf, 0x65, 0xa0, 0x6d, 0xe3, 0xf0, 0x02,
+    0xd8, 0xb9, 0x4f, 0x02, 0x13, 0x69, 0xf1, 0x6d, 0x04, 0x45, 0x6d, 0xa2, 0x23, 0x6d, 0x7c, 0x9b,
+    0xdd, 0xe7, 0x89, 0x8f, 0xe3, 0xeb, 0xd6, 0xc5, 0x4c, 0xf0, 0x55, 0x14, 0x3f, 0xff, 0x7a, 0xcc,
+    0x09, 0x2d, 0xa3, 0x5e, 0xe2, 0x43, 0xfe, 0x24, 0xdf, 0xc9, 0x46, 0x26, 0xd7, 0x85, 0xef, 0x88,
+    0x4c, 0x83, 0x89, 0x13, 0xeb, 0xfd, 0x70, 0xbe, 0x8d, 0xd4, 0xe4, 0x22, 0x36, 0x80, 0x27, 0x9e,
+    0x61, 0xaa, 0xbe, 0xef, 0x8b, 0x4e, 0x5c, 0xeb, 0x43, 0x15, 0x0b, 0x69, 0x53, 0x09, 0x34, 0x3d,
+    0x5c, 0xb4, 0x0c, 0x66, 0xff, 0x23, 0x85, 0x61, 0x8c, 0x84, 0x9d, 0x03, 0x25, 0xd9, 0x4a, 0x16,
+    0x68, 0xc6, 0x2f, 0xaf, 0x05, 0xb4, 0xa7, 0x14, 0x51, 0x5d, 0x85, 0x4c, 0x75, 0x4d, 0x62, 0x0b,
+    0xc0, 0x64, 0x76, 0x21, 0xcf, 0x68, 0x28, 0x10, 0x2c, 0x23, 0x05, 0x88, 0x45, 0x4c, 0xa0, 0xea,
+    0xcb, 0x64, 0x46, 0xfa, 0xc8, 0x87, 0x42, 0xc6, 0x7a, 0x14, 0x89, 0x51, 0xd0, 0x15, 0xb1, 0x0d,
+    0xa2, 0x82, 0x84, 0x61, 0xc7, 0xef, 0xda, 0xd3, 0x16, 0x47, 0x37, 0x0b, 0xc4, 0xb5, 0x27, 0xde,
+    0x3c, 0x74, 0x60, 0xbb, 0xec, 0x16, 0xc3, 0x63, 0xec, 0x83, 0x71, 0x37, 0xc3, 0xbe, 0xbb, 0x13,
+    0x1e, 0x17, 0x04, 0xa7, 0x2f, 0xd3, 0xf6, 0x05, 0x80, 0x26, 0xce, 0x93, 0x64, 0x7b, 0xef, 0xc6,
+    0x6a, 0x4a, 0x0c, 0x86, 0x94, 0x11, 0xaf, 0x41, 0xe6, 0x04, 0xc5, 0x7c, 0xf3, 0xde, 0x15, 0xa0,
+    0x57, 0xc1, 0x6e, 0xc6, 0x3e, 0x7e, 0xcf, 0xeb, 0x06, 0x60, 0x14, 0x4f, 0xae, 0xeb, 0x6e, 0xc5,
+    0x03, 0xea, 0xd9, 0x15, 0xed, 0xb0, 0x61, 0x5a, 0xfb, 0xbb, 0x85, 0x95, 0x4f, 0x0c, 0x69, 0x61,
+    0x58, 0x25, 0x5d, 0x14, 0x55, 0x7b, 0xda, 0xbb, 0x9e, 0x94, 0x3d, 0x03, 0x14, 0x0e, 0x48, 0x57,
+    0x80, 0xbe, 0xd8, 0x9f, 0x3f, 0x35, 0x64, 0x4a, 0x5f, 0x51, 0x9b, 0xd3, 0x4f, 0x3e, 0x0b, 0xaf,
+    0x17, 0x3b, 0x98, 0x7f, 0x62, 0xe7, 0xa1, 0x54, 0xba, 0x0f, 0xd9, 0x77, 0xd4, 0x9d, 0x3d, 0xf4,
+    0x49, 0xb3, 0x81, 0x2d, 0x14, 0x35, 0x5a, 0x12, 0x31, 0x6d, 0xdd, 0x03, 0xcc, 0xa5, 0xd6, 0x6a,
+    0x52, 0x99, 0x15, 0x35, 0xc6, 0xd0, 0xae, 0xa1, 0xac, 0x04, 0x9e, 0xc0, 0xd4, 0x92, 0x0f, 0x1e,
+    0x78, 0x73, 0x6b, 0xaf, 0xa1, 0x86, 0xb7, 0xd5, 0x90, 0xb7, 0xa5, 0xb0, 0xf9, 0xd1, 0x28, 0xfe,
+    0x08, 0x53, 0xd1, 0x7e, 0x53, 0xdd, 0x1d, 0x06, 0xe7, 0x74, 0x00, 0x6c, 0xf4, 0x2d, 0x14, 0x00,
+    0xa0, 0xb6, 0xe2, 0x49, 0x03, 0xdb, 0x66, 0x60, 0x33, 0xcf, 0x5b, 0x1d, 0xcd, 0x1a, 0xf2, 0xe7,
+    0x5f, 0x45, 0x28, 0xb8, 0xef, 0xb2, 0x67, 0x48, 0x0b, 0x83, 0xb2, 0x62, 0x3e, 0x9e, 0xb1, 0xfe,
+    0xe4, 0xc8, 0xca, 0x14, 0x2f, 0x99, 0x21, 0x2a, 0xf6, 0x13, 0xe2, 0xc0, 0xa3, 0xec, 0x6c, 0x7a,
+    0x70, 0xe2, 0x30, 0xa1, 0xa9, 0xcb, 0x0e, 0x7c, 0x28, 0x7c, 0x1b, 0x80, 0x99, 0x64, 0xd8, 0xdb,
+    0xad, 0xdd, 0xb0, 0x37, 0xab, 0xdc, 0x56, 0x3f, 0xa9, 0x32, 0x60, 0x38, 0x74, 0xbc, 0xfc, 0xe0,
+    0xbb, 0xe0, 0x9e, 0x0c, 0x39, 0xcc, 0xfc, 0xad, 0x51, 0x37, 0x21, 0x60, 0x44, 0xaf, 0x04, 0x96,
+    0xbb, 0x6d, 0x17, 0x9b, 0x29, 0x45, 0x84, 0x5e, 0x3b, 0xf8, 0xaa, 0x70, 0x2a, 0xff, 0xc8, 0xd8,
+    0xd6, 0x75, 0xb6, 0x42, 0xeb, 0xa9, 0x44, 0xcc, 0x38, 0xb5, 0x61, 0x7a, 0x04, 0xd7, 0x8e, 0x3a,
+    0x7c, 0x74, 0x3e, 0x29, 0xbb, 0x8a, 0x00, 0x70, 0x69, 0xbf, 0x61, 0x65, 0x38, 0xb8, 0x79, 0x8f,
+    0x8d, 0x77, 0x93, 0xb2, 0x76, 0x83, 0xda, 0x3e, 0x90, 0x73, 0xde, 0x88, 0xd4, 0xc4, 0x53, 0x1f,
+    0xdf, 0x8d, 0xea, 0x80, 0x0a, 0xbb, 0x9d, 0x5a, 0x4e, 0x08, 0xeb, 0x4d, 0x5c, 0x3b, 0xd8, 0x57,
+    0x18, 0x18, 0x7a, 0x36, 0x1d, 0xe3, 0x2a, 0x33, 0xca, 0x4e, 0x44, 0xd7, 0x4a, 0xd2, 0x0a, 0x20,
+    0xeb, 0x92, 0x91, 0x16, 0x23, 0x42, 0xe1, 0x03, 0x5f, 0xe4, 0x1c, 0x3b, 0xe9, 0xa9, 0x88, 0x9f,
+    0x3b, 0xf2, 0x9e, 0xf4, 0x62, 0x66, 0x26, 0xcd, 0xa5, 0xb7, 0x5c, 0x50, 0x80, 0x0d, 0x7e, 0x91,
+    0x45, 0xc5, 0xf0, 0xbc, 0xfc, 0xa8, 0xa4, 0x98, 0x22, 0x25, 0x50, 0x5c, 0x88, 0x01, 0xf1, 0x6a,
+    0x67, 0x25, 0xf9, 0xfb, 0xa1, 0x87, 0x74, 0xe5, 0x65, 0x61, 0x5e, 0x9d, 0x2e, 0xb1, 0xb8, 0xa1,
+    0x83, 0xdd, 0x0e, 0x11, 0xf2, 0xe2, 0x9b, 0x33, 0x88, 0x87, 0xd6, 0x15, 0x1b, 0x03, 0xe2, 0xb8,
+    0xbe, 0x5b, 0xbc, 0xc4, 0x78, 0x0e, 0xa5, 0xeb, 0x48, 0x55, 0x83, 0x1b, 0x64, 0x0c, 0x21, 0xa3,
+    0x99, 0x43, 0xcd, 0xc6, 0xa5, 0xc6, 0x4d, 0x5f, 0x22, 0x33, 0x97, 0x5a, 0xfb, 0xde, 0x80, 0x1d,
+    0xf6, 0xa7, 0xb6, 0x84, 0xc7, 0x02, 0xa8, 0x92, 0x41, 0xa7, 0xfa, 0x8a, 0x3e, 0x0c, 0xa1, 0xd5,
+    0x1a, 0x57, 0xa3, 0x6c, 0xbf, 0x18, 0x1a, 0xca, 0x49, 0x5f, 0xbd, 0x0e, 0xd3, 0x83, 0xb1, 0x4d,
+    0x06, 0x86, 0x94, 0x54, 0x30, 0x4c, 0x1f, 0x0d, 0x72, 0xef, 0x05, 0x74, 0x40, 0x34, 0xcf, 0x22,
+    0x70, 0x90, 0x40, 0xe9, 0xc1, 0xd2, 0xd7, 0x23, 0x26, 0x5f, 0xdf, 0x4d, 0xf6, 0x65, 0x5e, 0x7e,
+    0x5b, 0xdf, 0x64, 0x3c, 0xdf, 0x47, 0x7c, 0x23, 0x05, 0xa9, 0xaa, 0xdd, 0x8e, 0x4b, 0x46, 0x04,
+    0x83, 0xc0, 0xe7, 0x35, 0x40, 0xdb, 0x27, 0x11, 0x80, 0x28, 0xa8, 0xc5, 0xf7, 0x78, 0x2c, 0xf6,
+    0x88, 0xc0, 0x9f, 0x19, 0xfc, 0x06, 0xc8, 0x0e, 0xbd, 0x1a, 0xe2, 0x6d, 0x17, 0x28, 0xc3, 0x2c,
+    0xd0, 0xda, 0xbc, 0x34, 0xe3, 0xfd, 0xc8, 0x67, 0xa6, 0x07, 0xa6, 0x1c, 0xa6, 0x2a, 0xaa, 0x9b,
+    0xc8, 0xba, 0xa1, 0x65, 0xa6, 0x9a, 0x41, 0x30, 0xfe, 0x7f, 0x1b, 0xb9, 0xae, 0x6e, 0x45, 0x91,
+    0x2d, 0xfc, 0x7e, 0x7e, 0x05, 0xcb, 0x35, 0x33, 0xe2, 0xe5, 0xb4, 0x60, 0xc6, 0x3e, 0xa1, 0x97,
+    0x0a, 0x18, 0x31, 0x00, 0x86, 0x73, 0x9e, 0x06, 0x25, 0x2a, 0x41, 0x09, 0xa2, 0xf6, 0xea, 0xff,
+    0x7e, 0x77, 0x15, 0x18, 0xba, 0xa7, 0x6f, 0xf0, 0x41, 0xca, 0xda, 0xb1, 0x76, 0xa2, 0x7c, 0xf9,
+    0x04, 0xa6, 0x34, 0x1c, 0xcb, 0x43, 0x77, 0x19, 0xaa, 0x8b, 0xfa, 0x69, 0xfe, 0xa1, 0xd1, 0xe3,
+    0x13, 0x25, 0xa9, 0x7a, 0x99, 0x13, 0x0d, 0x46, 0x50, 0xe0, 0x2a, 0xdc, 0x9a, 0x41, 0x90, 0x45,
+    0x4d, 0x68, 0x45, 0xb2, 0xe5, 0xed, 0xeb, 0x91, 0xdc, 0xeb, 0xf3, 0xd1, 0x8c, 0xdd, 0xc4, 0xf4,
+    0xf6, 0xec, 0x50, 0xb4, 0x0c, 0x7f, 0x26, 0xf7, 0xbc, 0x79, 0xec, 0x73, 0xf5, 0x61, 0x70, 0x8c,
+    0x22, 0xff, 0xd0, 0x94, 0x2a, 0x92, 0xaf, 0x5a, 0xd2, 0xbe, 0x35, 0x9a, 0xb5, 0xd8, 0x85, 0x64,
+    0x7e, 0x9c, 0x77, 0x6d, 0x3b, 0xf0, 0x06, 0xed, 0x4b, 0x89, 0x86, 0x7b, 0x57, 0xd0, 0x3e, 0x59,
+    0xe5, 0x53, 0xb4, 0x8b, 0x6b, 0xf5, 0x2e, 0xfd, 0x19, 0x0b, 0xf5, 0x83, 0x58, 0xa2, 0x47, 0x35,
+    0xbe, 0xa9, 0xc6, 0x5d, 0xd6, 0x55, 0x8c, 0xa9, 0x41, 0xb1, 0x32, 0xdd, 0x62, 0x96, 0x52, 0x67,
+    0x70, 0x92, 0xa5, 0xe3, 0xd2, 0xe3, 0xc6, 0xad, 0x4f, 0xff, 0x6c, 0x24, 0xeb, 0x5d, 0xff, 0xe8,
+    0x2f, 0xe8, 0x45, 0xe3, 0xa3, 0xd1, 0x6a, 0x53, 0xbc, 0xd8, 0x9b, 0xf6, 0x26, 0xe7, 0x9d, 0xa0,
+    0xd2, 0x5d, 0x9a, 0x97, 0x9b, 0x23, 0xc6, 0x8d, 0xf6, 0x93, 0xed, 0x58, 0x11, 0xa6, 0x0c, 0x33,
+    0x64, 0xd5, 0xc1, 0x2c, 0x2a, 0x33, 0x53, 0xfa, 0x5c, 0x0f, 0xab, 0x95, 0x8d, 0xa6, 0x5e, 0xe0,
+    0x8f, 0xf7, 0xc6, 0x32, 0x0e, 0xbb, 0x46, 0x8d, 0xb3, 0x96, 0xde, 0xb2, 0x17, 0x48, 0x9c, 0xd8,
+    0x6d, 0xaa, 0x93, 0x6e, 0x27, 0x74, 0xb9, 0x83, 0xd0, 0xac, 0x7e, 0x1c, 0xe6, 0x75, 0x79, 0xd1,
+    0x65, 0x3b, 0x33, 0xb8, 0x7a, 0xf2, 0x89, 0x49, 0xe9, 0x6e, 0x93, 0x1e, 0x2f, 0x1b, 0x4c, 0xb7,
+    0xd9, 0x72, 0xd8, 0x12, 0xdc, 0x0e, 0x03, 0xb6, 0xbc, 0xd5, 0x99, 0xee, 0x6e, 0x35, 0x5b, 0xf9,
+    0x97, 0x71, 0xd2, 0xaa, 0xac, 0xd5, 0xa9, 0xba, 0x55, 0x5b, 0x73, 0xa6, 0xb7, 0xee, 0xdb, 0xb2,
+    0x79, 0x89, 0x4e, 0x3a, 0x35, 0xfd, 0x94, 0x9a, 0xc3, 0x0d, 0x25, 0x27, 0x15, 0x45, 0x5d, 0x8e,
+    0xdb, 0xab, 0xbd, 0xe6, 0x96, 0xc2, 0x2e, 0xb5, 0xd0, 0xc3, 0x8a, 0xde, 0x1a, 0x6f, 0xcc, 0x8b,
+    0xb0, 0x11, 0xb9, 0xf9, 0xb2, 0x3b, 0x10, 0x65, 0x76, 0x69, 0x2e, 0xda, 0x5e, 0x28, 0x7d, 0xee,
+    0xd6, 0x95, 0x51, 0x22, 0xcd, 0xa2, 0x79, 0x9b, 0x8b, 0xc5, 0xc8, 0xf2, 0x16, 0xc9, 0x7a, 0x52,
+    0xe6, 0x95, 0x66, 0xb3, 0x3f, 0xbe, 0xd4, 0x77, 0x4b, 0x56, 0xd0, 0x1d, 0x67, 0x71, 0x2c, 0x1b,
+    0x73, 0xf6, 0x42, 0xb9, 0xc2, 0xbc, 0xb2, 0x9d, 0xcf, 0x50, 0x65, 0xa8, 0xfd, 0x99, 0x65, 0x45,
+    0xa5, 0xfa, 0x41, 0x99, 0xf0, 0x70, 0x6d, 0x15, 0x05, 0xb8, 0x8a, 0x7f, 0xfa, 0x7a, 0x47, 0x18,
+    0x1a, 0x1d, 0x97, 0xed, 0xf7, 0x22, 0xdb, 0xab, 0x0a, 0xf4, 0x99, 0x6d, 0x6a, 0xfb, 0xc0, 0x17,
+    0xb8, 0x19, 0x7f, 0x54, 0xdd, 0x90, 0x9b, 0x9d, 0x3a, 0x5e, 0xe9, 0xe8, 0x29, 0xf5, 0x78, 0xb0,
+    0x9d, 0x56, 0x2a, 0x0d, 0xc9, 0xaa, 0x8a, 0xea, 0x92, 0xa3, 0xc3, 0xc0, 0xfe, 0x54, 0xca, 0x27,
+    0xaf, 0x33, 0x9b, 0x8a, 0x49, 0xc7, 0x6c, 0xcd, 0xb5, 0x7d, 0x28, 0xd0, 0xcb, 0x0e, 0x3d, 0xd9,
+    0xf7, 0xe4, 0xba, 0x28, 0xc8, 0xcd, 0x39, 0xeb, 0x38, 0x71, 0xab, 0xeb, 0x76, 0xa9, 0xf5, 0xa8,
+    0x3a, 0xb0, 0x25, 0x7a, 0xe4, 0x8f, 0x4a, 0x33, 0xd3, 0xab, 0xd0, 0x30, 0x73, 0x9a, 0x23, 0xc9,
+    0xed, 0x50, 0x49, 0xa8, 0x1a, 0xdb, 0x89, 0xe4, 0x5e, 0x4a, 0x47, 0xb3, 0x47, 0x73, 0xb3, 0xcd,
+    0xb4, 0x79, 0xda, 0x94, 0xba, 0x97, 0xfd, 0x65, 0xd8, 0x2e, 0x4d, 0x0f, 0xc6, 0x4c, 0x3a, 0xf1,
+    0xac, 0x77, 0x91, 0xf9, 0xfe, 0xac, 0x56, 0x61, 0x99, 0x55, 0x68, 0x7e, 0xc4, 0x83, 0x41, 0x75,
+    0xa0, 0x4c, 0x0e, 0xc7, 0xdd, 0x69, 0x63, 0x9c, 0x85, 0x73, 0x69, 0x3e, 0x94, 0xd8, 0x68, 0x75,
+    0x0a, 0x98, 0xc9, 0x48, 0xe0, 0xab, 0xba, 0xb8, 0xa2, 0x2f, 0xca, 0x82, 0x72, 0xf4, 0x2a, 0x23,
+    0x9e, 0xb8, 0xfa, 0xa7, 0x5d, 0x1f, 0x6b, 0x8c, 0xe1, 0x36, 0x4b, 0x2c, 0xcb, 0x5d, 0x0e, 0x4d,
+    0xed, 0xd8, 0xb7, 0x94, 0xf6, 0x66, 0x74, 0xe0, 0x23, 0x87, 0xea, 0x4c, 0x2b, 0xc7, 0xb6, 0x66,
+    0xfb, 0x9e, 0x68, 0xb7, 0xb9, 0xde, 0x64, 0x2d, 0xcd, 0x2e, 0x94, 0x32, 0x29, 0x33, 0xc3, 0xb8,
+    0x2e, 0xaa, 0x17, 0xbe, 0x0d, 0xaf, 0xdb, 0xe8, 0x64, 0x2e, 0xf6, 0xd1, 0xac, 0x3a, 0xd4, 0x05,
+    0xeb, 0x23, 0x59, 0xd2, 0xe2, 0x88, 0xb2, 0x2d, 0xd9, 0x2f, 0xfb, 0x0e, 0x9d, 0x34, 0x61, 0x5a,
+    0x38, 0xc9, 0x76, 0xa4, 0x99, 0xb1, 0xbb, 0x55, 0xcd, 0xfe, 0xa5, 0x6a, 0x4c, 0xbd, 0x68, 0x4b,
+    0x33, 0x06, 0x3d, 0xa1, 0xd7, 0x1d, 0x61, 0xdf, 0x5e, 0xce, 0x97, 0x94, 0x69, 0xd8, 0xdd, 0xf9,
+    0x67, 0x4f, 0x2d, 0xd7, 0x14, 0x41, 0x9e, 0x33, 0x35, 0x41, 0x4a, 0x22, 0x31, 0xe9, 0x0b, 0xe2,
+    0xc7, 0xc8, 0xeb, 0xd1, 0xeb, 0x59, 0xbf, 0x4d, 0xb9, 0x6b, 0x79, 0xcc, 0x2a, 0x0b, 0xc7, 0xdf,
+    0xed, 0xa3, 0xb5, 0x65, 0x6e, 0x12, 0x41, 0x14, 0xbc, 0x95, 0x77, 0x5c, 0x4d, 0x29, 0x75, 0x2d,
+    0x4b, 0x9d, 0xee, 0x9c, 0x4e, 0xe6, 0xdd, 0x55, 0x63, 0xae, 0x1e, 0x2a, 0xfd, 0xe6, 0x76, 0x6c,
+    0xc3, 0x1f, 0x9d, 0xe5, 0x7c, 0x2a, 0x5a, 0xf2, 0xce, 0xf7, 0x3c, 0x55, 0x1c, 0x7b, 0xed, 0x59,
+    0x59, 0xa8, 0x85, 0xdc, 0x39, 0x29, 0x5d, 0x26, 0xc3, 0x8b, 0x3c, 0x4d, 0x64, 0x6f, 0x33, 0x3e,
+    0x35, 0xa9, 0x73, 0x59, 0xfa, 0x98, 0xed, 0x47, 0x3b, 0x85, 0xef, 0x8c, 0xec, 0xbd, 0x39, 0x63,
+    0x76, 0xe5, 0x35, 0xc5, 0x9f, 0xa7, 0xc9, 0xc2, 0xae, 0xad, 0x0f, 0xe3, 0x98, 0x6b, 0xb6, 0xb6,
+    0x35, 0x6b, 0x30, 0xe6, 0x6a, 0x4b, 0x89, 0x83, 0x1a, 0xd9, 0x7d, 0xca, 0x53, 0xee, 0x14, 0x69,
+    0xae, 0xf5, 0xd9, 0xd7, 0x69, 0xaa, 0x31, 0xb6, 0x17, 0x1a, 0x5f, 0x8e, 0x0e, 0xd4, 0xea, 0xd4,
+    0xa6, 0x1a, 0xcc, 0x42, 0x8d, 0x36, 0x7d, 0xad, 0xe7, 0x58, 0xb1, 0xac, 0x34, 0x0e, 0xec, 0x6a,
+    0xa4, 0x73, 0xd2, 0x90, 0x33, 0xc2, 0xda, 0xda, 0x68, 0xf2, 0xad, 0x53, 0x58, 0x8e, 0xb6, 0x51,
+    0x2d, 0x71, 0xcc, 0x8b, 0xd5, 0xa0, 0x3b, 0xec, 0x4a, 0xb9, 0x9c, 0x4b, 0xbb, 0x29, 0xaf, 0xc6,
+    0x4a, 0xdf, 0xb3, 0x8f, 0xee, 0xf1, 0xb0, 0xea, 0x30, 0xec, 0xf4, 0xec, 0xa8, 0x65, 0x49, 0xdb,
+    0x52, 0x9d, 0xa5, 0xa0, 0xf0, 0x7d, 0x91, 0xea, 0xad, 0xcf, 0xda, 0x38, 0x6c, 0xc1, 0x88, 0x8f,
+    0x62, 0x61, 0x48, 0x09, 0x2d, 0xaa, 0xc7, 0xf5, 0xba, 0x5a, 0xb9, 0xb1, 0x62, 0xcf, 0x4d, 0x0e,
+    0xe2, 0x2c, 0xb4, 0xeb, 0x23, 0x69, 0xd0, 0x62, 0x22, 0x6e, 0x95, 0x60, 0xec, 0x8c, 0x81, 0x34,
+    0xaf, 0xf1, 0xc1, 0x6e, 0x60, 0x9a, 0xe6, 0xdb, 0xdb, 0xaf, 0xa8, 0x20, 0x29, 0xb0, 0xc8, 0x23,
+    0x08, 0x50, 0x15, 0xe1, 0xd1, 0xfc, 0x0a, 0x52, 0x83, 0x51, 0x9c, 0xae, 0x88, 0x24, 0x29, 0xe8,
+    0x4b, 0x0a, 0x25, 0xf3, 0xba, 0x7f, 0xff, 0xf0, 0xe3, 0x80, 0x80, 0xbb, 0xb1, 0x9e, 0xa8, 0x67,
+    0x84, 0x8a, 0x84, 0x81, 0x8d, 0xfc, 0xc0, 0xd1, 0x10, 0xa0, 0x91, 0xa5, 0xba, 0x04, 0x42, 0xcb,
+    0xf1, 0x5f, 0xe9, 0x7d, 0x26, 0x9e, 0x41, 0x19, 0xa5, 0xe8, 0x27, 0x61, 0xbc, 0x76, 0xed, 0x28,
+    0xf7, 0x2e, 0xab, 0x47, 0xfd, 0x95, 0x4e, 0x49, 0x08, 0xb2, 0x05, 0x21, 0xca, 0xc0, 0x33, 0xdc,
+    0x04, 0xf6, 0x3e, 0x7a, 0x37, 0xf4, 0x68, 0x63, 0x91, 0x39, 0x3a, 0xdc, 0xa8, 0x5e, 0xae, 0x50,
+    0x04, 0x0b, 0x1e, 0x19, 0xe8, 0x21, 0xf1, 0xf6, 0x4e, 0xc0, 0xa3, 0x08, 0xb7, 0x30, 0x8f, 0x2c,
+    0x64, 0xfb, 0x08, 0xe3, 0x04, 0x11, 0xbe, 0x67, 0x20, 0x3e, 0x5e, 0x18, 0x11, 0xc0, 0x49, 0x68,
+    0xfe, 0x26, 0x46, 0x10, 0x55, 0x45, 0x53, 0x8f, 0xf8, 0x14, 0xad, 0xaa, 0x7d, 0xee, 0x6b, 0x64,
+    0x8a, 0x2c, 0x53, 0x48, 0x11, 0x73, 0xc2, 0xa2, 0xed, 0x79, 0x7a, 0xd0, 0x53, 0xc4, 0x11, 0x88,
+    0xe4, 0x72, 0xe9, 0x2e, 0x52, 0x59, 0x04, 0x8f, 0x78, 0x15, 0xbc, 0xf0, 0xee, 0xca, 0xef, 0x06,
+    0xfc, 0x47, 0x03, 0x9b, 0x40, 0x87, 0x68, 0x64, 0x36, 0xc8, 0x5c, 0x8a, 0x43, 0x73, 0xb5, 0x80,
+    0x3e, 0x7e, 0xf1, 0xa8, 0x3a, 0xb1, 0x0e, 0x32, 0x5e, 0x11, 0x59, 0x7f, 0xa4, 0x20, 0x8c, 0x97,
+    0x1b, 0x81, 0xa0, 0x88, 0x1c, 0x41, 0xe6, 0xe0, 0xe1, 0x15, 0x03, 0xd8, 0xc0, 0xbf, 0xb5, 0xb6,
+    0x8b, 0x76, 0x48, 0x60, 0xd1, 0x37, 0xc4, 0x1b, 0xb8, 0xe9, 0xef, 0x11, 0x80, 0xcc, 0x37, 0x22,
+    0xf7, 0x4c, 0xa4, 0xcb, 0xaf, 0xe0, 0x7a, 0x01, 0x31, 0x17, 0x72, 0x77, 0xdd, 0x61, 0x51, 0xd5,
+    0x34, 0xd2, 0xcf, 0x60, 0xc6, 0x0a, 0x4f, 0x3f, 0x0a, 0xc5, 0x8d, 0x8a, 0xe2, 0x4a, 0x16, 0xee,
+    0x47, 0xfa, 0x1f, 0x51, 0xfa, 0x39, 0x3c, 0x19, 0x10, 0xcf, 0x3b, 0x1f, 0x04, 0x7e, 0x40, 0x38,
+    0xbe, 0x8a, 0x20, 0x90, 0x08, 0x2f, 0x45, 0xf4, 0x09, 0x6f, 0x08, 0x3c, 0x39, 0x30, 0xf5, 0x4a,
+    0x67, 0xa9, 0x7c, 0xba, 0x25, 0x15, 0xec, 0xd1, 0x34, 0xd1, 0xd5, 0x23, 0x84, 0x34, 0x15, 0x20,
+    0xec, 0x2c, 0xc7, 0xdf, 0xa8, 0x0e, 0x81, 0x40, 0x72, 0x08, 0x23, 0xf0, 0x5d, 0x5c, 0x49, 0x71,
+    0xa8, 0x07, 0xf9, 0x90, 0x48, 0x61, 0xf2, 0x9e, 0xae, 0xf1, 0xf6, 0xfc, 0x04, 0x05, 0x49, 0x4f,
+    0x08, 0x0e, 0x42, 0x4d, 0xe2, 0xd8, 0xa6, 0x14, 0x0b, 0xaa, 0x11, 0xa5, 0x1b, 0x38, 0xd0, 0x19,
+    0x7a, 0xe8, 0x27, 0x09, 0xa5, 0xe1, 0xcb, 0x51, 0x00, 0xde, 0xc1, 0x72, 0xaf, 0x6a, 0x72, 0xa4,
+    0x06, 0x11, 0x59, 0x7e, 0x26, 0xf2, 0x4c, 0xfe, 0x41, 0xd6, 0xb5, 0xbd, 0x38, 0xd2, 0x1f, 0xa4,
+    0xc5, 0x74, 0xe3, 0xff, 0x95, 0xc7, 0xfe, 0x2b, 0xc8, 0xfd, 0x37, 0xe2, 0xef, 0x3f, 0xbe, 0x63,
+    0x57, 0x7e, 0x7c, 0xfd, 0xe3, 0x7b, 0xa6, 0xf7, 0xc7, 0xdf, 0x2f, 0x4f, 0xe9, 0xa1, 0x05, 0xdb,
+    0x71, 0xf0, 0xe9, 0x52, 0xf0, 0x9f, 0x14, 0x8a, 0x8d, 0x48, 0x01, 0xfc, 0x52, 0x20, 0x3a, 0xdc,
+    0x17, 0x10, 0x73, 0xdf, 0x7b, 0xfa, 0xcf, 0x49, 0xc9, 0xa3, 0x50, 0xe5, 0x0b, 0xb7, 0x6a, 0xba,
+    0xd9, 0xbf, 0xda, 0x51, 0xc0, 0x44, 0x1a, 0x39, 0x08, 0x21, 0x8e, 0xeb, 0xc5, 0xf7, 0x30, 0x90,
+    0x99, 0x4a, 0x4c, 0x27, 0x72, 0x7f, 0x45, 0x28, 0x9f, 0x44, 0x10, 0x3b, 0xfa, 0x33, 0xa1, 0x17,
+    0xcd, 0x22, 0x64, 0x94, 0x62, 0x4a, 0xef, 0x5f, 0x4a, 0xf0, 0x28, 0xbf, 0x7f, 0x29, 0x3f, 0x8b,
+    0x95, 0x62, 0xad, 0xc8, 0x3c, 0x8b, 0x25, 0x06, 0x3d, 0xe9, 0x4a, 0xee, 0x39, 0xd5, 0x1b, 0xa6,
+    0x5d, 0x9e, 0x81, 0xd2, 0x81, 0xc7, 0x8e, 0xe3, 0x27, 0x90, 0x24, 0xf5, 0xec, 0xd8, 0xa6, 0x05,
+    0xfd, 0xa6, 0x1e, 0x51, 0x25, 0x60, 0x8b, 0xeb, 0x33, 0x61, 0x47, 0xa1, 0xee, 0x18, 0x20, 0x6a,
+    0xc4, 0x1e, 0x06, 0x89, 0x22, 0xf6, 0x7e, 0x68, 0x9f, 0x94, 0x0b, 0x54, 0xde, 0x63, 0x9b, 0x9e,
+    0xef, 0x91, 0x17, 0x62, 0xc7, 0xf9, 0xd0, 0xd5, 0x80, 0x2c, 0x3c, 0x23, 0xb5, 0x40, 0x60, 0xeb,
+    0x55, 0x06, 0x7d, 0x5e, 0x1e, 0x04, 0x74, 0x35, 0x44, 0xcd, 0x12, 0xa1, 0xfa, 0xfd, 0x72, 0xab,
+    0x86, 0xa8, 0x80, 0x34, 0xa0, 0x38, 0xa0, 0xd3, 0x4e, 0x0c, 0x23, 0xd4, 0x23, 0x28, 0x11, 0xe4,
+    0x78, 0x96, 0x89, 0x07, 0x15, 0x5b, 0x15, 0x1a, 0x1a, 0x2b, 0x22, 0x91, 0x70, 0x71, 0xae, 0x74,
+    0xc8, 0x33, 0x86, 0xda, 0x2a, 0x15, 0xc0, 0xf6, 0x36, 0x76, 0x7e, 0x47, 0xae, 0x63, 0xf2, 0xa3,
+    0x2b, 0x61, 0xa4, 0x01, 0xa3, 0xa8, 0x46, 0x56, 0x11, 0x8c, 0x90, 0xa0, 0x16, 0x0b, 0x23, 0xf7,
+    0xb1, 0x8f, 0x29, 0x45, 0x3d, 0xdd, 0x29, 0x8f, 0xd2, 0xd0, 0x31, 0xe8, 0xec, 0xe8, 0x1c, 0x59,
+    0x9d, 0x79, 0xbf, 0x2f, 0xb4, 0x5b, 0x99, 0xbb, 0xc0, 0xef, 0x22, 0x7e, 0xac, 0xd8, 0x70, 0x7c,
+    0x3f, 0x20, 0x5d, 0x82, 0x26, 0xea, 0x0c, 0x6a, 0x7c, 0x58, 0xfe, 0x09, 0x4b, 0x98, 0x09, 0xf9,
+    0xaf, 0x79, 0xf8, 0x0d, 0xfa, 0xb3, 0xad, 0x02, 0x0c, 0x87, 0xfc, 0xcf, 0xba, 0x70, 0x4d, 0x64,
+    0xda, 0xf2, 0xaf, 0xf9, 0x54, 0xfc, 0x95, 0xc0, 0xd2, 0x5f, 0xf2, 0x88, 0x9f, 0xca, 0x17, 0x32,
+    0x25, 0x0f, 0xd6, 0xf0, 0x52, 0x5d, 0x87, 0xa4, 0x5b, 0x48, 0xed, 0xfe, 0x6c, 0xf8, 0xc6, 0x9d,
+    0xb1, 0x3c, 0x18, 0x07, 0xbe, 0xfc, 0x3b, 0xd8, 0xc9, 0x46, 0x13, 0xc8, 0xbc, 0x3f, 0x5a, 0xc3,
+    0x0c, 0x96, 0xfb, 0x28, 0x9d, 0xf9, 0x6b, 0x1b, 0x04, 0x89, 0x03, 0xfd, 0x86, 0xa2, 0x5a, 0x80,
+    0xe1, 0x1f, 0xc5, 0x81, 0x87, 0x0f, 0x80, 0xf6, 0x33, 0x2e, 0xc8, 0x33, 0xc6, 0xe7, 0xf4, 0x4c,
+    0x9d, 0xb0, 0x33, 0xa0, 0x3d, 0x84, 0x51, 0xb8, 0x41, 0xd0, 0x89, 0x69, 0x51, 0x6e, 0xe3, 0xf0,
+    0xd6, 0x6f, 0x76, 0xf4, 0x8c, 0x79, 0x1c, 0x54, 0x4c, 0x89, 0xae, 0xef, 0xae, 0x40, 0x7c, 0xae,
+    0xef, 0x21, 0x74, 0xbe, 0x90, 0xa8, 0x3d, 0x04, 0x0b, 0x75, 0x0b, 0x04, 0x8b, 0x04, 0xa1, 0x54,
+    0xbe, 0xf0, 0xf8, 0x3e, 0x48, 0x79, 0xb4, 0xc7, 0xd9, 0x14, 0xc1, 0x61, 0x32, 0x4b, 0xff, 0x82,
+    0x10, 0xc0, 0x07, 0x6a, 0xc2, 0x49, 0x0b, 0xf7, 0xc6, 0xf4, 0x58, 0x5b, 0x1a, 0xaa, 0x5e, 0x58,
+    0x8b, 0xc8, 0x3c, 0x89, 0x62, 0x51, 0x82, 0x7a, 0x2c, 0x14, 0xb2, 0xed, 0xfb, 0xc0, 0xbb, 0x1b,
+    0x84, 0x8a, 0xc3, 0xaf, 0xb8, 0x8c, 0x25, 0x1b, 0x7a, 0xd8, 0x1e, 0x88, 0xdf, 0x14, 0x5e, 0xa7,
+    0xd9, 0x55, 0x38, 0x0b, 0x5f, 0xfe, 0x59, 0xc4, 0x49, 0xff, 0x8d, 0x61, 0x9c, 0xaa, 0xe2, 0x4f,
+    0xd4, 0xd4, 0x3e, 0xec, 0x34, 0x20, 0x6b, 0xf8, 0x1c, 0xdf, 0x88, 0x1a, 0xa4, 0x0d, 0x67, 0x6b,
+    0xa3, 0xdb, 0xce, 0xaf, 0x9c, 0x34, 0xd1, 0x28, 0xdc, 0xf4, 0xdc, 0x01, 0x2d, 0x6f, 0x4c, 0x67,
+    0x32, 0x2d, 0x1c, 0x7c, 0x86, 0x37, 0xa2, 0x54, 0xc6, 0xa5, 0x80, 0x2b, 0x81, 0xce, 0xa7, 0x95,
+    0x80, 0x68, 0xd7, 0x1a, 0xf8, 0x91, 0x3e, 0x1c, 0x1d, 0xf5, 0x1c, 0x74, 0x07, 0x9c, 0x3b, 0x9f,
+    0x87, 0xf9, 0xe5, 0x69, 0x78, 0x75, 0x45, 0xbe, 0x0b, 0x08, 0x12, 0xb1, 0x20, 0xf2, 0x3f, 0xfa,
+    0xfa, 0x05, 0xb6, 0x5f, 0x1f, 0xb6, 0xb3, 0x10, 0x5f, 0x49, 0xd4, 0x1b, 0x1a, 0x39, 0x85, 0x5b,
+    0x52, 0x51, 0xd5, 0xe1, 0x09, 0x80, 0x52, 0x89, 0x29, 0x6f, 0xd9, 0x48, 0x88, 0xe0, 0x60, 0x08,
+    0xae, 0x11, 0x02, 0x7b, 0x83, 0x54, 0x44, 0x56, 0x1d, 0xd4, 0xcd, 0x50, 0x21, 0x96, 0x8d, 0xa7,
+    0x13, 0x96, 0xba, 0xd2, 0x13, 0xcb, 0x86, 0x0a, 0x22, 0x81, 0xf4, 0x05, 0xf1, 0xbd, 0x67, 0x35,
+    0xf1, 0x8f, 0x2b, 0x85, 0x6b, 0x6b, 0x78, 0xa4, 0x83, 0xf4, 0x43, 0xd3, 0x5d, 0xe5, 0x50, 0x58,
+    0xcb, 0x0f, 0x57, 0x8a, 0x9b, 0x8f, 0x20, 0x76, 0xf7, 0x0f, 0xf8, 0x0a, 0xa9, 0x33, 0xb0, 0xfd,
+    0x42, 0xe8, 0x4e, 0xa8, 0xa7, 0x3e, 0xb9, 0xf7, 0x4b, 0xc7, 0x15, 0x25, 0x11, 0x29, 0x7e, 0x43,
+    0xdf, 0x7f, 0xa6, 0x1e, 0xbd, 0xfc, 0x7a, 0x7a, 0xcb, 0x2e, 0xdc, 0x1a, 0xef, 0x1a, 0x79, 0xd4,
+    0x0d, 0x40, 0x78, 0x26, 0x70, 0xf7, 0xa5, 0x06, 0xd2, 0x4c, 0xdc, 0x28, 0x88, 0xff, 0xe5, 0x01,
+    0x8f, 0x31, 0x2b, 0xba, 0x54, 0xc3, 0x5f, 0x7f, 0x61, 0xf6, 0x6f, 0xf7, 0x16, 0x86, 0xe3, 0xe2,
+    0x35, 0x36, 0x43, 0x65, 0x6c, 0x14, 0xe6, 0xfa, 0x9a, 0x52, 0xbe, 0x64, 0xaf, 0x88, 0x5f, 0x07,
+    0x3c, 0xb6, 0xf2, 0xe3, 0xbf, 0xbe, 0x2e, 0x2f, 0x0f, 0x2f, 0xcb, 0xdb, 0x2b, 0xe8, 0xe5, 0xe9,
+    0xe1, 0x72, 0x02, 0x6b, 0x04, 0x86, 0x8b, 0x01, 0x11, 0x31, 0xf0, 0xef, 0xd3, 0xbf, 0x01, 0x4c,
+    0xfe, 0x93, 0x4c, 0x12, 0x58, 0x00, 0x00,
+};
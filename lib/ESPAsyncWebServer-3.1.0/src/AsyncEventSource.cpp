@@ -104,23 +104,46 @@ static String generateEventMessage(const char *message, const char *event, uint3
   return ev;
 }
 
-// Message
+// Payload
 
-AsyncEventSourceMessage::AsyncEventSourceMessage(const char * data, size_t len)
-: _data(nullptr), _len(len), _sent(0), _acked(0)
+AsyncEventSourcePayload::AsyncEventSourcePayload(const char * data, size_t len, const char * event)
+: _data(nullptr), _len(len), _event(nullptr), _count(1)
 {
-  _data = (uint8_t*)malloc(_len+1);
+  // text and event name in one block
+  size_t elen = event ? strlen(event) + 1 : 0;
+  _data = (char*)malloc(_len + 1 + elen);
   if(_data == nullptr){
     _len = 0;
   } else {
     memcpy(_data, data, len);
     _data[_len] = 0;
+    if(event){
+      memcpy(_data + _len + 1, event, elen);
+      _event = _data + _len + 1;
+    }
   }
 }
 
+AsyncEventSourcePayload::~AsyncEventSourcePayload() {
+  if(_data != NULL)
+    free(_data);
+}
+
+// Message
+
+AsyncEventSourceMessage::AsyncEventSourceMessage(const char * data, size_t len)
+: _payload(new AsyncEventSourcePayload(data, len)), _len(_payload->length()), _sent(0), _acked(0)
+{
+}
+
+AsyncEventSourceMessage::AsyncEventSourceMessage(AsyncEventSourcePayload * payload)
+: _payload(payload), _len(payload->length()), _sent(0), _acked(0)
+{
+  _payload->retain();
+}
+
 AsyncEventSourceMessage::~AsyncEventSourceMessage() {
-     if(_data != NULL)
-        free(_data);
+  _payload->release();
 }
 
 size_t AsyncEventSourceMessage::ack(size_t len, uint32_t time) {
@@ -140,16 +163,28 @@ size_t AsyncEventSourceMessage::ack(size_t len, uint32_t time) {
 size_t AsyncEventSourceMessage::send(AsyncClient *client) {
   if (!client->canSend())
     return 0;
-  const size_t len = _len - _sent;
-  if(client->space() < len){
-    return 0;
-  }
-  size_t sent = client->add((const char *)_data, len);
+  // as much as fits, an event larger than the send window goes out in pieces
+  const size_t len = std::min(_len - _sent, client->space());
+  size_t sent = client->add(_payload->data() + _sent, len);
   client->send();
   _sent += sent;
   return sent;
 }
 
+bool AsyncEventSourceMessage::supersedes(const AsyncEventSourceMessage *older) const {
+  const char * event = _payload->event();
+  return event && !older->started() && older->_payload->event() && !strcmp(event, older->_payload->event());
+}
+
+// Takes over the newer message's text, keeping this one's place in the queue
+void AsyncEventSourceMessage::replace(AsyncEventSourceMessage *newer) {
+  AsyncEventSourcePayload * payload = _payload;
+  _payload = newer->_payload;
+  _len = newer->_len;
+  newer->_payload = payload;
+  newer->_len = payload->length();
+}
+
 // Client
 
 AsyncEventSourceClient::AsyncEventSourceClient(AsyncWebServerRequest *request, AsyncEventSource *server)
@@ -158,8 +193,10 @@ AsyncEventSourceClient::AsyncEventSourceClient(AsyncWebServerRequest *request, A
   _client = request->client();
   _server = server;
   _lastId = 0;
-  if(request->hasHeader("Last-Event-ID"))
-    _lastId = atoi(request->getHeader("Last-Event-ID")->value().c_str());
+  _dropped = 0;
+  const char * lastEventId = request->headerValue("Last-Event-ID");
+  if(lastEventId)
+    _lastId = atoi(lastEventId);
 
   _client->setRxTimeout(0);
   _client->onError(NULL, NULL);
@@ -185,9 +222,28 @@ void AsyncEventSourceClient::_queueMessage(AsyncEventSourceMessage *dataMessage)
     delete dataMessage;
     return;
   }
-  if(_messageQueue.length() >= SSE_MAX_QUEUED_MESSAGES){
-      ets_printf("ERROR: Too many messages queued\n");
+  AsyncWebLockGuard l(_server->_lock);
+  if(_server->_coalesce){
+    for(const auto &m: _messageQueue){
+      if(dataMessage->supersedes(m)){
+        m->replace(dataMessage);
+        delete dataMessage;
+        _dropped++;
+        if(_client->canSend())
+          _runQueue();
+        return;
+      }
+    }
+  }
+  // A slow client keeps the newest events: older ones not yet on the wire make room
+  auto full = [&](){
+    return _messageQueue.length() >= SSE_MAX_QUEUED_MESSAGES ||
+      (!_messageQueue.isEmpty() && bytesWaiting() + dataMessage->length() > SSE_MAX_QUEUED_BYTES);
+  };
+  while(full() && _dropOldestUnsent());
+  if(full()){
       delete dataMessage;
+      _dropped++;
   } else {
       _messageQueue.add(dataMessage);
   }
@@ -195,7 +251,26 @@ void AsyncEventSourceClient::_queueMessage(AsyncEventSourceMessage *dataMessage)
     _runQueue();
 }
 
+bool AsyncEventSourceClient::_dropOldestUnsent(){
+  for(const auto &m: _messageQueue){
+    if(!m->started()){
+      _messageQueue.remove(m);
+      _dropped++;
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t AsyncEventSourceClient::bytesWaiting() const {
+  size_t bytes = 0;
+  for(const auto &m: _messageQueue)
+    bytes += m->length();
+  return bytes;
+}
+
 void AsyncEventSourceClient::_onAck(size_t len, uint32_t time){
+  AsyncWebLockGuard l(_server->_lock);
   while(len && !_messageQueue.isEmpty()){
     len = _messageQueue.front()->ack(len, time);
     if(_messageQueue.front()->finished())
@@ -206,6 +281,7 @@ void AsyncEventSourceClient::_onAck(size_t len, uint32_t time){
 }
 
 void AsyncEventSourceClient::_onPoll(){
+  AsyncWebLockGuard l(_server->_lock);
   if(!_messageQueue.isEmpty()){
     _runQueue();
   }
@@ -232,7 +308,9 @@ void AsyncEventSourceClient::write(const char * message, size_t len){
 
 void AsyncEventSourceClient::send(const char *message, const char *event, uint32_t id, uint32_t reconnect){
   String ev = generateEventMessage(message, event, id, reconnect);
-  _queueMessage(new AsyncEventSourceMessage(ev.c_str(), ev.length()));
+  AsyncEventSourcePayload *payload = new AsyncEventSourcePayload(ev.c_str(), ev.length(), event);
+  _queueMessage(new AsyncEventSourceMessage(payload));
+  payload->release();
 }
 
 void AsyncEventSourceClient::_runQueue(){
@@ -240,10 +318,11 @@ void AsyncEventSourceClient::_runQueue(){
     _messageQueue.remove(_messageQueue.front());
   }
 
+  // In order: acks are credited to the front of the queue
   for(auto i = _messageQueue.begin(); i != _messageQueue.end(); ++i)
   {
-    if(!(*i)->sent())
-      (*i)->send(_client);
+    if(!(*i)->sent() && !(*i)->send(_client))
+      break;
   }
 }
 
@@ -254,6 +333,7 @@ AsyncEventSource::AsyncEventSource(const String& url)
   : _url(url)
   , _clients(LinkedList<AsyncEventSourceClient *>([](AsyncEventSourceClient *c){ delete c; }))
   , _connectcb(NULL)
+  , _coalesce(false)
 {}
 
 AsyncEventSource::~AsyncEventSource(){
@@ -278,12 +358,14 @@ void AsyncEventSource::_addClient(AsyncEventSourceClient * client){
     free(temp);
   }*/
 
+  AsyncWebLockGuard l(_lock);
   _clients.add(client);
   if(_connectcb)
     _connectcb(client);
 }
 
 void AsyncEventSource::_handleDisconnect(AsyncEventSourceClient * client){
+  AsyncWebLockGuard l(_lock);
   _clients.remove(client);
 }
 
@@ -313,14 +395,19 @@ size_t AsyncEventSource::avgPacketsWaiting() const {
 }
 
 void AsyncEventSource::send(const char *message, const char *event, uint32_t id, uint32_t reconnect){
+  AsyncWebLockGuard l(_lock);
+  if(!count())
+    return;
 
-
+  // One copy of the text, every client queues a reference to it
   String ev = generateEventMessage(message, event, id, reconnect);
+  AsyncEventSourcePayload *payload = new AsyncEventSourcePayload(ev.c_str(), ev.length(), event);
   for(const auto &c: _clients){
     if(c->connected()) {
-      c->write(ev.c_str(), ev.length());
+      c->_queueMessage(new AsyncEventSourceMessage(payload));
     }
   }
+  payload->release();
 }
 
 size_t AsyncEventSource::count() const {
@@ -32,6 +32,12 @@
 #define SSE_MAX_QUEUED_MESSAGES 32
 #endif
 
+// Bytes of event text a client may have queued (sent or not) before older
+// unsent events are dropped to make room for new ones
+#ifndef SSE_MAX_QUEUED_BYTES
+#define SSE_MAX_QUEUED_BYTES 8192
+#endif
+
 #include <ESPAsyncWebServer.h>
 
 #include "AsyncWebSynchronization.h"
@@ -54,20 +60,42 @@ class AsyncEventSourceResponse;
 class AsyncEventSourceClient;
 typedef std::function<void(AsyncEventSourceClient *client)> ArEventHandlerFunction;
 
+// Event text and name, shared by every client the event was queued for
+class AsyncEventSourcePayload {
+  private:
+    char * _data;
+    size_t _len;
+    const char * _event;
+    uint32_t _count;
+  public:
+    AsyncEventSourcePayload(const char * data, size_t len, const char * event=NULL);
+    ~AsyncEventSourcePayload();
+    const char * data() const { return _data; }
+    size_t length() const { return _len; }
+    const char * event() const { return _event; }
+    void retain() { _count++; }
+    void release() { if(_count <= 1) delete this; else _count--; }
+};
+
 class AsyncEventSourceMessage {
   private:
-    uint8_t * _data;
+    AsyncEventSourcePayload * _payload;
     size_t _len;
     size_t _sent;
     //size_t _ack;
     size_t _acked;
   public:
     AsyncEventSourceMessage(const char * data, size_t len);
+    AsyncEventSourceMessage(AsyncEventSourcePayload * payload);
     ~AsyncEventSourceMessage();
     size_t ack(size_t len, uint32_t time __attribute__((unused)));
     size_t send(AsyncClient *client);
     bool finished(){ return _acked == _len; }
     bool sent() { return _sent == _len; }
+    bool started() const { return _sent > 0; }
+    size_t length() const { return _len; }
+    bool supersedes(const AsyncEventSourceMessage *older) const;
+    void replace(AsyncEventSourceMessage *newer);
 };
 
 class AsyncEventSourceClient {
@@ -75,9 +103,12 @@ class AsyncEventSourceClient {
     AsyncClient *_client;
     AsyncEventSource *_server;
     uint32_t _lastId;
+    uint32_t _dropped;
     LinkedList<AsyncEventSourceMessage *> _messageQueue;
     void _queueMessage(AsyncEventSourceMessage *dataMessage);
+    bool _dropOldestUnsent();
     void _runQueue();
+    friend class AsyncEventSource;
 
   public:
 
@@ -91,6 +122,8 @@ class AsyncEventSourceClient {
     bool connected() const { return (_client != NULL) && _client->connected(); }
     uint32_t lastId() const { return _lastId; }
     size_t  packetsWaiting() const { return _messageQueue.length(); }
+    size_t  bytesWaiting() const;
+    uint32_t messagesDropped() const { return _dropped; } // superseded or dropped to stay within bounds
 
     //system callbacks (do not call)
     void _onAck(size_t len, uint32_t time);
@@ -104,6 +137,10 @@ class AsyncEventSource: public AsyncWebHandler {
     String _url;
     LinkedList<AsyncEventSourceClient *> _clients;
     ArEventHandlerFunction _connectcb;
+    bool _coalesce;
+    // guards the client list and the message queues, acks arrive on the TCP task
+    AsyncWebLock _lock;
+    friend class AsyncEventSourceClient;
   public:
     AsyncEventSource(const String& url);
     ~AsyncEventSource();
@@ -111,6 +148,8 @@ class AsyncEventSource: public AsyncWebHandler {
     const char * url() const { return _url.c_str(); }
     void close();
     void onConnect(ArEventHandlerFunction cb);
+    // A named event still waiting in a client's queue is replaced by a newer one of the same name
+    void setCoalescing(bool coalesce){ _coalesce = coalesce; }
     void send(const char *message, const char *event=NULL, uint32_t id=0, uint32_t reconnect=0);
     size_t count() const; //number clinets connected
     size_t  avgPacketsWaiting() const;
@@ -64,11 +64,7 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
 
   if(len > space) len = space;
 
-  uint8_t *buf = (uint8_t*)malloc(headLen);
-  if(buf == NULL){
-    //os_printf("could not malloc %u bytes for frame header\n", headLen);
-    return 0;
-  }
+  uint8_t buf[8];
 
   buf[0] = opcode & 0x0F;
   if(final)
@@ -86,10 +82,8 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
   }
   if(client->add((const char *)buf, headLen) != headLen){
     //os_printf("error adding %lu header bytes\n", headLen);
-    free(buf);
     return 0;
   }
-  free(buf);
 
   if(len){
     if(len && mask){
@@ -463,7 +457,12 @@ AsyncWebSocketMultiMessage::~AsyncWebSocketMultiMessage() {
 
 AsyncWebSocketClient::AsyncWebSocketClient(AsyncWebServerRequest *request, AsyncWebSocket *server)
   : _controlQueue(LinkedList<AsyncWebSocketControl *>([](AsyncWebSocketControl *c){ delete  c; }))
-  , _messageQueue(LinkedList<AsyncWebSocketMessage *>([](AsyncWebSocketMessage *m){ delete  m; }))
+  , _messageQueue(LinkedList<AsyncWebSocketMessage *>([this](AsyncWebSocketMessage *m){
+      // every way out of the queue passes here, which keeps the byte counts exact
+      _queuedBytes -= m->length();
+      _server->_queuedBytes -= m->charged();
+      delete  m;
+    }))
   , _tempObject(NULL)
 {
   _client = request->client();
@@ -473,6 +472,8 @@ AsyncWebSocketClient::AsyncWebSocketClient(AsyncWebServerRequest *request, Async
   _pstate = 0;
   _lastMessageTime = millis();
   _keepAlivePeriod = 0;
+  _queuedBytes = 0;
+  _dropped = 0;
   _client->setRxTimeout(0);
   _client->onError([](void *r, AsyncClient* c, int8_t error){ (void)c; ((AsyncWebSocketClient*)(r))->_onError(error); }, this);
   _client->onAck([](void *r, AsyncClient* c, size_t len, uint32_t time){ (void)c; ((AsyncWebSocketClient*)(r))->_onAck(len, time); }, this);
@@ -492,6 +493,7 @@ AsyncWebSocketClient::~AsyncWebSocketClient(){
 }
 
 void AsyncWebSocketClient::_onAck(size_t len, uint32_t time){
+  AsyncWebLockGuard l(_server->_lock);
   _lastMessageTime = millis();
   if(!_controlQueue.isEmpty()){
     auto head = _controlQueue.front();
@@ -514,6 +516,7 @@ void AsyncWebSocketClient::_onAck(size_t len, uint32_t time){
 }
 
 void AsyncWebSocketClient::_onPoll(){
+  AsyncWebLockGuard l(_server->_lock);
   if(_client->canSend() && (!_controlQueue.isEmpty() || !_messageQueue.isEmpty())){
     _runQueue();
   } else if(_keepAlivePeriod > 0 && _controlQueue.isEmpty() && _messageQueue.isEmpty() && (millis() - _lastMessageTime) >= _keepAlivePeriod){
@@ -534,10 +537,18 @@ void AsyncWebSocketClient::_runQueue(){
 }
 
 bool AsyncWebSocketClient::queueIsFull(){
-  if((_messageQueue.length() >= WS_MAX_QUEUED_MESSAGES) || (_status != WS_CONNECTED) ) return true;
+  if((_messageQueue.length() >= WS_MAX_QUEUED_MESSAGES) || (_queuedBytes >= WS_MAX_QUEUED_BYTES) ||
+     (_server->_queuedBytes >= WS_MAX_TOTAL_QUEUED_BYTES) || (_status != WS_CONNECTED) ) return true;
   return false;
 }
 
+bool AsyncWebSocketClient::_queueFull(size_t len) const {
+  // an empty queue takes one message of any size, so nobody starves
+  if(_messageQueue.isEmpty())
+    return false;
+  return _messageQueue.length() >= WS_MAX_QUEUED_MESSAGES || _queuedBytes + len > WS_MAX_QUEUED_BYTES;
+}
+
 void AsyncWebSocketClient::_queueMessage(AsyncWebSocketMessage *dataMessage){
   if(dataMessage == NULL)
     return;
@@ -545,10 +556,32 @@ void AsyncWebSocketClient::_queueMessage(AsyncWebSocketMessage *dataMessage){
     delete dataMessage;
     return;
   }
-  if(_messageQueue.length() >= WS_MAX_QUEUED_MESSAGES){
-      ets_printf("ERROR: Too many messages queued\n");
+  AsyncWebLockGuard l(_server->_lock);
+  auto dropped = [this](){
+    _dropped++;
+    _server->_dropped++;
+  };
+  const size_t len = dataMessage->length();
+  const uint32_t key = dataMessage->key();
+  if(_server->_dropPolicy == WS_DROP_COALESCE && key){
+    if(_messageQueue.remove_first([key](AsyncWebSocketMessage *m){ return !m->started() && m->key() == key; }))
+      dropped();
+  }
+  if(_server->_dropPolicy != WS_DROP_NEWEST){
+    // make room from the oldest messages that are not on the wire yet
+    while(_queueFull(len) && _messageQueue.remove_first([](AsyncWebSocketMessage *m){ return !m->started(); }))
+      dropped();
+  }
+  // evicting our own messages would not help against the server total,
+  // that is spent by all clients together
+  const size_t footprint = dataMessage->footprint();
+  if(_queueFull(len) || (_server->_queuedBytes && _server->_queuedBytes + footprint > WS_MAX_TOTAL_QUEUED_BYTES)){
       delete dataMessage;
+      dropped();
   } else {
+      _queuedBytes += len;
+      _server->_queuedBytes += footprint;
+      dataMessage->charged(footprint);
       _messageQueue.add(dataMessage);
   }
   if(_client->canSend())
@@ -558,6 +591,7 @@ void AsyncWebSocketClient::_queueMessage(AsyncWebSocketMessage *dataMessage){
 void AsyncWebSocketClient::_queueControl(AsyncWebSocketControl *controlMessage){
   if(controlMessage == NULL)
     return;
+  AsyncWebLockGuard l(_server->_lock);
   _controlQueue.add(controlMessage);
   if(_client->canSend())
     _runQueue();
@@ -758,8 +792,10 @@ size_t AsyncWebSocketClient::printf_P(PGM_P formatP, ...) {
 }
 #endif
 
-void AsyncWebSocketClient::text(const char * message, size_t len){
-  _queueMessage(new AsyncWebSocketBasicMessage(message, len));
+void AsyncWebSocketClient::text(const char * message, size_t len, uint32_t key){
+  AsyncWebSocketMessage *m = new AsyncWebSocketBasicMessage(message, len);
+  m->key(key);
+  _queueMessage(m);
 }
 void AsyncWebSocketClient::text(const char * message){
   text(message, strlen(message));
@@ -789,13 +825,17 @@ void AsyncWebSocketClient::text(const __FlashStringHelper *data){
     free(message);
   }
 }
-void AsyncWebSocketClient::text(AsyncWebSocketMessageBuffer * buffer)
+void AsyncWebSocketClient::text(AsyncWebSocketMessageBuffer * buffer, uint32_t key)
 {
-  _queueMessage(new AsyncWebSocketMultiMessage(buffer));
+  AsyncWebSocketMessage *m = new AsyncWebSocketMultiMessage(buffer);
+  m->key(key);
+  _queueMessage(m);
 }
 
-void AsyncWebSocketClient::binary(const char * message, size_t len){
-  _queueMessage(new AsyncWebSocketBasicMessage(message, len, WS_BINARY));
+void AsyncWebSocketClient::binary(const char * message, size_t len, uint32_t key){
+  AsyncWebSocketMessage *m = new AsyncWebSocketBasicMessage(message, len, WS_BINARY);
+  m->key(key);
+  _queueMessage(m);
 }
 void AsyncWebSocketClient::binary(const char * message){
   binary(message, strlen(message));
@@ -820,9 +860,11 @@ void AsyncWebSocketClient::binary(const __FlashStringHelper *data, size_t len){
   }
 
 }
-void AsyncWebSocketClient::binary(AsyncWebSocketMessageBuffer * buffer)
+void AsyncWebSocketClient::binary(AsyncWebSocketMessageBuffer * buffer, uint32_t key)
 {
-  _queueMessage(new AsyncWebSocketMultiMessage(buffer, WS_BINARY));
+  AsyncWebSocketMessage *m = new AsyncWebSocketMultiMessage(buffer, WS_BINARY);
+  m->key(key);
+  _queueMessage(m);
 }
 
 IPAddress AsyncWebSocketClient::remoteIP() {
@@ -850,6 +892,9 @@ AsyncWebSocket::AsyncWebSocket(const String& url)
   ,_clients(LinkedList<AsyncWebSocketClient *>([](AsyncWebSocketClient *c){ delete c; }))
   ,_cNextId(1)
   ,_enabled(true)
+  ,_dropPolicy(WS_DROP_NEWEST)
+  ,_queuedBytes(0)
+  ,_dropped(0)
   ,_buffers(LinkedList<AsyncWebSocketMessageBuffer *>([](AsyncWebSocketMessageBuffer *b){ delete b; }))
 {
   _eventHandler = NULL;
@@ -864,10 +909,12 @@ void AsyncWebSocket::_handleEvent(AsyncWebSocketClient * client, AwsEventType ty
 }
 
 void AsyncWebSocket::_addClient(AsyncWebSocketClient * client){
+  AsyncWebLockGuard l(_lock);
   _clients.add(client);
 }
 
 void AsyncWebSocket::_handleDisconnect(AsyncWebSocketClient * client){
+  AsyncWebLockGuard l(_lock);
 
   _clients.remove_first([=](AsyncWebSocketClient * c){
     return c->id() == client->id();
@@ -943,12 +990,13 @@ void AsyncWebSocket::text(uint32_t id, const char * message, size_t len){
     c->text(message, len);
 }
 
-void AsyncWebSocket::textAll(AsyncWebSocketMessageBuffer * buffer){
+void AsyncWebSocket::textAll(AsyncWebSocketMessageBuffer * buffer, uint32_t key){
   if (!buffer) return;
+  AsyncWebLockGuard l(_lock);
   buffer->lock();
   for(const auto& c: _clients){
     if(c->status() == WS_CONNECTED){
-        c->text(buffer);
+        c->text(buffer, key);
     }
   }
   buffer->unlock();
@@ -956,9 +1004,9 @@ void AsyncWebSocket::textAll(AsyncWebSocketMessageBuffer * buffer){
 }
 
 
-void AsyncWebSocket::textAll(const char * message, size_t len){
+void AsyncWebSocket::textAll(const char * message, size_t len, uint32_t key){
   AsyncWebSocketMessageBuffer * WSBuffer = makeBuffer((uint8_t *)message, len);
-    textAll(WSBuffer);
+    textAll(WSBuffer, key);
 }
 
 void AsyncWebSocket::binary(uint32_t id, const char * message, size_t len){
@@ -967,18 +1015,19 @@ void AsyncWebSocket::binary(uint32_t id, const char * message, size_t len){
     c->binary(message, len);
 }
 
-void AsyncWebSocket::binaryAll(const char * message, size_t len){
+void AsyncWebSocket::binaryAll(const char * message, size_t len, uint32_t key){
   AsyncWebSocketMessageBuffer * buffer = makeBuffer((uint8_t *)message, len);
-  binaryAll(buffer);
+  binaryAll(buffer, key);
 }
 
-void AsyncWebSocket::binaryAll(AsyncWebSocketMessageBuffer * buffer)
+void AsyncWebSocket::binaryAll(AsyncWebSocketMessageBuffer * buffer, uint32_t key)
 {
   if (!buffer) return;
+  AsyncWebLockGuard l(_lock);
   buffer->lock();
     for(const auto& c: _clients){
     if(c->status() == WS_CONNECTED)
-      c->binary(buffer);
+      c->binary(buffer, key);
   }
   buffer->unlock();
   _cleanBuffers();
@@ -1102,9 +1151,12 @@ void AsyncWebSocket::textAll(const String &message){
   textAll(message.c_str(), message.length());
 }
 void AsyncWebSocket::textAll(const __FlashStringHelper *message){
-  for(const auto& c: _clients){
-    if(c->status() == WS_CONNECTED)
-      c->text(message);
+  PGM_P p = reinterpret_cast<PGM_P>(message);
+  size_t n = strlen_P(p);
+  AsyncWebSocketMessageBuffer * buffer = makeBuffer(n);
+  if (buffer) {
+    memcpy_P(buffer->get(), p, n);
+    textAll(buffer);
   }
 }
 void AsyncWebSocket::binary(uint32_t id, const char * message){
@@ -1137,11 +1189,12 @@ void AsyncWebSocket::binaryAll(const String &message){
   binaryAll(message.c_str(), message.length());
 }
 void AsyncWebSocket::binaryAll(const __FlashStringHelper *message, size_t len){
-  for(const auto& c: _clients){
-    if(c->status() == WS_CONNECTED)
-      c-> binary(message, len);
+  AsyncWebSocketMessageBuffer * buffer = makeBuffer(len);
+  if (buffer) {
+    memcpy_P(buffer->get(), message, len);
+    binaryAll(buffer);
   }
- }
+}
 
 const char * WS_STR_CONNECTION = "Connection";
 const char * WS_STR_UPGRADE = "Upgrade";
@@ -27,11 +27,23 @@
 #ifndef WS_MAX_QUEUED_MESSAGES
 #define WS_MAX_QUEUED_MESSAGES 32
 #endif
+#ifndef WS_MAX_QUEUED_BYTES
+#define WS_MAX_QUEUED_BYTES 16384
+#endif
+#ifndef WS_MAX_TOTAL_QUEUED_BYTES
+#define WS_MAX_TOTAL_QUEUED_BYTES 65536
+#endif
 #else
 #include <ESPAsyncTCP.h>
 #ifndef WS_MAX_QUEUED_MESSAGES
 #define WS_MAX_QUEUED_MESSAGES 8
 #endif
+#ifndef WS_MAX_QUEUED_BYTES
+#define WS_MAX_QUEUED_BYTES 4096
+#endif
+#ifndef WS_MAX_TOTAL_QUEUED_BYTES
+#define WS_MAX_TOTAL_QUEUED_BYTES 12288
+#endif
 #endif
 #include <ESPAsyncWebServer.h>
 
@@ -83,6 +95,12 @@ typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus
 typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
 typedef enum { WS_MSG_SENDING, WS_MSG_SENT, WS_MSG_ERROR } AwsMessageStatus;
 typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+/** What a client's full queue gives up for a new message.
+ * WS_DROP_NEWEST: the new message (default).
+ * WS_DROP_OLDEST: queued messages not yet on the wire, oldest first.
+ * WS_DROP_COALESCE: as OLDEST, and a keyed message also replaces a queued
+ * one with the same key that has not started sending. */
+typedef enum { WS_DROP_NEWEST, WS_DROP_OLDEST, WS_DROP_COALESCE } AwsDropPolicy;
 
 class AsyncWebSocketMessageBuffer {
   private:
@@ -117,13 +135,27 @@ class AsyncWebSocketMessage {
     uint8_t _opcode;
     bool _mask;
     AwsMessageStatus _status;
+    uint32_t _key;
+    size_t _charged;
   public:
-    AsyncWebSocketMessage():_opcode(WS_TEXT),_mask(false),_status(WS_MSG_ERROR){}
+    AsyncWebSocketMessage():_opcode(WS_TEXT),_mask(false),_status(WS_MSG_ERROR),_key(0),_charged(0){}
     virtual ~AsyncWebSocketMessage(){}
     virtual void ack(size_t len __attribute__((unused)), uint32_t time __attribute__((unused))){}
     virtual size_t send(AsyncClient *client __attribute__((unused))){ return 0; }
     virtual bool finished(){ return _status != WS_MSG_SENDING; }
     virtual bool betweenFrames() const { return false; }
+    virtual bool started() const { return false; }
+    //payload bytes charged to the client queue holding the message
+    virtual size_t length() const { return 0; }
+    //payload bytes charged to the server total, a shared buffer only counts once
+    virtual size_t footprint() const { return length(); }
+    //coalescing key, 0 for none
+    void key(uint32_t key){ _key = key; }
+    uint32_t key() const { return _key; }
+    //footprint charged to the server total when queued, given back when it leaves:
+    //the buffer's holders change in between, so footprint() may differ by then
+    void charged(size_t bytes){ _charged = bytes; }
+    size_t charged() const { return _charged; }
 };
 
 class AsyncWebSocketBasicMessage: public AsyncWebSocketMessage {
@@ -138,6 +170,8 @@ public:
     AsyncWebSocketBasicMessage(uint8_t opcode=WS_TEXT, bool mask=false);
     virtual ~AsyncWebSocketBasicMessage() override;
     virtual bool betweenFrames() const override { return _acked == _ack; }
+    virtual bool started() const override { return _sent > 0; }
+    virtual size_t length() const override { return _len; }
     virtual void ack(size_t len, uint32_t time) override ;
     virtual size_t send(AsyncClient *client) override ;
 };
@@ -154,6 +188,9 @@ public:
     AsyncWebSocketMultiMessage(AsyncWebSocketMessageBuffer * buffer, uint8_t opcode=WS_TEXT, bool mask=false); 
     virtual ~AsyncWebSocketMultiMessage() override;
     virtual bool betweenFrames() const override { return _acked == _ack; }
+    virtual bool started() const override { return _sent > 0; }
+    virtual size_t length() const override { return _len; }
+    virtual size_t footprint() const override { return (_WSbuffer && _WSbuffer->count() > 1) ? 0 : _len; }
     virtual void ack(size_t len, uint32_t time) override ;
     virtual size_t send(AsyncClient *client) override ;
 };
@@ -174,7 +211,11 @@ class AsyncWebSocketClient {
     uint32_t _lastMessageTime;
     uint32_t _keepAlivePeriod;
 
+    size_t _queuedBytes;
+    uint32_t _dropped;
+
     void _queueMessage(AsyncWebSocketMessage *dataMessage);
+    bool _queueFull(size_t len) const;
     void _queueControl(AsyncWebSocketControl *controlMessage);
     void _runQueue();
 
@@ -209,28 +250,31 @@ class AsyncWebSocketClient {
     //data packets
     void message(AsyncWebSocketMessage *message){ _queueMessage(message); }
     bool queueIsFull();
+    size_t queueLen() const { return _messageQueue.length(); }
+    size_t queuedBytes() const { return _queuedBytes; }
+    uint32_t droppedMessages() const { return _dropped; }
 
     size_t printf(const char *format, ...)  __attribute__ ((format (printf, 2, 3)));
 #ifndef ESP32
     size_t printf_P(PGM_P formatP, ...)  __attribute__ ((format (printf, 2, 3)));
 #endif
-    void text(const char * message, size_t len);
+    void text(const char * message, size_t len, uint32_t key=0);
     void text(const char * message);
     void text(uint8_t * message, size_t len);
     void text(char * message);
     void text(const String &message);
     void text(const __FlashStringHelper *data);
-    void text(AsyncWebSocketMessageBuffer *buffer); 
+    void text(AsyncWebSocketMessageBuffer *buffer, uint32_t key=0);
 
-    void binary(const char * message, size_t len);
+    void binary(const char * message, size_t len, uint32_t key=0);
     void binary(const char * message);
     void binary(uint8_t * message, size_t len);
     void binary(char * message);
     void binary(const String &message);
     void binary(const __FlashStringHelper *data, size_t len);
-    void binary(AsyncWebSocketMessageBuffer *buffer); 
+    void binary(AsyncWebSocketMessageBuffer *buffer, uint32_t key=0);
 
-    bool canSend() { return _messageQueue.length() < WS_MAX_QUEUED_MESSAGES; }
+    bool canSend() { return _messageQueue.length() < WS_MAX_QUEUED_MESSAGES && _queuedBytes < WS_MAX_QUEUED_BYTES; }
 
     //system callbacks (do not call)
     void _onAck(size_t len, uint32_t time);
@@ -253,7 +297,11 @@ class AsyncWebSocket: public AsyncWebHandler {
     uint32_t _cNextId;
     AwsEventHandler _eventHandler;
     bool _enabled;
+    AwsDropPolicy _dropPolicy;
+    size_t _queuedBytes;
+    uint32_t _dropped;
     AsyncWebLock _lock;
+    friend class AsyncWebSocketClient;
 
   public:
     AsyncWebSocket(const String& url);
@@ -264,6 +312,13 @@ class AsyncWebSocket: public AsyncWebHandler {
     bool availableForWriteAll();
     bool availableForWrite(uint32_t id);
 
+    //queue limits are WS_MAX_QUEUED_MESSAGES and WS_MAX_QUEUED_BYTES per client,
+    //WS_MAX_TOTAL_QUEUED_BYTES for all clients together
+    void dropPolicy(AwsDropPolicy policy){ _dropPolicy = policy; }
+    AwsDropPolicy dropPolicy() const { return _dropPolicy; }
+    size_t queuedBytes() const { return _queuedBytes; }
+    uint32_t droppedMessages() const { return _dropped; }
+
     size_t count() const;
     AsyncWebSocketClient * client(uint32_t id);
     bool hasClient(uint32_t id){ return client(id) != NULL; }
@@ -282,13 +337,13 @@ class AsyncWebSocket: public AsyncWebHandler {
     void text(uint32_t id, const String &message);
     void text(uint32_t id, const __FlashStringHelper *message);
 
-    void textAll(const char * message, size_t len);
+    void textAll(const char * message, size_t len, uint32_t key=0);
     void textAll(const char * message);
     void textAll(uint8_t * message, size_t len);
     void textAll(char * message);
     void textAll(const String &message);
     void textAll(const __FlashStringHelper *message); //  need to convert
-    void textAll(AsyncWebSocketMessageBuffer * buffer); 
+    void textAll(AsyncWebSocketMessageBuffer * buffer, uint32_t key=0);
 
     void binary(uint32_t id, const char * message, size_t len);
     void binary(uint32_t id, const char * message);
@@ -297,13 +352,13 @@ class AsyncWebSocket: public AsyncWebHandler {
     void binary(uint32_t id, const String &message);
     void binary(uint32_t id, const __FlashStringHelper *message, size_t len);
 
-    void binaryAll(const char * message, size_t len);
+    void binaryAll(const char * message, size_t len, uint32_t key=0);
     void binaryAll(const char * message);
     void binaryAll(uint8_t * message, size_t len);
     void binaryAll(char * message);
     void binaryAll(const String &message);
     void binaryAll(const __FlashStringHelper *message, size_t len);
-    void binaryAll(AsyncWebSocketMessageBuffer * buffer); 
+    void binaryAll(AsyncWebSocketMessageBuffer * buffer, uint32_t key=0);
 
     void message(uint32_t id, AsyncWebSocketMessage *message);
     void messageAll(AsyncWebSocketMultiMessage *message);
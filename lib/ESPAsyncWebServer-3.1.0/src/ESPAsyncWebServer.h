@@ -46,6 +46,13 @@
 
 #define DEBUGF(...) //Serial.printf(__VA_ARGS__)
 
+// Request heads (and url-encoded bodies) are parsed in place into one buffer of
+// this many bytes per connection, with headers and parameters kept as views
+// into it instead of String objects. 0 keeps the String based parser.
+#ifndef ASYNCWEBSERVER_ARENA_SIZE
+#define ASYNCWEBSERVER_ARENA_SIZE 0
+#endif
+
 class AsyncWebServer;
 class AsyncWebServerRequest;
 class AsyncWebServerResponse;
@@ -54,6 +61,7 @@ class AsyncWebParameter;
 class AsyncWebRewrite;
 class AsyncWebHandler;
 class AsyncStaticWebHandler;
+class AsyncStaticProgmemWebHandler;
 class AsyncCallbackWebHandler;
 class AsyncResponseStream;
 
@@ -179,6 +187,30 @@ class AsyncWebServerRequest {
     size_t _itemBufferIndex;
     bool _itemIsFile;
 
+#if ASYNCWEBSERVER_ARENA_SIZE
+    // Text grows up from the start of the arena, entries down from its end
+    struct ArenaEntry {
+      uint16_t name;  // offsets of NUL terminated strings in the arena
+      uint16_t value;
+      uint8_t kind;
+    };
+    char *_arena;
+    uint16_t _arenaText;    // bytes of text in use
+    uint16_t _arenaLine;    // start of the line being received
+    uint16_t _arenaEntries;
+    ArenaEntry* _arenaEntry(size_t i) const;
+    size_t _arenaFree() const;
+    bool _arenaAdd(const char *name, const char *value, uint8_t kind);
+    void _arenaOverflow();
+    size_t _arenaReceive(const char *data, size_t len);
+    void _arenaParseLine(char *line);
+    void _arenaParseReqHead(char *line);
+    void _arenaParseReqHeader(char *line);
+    void _arenaParseParams(char *params, uint8_t kind);
+    void _arenaParsePlainPostChar(uint8_t data);
+    void _arenaMaterialize() const;
+#endif
+
     void _onPoll();
     void _onAck(size_t len, uint32_t time);
     void _onError(int8_t error);
@@ -192,6 +224,7 @@ class AsyncWebServerRequest {
     bool _parseReqHead();
     bool _parseReqHeader();
     void _parseLine();
+    void _parseReqHeadEnd();
     void _parsePlainPostChar(uint8_t data);
     void _parseMultipartPostByte(uint8_t data, bool last);
     void _addGetParams(const String& params);
@@ -280,6 +313,8 @@ class AsyncWebServerRequest {
     const String& ASYNCWEBSERVER_REGEX_ATTRIBUTE pathArg(size_t i) const;
 
     const String& header(const char* name) const;// get request header value by name
+    const char * headerValue(const char* name) const; // header value by name without copying, NULL if absent
+    const char * paramValue(const char* name, bool post=false) const; // parameter value by name without copying, NULL if absent
     const String& header(const __FlashStringHelper * data) const;// get request header value by F(name)    
     const String& header(size_t i) const;        // get request header value by number
     const String& headerName(size_t i) const;    // get request header name by number
@@ -426,6 +461,7 @@ class AsyncWebServer {
     AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody);
 
     AsyncStaticWebHandler& serveStatic(const char* uri, fs::FS& fs, const char* path, const char* cache_control = NULL);
+    AsyncStaticProgmemWebHandler& serveStatic_P(const char* uri, const char* contentType, const uint8_t * content, size_t len, const char* etag = NULL, const char* cache_control = NULL);
 
     void onNotFound(ArRequestHandlerFunction fn);  //called when handler is not assigned
     void onFileUpload(ArUploadHandlerFunction fn); //handle file uploads
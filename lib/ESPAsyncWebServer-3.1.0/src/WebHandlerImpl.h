@@ -63,6 +63,30 @@ class AsyncStaticWebHandler: public AsyncWebHandler {
     AsyncStaticWebHandler& setTemplateProcessor(AwsTemplateProcessor newCallback) {_callback = newCallback; return *this;}
 };
 
+// Serves one PROGMEM asset, usually gzipped at build time, with an ETag and
+// 304 revalidation. An optional uncompressed copy is sent to clients that do
+// not advertise gzip support.
+class AsyncStaticProgmemWebHandler: public AsyncWebHandler {
+  protected:
+    String _uri;
+    String _contentType;
+    const uint8_t * _content;
+    size_t _length;
+    const uint8_t * _identity;
+    size_t _identityLength;
+    String _etag;
+    String _cache_control;
+    bool _gzip;
+    bool _acceptsGzip(AsyncWebServerRequest *request) const;
+  public:
+    AsyncStaticProgmemWebHandler(const char* uri, const char* contentType, const uint8_t * content, size_t len, const char* etag, const char* cache_control);
+    virtual bool canHandle(AsyncWebServerRequest *request) override final;
+    virtual void handleRequest(AsyncWebServerRequest *request) override final;
+    AsyncStaticProgmemWebHandler& setGzip(bool gzip);
+    AsyncStaticProgmemWebHandler& setIdentity(const uint8_t * content, size_t len);
+    AsyncStaticProgmemWebHandler& setCacheControl(const char* cache_control);
+};
+
 class AsyncCallbackWebHandler: public AsyncWebHandler {
   private:
   protected:
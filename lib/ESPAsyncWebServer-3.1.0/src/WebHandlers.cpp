@@ -218,3 +218,88 @@ void AsyncStaticWebHandler::handleRequest(AsyncWebServerRequest *request)
     request->send(404);
   }
 }
+
+/*
+ * Static Progmem Handler
+ * */
+
+AsyncStaticProgmemWebHandler::AsyncStaticProgmemWebHandler(const char* uri, const char* contentType, const uint8_t * content, size_t len, const char* etag, const char* cache_control)
+  : _uri(uri), _contentType(contentType), _content(content), _length(len), _identity(NULL), _identityLength(0), _etag(etag), _cache_control(cache_control), _gzip(true)
+{
+  // Ensure leading '/'
+  if (_uri.length() == 0 || _uri[0] != '/') _uri = "/" + _uri;
+}
+
+AsyncStaticProgmemWebHandler& AsyncStaticProgmemWebHandler::setGzip(bool gzip){
+  _gzip = gzip;
+  return *this;
+}
+
+AsyncStaticProgmemWebHandler& AsyncStaticProgmemWebHandler::setIdentity(const uint8_t * content, size_t len){
+  _identity = content;
+  _identityLength = len;
+  return *this;
+}
+
+AsyncStaticProgmemWebHandler& AsyncStaticProgmemWebHandler::setCacheControl(const char* cache_control){
+  _cache_control = String(cache_control);
+  return *this;
+}
+
+bool AsyncStaticProgmemWebHandler::canHandle(AsyncWebServerRequest *request){
+  if(request->method() != HTTP_GET
+    || request->url() != _uri
+    || !request->isExpectedRequestedConnType(RCT_DEFAULT, RCT_HTTP)
+  ){
+    return false;
+  }
+  if(_etag.length())
+    request->addInterestingHeader("If-None-Match");
+  if(_gzip && _identity)
+    request->addInterestingHeader("Accept-Encoding");
+  return true;
+}
+
+bool AsyncStaticProgmemWebHandler::_acceptsGzip(AsyncWebServerRequest *request) const {
+  const char * accept = request->headerValue("Accept-Encoding");
+  const char * gzip = accept ? strstr(accept, "gzip") : NULL;
+  // "gzip;q=0" explicitly refuses it
+  return gzip && strncmp(gzip + 4, ";q=0", 4);
+}
+
+void AsyncStaticProgmemWebHandler::handleRequest(AsyncWebServerRequest *request)
+{
+  if((_username != "" && _password != "") && !request->authenticate(_username.c_str(), _password.c_str()))
+      return request->requestAuthentication();
+
+  // The ETag names the gzipped bytes, the identity fallback goes out untagged
+  bool identity = _gzip && _identity && !_acceptsGzip(request);
+  AsyncWebServerResponse * response;
+  const char * match = _etag.length() ? request->headerValue("If-None-Match") : NULL;
+  if(!identity && match){
+    if(!strcmp(match, "*") || strstr(match, _etag.c_str())){
+      response = new AsyncBasicResponse(304); // Not modified
+      if(_cache_control.length())
+        response->addHeader("Cache-Control", _cache_control);
+      response->addHeader("ETag", _etag);
+      if(_identity)
+        response->addHeader("Vary", "Accept-Encoding");
+      request->send(response);
+      return;
+    }
+  }
+  if(identity){
+    response = new AsyncStaticProgmemResponse(200, _contentType, _identity, _identityLength);
+  } else {
+    response = new AsyncStaticProgmemResponse(200, _contentType, _content, _length);
+    if(_gzip)
+      response->addHeader("Content-Encoding", "gzip");
+    if(_etag.length())
+      response->addHeader("ETag", _etag);
+  }
+  if(_cache_control.length())
+    response->addHeader("Cache-Control", _cache_control);
+  if(_identity)
+    response->addHeader("Vary", "Accept-Encoding");
+  request->send(response);
+}
@@ -32,6 +32,17 @@ static const String SharedEmptyString = String();
 
 enum { PARSE_REQ_START, PARSE_REQ_HEADERS, PARSE_REQ_BODY, PARSE_REQ_END, PARSE_REQ_FAIL };
 
+#if ASYNCWEBSERVER_ARENA_SIZE
+static_assert(ASYNCWEBSERVER_ARENA_SIZE <= 0xFFFF, "arena offsets are 16 bit");
+
+enum { ARENA_HEADER, ARENA_GET, ARENA_POST, ARENA_COPIED = 0x80 };
+
+// The String based accessors hand out objects; they copy the arena entries out on first use
+#define MATERIALIZE_ARENA() _arenaMaterialize()
+#else
+#define MATERIALIZE_ARENA()
+#endif
+
 AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* s, AsyncClient* c)
   : _client(c)
   , _server(s)
@@ -67,6 +78,12 @@ AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* s, AsyncClient* c)
   , _itemBuffer(0)
   , _itemBufferIndex(0)
   , _itemIsFile(false)
+#if ASYNCWEBSERVER_ARENA_SIZE
+  , _arena((char *)malloc(ASYNCWEBSERVER_ARENA_SIZE))
+  , _arenaText(0)
+  , _arenaLine(0)
+  , _arenaEntries(0)
+#endif
   , _tempObject(NULL)
 {
   c->onError([](void *r, AsyncClient* c, int8_t error){ (void)c; AsyncWebServerRequest *req = (AsyncWebServerRequest*)r; req->_onError(error); }, this);
@@ -96,12 +113,27 @@ AsyncWebServerRequest::~AsyncWebServerRequest(){
   if(_tempFile){
     _tempFile.close();
   }
+
+#if ASYNCWEBSERVER_ARENA_SIZE
+  free(_arena);
+#endif
 }
 
 void AsyncWebServerRequest::_onData(void *buf, size_t len){
   size_t i = 0;
   while (true) {
 
+#if ASYNCWEBSERVER_ARENA_SIZE
+  if(_parseState < PARSE_REQ_BODY){
+    size_t used = _arenaReceive((const char*)buf, len);
+    if(used < len && _parseState == PARSE_REQ_BODY){
+      // The body starts in the same packet
+      buf = (char*)buf + used;
+      len -= used;
+      continue;
+    }
+  } else
+#endif
   if(_parseState < PARSE_REQ_BODY){
     // Find new line in buf
     char *str = (char*)buf;
@@ -159,15 +191,19 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
         _parsedLength += len;
       } else if(needParse) {
         size_t i;
-        for(i=0; i<len; i++){
+        for(i=0; i<len && _parseState == PARSE_REQ_BODY; i++){
           _parsedLength++;
+#if ASYNCWEBSERVER_ARENA_SIZE
+          _arenaParsePlainPostChar(((uint8_t*)buf)[i]);
+#else
           _parsePlainPostChar(((uint8_t*)buf)[i]);
+#endif
         }
       } else {
         _parsedLength += len;
       }
     }
-    if(_parsedLength == _contentLength){
+    if(_parseState == PARSE_REQ_BODY && _parsedLength == _contentLength){
       _parseState = PARSE_REQ_END;
       //check if authenticated before calling handleRequest and request auth instead
       if(_handler) _handler->handleRequest(this);
@@ -180,6 +216,25 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
 
 void AsyncWebServerRequest::_removeNotInterestingHeaders(){
   if (_interestingHeaders.containsIgnoreCase("ANY")) return; // nothing to do
+#if ASYNCWEBSERVER_ARENA_SIZE
+  size_t kept = 0;
+  for(size_t i = 0; i < _arenaEntries; i++){
+    ArenaEntry entry = *_arenaEntry(i);
+    if((entry.kind & ~ARENA_COPIED) == ARENA_HEADER){
+      bool interesting = false;
+      for(const auto& name: _interestingHeaders){
+        if(!strcasecmp(name.c_str(), _arena + entry.name)){
+          interesting = true;
+          break;
+        }
+      }
+      if(!interesting)
+        continue;
+    }
+    *_arenaEntry(kept++) = entry;
+  }
+  _arenaEntries = kept;
+#endif
   for(const auto& header: _headers){
       if(!_interestingHeaders.containsIgnoreCase(header->name().c_str())){
         _headers.remove(header);
@@ -251,6 +306,25 @@ void AsyncWebServerRequest::_addGetParams(const String& params){
   }
 }
 
+static WebRequestMethodComposite _parseMethod(const char *m, WebRequestMethodComposite method){
+  if(!strcmp(m, "GET")){
+    return HTTP_GET;
+  } else if(!strcmp(m, "POST")){
+    return HTTP_POST;
+  } else if(!strcmp(m, "DELETE")){
+    return HTTP_DELETE;
+  } else if(!strcmp(m, "PUT")){
+    return HTTP_PUT;
+  } else if(!strcmp(m, "PATCH")){
+    return HTTP_PATCH;
+  } else if(!strcmp(m, "HEAD")){
+    return HTTP_HEAD;
+  } else if(!strcmp(m, "OPTIONS")){
+    return HTTP_OPTIONS;
+  }
+  return method;
+}
+
 bool AsyncWebServerRequest::_parseReqHead(){
   // Split the head into method, url and version
   int index = _temp.indexOf(' ');
@@ -259,21 +333,7 @@ bool AsyncWebServerRequest::_parseReqHead(){
   String u = _temp.substring(m.length()+1, index);
   _temp = _temp.substring(index+1);
 
-  if(m == "GET"){
-    _method = HTTP_GET;
-  } else if(m == "POST"){
-    _method = HTTP_POST;
-  } else if(m == "DELETE"){
-    _method = HTTP_DELETE;
-  } else if(m == "PUT"){
-    _method = HTTP_PUT;
-  } else if(m == "PATCH"){
-    _method = HTTP_PATCH;
-  } else if(m == "HEAD"){
-    _method = HTTP_HEAD;
-  } else if(m == "OPTIONS"){
-    _method = HTTP_OPTIONS;
-  }
+  _method = _parseMethod(m.c_str(), _method);
 
   String g = String();
   index = u.indexOf('?');
@@ -565,37 +625,296 @@ void AsyncWebServerRequest::_parseLine(){
 
   if(_parseState == PARSE_REQ_HEADERS){
     if(!_temp.length()){
-      //end of headers
-      _server->_rewriteRequest(this);
-      _server->_attachHandler(this);
-      _removeNotInterestingHeaders();
-      if(_expectingContinue){
-        const char * response = "HTTP/1.1 100 Continue\r\n\r\n";
-        _client->write(response, os_strlen(response));
-      }
-      //check handler for authentication
-      if(_contentLength){
-        _parseState = PARSE_REQ_BODY;
-      } else {
-        _parseState = PARSE_REQ_END;
-        if(_handler) _handler->handleRequest(this);
-        else send(501);
-      }
+      _parseReqHeadEnd();
     } else _parseReqHeader();
   }
 }
 
+void AsyncWebServerRequest::_parseReqHeadEnd(){
+  //end of headers
+  _server->_rewriteRequest(this);
+  _server->_attachHandler(this);
+  _removeNotInterestingHeaders();
+  if(_expectingContinue){
+    const char * response = "HTTP/1.1 100 Continue\r\n\r\n";
+    _client->write(response, os_strlen(response));
+  }
+  //check handler for authentication
+  if(_contentLength){
+    _parseState = PARSE_REQ_BODY;
+  } else {
+    _parseState = PARSE_REQ_END;
+    if(_handler) _handler->handleRequest(this);
+    else send(501);
+  }
+}
+
+#if ASYNCWEBSERVER_ARENA_SIZE
+/*
+ * Arena parser: the head is copied into the arena a line at a time and
+ * tokenized in place. Names and values are NUL terminated inside the arena,
+ * url-decoding shrinks them where they are, and the entry table at the end
+ * of the arena records their offsets.
+ * */
+
+static void _urlDecodeInPlace(char *text){
+  char *out = text;
+  while(*text){
+    char decodedChar = *text++;
+    if(decodedChar == '%' && text[0] && text[1]){
+      char temp[3] = { text[0], text[1], 0 };
+      decodedChar = strtol(temp, NULL, 16);
+      text += 2;
+    } else if(decodedChar == '+'){
+      decodedChar = ' ';
+    }
+    *out++ = decodedChar;
+  }
+  *out = 0;
+}
+
+static bool _containsIgnoreCase(const char *text, const char *find){
+  size_t flen = strlen(find);
+  for(; *text; text++){
+    if(!strncasecmp(text, find, flen))
+      return true;
+  }
+  return false;
+}
+
+AsyncWebServerRequest::ArenaEntry* AsyncWebServerRequest::_arenaEntry(size_t i) const {
+  const size_t end = ASYNCWEBSERVER_ARENA_SIZE / sizeof(ArenaEntry) * sizeof(ArenaEntry);
+  return (ArenaEntry *)(_arena + end) - 1 - i;
+}
+
+size_t AsyncWebServerRequest::_arenaFree() const {
+  // between the end of the text and the last entry
+  return (char *)(_arenaEntry(_arenaEntries) + 1) - (_arena + _arenaText);
+}
+
+bool AsyncWebServerRequest::_arenaAdd(const char *name, const char *value, uint8_t kind){
+  if(_arenaFree() < sizeof(ArenaEntry)){
+    _arenaOverflow();
+    return false;
+  }
+  ArenaEntry *entry = _arenaEntry(_arenaEntries++);
+  entry->name = name - _arena;
+  entry->value = value - _arena;
+  entry->kind = kind;
+  return true;
+}
+
+void AsyncWebServerRequest::_arenaOverflow(){
+  bool body = _parseState == PARSE_REQ_BODY;
+  _parseState = PARSE_REQ_FAIL;
+  send(body ? 413 : 431);
+}
+
+size_t AsyncWebServerRequest::_arenaReceive(const char *data, size_t len){
+  if(!_arena){
+    _parseState = PARSE_REQ_FAIL;
+    _client->close();
+    return len;
+  }
+  size_t used = 0;
+  while(used < len && _parseState < PARSE_REQ_BODY){
+    const char *newline = (const char *)memchr(data + used, '\n', len - used);
+    size_t n = (newline ? newline + 1 : data + len) - (data + used);
+    if(_arenaFree() < n){
+      _arenaOverflow();
+      return len;
+    }
+    memcpy(_arena + _arenaText, data + used, n);
+    _arenaText += n;
+    used += n;
+    if(newline){
+      char *line = _arena + _arenaLine;
+      _arena[_arenaText - 1] = 0;
+      _arenaLine = _arenaText;
+      _arenaParseLine(line);
+    }
+  }
+  return used;
+}
+
+void AsyncWebServerRequest::_arenaParseLine(char *line){
+  char *end = line + strlen(line);
+  while(end > line && isspace((unsigned char)end[-1]))
+    *--end = 0;
+  while(isspace((unsigned char)*line))
+    line++;
+
+  if(_parseState == PARSE_REQ_START){
+    if(!*line){
+      _parseState = PARSE_REQ_FAIL;
+      _client->close();
+    } else {
+      _arenaParseReqHead(line);
+      if(_parseState == PARSE_REQ_START)
+        _parseState = PARSE_REQ_HEADERS;
+    }
+  } else if(_parseState == PARSE_REQ_HEADERS){
+    if(!*line){
+      _parseReqHeadEnd();
+    } else _arenaParseReqHeader(line);
+  }
+}
+
+void AsyncWebServerRequest::_arenaParseReqHead(char *line){
+  // Split the head into method, url and version
+  char *url = strchr(line, ' ');
+  if(url) *url++ = 0;
+  else url = line + strlen(line);
+  char *version = strchr(url, ' ');
+  if(version) *version++ = 0;
+  else version = url + strlen(url);
+
+  _method = _parseMethod(line, _method);
+
+  char *params = strchr(url, '?');
+  if(params == url){
+    params = NULL;
+  } else if(params){
+    *params++ = 0;
+  }
+  _urlDecodeInPlace(url);
+  _url = url;
+  if(params)
+    _arenaParseParams(params, ARENA_GET);
+
+  if(strncmp(version, "HTTP/1.0", 8))
+    _version = 1;
+}
+
+void AsyncWebServerRequest::_arenaParseReqHeader(char *line){
+  char *value = strchr(line, ':');
+  if(!value || value == line)
+    return;
+  *value++ = 0;
+  while(*value == ' ' || *value == '\t')
+    value++;
+  const char *name = line;
+
+  if(!strcasecmp(name, "Host")){
+    _host = value;
+  } else if(!strcasecmp(name, "Content-Type")){
+    _contentType = value;
+    int index = _contentType.indexOf(';');
+    if(index >= 0)
+      _contentType.remove(index);
+    if(!strncmp(value, "multipart/", 10)){
+      const char *boundary = strchr(value, '=');
+      _boundary = boundary ? boundary + 1 : value;
+      _boundary.replace("\"","");
+      _isMultipart = true;
+    }
+  } else if(!strcasecmp(name, "Content-Length")){
+    _contentLength = atoi(value);
+  } else if(!strcasecmp(name, "Expect") && !strcmp(value, "100-continue")){
+    _expectingContinue = true;
+  } else if(!strcasecmp(name, "Authorization")){
+    if(strlen(value) > 5 && !strncasecmp(value, "Basic", 5)){
+      _authorization = value + 6;
+    } else if(strlen(value) > 6 && !strncasecmp(value, "Digest", 6)){
+      _isDigest = true;
+      _authorization = value + 7;
+    }
+  } else if(!strcasecmp(name, "Upgrade") && !strcasecmp(value, "websocket")){
+    // WebSocket request can be uniquely identified by header: [Upgrade: websocket]
+    _reqconntype = RCT_WS;
+  } else if(!strcasecmp(name, "Accept") && _containsIgnoreCase(value, "text/event-stream")){
+    // WebEvent request can be uniquely identified by header:  [Accept: text/event-stream]
+    _reqconntype = RCT_EVENT;
+  }
+  _arenaAdd(line, value, ARENA_HEADER);
+}
+
+void AsyncWebServerRequest::_arenaParseParams(char *params, uint8_t kind){
+  while(*params){
+    char *end = strchr(params, '&');
+    char *next = end ? end + 1 : params + strlen(params);
+    if(end) *end = 0;
+    char *value = strchr(params, '=');
+    if(value) *value++ = 0;
+    else value = params + strlen(params);
+    _urlDecodeInPlace(params);
+    _urlDecodeInPlace(value);
+    if(!_arenaAdd(params, value, kind))
+      return;
+    params = next;
+  }
+}
+
+void AsyncWebServerRequest::_arenaParsePlainPostChar(uint8_t data){
+  // The field grows from _arenaLine; one byte is kept back for its terminator
+  if(data && (char)data != '&'){
+    if(_arenaFree() < 2){
+      _arenaOverflow();
+      return;
+    }
+    _arena[_arenaText++] = data;
+  }
+  if(!data || (char)data == '&' || _parsedLength == _contentLength){
+    // '&' or NUL may come with the arena full to the byte
+    if(_arenaFree() < 1){
+      _arenaOverflow();
+      return;
+    }
+    char *field = _arena + _arenaLine;
+    _arena[_arenaText++] = 0;
+    _arenaLine = _arenaText;
+    char *value = strchr(field, '=');
+    if(*field != '{' && *field != '[' && value && value > field){
+      *value++ = 0;
+      _urlDecodeInPlace(field);
+    } else {
+      // not name=value, hand the whole body over as "body"
+      if(_arenaFree() < sizeof("body")){
+        _arenaOverflow();
+        return;
+      }
+      value = field;
+      field = _arena + _arenaText;
+      memcpy(field, "body", sizeof("body"));
+      _arenaText += sizeof("body");
+      _arenaLine = _arenaText;
+    }
+    _urlDecodeInPlace(value);
+    _arenaAdd(field, value, ARENA_POST);
+  }
+}
+
+void AsyncWebServerRequest::_arenaMaterialize() const {
+  AsyncWebServerRequest *self = const_cast<AsyncWebServerRequest *>(this);
+  for(size_t i = 0; i < _arenaEntries; i++){
+    ArenaEntry *entry = _arenaEntry(i);
+    if(entry->kind & ARENA_COPIED)
+      continue;
+    if(entry->kind == ARENA_HEADER)
+      self->_headers.add(new AsyncWebHeader(_arena + entry->name, _arena + entry->value));
+    else
+      self->_params.add(new AsyncWebParameter(_arena + entry->name, _arena + entry->value, entry->kind == ARENA_POST));
+    entry->kind |= ARENA_COPIED;
+  }
+}
+#endif
+
 size_t AsyncWebServerRequest::headers() const{
+  MATERIALIZE_ARENA();
   return _headers.length();
 }
 
 bool AsyncWebServerRequest::hasHeader(const String& name) const {
+#if ASYNCWEBSERVER_ARENA_SIZE
+  return headerValue(name.c_str()) != NULL;
+#else
   for(const auto& h: _headers){
     if(h->name().equalsIgnoreCase(name)){
       return true;
     }
   }
   return false;
+#endif
 }
 
 bool AsyncWebServerRequest::hasHeader(const __FlashStringHelper * data) const {
@@ -619,6 +938,7 @@ bool AsyncWebServerRequest::hasHeader(const __FlashStringHelper * data) const {
 }
 
 AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const {
+  MATERIALIZE_ARENA();
   for(const auto& h: _headers){
     if(h->name().equalsIgnoreCase(name)){
       return h;
@@ -642,15 +962,21 @@ AsyncWebHeader* AsyncWebServerRequest::getHeader(const __FlashStringHelper * dat
 }
 
 AsyncWebHeader* AsyncWebServerRequest::getHeader(size_t num) const {
+  MATERIALIZE_ARENA();
   auto header = _headers.nth(num);
   return header ? *header : nullptr;
 }
 
 size_t AsyncWebServerRequest::params() const {
+  MATERIALIZE_ARENA();
   return _params.length();
 }
 
 bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const {
+#if ASYNCWEBSERVER_ARENA_SIZE
+  if(!file && paramValue(name.c_str(), post))
+    return true;
+#endif
   for(const auto& p: _params){
     if(p->name() == name && p->isPost() == post && p->isFile() == file){
       return true;
@@ -676,6 +1002,7 @@ bool AsyncWebServerRequest::hasParam(const __FlashStringHelper * data, bool post
 }
 
 AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool file) const {
+  MATERIALIZE_ARENA();
   for(const auto& p: _params){
     if(p->name() == name && p->isPost() == post && p->isFile() == file){
       return p;
@@ -699,6 +1026,7 @@ AsyncWebParameter* AsyncWebServerRequest::getParam(const __FlashStringHelper * d
 }
 
 AsyncWebParameter* AsyncWebServerRequest::getParam(size_t num) const {
+  MATERIALIZE_ARENA();
   auto param = _params.nth(num);
   return param ? *param : nullptr;
 }
@@ -862,6 +1190,10 @@ void AsyncWebServerRequest::requestAuthentication(const char * realm, bool isDig
 }
 
 bool AsyncWebServerRequest::hasArg(const char* name) const {
+#if ASYNCWEBSERVER_ARENA_SIZE
+  if(paramValue(name, false) || paramValue(name, true))
+    return true;
+#endif
   for(const auto& arg: _params){
     if(arg->name() == name){
       return true;
@@ -886,6 +1218,7 @@ bool AsyncWebServerRequest::hasArg(const __FlashStringHelper * data) const {
 
 
 const String& AsyncWebServerRequest::arg(const String& name) const {
+  MATERIALIZE_ARENA();
   for(const auto& arg: _params){
     if(arg->name() == name){
       return arg->value();
@@ -952,6 +1285,38 @@ const String& AsyncWebServerRequest::headerName(size_t i) const {
   return h ? h->name() : SharedEmptyString;
 }
 
+const char * AsyncWebServerRequest::headerValue(const char* name) const {
+#if ASYNCWEBSERVER_ARENA_SIZE
+  for(size_t i = 0; i < _arenaEntries; i++){
+    const ArenaEntry *entry = _arenaEntry(i);
+    if((entry->kind & ~ARENA_COPIED) == ARENA_HEADER && !strcasecmp(_arena + entry->name, name))
+      return _arena + entry->value;
+  }
+  return NULL;
+#else
+  AsyncWebHeader* h = getHeader(String(name));
+  return h ? h->value().c_str() : NULL;
+#endif
+}
+
+const char * AsyncWebServerRequest::paramValue(const char* name, bool post) const {
+#if ASYNCWEBSERVER_ARENA_SIZE
+  uint8_t kind = post ? ARENA_POST : ARENA_GET;
+  for(size_t i = 0; i < _arenaEntries; i++){
+    const ArenaEntry *entry = _arenaEntry(i);
+    if((entry->kind & ~ARENA_COPIED) == kind && !strcmp(_arena + entry->name, name))
+      return _arena + entry->value;
+  }
+  // multipart fields are not kept in the arena
+#endif
+  for(const auto& p: _params){
+    if(p->isPost() == post && !p->isFile() && p->name() == name){
+      return p->value().c_str();
+    }
+  }
+  return NULL;
+}
+
 String AsyncWebServerRequest::urlDecode(const String& text) const {
   char temp[] = "0x00";
   unsigned int len = text.length();
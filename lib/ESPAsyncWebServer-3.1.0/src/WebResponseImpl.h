@@ -118,6 +118,19 @@ class AsyncProgmemResponse: public AsyncAbstractResponse {
     virtual size_t _fillBuffer(uint8_t *buf, size_t maxLen) override;
 };
 
+// Fixed PROGMEM body (typically pre-gzipped) queued straight from flash into
+// the TCP send buffer: no template scanning and no intermediate heap buffer
+class AsyncStaticProgmemResponse: public AsyncWebServerResponse {
+  private:
+    String _head;
+    const uint8_t * _content;
+  public:
+    AsyncStaticProgmemResponse(int code, const String& contentType, const uint8_t * content, size_t len);
+    void _respond(AsyncWebServerRequest *request);
+    size_t _ack(AsyncWebServerRequest *request, size_t len, uint32_t time);
+    bool _sourceValid() const { return true; }
+};
+
 class cbuf;
 
 class AsyncResponseStream: public AsyncAbstractResponse, public Print {
@@ -72,6 +72,7 @@ const char* AsyncWebServerResponse::_responseCodeToString(int code) {
     case 415: return "Unsupported Media Type";
     case 416: return "Requested range not satisfiable";
     case 417: return "Expectation Failed";
+    case 431: return "Request Header Fields Too Large";
     case 500: return "Internal Server Error";
     case 501: return "Not Implemented";
     case 502: return "Bad Gateway";
@@ -661,6 +662,75 @@ size_t AsyncProgmemResponse::_fillBuffer(uint8_t *data, size_t len){
   return left;
 }
 
+/*
+ * Static Progmem Response
+ * */
+
+AsyncStaticProgmemResponse::AsyncStaticProgmemResponse(int code, const String& contentType, const uint8_t * content, size_t len){
+  _code = code;
+  _content = content;
+  _contentType = contentType;
+  _contentLength = len;
+}
+
+void AsyncStaticProgmemResponse::_respond(AsyncWebServerRequest *request){
+  addHeader("Connection","close");
+  _head = _assembleHead(request->version());
+  _state = RESPONSE_HEADERS;
+  _ack(request, 0, 0);
+}
+
+size_t AsyncStaticProgmemResponse::_ack(AsyncWebServerRequest *request, size_t len, uint32_t time){
+  (void)time;
+  _ackedLength += len;
+  if(_state == RESPONSE_HEADERS || _state == RESPONSE_CONTENT){
+    AsyncClient *client = request->client();
+    size_t space = client->space();
+    size_t queued = 0;
+    while(space && _state != RESPONSE_WAIT_ACK){
+      size_t added;
+      if(_state == RESPONSE_HEADERS){
+        added = client->add(_head.c_str() + _writtenLength, std::min(space, _headLength - _writtenLength));
+        _writtenLength += added;
+        if(_writtenLength == _headLength){
+          _head = String();
+          _state = _contentLength ? RESPONSE_CONTENT : RESPONSE_WAIT_ACK;
+        }
+      } else {
+        size_t outLen = std::min(space, _contentLength - _sentLength);
+#ifdef ESP8266
+        // flash is not byte addressable here, bounce through the stack
+        uint8_t buf[256];
+        outLen = std::min(outLen, sizeof(buf));
+        memcpy_P(buf, _content + _sentLength, outLen);
+        added = client->add((const char*)buf, outLen);
+#else
+        added = client->add((const char*)_content + _sentLength, outLen);
+#endif
+        _sentLength += added;
+        _writtenLength += added;
+        if(_sentLength == _contentLength){
+          _state = RESPONSE_WAIT_ACK;
+        }
+      }
+      if(!added){
+        break;
+      }
+      space -= added;
+      queued += added;
+    }
+    if(queued){
+      client->send();
+    }
+    return queued;
+  } else if(_state == RESPONSE_WAIT_ACK){
+    if(_ackedLength >= _writtenLength){
+      _state = RESPONSE_END;
+    }
+  }
+  return 0;
+}
+
 
 /*
  * Response Stream (You can print/write/printf to it, up to the contentLen bytes)
@@ -168,6 +168,12 @@ AsyncStaticWebHandler& AsyncWebServer::serveStatic(const char* uri, fs::FS& fs,
   return *handler;
 }
 
+AsyncStaticProgmemWebHandler& AsyncWebServer::serveStatic_P(const char* uri, const char* contentType, const uint8_t * content, size_t len, const char* etag, const char* cache_control){
+  AsyncStaticProgmemWebHandler* handler = new AsyncStaticProgmemWebHandler(uri, contentType, content, len, etag, cache_control);
+  addHandler(handler);
+  return *handler;
+}
+
 void AsyncWebServer::onNotFound(ArRequestHandlerFunction fn){
   _catchAllHandler->onRequest(fn);
 }
@@ -0,0 +1,233 @@
+//
+//  inflate_check.cpp
+//  pngdec_test
+//
+//  Verifies that inflate_fast() produces bit-exact output over a corpus of
+//  deflate streams and reports its throughput.
+//
+//  The reference output is produced by feeding inflate() with at most 257
+//  bytes of output space per call, which keeps it on the byte-wise slow path
+//  and never enters inflate_fast(). The same stream is then decoded through
+//  the fast path in one shot and in PNG-row sized chunks (which exercises the
+//  sliding window copies) and compared byte for byte.
+//
+//  Usage: inflate_check [-b iterations] <file.png | file.zlib> ...
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <vector>
+#include <string>
+
+#include "../src/zutil.h"
+#include "../src/inftrees.h"
+#include "../src/inflate.h"
+
+// The PNG assets embedded in the firmware
+#define PROGMEM
+typedef uint8_t byte;
+#include "../../../include/fancySplash.h"
+#include "../../../include/factoryReset.h"
+
+struct Sample {
+    std::string name;
+    std::vector<uint8_t> zlib; // zlib wrapped deflate stream
+};
+
+// Same layout as PNGdec uses: inflate_state followed by the 32K window
+struct Inflater {
+    z_stream strm;
+    uint8_t mem[sizeof(struct inflate_state) + 32768];
+
+    int init()
+    {
+        struct inflate_state *state = (struct inflate_state *)mem;
+        memset(&strm, 0, sizeof(strm));
+        strm.state = (struct internal_state *)state;
+        state->window = &mem[sizeof(struct inflate_state)];
+        return inflateInit(&strm);
+    }
+};
+
+static double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Concatenate the IDAT chunks of a PNG file into a single zlib stream
+static bool extractIDAT(const uint8_t *pData, size_t iSize, std::vector<uint8_t> &out)
+{
+    static const uint8_t sig[8] = {0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a};
+    if (iSize < 8 || memcmp(pData, sig, 8) != 0)
+        return false;
+    size_t off = 8;
+    while (off + 12 <= iSize) {
+        uint32_t len = get32(&pData[off]);
+        uint32_t type = get32(&pData[off + 4]);
+        if (off + 12 + len > iSize)
+            break;
+        if (type == 0x49444154) // 'IDAT'
+            out.insert(out.end(), &pData[off + 8], &pData[off + 8 + len]);
+        off += 12 + len;
+    }
+    return !out.empty();
+}
+
+static bool loadFile(const char *fname, Sample &s)
+{
+    FILE *f = fopen(fname, "rb");
+    if (f == NULL)
+        return false;
+    fseek(f, 0L, SEEK_END);
+    long iSize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    std::vector<uint8_t> data((size_t)iSize);
+    size_t got = fread(data.data(), 1, data.size(), f);
+    fclose(f);
+    if (got != data.size())
+        return false;
+    s.name = fname;
+    if (!extractIDAT(data.data(), data.size(), s.zlib))
+        s.zlib = data; // treat as a raw zlib stream
+    return true;
+}
+
+// Decode with avail_out < 258 so that inflate_fast() is never used
+static int decodeReference(const Sample &s, std::vector<uint8_t> &out)
+{
+    Inflater inf;
+    uint8_t chunk[257];
+    int err = inf.init();
+    inf.strm.next_in = (Bytef *)s.zlib.data();
+    inf.strm.avail_in = (uInt)s.zlib.size();
+    while (err == Z_OK) {
+        inf.strm.next_out = chunk;
+        inf.strm.avail_out = sizeof(chunk);
+        err = inflate(&inf.strm, Z_NO_FLUSH, 1);
+        out.insert(out.end(), chunk, chunk + (sizeof(chunk) - inf.strm.avail_out));
+        if (err == Z_BUF_ERROR && inf.strm.avail_in == 0)
+            break;
+    }
+    return err;
+}
+
+// Decode through the fast path, iOutChunk/iInChunk == 0 means all at once
+static int decodeFast(const Sample &s, uint8_t *pOut, size_t iOutSize, size_t iOutChunk, size_t iInChunk, int bCheck, size_t *pDecoded)
+{
+    Inflater inf;
+    int err = inf.init();
+    size_t inOff = 0, outOff = 0;
+    while (err == Z_OK) {
+        if (inf.strm.avail_in == 0) {
+            size_t n = s.zlib.size() - inOff;
+            if (iInChunk && n > iInChunk)
+                n = iInChunk;
+            if (n == 0)
+                break;
+            inf.strm.next_in = (Bytef *)&s.zlib[inOff];
+            inf.strm.avail_in = (uInt)n;
+            inOff += n;
+        }
+        if (inf.strm.avail_out == 0) {
+            size_t n = iOutSize - outOff;
+            if (iOutChunk && n > iOutChunk)
+                n = iOutChunk;
+            if (n == 0)
+                break;
+            inf.strm.next_out = &pOut[outOff];
+            inf.strm.avail_out = (uInt)n;
+            outOff += n;
+        }
+        err = inflate(&inf.strm, Z_NO_FLUSH, bCheck);
+    }
+    *pDecoded = outOff - inf.strm.avail_out;
+    return err;
+}
+
+int main(int argc, const char *argv[])
+{
+    std::vector<Sample> corpus;
+    int iIterations = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            iIterations = atoi(argv[++i]);
+            continue;
+        }
+        Sample s;
+        if (!loadFile(argv[i], s)) {
+            fprintf(stderr, "Unable to open file: %s\n", argv[i]);
+            return -1;
+        }
+        corpus.push_back(s);
+    }
+    Sample splash, reset;
+    splash.name = "include/fancySplash.h";
+    extractIDAT(fancySplash, sizeof(fancySplash), splash.zlib);
+    corpus.push_back(splash);
+    reset.name = "include/factoryReset.h";
+    extractIDAT(factoryReset, sizeof(factoryReset), reset.zlib);
+    corpus.push_back(reset);
+
+    int iFailures = 0;
+    size_t iTotalOut = 0;
+    std::vector<std::vector<uint8_t>> refs;
+    for (const Sample &s : corpus) {
+        std::vector<uint8_t> ref;
+        int err = decodeReference(s, ref);
+        refs.push_back(ref);
+        iTotalOut += ref.size();
+        if (err != Z_STREAM_END) {
+            printf("FAIL %s: reference decode returned %d\n", s.name.c_str(), err);
+            iFailures++;
+            continue;
+        }
+        // one shot, PNG row sized output with 2K input reads, and tiny input reads
+        static const size_t chunks[][2] = {{0, 0}, {1281, 2048}, {961, 7}};
+        for (const auto &c : chunks) {
+            std::vector<uint8_t> out(ref.size() + 1);
+            size_t iDecoded;
+            err = decodeFast(s, out.data(), out.size(), c[0], c[1], 1, &iDecoded);
+            if (err != Z_STREAM_END || iDecoded != ref.size() || memcmp(out.data(), ref.data(), ref.size()) != 0) {
+                printf("FAIL %s: out chunk %d, in chunk %d (err %d, %d of %d bytes)\n", s.name.c_str(),
+                       (int)c[0], (int)c[1], err, (int)iDecoded, (int)ref.size());
+                iFailures++;
+            }
+        }
+        printf("%-40s %8d -> %9d bytes\n", s.name.c_str(), (int)s.zlib.size(), (int)ref.size());
+    }
+    printf("%d streams, %s\n", (int)corpus.size(), iFailures ? "MISMATCH" : "bit-exact");
+
+    if (iIterations > 0) {
+        // report the fastest pass over the corpus to filter out scheduling noise
+        static const size_t rows[2] = {0, 1281};
+        std::vector<uint8_t> out;
+        for (size_t iRow : rows) {
+            double best = 1e9;
+            for (int j = 0; j < iIterations; j++) {
+                double t0 = now_sec();
+                for (size_t k = 0; k < corpus.size(); k++) {
+                    out.resize(refs[k].size() + 1);
+                    size_t iDecoded;
+                    decodeFast(corpus[k], out.data(), out.size(), iRow, 0, 0, &iDecoded); // Adler-32 off, inflate only
+                }
+                double dt = now_sec() - t0;
+                if (dt < best)
+                    best = dt;
+            }
+            printf("%s: %.1f MB/s output (best of %d passes, %.1f ms)\n", iRow ? "row sized" : "one shot",
+                   (double)iTotalOut / best / 1e6, iIterations, best * 1e3);
+        }
+    }
+    return iFailures ? 1 : 0;
+}
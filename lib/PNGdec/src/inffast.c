@@ -15,6 +15,109 @@
 #if ((INTPTR_MAX == INT64_MAX) || defined(HAL_ESP32_HAL_H_) || defined(TEENSYDUINO) || defined(ARM_MATH_CM4) || defined(ARM_MATH_CM7)) && !defined(ARDUINO_ARCH_RP2040)
 #define ALLOWS_UNALIGNED
 #endif
+
+/*
+   On 64-bit little-endian hosts the bit accumulator is refilled 7 bytes at a
+   time with a single unaligned load, which leaves at least 56 bits available
+   at the top of each loop: enough for a complete length/distance pair (48
+   bits) or several literals without touching the input pointer again.
+ */
+#if defined(ALLOWS_UNALIGNED) && (INTPTR_MAX == INT64_MAX) && \
+    (!defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+#define INFLATE_FAST_64
+typedef uint64_t bitbuf;
+#else
+typedef unsigned long bitbuf;
+#endif
+
+#ifdef ALLOWS_UNALIGNED
+#if INTPTR_MAX == INT64_MAX
+typedef uint64_t copyword;
+#else
+typedef uint32_t copyword;
+#endif
+#define WORDSIZE ((unsigned)sizeof(copyword))
+#endif
+
+/*
+   Copy len bytes from a source that does not overlap the destination closer
+   than a word (the window, or a match with dist >= WORDSIZE).
+ */
+local inline unsigned char FAR *copy_words(unsigned char FAR *out, const unsigned char FAR *from, unsigned len)
+{
+#ifdef ALLOWS_UNALIGNED
+    while (len >= WORDSIZE) {
+        copyword w;
+        memcpy(&w, from, WORDSIZE);
+        memcpy(out, &w, WORDSIZE);
+        out += WORDSIZE;
+        from += WORDSIZE;
+        len -= WORDSIZE;
+    }
+#endif
+    while (len > 2) {
+        *out++ = *from++;
+        *out++ = *from++;
+        *out++ = *from++;
+        len -= 3;
+    }
+    if (len) {
+        *out++ = *from++;
+        if (len > 1)
+            *out++ = *from++;
+    }
+    return out;
+}
+
+/*
+   Copy a match of len bytes that starts dist bytes back in the output. The
+   source and destination may overlap. Runs (dist == 1) become a fill; other
+   short distances are copied a byte at a time until the repeating pattern is
+   at least a word long, after which the source is moved back by a whole
+   number of periods and the rest is copied a machine word at a time. When
+   limit (the end of the output buffer) allows it the last word is allowed to
+   overshoot out + len; those bytes are rewritten by later output.
+ */
+local inline unsigned char FAR *copy_match(unsigned char FAR *out, unsigned dist, unsigned len, unsigned char FAR *limit)
+{
+    const unsigned char FAR *from = out - dist;
+#ifdef ALLOWS_UNALIGNED
+    if (dist == 1) {
+        memset(out, *from, len);
+        return out + len;
+    }
+    if (dist < WORDSIZE) {
+        unsigned n = WORDSIZE;
+        if (len < 2 * WORDSIZE) {           /* short, byte-wise */
+            do {
+                *out++ = *from++;
+            } while (--len);
+            return out;
+        }
+        len -= n;
+        do {
+            *out++ = *from++;
+        } while (--n);
+        dist *= (dist + WORDSIZE) / dist;   /* period multiple >= WORDSIZE */
+        from = out - dist;
+    }
+    if ((unsigned)(limit - out) >= len + WORDSIZE) {
+        unsigned char FAR *stop = out + len;
+        do {
+            copyword w;
+            memcpy(&w, from, WORDSIZE);
+            memcpy(out, &w, WORDSIZE);
+            out += WORDSIZE;
+            from += WORDSIZE;
+        } while (out < stop);
+        return stop;
+    }
+#else
+    (void)limit;
+#endif
+    return copy_words(out, from, len);
+}
+
 /*
    Decode literal, length, and distance codes and write out the resulting
    literal and match bytes until either not enough input or output is
@@ -49,14 +152,23 @@
       bytes, which is the maximum length that can be coded.  inflate_fast()
       requires strm->avail_out >= 258 for each loop to avoid checking for
       output space.
+
+    - With INFLATE_FAST_64 the wide refill is only used while at least 8 input
+      bytes remain; the last few bytes fall back to the byte-wise refill, so
+      the entry assumptions are unchanged.
  */
 void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
     struct inflate_state FAR *state;
     z_const unsigned char FAR *in;      /* local strm->next_in */
     z_const unsigned char FAR *last;    /* have enough input while in < last */
+#ifdef INFLATE_FAST_64
+    z_const unsigned char FAR *lastwide;    /* 8-byte loads allowed while in < lastwide */
+    int lits;                   /* literals decoded since the last refill */
+#endif
     unsigned char FAR *out;     /* local strm->next_out */
     unsigned char FAR *beg;     /* inflate()'s initial strm->next_out */
     unsigned char FAR *end;     /* while out < end, enough space available */
+    unsigned char FAR *limit;   /* end of the output buffer */
 #ifdef INFLATE_STRICT
     unsigned dmax;              /* maximum distance from zlib header */
 #endif
@@ -64,7 +176,7 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
     unsigned whave;             /* valid bytes in the window */
     unsigned wnext;             /* window write index */
     unsigned char FAR *window;  /* allocated sliding window, if wsize != 0 */
-    unsigned long hold;         /* local strm->hold */
+    bitbuf hold;                /* local strm->hold */
     unsigned bits;              /* local strm->bits */
     code const FAR *lcode;      /* local strm->lencode */
     code const FAR *dcode;      /* local strm->distcode */
@@ -81,9 +193,13 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
     state = (struct inflate_state FAR *)strm->state;
     in = strm->next_in;
     last = in + (strm->avail_in - 5);
+#ifdef INFLATE_FAST_64
+    lastwide = strm->avail_in >= 8 ? in + (strm->avail_in - 7) : in;
+#endif
     out = strm->next_out;
     beg = out - (start - strm->avail_out);
     end = out + (strm->avail_out - 257);
+    limit = out + strm->avail_out;
 #ifdef INFLATE_STRICT
     dmax = state->dmax;
 #endif
@@ -91,7 +207,7 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
     whave = state->whave;
     wnext = state->wnext;
     window = state->window;
-    hold = state->hold;
+    hold = (bitbuf)state->hold;
     bits = state->bits;
     lcode = state->lencode;
     dcode = state->distcode;
@@ -101,13 +217,28 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
     /* decode literals and length/distances until end-of-block or not enough
        input data or output space */
     do {
+#ifdef INFLATE_FAST_64
+        if (in < lastwide) {
+            uint64_t w;
+            memcpy(&w, in, 8);
+            hold |= w << bits;
+            in += (63 - bits) >> 3;
+            bits |= 56;
+            /* hold may now also contain the low bits of *in above bits; all
+               refills OR in whole bytes, so re-reading them is harmless */
+        }
+        else
+#endif
         if (bits < 15) {
-            hold += (unsigned long)(*in++) << bits;
+            hold |= (bitbuf)(*in++) << bits;
             bits += 8;
-            hold += (unsigned long)(*in++) << bits;
+            hold |= (bitbuf)(*in++) << bits;
             bits += 8;
         }
         here = lcode + (hold & lmask);
+#ifdef INFLATE_FAST_64
+        lits = 0;
+#endif
       dolen:
         op = (unsigned)(here->bits);
         hold >>= op;
@@ -118,13 +249,24 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
                     "inflate:         literal '%c'\n" :
                     "inflate:         literal 0x%02x\n", here->val));
             *out++ = (unsigned char)(here->val);
+#ifdef INFLATE_FAST_64
+            /* literals come in runs: decode up to two more from the same
+               refill if their first level entry is a literal */
+            if (lits < 2) {
+                here = lcode + (hold & lmask);
+                if (here->op == 0 && here->bits <= bits) {
+                    lits++;
+                    goto dolen;
+                }
+            }
+#endif
         }
         else if (op & 16) {                     /* length base */
             len = (unsigned)(here->val);
             op &= 15;                           /* number of extra bits */
             if (op) {
                 if (bits < op) {
-                    hold += (unsigned long)(*in++) << bits;
+                    hold |= (bitbuf)(*in++) << bits;
                     bits += 8;
                 }
                 len += (unsigned)hold & ((1U << op) - 1);
@@ -133,9 +275,9 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
             }
             Tracevv((stderr, "inflate:         length %u\n", len));
             if (bits < 15) {
-                hold += (unsigned long)(*in++) << bits;
+                hold |= (bitbuf)(*in++) << bits;
                 bits += 8;
-                hold += (unsigned long)(*in++) << bits;
+                hold |= (bitbuf)(*in++) << bits;
                 bits += 8;
             }
             here = dcode + (hold & dmask);
@@ -148,10 +290,10 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
                 dist = (unsigned)(here->val);
                 op &= 15;                       /* number of extra bits */
                 if (bits < op) {
-                    hold += (unsigned long)(*in++) << bits;
+                    hold |= (bitbuf)(*in++) << bits;
                     bits += 8;
                     if (bits < op) {
-                        hold += (unsigned long)(*in++) << bits;
+                        hold |= (bitbuf)(*in++) << bits;
                         bits += 8;
                     }
                 }
@@ -188,126 +330,40 @@ void ZLIB_INTERNAL inflate_fast(z_streamp strm, unsigned start) {
                             *out++ = 0;
                         } while (--op > whave);
                         if (op == 0) {
-                            from = out - dist;
-                            do {
-                                *out++ = *from++;
-                            } while (--len);
+                            out = copy_match(out, dist, len, limit);
                             continue;
                         }
 #endif
                     }
+                    /* the window never overlaps the output, so the part of
+                       the match that lies in it is a plain word copy */
                     from = window;
                     if (wnext == 0) {           /* very common case */
                         from += wsize - op;
-                        if (op < len) {         /* some from window */
-                            len -= op;
-                            do {
-                                *out++ = *from++;
-                            } while (--op);
-                            from = out - dist;  /* rest from output */
-                        }
                     }
                     else if (wnext < op) {      /* wrap around window */
                         from += wsize + wnext - op;
                         op -= wnext;
                         if (op < len) {         /* some from end of window */
                             len -= op;
-                            do {
-                                *out++ = *from++;
-                            } while (--op);
+                            out = copy_words(out, from, op);
                             from = window;
-                            if (wnext < len) {  /* some from start of window */
-                                op = wnext;
-                                len -= op;
-                                do {
-                                    *out++ = *from++;
-                                } while (--op);
-                                from = out - dist;      /* rest from output */
-                            }
+                            op = wnext;
                         }
                     }
                     else {                      /* contiguous in window */
                         from += wnext - op;
-                        if (op < len) {         /* some from window */
-                            len -= op;
-                            do {
-                                *out++ = *from++;
-                            } while (--op);
-                            from = out - dist;  /* rest from output */
-                        }
                     }
-#ifdef ALLOWS_UNALIGNED
-                    {
-                    uint8_t *pEnd = out+len;
-                        while (out < pEnd) {
-                            *(uint32_t *)out = *(uint32_t *)from;
-                            out += 4;
-                            from += 4;
-                        }
-                        // correct for possible overshoot of destination ptr
-                        out = pEnd;
+                    if (op >= len) {            /* all from window */
+                        out = copy_words(out, from, len);
+                    }
+                    else {                      /* rest from output */
+                        out = copy_words(out, from, op);
+                        out = copy_match(out, dist, len - op, limit);
                     }
-#else
-                        while (len > 2) {
-                            *out++ = *from++;
-                            *out++ = *from++;
-                            *out++ = *from++;
-                            len -= 3;
-                        }
-                        if (len) {
-                            *out++ = *from++;
-                            if (len > 1)
-                                *out++ = *from++;
-                        }
-#endif // ALLOWS_UNALIGNED
                 }
                 else {
-                    from = out - dist;          /* copy direct from output */
-#ifdef ALLOWS_UNALIGNED
-                    {
-                        uint8_t *pEnd = out+len;
-                        int overlap = (int)(intptr_t)(out-from);
-                        if (overlap > 4) { // overlap of source/dest won't impede normal copy
-                            while (out < pEnd) {
-                                *(uint32_t *)out = *(uint32_t *)from;
-                                out += 4;
-                                from += 4;
-                            }
-                            // correct for possible overshoot of destination ptr
-                            out = pEnd;
-                        } else if (overlap == 1 || overlap == 4) { // copy 1/4-byte patterns
-                            uint32_t pattern;
-                            if (overlap == 1) {
-                                pattern = *from;
-                                pattern = pattern | (pattern << 8);
-                                pattern = pattern | (pattern << 16);
-                            } else {
-                                pattern = *(uint32_t *)from;
-                            }
-                            while (out < pEnd) {
-                                *(uint32_t *)out = pattern;
-                                out += 4;
-                            }
-                            out = pEnd; // correct possible overshoot
-                        } else { // overlap of 2 or 3
-                            while (out < pEnd) {
-                                *out++ = *from++;
-                            }
-                        }
-                    }
-#else
-                        do {                        /* minimum length is three */
-                            *out++ = *from++;
-                            *out++ = *from++;
-                            *out++ = *from++;
-                            len -= 3;
-                        } while (len > 2);
-                        if (len) {
-                            *out++ = *from++;
-                            if (len > 1)
-                                *out++ = *from++;
-                        }
-#endif // ALLOWS_UNALIGNED
+                    out = copy_match(out, dist, len, limit);  /* copy direct from output */
                 }
             }
             else if ((op & 64) == 0) {          /* 2nd level distance code */
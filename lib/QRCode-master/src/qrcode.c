@@ -88,6 +88,52 @@ static const uint16_t NUM_RAW_DATA_MODULES = 567;
 #endif
 
 
+#pragma mark - Galois field tables
+
+// Powers of the generator 0x02 in GF(2^8/0x11D): GF_EXP[i] = 2^i
+static const uint8_t GF_EXP[255] = {
+      1,   2,   4,   8,  16,  32,  64, 128,  29,  58, 116, 232, 205, 135,  19,  38,
+     76, 152,  45,  90, 180, 117, 234, 201, 143,   3,   6,  12,  24,  48,  96, 192,
+    157,  39,  78, 156,  37,  74, 148,  53, 106, 212, 181, 119, 238, 193, 159,  35,
+     70, 140,   5,  10,  20,  40,  80, 160,  93, 186, 105, 210, 185, 111, 222, 161,
+     95, 190,  97, 194, 153,  47,  94, 188, 101, 202, 137,  15,  30,  60, 120, 240,
+    253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163,  91, 182, 113, 226,
+    217, 175,  67, 134,  17,  34,  68, 136,  13,  26,  52, 104, 208, 189, 103, 206,
+    129,  31,  62, 124, 248, 237, 199, 147,  59, 118, 236, 197, 151,  51, 102, 204,
+    133,  23,  46,  92, 184, 109, 218, 169,  79, 158,  33,  66, 132,  21,  42,  84,
+    168,  77, 154,  41,  82, 164,  85, 170,  73, 146,  57, 114, 228, 213, 183, 115,
+    230, 209, 191,  99, 198, 145,  63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+    227, 219, 171,  75, 150,  49,  98, 196, 149,  55, 110, 220, 165,  87, 174,  65,
+    130,  25,  50, 100, 200, 141,   7,  14,  28,  56, 112, 224, 221, 167,  83, 166,
+     81, 162,  89, 178, 121, 242, 249, 239, 195, 155,  43,  86, 172,  69, 138,   9,
+     18,  36,  72, 144,  61, 122, 244, 245, 247, 243, 251, 235, 203, 139,  11,  22,
+     44,  88, 176, 125, 250, 233, 207, 131,  27,  54, 108, 216, 173,  71, 142
+};
+
+// Discrete logarithms, the inverse of GF_EXP (GF_LOG[0] is undefined)
+static const uint8_t GF_LOG[256] = {
+      0,   0,   1,  25,   2,  50,  26, 198,   3, 223,  51, 238,  27, 104, 199,  75,
+      4, 100, 224,  14,  52, 141, 239, 129,  28, 193, 105, 248, 200,   8,  76, 113,
+      5, 138, 101,  47, 225,  36,  15,  33,  53, 147, 142, 218, 240,  18, 130,  69,
+     29, 181, 194, 125, 106,  39, 249, 185, 201, 154,   9, 120,  77, 228, 114, 166,
+      6, 191, 139,  98, 102, 221,  48, 253, 226, 152,  37, 179,  16, 145,  34, 136,
+     54, 208, 148, 206, 143, 150, 219, 189, 241, 210,  19,  92, 131,  56,  70,  64,
+     30,  66, 182, 163, 195,  72, 126, 110, 107,  58,  40,  84, 250, 133, 186,  61,
+    202,  94, 155, 159,  10,  21, 121,  43,  78, 212, 229, 172, 115, 243, 167,  87,
+      7, 112, 192, 247, 140, 128,  99,  13, 103,  74, 222, 237,  49, 197, 254,  24,
+    227, 165, 153, 119,  38, 184, 180, 124,  17,  68, 146, 217,  35,  32, 137,  46,
+     55,  63, 209,  91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190,  97,
+    242,  86, 211, 171,  20,  42,  93, 158, 132,  60,  57,  83,  71, 109,  65, 162,
+     31,  45,  67, 216, 183, 123, 164, 118, 196,  23,  73, 236, 127,  12, 111, 246,
+    108, 161,  59,  82,  41, 157,  85, 170, 251,  96, 134, 177, 187, 204,  62,  90,
+    203,  89,  95, 176, 156, 169, 160,  81,  11, 245,  22, 235, 122, 117,  44, 215,
+     79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168,  80,  88, 175
+};
+
+// Stands for the logarithm of zero in the logarithmic generator coefficients
+static const uint8_t GF_ZERO = 0xFF;
+
+
 static int max(int a, int b) {
     if (a > b) { return a; }
     return b;
@@ -481,87 +527,152 @@ static void drawCodewords(BitBucket *modules, BitBucket *isFunction, BitBucket *
 #define PENALTY_N3     40
 #define PENALTY_N4     10
 
+// The penalty is evaluated a row at a time on bitsets, module x of a row being bit
+// 31 - (x % 32) of word x / 32. Rows of the largest (177 module) code need 6 words.
+#define PENALTY_WORDS   6
+
+// Rows kept for the vertical finder-like pattern search
+#define PENALTY_ROWS   11
+
+static uint8_t popCount(uint32_t value) {
+#if defined(__GNUC__)
+    return __builtin_popcount(value);
+#else
+    uint8_t count = 0;
+    for (; value; value &= value - 1) { count++; }
+    return count;
+#endif
+}
+
+// Loads row y of the grid into words (bits past the end of the row are not cleared)
+static void bb_getRow(BitBucket *bitGrid, uint8_t y, uint8_t words, uint32_t *row) {
+    uint32_t offset = y * bitGrid->bitOffsetOrWidth;
+    for (uint8_t w = 0; w < words; w++, offset += 32) {
+        uint64_t bits = 0;
+        for (uint8_t b = 0; b < 5; b++) {
+            uint32_t index = (offset >> 3) + b;
+            bits = (bits << 8) | (index < bitGrid->capacityBytes ? bitGrid->data[index] : 0);
+        }
+        row[w] = (uint32_t)(bits >> (8 - (offset & 7)));
+    }
+}
+
+// Moves every module of a row one place right: out[x] = in[x - 1], out[0] = 0
+static void penaltyShift(const uint32_t *in, uint32_t *out, uint8_t words) {
+    for (int8_t w = words - 1; w >= 0; w--) {
+        out[w] = (in[w] >> 1) | (w > 0 ? in[w - 1] << 31 : 0);
+    }
+}
+
+// Modules x of a row at which the 11 modules ending at x match the finder-like pattern,
+// the module at x being the low bit of the pattern
+static uint8_t countFinderLike(const uint32_t *row, const uint32_t *valid, uint8_t words, uint16_t pattern) {
+    uint32_t match[PENALTY_WORDS];
+    uint8_t count = 0;
+    for (uint8_t w = 0; w < words; w++) {
+        match[w] = ((pattern >> 10) & 1 ? row[w] : ~row[w]) & valid[w];
+    }
+    for (int8_t k = 9; k >= 0; k--) {
+        penaltyShift(match, match, words);
+        for (uint8_t w = 0; w < words; w++) {
+            match[w] &= (pattern >> k) & 1 ? row[w] : ~row[w];
+        }
+    }
+    for (uint8_t w = 0; w < words; w++) {
+        count += popCount(match[w] & valid[w]);
+    }
+    return count;
+}
+
 // Calculates and returns the penalty score based on state of this QR Code's current modules.
 // This is used by the automatic mask choice algorithm to find the mask pattern that yields the lowest score.
-// @TODO: This can be optimized by working with the bytes instead of bits.
-static uint32_t getPenaltyScore(BitBucket *modules) {
+// Scoring stops as soon as the score reaches limit, since it can only grow from there.
+static uint32_t getPenaltyScore(BitBucket *modules, uint32_t limit) {
     uint32_t result = 0;
     
     uint8_t size = modules->bitOffsetOrWidth;
+    uint8_t words = (size + 31) / 32;
+    
+    uint32_t valid[PENALTY_WORDS];
+    for (uint8_t w = 0; w < words; w++) { valid[w] = 0xFFFFFFFF; }
+    valid[words - 1] <<= 32 * words - size;
     
-    // Adjacent modules in row having same color
+    // The last rows, the same-color-as-left modules of the previous row, and the columns
+    // whose run of one color ending at the current row is at least 2, 3, 4 and 5 modules long
+    uint32_t rows[PENALTY_ROWS][PENALTY_WORDS];
+    uint32_t sameLeftAbove[PENALTY_WORDS];
+    uint32_t runUp[4][PENALTY_WORDS];
+    memset(runUp, 0, sizeof(runUp));
+    
+    uint16_t black = 0;
     for (uint8_t y = 0; y < size; y++) {
+        uint32_t *row = rows[y % PENALTY_ROWS];
+        uint32_t sameLeft[PENALTY_WORDS], run[PENALTY_WORDS], shifted[PENALTY_WORDS];
         
-        bool colorX = bb_getBit(modules, 0, y);
-        for (uint8_t x = 1, runX = 1; x < size; x++) {
-            bool cx = bb_getBit(modules, x, y);
-            if (cx != colorX) {
-                colorX = cx;
-                runX = 1;
-                
-            } else {
-                runX++;
-                if (runX == 5) {
-                    result += PENALTY_N1;
-                } else if (runX > 5) {
-                    result++;
-                }
-            }
+        bb_getRow(modules, y, words, row);
+        row[words - 1] &= valid[words - 1];
+        for (uint8_t w = 0; w < words; w++) {
+            black += popCount(row[w]);
         }
-    }
-    
-    // Adjacent modules in column having same color
-    for (uint8_t x = 0; x < size; x++) {
-        bool colorY = bb_getBit(modules, x, 0);
-        for (uint8_t y = 1, runY = 1; y < size; y++) {
-            bool cy = bb_getBit(modules, x, y);
-            if (cy != colorY) {
-                colorY = cy;
-                runY = 1;
-            } else {
-                runY++;
-                if (runY == 5) {
-                    result += PENALTY_N1;
-                } else if (runY > 5) {
-                    result++;
-                }
+        
+        // Adjacent modules in row having same color: the run ending at x is 5 or more
+        // long where the last 4 modules were each the same color as their left neighbor
+        penaltyShift(row, shifted, words);
+        for (uint8_t w = 0; w < words; w++) {
+            sameLeft[w] = ~(row[w] ^ shifted[w]) & valid[w];
+            run[w] = sameLeft[w];
+        }
+        sameLeft[0] &= 0x7FFFFFFF;
+        run[0] &= 0x7FFFFFFF;
+        for (uint8_t k = 0; k < 3; k++) {
+            penaltyShift(run, shifted, words);
+            for (uint8_t w = 0; w < words; w++) {
+                run[w] = sameLeft[w] & shifted[w];
             }
         }
-    }
-    
-    uint16_t black = 0;
-    for (uint8_t y = 0; y < size; y++) {
-        uint16_t bitsRow = 0, bitsCol = 0;
-        for (uint8_t x = 0; x < size; x++) {
-            bool color = bb_getBit(modules, x, y);
-
-            // 2*2 blocks of modules having same color
-            if (x > 0 && y > 0) {
-                bool colorUL = bb_getBit(modules, x - 1, y - 1);
-                bool colorUR = bb_getBit(modules, x, y - 1);
-                bool colorL = bb_getBit(modules, x - 1, y);
-                if (color == colorUL && color == colorUR && color == colorL) {
-                    result += PENALTY_N2;
-                }
+        penaltyShift(run, shifted, words);
+        for (uint8_t w = 0; w < words; w++) {
+            result += popCount(run[w] & ~shifted[w]) * PENALTY_N1 + popCount(run[w] & shifted[w]);
+        }
+        
+        // Finder-like pattern in rows
+        result += (countFinderLike(row, valid, words, 0x05D) + countFinderLike(row, valid, words, 0x5D0)) * PENALTY_N3;
+        
+        if (y > 0) {
+            const uint32_t *above = rows[(y - 1) % PENALTY_ROWS];
+            for (uint8_t w = 0; w < words; w++) {
+                uint32_t sameUp = ~(row[w] ^ above[w]) & valid[w];
+                
+                // 2*2 blocks of modules having same color
+                result += popCount(sameLeft[w] & sameLeftAbove[w] & sameUp) * PENALTY_N2;
+                
+                // Adjacent modules in column having same color
+                uint32_t longRun = runUp[3][w];
+                runUp[3][w] = sameUp & runUp[2][w];
+                runUp[2][w] = sameUp & runUp[1][w];
+                runUp[1][w] = sameUp & runUp[0][w];
+                runUp[0][w] = sameUp;
+                result += popCount(runUp[3][w] & ~longRun) * PENALTY_N1 + popCount(runUp[3][w] & longRun);
             }
-
-            // Finder-like pattern in rows and columns
-            bitsRow = ((bitsRow << 1) & 0x7FF) | color;
-            bitsCol = ((bitsCol << 1) & 0x7FF) | bb_getBit(modules, y, x);
-
-            // Needs 11 bits accumulated
-            if (x >= 10) {
-                if (bitsRow == 0x05D || bitsRow == 0x5D0) {
-                    result += PENALTY_N3;
-                }
-                if (bitsCol == 0x05D || bitsCol == 0x5D0) {
-                    result += PENALTY_N3;
+        }
+        
+        // Finder-like pattern in columns, the current row being the low bit
+        if (y >= PENALTY_ROWS - 1) {
+            static const uint16_t patterns[2] = { 0x05D, 0x5D0 };
+            for (uint8_t p = 0; p < 2; p++) {
+                for (uint8_t w = 0; w < words; w++) {
+                    uint32_t match = valid[w];
+                    for (uint8_t k = 0; k < PENALTY_ROWS; k++) {
+                        uint32_t bits = rows[(y - k) % PENALTY_ROWS][w];
+                        match &= (patterns[p] >> k) & 1 ? bits : ~bits;
+                    }
+                    result += popCount(match) * PENALTY_N3;
                 }
             }
-
-            // Balance of black and white modules
-            if (color) { black++; }
         }
+        
+        memcpy(sameLeftAbove, sameLeft, sizeof(sameLeft));
+        if (result >= limit) { return result; }
     }
 
     // Find smallest k such that (45-5k)% <= dark/total <= (55+5k)%
@@ -576,17 +687,15 @@ static uint32_t getPenaltyScore(BitBucket *modules) {
 
 #pragma mark - Reed-Solomon Generator
 
+// Multiplies two elements of GF(2^8/0x11D) by adding their logarithms
 static uint8_t rs_multiply(uint8_t x, uint8_t y) {
-    // Russian peasant multiplication
-    // See: https://en.wikipedia.org/wiki/Ancient_Egyptian_multiplication
-    uint16_t z = 0;
-    for (int8_t i = 7; i >= 0; i--) {
-        z = (z << 1) ^ ((z >> 7) * 0x11D);
-        z ^= ((y >> i) & 1) * x;
-    }
-    return z;
+    if (x == 0 || y == 0) { return 0; }
+    uint16_t z = GF_LOG[x] + GF_LOG[y];
+    return GF_EXP[z < 255 ? z : z - 255];
 }
 
+// Computes the generator polynomial of the given degree, returning the logarithms of
+// its coefficients (GF_ZERO for a zero coefficient) as rs_getRemainder takes them.
 static void rs_init(uint8_t degree, uint8_t *coeff) {
     memset(coeff, 0, degree);
     coeff[degree - 1] = 1;
@@ -605,6 +714,10 @@ static void rs_init(uint8_t degree, uint8_t *coeff) {
         }
         root = (root << 1) ^ ((root >> 7) * 0x11D);  // Multiply by 0x02 mod GF(2^8/0x11D)
     }
+    
+    for (uint8_t j = 0; j < degree; j++) {
+        coeff[j] = coeff[j] ? GF_LOG[coeff[j]] : GF_ZERO;
+    }
 }
 
 static void rs_getRemainder(uint8_t degree, uint8_t *coeff, uint8_t *data, uint8_t length, uint8_t *result, uint8_t stride) {
@@ -620,8 +733,12 @@ static void rs_getRemainder(uint8_t degree, uint8_t *coeff, uint8_t *data, uint8
         }
         result[(degree - 1) * stride] = 0;
         
+        if (factor == 0) { continue; }
+        uint8_t factorLog = GF_LOG[factor];
         for (uint8_t j = 0; j < degree; j++) {
-            result[j * stride] ^= rs_multiply(coeff[j], factor);
+            if (coeff[j] == GF_ZERO) { continue; }
+            uint16_t z = coeff[j] + factorLog;
+            result[j * stride] ^= GF_EXP[z < 255 ? z : z - 255];
         }
     }
 }
@@ -630,14 +747,12 @@ static void rs_getRemainder(uint8_t degree, uint8_t *coeff, uint8_t *data, uint8
 
 #pragma mark - QrCode
 
-static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version) {
-    int8_t mode = MODE_BYTE;
+// Appends one segment, the whole of text in the given mode
+static void encodeSegment(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version, uint8_t mode) {
+    bb_appendBits(dataCodewords, 1 << mode, 4);
+    bb_appendBits(dataCodewords, length, getModeBits(version, mode));
     
-    if (isNumeric((char*)text, length)) {
-        mode = MODE_NUMERIC;
-        bb_appendBits(dataCodewords, 1 << MODE_NUMERIC, 4);
-        bb_appendBits(dataCodewords, length, getModeBits(version, MODE_NUMERIC));
-
+    if (mode == MODE_NUMERIC) {
         uint16_t accumData = 0;
         uint8_t accumCount = 0;
         for (uint16_t i = 0; i < length; i++) {
@@ -655,11 +770,7 @@ static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text,
             bb_appendBits(dataCodewords, accumData, accumCount * 3 + 1);
         }
         
-    } else if (isAlphanumeric((char*)text, length)) {
-        mode = MODE_ALPHANUMERIC;
-        bb_appendBits(dataCodewords, 1 << MODE_ALPHANUMERIC, 4);
-        bb_appendBits(dataCodewords, length, getModeBits(version, MODE_ALPHANUMERIC));
-
+    } else if (mode == MODE_ALPHANUMERIC) {
         uint16_t accumData = 0;
         uint8_t accumCount = 0;
         for (uint16_t i = 0; i  < length; i++) {
@@ -678,18 +789,102 @@ static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text,
         }
         
     } else {
-        bb_appendBits(dataCodewords, 1 << MODE_BYTE, 4);
-        bb_appendBits(dataCodewords, length, getModeBits(version, MODE_BYTE));
         for (uint16_t i = 0; i < length; i++) {
             bb_appendBits(dataCodewords, (char)(text[i]), 8);
         }
     }
+}
+
+// Encodes text as a single segment in the narrowest mode that holds all of it or, if modes
+// is given, as one segment per run of bytes of the same mode. Returns the widest mode used.
+static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version, const uint8_t *modes) {
+    int8_t mode = MODE_BYTE;
+    
+    if (modes) {
+        mode = MODE_NUMERIC;
+        for (uint16_t start = 0, end; start < length; start = end) {
+            for (end = start + 1; end < length && modes[end] == modes[start]; end++) { }
+            encodeSegment(dataCodewords, &text[start], end - start, version, modes[start]);
+            mode = max(mode, modes[start]);
+        }
+    } else if (isNumeric((char*)text, length)) {
+        mode = MODE_NUMERIC;
+        encodeSegment(dataCodewords, text, length, version, mode);
+    } else if (isAlphanumeric((char*)text, length)) {
+        mode = MODE_ALPHANUMERIC;
+        encodeSegment(dataCodewords, text, length, version, mode);
+    } else {
+        encodeSegment(dataCodewords, text, length, version, mode);
+    }
     
     //bb_setBits(dataCodewords, length, 4, getModeBits(version, mode));
     
     return mode;
 }
 
+// Segmentation costs are counted in sixths of a bit, since a digit takes 3 1/3 bits and an
+// alphanumeric character 5 1/2 in the middle of a segment
+#define SEGMENT_COST_NUMERIC         20
+#define SEGMENT_COST_ALPHANUMERIC    33
+#define SEGMENT_COST_BYTE            48
+
+// Marks a mode that cannot hold the byte in the segmentation trace
+#define MODE_NONE                    3
+
+uint32_t qrcode_getSegmentModes(uint8_t version, const uint8_t *data, uint16_t length, uint8_t *modes) {
+    // Cheapest encoding so far that ends in each mode, header of the open segment included
+    uint32_t head[3], cost[3];
+    for (uint8_t m = 0; m < 3; m++) {
+        head[m] = (4 + getModeBits(version, m)) * 6;
+        cost[m] = head[m];
+    }
+    
+    // For each byte, 2 bits per mode m: the mode of this byte on the cheapest encoding
+    // that ends here in mode m
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t from[3] = { MODE_NONE, MODE_NONE, MODE_BYTE };
+        cost[MODE_BYTE] += SEGMENT_COST_BYTE;
+        if (getAlphanumeric((char)data[i]) >= 0) {
+            cost[MODE_ALPHANUMERIC] += SEGMENT_COST_ALPHANUMERIC;
+            from[MODE_ALPHANUMERIC] = MODE_ALPHANUMERIC;
+        }
+        if (data[i] >= '0' && data[i] <= '9') {
+            cost[MODE_NUMERIC] += SEGMENT_COST_NUMERIC;
+            from[MODE_NUMERIC] = MODE_NUMERIC;
+        }
+        
+        // Or close the segment after this byte and open one in another mode
+        const uint32_t extended[3] = { cost[0], cost[1], cost[2] };
+        const uint8_t held[3] = { from[0], from[1], from[2] };
+        for (uint8_t to = 0; to < 3; to++) {
+            for (uint8_t m = 0; m < 3; m++) {
+                if (held[m] == MODE_NONE || m == to) { continue; }
+                uint32_t switched = (extended[m] + 5) / 6 * 6 + head[to];
+                if (from[to] == MODE_NONE || switched < cost[to]) {
+                    cost[to] = switched;
+                    from[to] = m;
+                }
+            }
+        }
+        modes[i] = from[0] | (from[1] << 2) | (from[2] << 4);
+    }
+    
+    uint8_t mode = MODE_BYTE;
+    for (uint8_t m = 0; m < 3; m++) {
+        if (cost[m] < cost[mode]) { mode = m; }
+    }
+    uint32_t bits = (cost[mode] + 5) / 6;
+    
+    // Trace the cheapest encoding back from its last byte
+    for (uint16_t i = length; i-- > 0; ) {
+        mode = (modes[i] >> (2 * mode)) & 0x03;
+        modes[i] = mode;
+    }
+    
+    return length ? bits : 0;
+}
+
+
 static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data) {
     
     // See: http://www.thonky.com/qr-code-tutorial/structure-final-message
@@ -775,8 +970,18 @@ uint16_t qrcode_getBufferSize(uint8_t version) {
     return bb_getGridSizeBytes(4 * version + 17);
 }
 
+// Data bits that fit a version at an ECC level (given as its format bits)
+static uint16_t getDataCapacityBits(uint8_t version, uint8_t eccFormatBits) {
+#if LOCK_VERSION == 0
+    return (NUM_RAW_DATA_MODULES[version - 1] / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits][version - 1]) * 8;
+#else
+    return (NUM_RAW_DATA_MODULES / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits]) * 8;
+#endif
+}
+
+// Encodes data as a single segment or, given the mode of each byte, as one segment per run
 // @TODO: Return error if data is too big.
-int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
+static int8_t initCode(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length, const uint8_t *modes) {
     uint8_t size = version * 4 + 17;
     qrcode->version = version;
     qrcode->size = size;
@@ -799,7 +1004,7 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     bb_initBuffer(&codewords, codewordBytes, (int32_t)sizeof(codewordBytes));
     
     // Place the data code words into the buffer
-    int8_t mode = encodeDataCodewords(&codewords, data, length, version);
+    int8_t mode = encodeDataCodewords(&codewords, data, length, version, modes);
     
     if (mode < 0) { return -1; }
     qrcode->mode = mode;
@@ -833,7 +1038,7 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     for (uint8_t i = 0; i < 8; i++) {
         drawFormatBits(&modulesGrid, &isFunctionGrid, eccFormatBits, i);
         applyMask(&modulesGrid, &isFunctionGrid, i);
-        int penalty = getPenaltyScore(&modulesGrid);
+        int penalty = getPenaltyScore(&modulesGrid, minPenalty);
         if (penalty < minPenalty) {
             mask = i;
             minPenalty = penalty;
@@ -852,10 +1057,50 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     return 0;
 }
 
+int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
+    return initCode(qrcode, modules, version, ecc, data, length, NULL);
+}
+
 int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, const char *data) {
     return qrcode_initBytes(qrcode, modules, version, ecc, (uint8_t*)data, strlen(data));
 }
 
+int8_t qrcode_initBytesAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, uint8_t *data, uint16_t length) {
+    uint8_t eccFormatBits = (ECC_FORMAT_BITS >> (2 * ecc)) & 0x03;
+    
+#if LOCK_VERSION == 0
+    uint8_t version = 1;
+    if (maxVersion > 40) { maxVersion = 40; }
+#else
+    uint8_t version = LOCK_VERSION;
+    if (maxVersion > LOCK_VERSION) { maxVersion = LOCK_VERSION; }
+#endif
+    if (maxVersion < version) { return -1; }
+    
+    // Nothing longer fits maxVersion, not even as digits (10 bits for 3, 7 for 2, 4 for 1)
+    uint16_t room = getDataCapacityBits(maxVersion, eccFormatBits) - 4 - getModeBits(maxVersion, MODE_NUMERIC);
+    uint16_t digits = room / 10 * 3 + (room % 10 >= 7 ? 2 : room % 10 >= 4 ? 1 : 0);
+    if (length > digits || length > QRCODE_AUTO_MAX_LENGTH) { return -1; }
+    
+    uint8_t modes[QRCODE_AUTO_MAX_LENGTH + 1];
+    uint32_t bits = 0;
+    for (uint8_t first = version; version <= maxVersion; version++) {
+        // The best segmentation only changes with the width of the character counts
+        if (version == first || version == 10 || version == 27) {
+            bits = qrcode_getSegmentModes(version, data, length, modes);
+        }
+        if (bits <= getDataCapacityBits(version, eccFormatBits)) {
+            return initCode(qrcode, modules, version, ecc, data, length, modes);
+        }
+    }
+    
+    return -1;
+}
+
+int8_t qrcode_initTextAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, const char *data) {
+    return qrcode_initBytesAuto(qrcode, modules, maxVersion, ecc, (uint8_t*)data, strlen(data));
+}
+
 bool qrcode_getModule(QRCode *qrcode, uint8_t x, uint8_t y) {
     if (x < 0 || x >= qrcode->size || y < 0 || y >= qrcode->size) {
         return false;
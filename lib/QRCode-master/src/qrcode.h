@@ -65,6 +65,14 @@ static const bool true = 1;
 #define LOCK_VERSION       0
 #endif
 
+// Longest data qrcode_initBytesAuto() takes, as it needs a byte of stack per data byte to
+// work out the segments. Digits pack densest, so the limit defaults to how many version
+// 40-L holds (7089); build with the digit capacity of the largest version used to bound
+// the stack. Data longer than the limit is refused even where it would fit the version.
+#ifndef QRCODE_AUTO_MAX_LENGTH
+#define QRCODE_AUTO_MAX_LENGTH  7089
+#endif
+
 
 typedef struct QRCode {
     uint8_t version;
@@ -87,6 +95,17 @@ uint16_t qrcode_getBufferSize(uint8_t version);
 int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, const char *data);
 int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length);
 
+// Encode in the smallest version up to maxVersion that holds the data at the ECC level,
+// splitting it into numeric, alphanumeric and byte segments so that it takes the fewest
+// bits. modules must hold qrcode_getBufferSize(maxVersion) bytes. Returns -1 if the data
+// does not fit maxVersion, or is longer than QRCODE_AUTO_MAX_LENGTH.
+int8_t qrcode_initTextAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, const char *data);
+int8_t qrcode_initBytesAuto(QRCode *qrcode, uint8_t *modules, uint8_t maxVersion, uint8_t ecc, uint8_t *data, uint16_t length);
+
+// Stores in modes the mode of each byte of data in the segmentation that takes the fewest
+// bits at the version, and returns that number of bits
+uint32_t qrcode_getSegmentModes(uint8_t version, const uint8_t *data, uint16_t length, uint8_t *modes);
+
 bool qrcode_getModule(QRCode *qrcode, uint8_t x, uint8_t y);
 
 
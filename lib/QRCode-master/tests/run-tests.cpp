@@ -1,8 +1,11 @@
+#include <cstring>
+#include <ctime>
 #include <iostream>
 #include <string>
 
 #include "../src/qrcode.h"
 #include "QrCode.hpp"
+#include "QrSegment.hpp"
 
 static uint32_t check(const qrcodegen::QrCode &nayuki, QRCode *ricmoo) {
     uint32_t wrong = 0;
@@ -21,8 +24,79 @@ static uint32_t check(const qrcodegen::QrCode &nayuki, QRCode *ricmoo) {
     return wrong;
 }
 
+// Longest prefix of text that fits the version at the ECC level (0 if none)
+static size_t fitLength(const char *text, int version, const qrcodegen::QrCode::Ecc &ecl) {
+    std::string prefix(text);
+    while (!prefix.empty()) {
+        try {
+            qrcodegen::QrCode::encodeText(prefix.c_str(), version, ecl);
+            return prefix.size();
+        } catch (const char *) {
+            prefix.resize(prefix.size() * 9 / 10);
+        }
+    }
+    return 0;
+}
+
+static const qrcodegen::QrCode::Ecc &eccLevel(int ecc) {
+    switch (ecc) {
+        case 1: return qrcodegen::QrCode::Ecc::MEDIUM;
+        case 2: return qrcodegen::QrCode::Ecc::QUARTILE;
+        case 3: return qrcodegen::QrCode::Ecc::HIGH;
+    }
+    return qrcodegen::QrCode::Ecc::LOW;
+}
+
+static qrcodegen::QrSegment makeSegment(const std::string &text, int mode) {
+    switch (mode) {
+        case MODE_NUMERIC: return qrcodegen::QrSegment::makeNumeric(text.c_str());
+        case MODE_ALPHANUMERIC: return qrcodegen::QrSegment::makeAlphanumeric(text.c_str());
+    }
+    return qrcodegen::QrSegment::makeBytes(std::vector<uint8_t>(text.begin(), text.end()));
+}
+
+// One segment per run of characters given the same mode
+static std::vector<qrcodegen::QrSegment> makeRuns(const std::string &text, const uint8_t *modes) {
+    std::vector<qrcodegen::QrSegment> segs;
+    for (size_t start = 0, end; start < text.size(); start = end) {
+        for (end = start + 1; end < text.size() && modes[end] == modes[start]; end++) { }
+        segs.push_back(makeSegment(text.substr(start, end - start), modes[start]));
+    }
+    return segs;
+}
+
+// Fewest bits of any split of text into segments, trying every split
+static int optimalBits(const std::string &text, int version) {
+    std::vector<int> best(text.size() + 1, -1);
+    best[0] = 0;
+    for (size_t end = 1; end <= text.size(); end++) {
+        for (size_t start = 0; start < end; start++) {
+            std::string part = text.substr(start, end - start);
+            for (int mode = 0; mode < 3; mode++) {
+                if ((mode == MODE_NUMERIC && !qrcodegen::QrSegment::isNumeric(part.c_str())) ||
+                    (mode == MODE_ALPHANUMERIC && !qrcodegen::QrSegment::isAlphanumeric(part.c_str()))) {
+                    continue;
+                }
+                int bits = qrcodegen::QrSegment::getTotalBits(std::vector<qrcodegen::QrSegment>(1, makeSegment(part, mode)), version);
+                if (bits >= 0 && (best[end] < 0 || best[start] + bits < best[end])) {
+                    best[end] = best[start] + bits;
+                }
+            }
+        }
+    }
+    return best[text.size()];
+}
+
 int main() {
-    std::clock_t t0, totalNayuki, totalRicMoo;
+    std::clock_t t0, totalNayuki = 0, totalRicMoo = 0;
+
+    // Byte mode text long enough to fill a version 40 code, so that every version
+    // is also checked with all of its blocks in use
+    std::string filler;
+    for (int i = 0; filler.size() < 2953; i++) {
+        filler += "the quick brown fox jumps over the lazy dog " + std::to_string(i * 7919 % 1000) + "; ";
+    }
+    filler.resize(2953);
 
     int total = 0, passed = 0;
     for (char version = 1; version <= 40; version++) {
@@ -45,7 +119,8 @@ int main() {
                     break;
             }
 
-            for (char tc = 0; tc < 3; tc++) {
+            std::string full;
+            for (char tc = 0; tc < 4; tc++) {
                 char *data;
                 switch(tc) {
                     case 0:
@@ -57,6 +132,10 @@ int main() {
                     case 2:
                         data = (char*)"1234";
                         break;
+                    case 3:
+                        full = filler.substr(0, fitLength(filler.c_str(), version, *errCorLvl));
+                        data = (char*)full.c_str();
+                        break;
                 }
                 t0 = std::clock();
                 const qrcodegen::QrCode nayuki = qrcodegen::QrCode::encodeText(data, version, *errCorLvl);
@@ -80,6 +159,116 @@ int main() {
         }
     }
 
+    // Automatic version and mixed mode segments, against segments built by the reference
+    std::string longMixed;
+    for (int i = 0; longMixed.size() < 1500; i++) {
+        longMixed += "ID:" + std::to_string(1000000000LL + i * 7919LL) + std::to_string(i) + " name=hb9iiu-" + std::to_string(i) + "; ";
+    }
+    std::string shortMixed = longMixed.substr(0, 400);
+    std::string allDigits(7089, '3');
+    std::string tooLong(8000, '7');
+    const char *mixed[] = {
+        "",
+        "HELLO WORLD",
+        "31415926535897932384626433832795",
+        "http://192.168.4.1",
+        "WIFI:T:nopass;S:HB9IIUSetup;;",
+        "WIFI:T:WPA;S:HB9IIU Shack;P:73 de HB9IIU 0123456789;;",
+        "HTTPS://WWW.HAMQSL.COM/SOLARXML.PHP?ID=1234567890123",
+        "Solar flux 146, A 8, K 2, MUF 22.48 MHz at 2025-07-31 13:21 UTC",
+        "0123456789012345678901234567890123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghij",
+        shortMixed.c_str(),
+        longMixed.c_str(),
+        allDigits.c_str(),
+        tooLong.c_str(),
+    };
+    static uint8_t modes[8001];
+    for (size_t i = 0; i < sizeof(mixed) / sizeof(mixed[0]); i++) {
+        std::string text(mixed[i]);
+        for (char ecc = 0; ecc < 4; ecc++) {
+            int expected = -1;
+            std::vector<qrcodegen::QrSegment> segs;
+            bool segmentsOk = true;
+            for (int version = 1; version <= 40 && expected < 0; version++) {
+                if (LOCK_VERSION != 0 && LOCK_VERSION != version) { continue; }
+
+                uint32_t bits = qrcode_getSegmentModes(version, (const uint8_t*)text.c_str(), text.size(), modes);
+                segs = makeRuns(text, modes);
+                int totalBits = qrcodegen::QrSegment::getTotalBits(segs, version);
+                if (totalBits >= 0 && (int)bits != totalBits) { segmentsOk = false; }
+                if (text.size() <= 80 && (int)bits != optimalBits(text, version)) { segmentsOk = false; }
+                try {
+                    qrcodegen::QrCode::encodeSegments(segs, eccLevel(ecc), version, version, -1, false);
+                    expected = version;
+                } catch (const char *) {
+                }
+            }
+
+            QRCode ricmoo;
+            uint8_t ricmooBytes[qrcode_getBufferSize(40)];
+            int8_t result = qrcode_initTextAuto(&ricmoo, ricmooBytes, 40, ecc, text.c_str());
+            uint32_t badModules = 0;
+            if (expected > 0 && result == 0) {
+                badModules = check(qrcodegen::QrCode::encodeSegments(segs, eccLevel(ecc), expected, expected, -1, false), &ricmoo);
+            }
+            if (!segmentsOk || (expected < 0) != (result < 0) || (result == 0 && ricmoo.version != expected) || badModules) {
+                printf("Failed auto version case: ecc=%d, data=\"%.40s\", version=%d (expected %d), segments %s, faliured=%d\n",
+                       ecc, text.c_str(), result == 0 ? ricmoo.version : -1, expected, segmentsOk ? "optimal" : "wrong", badModules);
+            } else {
+                passed++;
+            }
+            total++;
+        }
+    }
+
     printf("Tests complete: %d passed (out of %d)\n", passed, total);
     printf("Timing: Nayuki=%lu, RicMoo=%lu\n", totalNayuki, totalRicMoo);
+
+    // Smallest single mode version against the automatic one, and the time taken to encode
+    printf("Automatic version (ECC_LOW):\n");
+    for (size_t i = 3; i < sizeof(mixed) / sizeof(mixed[0]) - 1 && LOCK_VERSION == 0; i++) {
+        int single = qrcodegen::QrCode::encodeSegments(qrcodegen::QrSegment::makeSegments(mixed[i]), qrcodegen::QrCode::Ecc::LOW, 1, 40, -1, false).version;
+        QRCode ricmoo;
+        uint8_t ricmooBytes[qrcode_getBufferSize(40)];
+        int count = 0;
+        t0 = std::clock();
+        std::clock_t elapsed;
+        do {
+            qrcode_initTextAuto(&ricmoo, ricmooBytes, 40, ECC_LOW, mixed[i]);
+            count++;
+            elapsed = std::clock() - t0;
+        } while (elapsed < CLOCKS_PER_SEC / 10);
+        double autoUs = elapsed * 1e6 / CLOCKS_PER_SEC / count;
+        count = 0;
+        t0 = std::clock();
+        do {
+            qrcode_initText(&ricmoo, ricmooBytes, single, ECC_LOW, mixed[i]);
+            count++;
+            elapsed = std::clock() - t0;
+        } while (elapsed < CLOCKS_PER_SEC / 10);
+        double singleUs = elapsed * 1e6 / CLOCKS_PER_SEC / count;
+        qrcode_initTextAuto(&ricmoo, ricmooBytes, 40, ECC_LOW, mixed[i]);
+        printf("  %-5d chars: single mode v%-2d %8.1f us, mixed v%-2d %8.1f us\n", (int)strlen(mixed[i]), single, singleUs, ricmoo.version, autoUs);
+    }
+
+    // Encodes per second of a full code at ECC_LOW, for each version
+    printf("Encodes per second (full, ECC_LOW):\n");
+    for (char version = 1; version <= 40; version++) {
+        if (LOCK_VERSION != 0 && LOCK_VERSION != version) { continue; }
+
+        std::string data = filler.substr(0, fitLength(filler.c_str(), version, qrcodegen::QrCode::Ecc::LOW));
+        uint8_t ricmooBytes[qrcode_getBufferSize(version)];
+        QRCode ricmoo;
+        int count = 0;
+        t0 = std::clock();
+        std::clock_t elapsed;
+        do {
+            qrcode_initText(&ricmoo, ricmooBytes, version, ECC_LOW, data.c_str());
+            count++;
+            elapsed = std::clock() - t0;
+        } while (elapsed < CLOCKS_PER_SEC / 5);
+        printf("  v%-2d %8.0f%s", version, count * (double)CLOCKS_PER_SEC / elapsed, version % 5 == 0 || LOCK_VERSION ? "\n" : "");
+    }
+
+    return passed == total ? 0 : 1;
 }
@@ -117,6 +117,62 @@ uint16_t TFT_eSPI::getTouchRawZ(void){
   return (uint16_t)tz;
 }
 
+/***************************************************************************************
+** Function name:           getTouchRawBurst
+** Description:             read raw x,y and z in one transaction. Returns z value.
+***************************************************************************************/
+#define _BURST_MAX 8 // Most conversions per axis in one burst
+
+// Mean of n samples without the highest and lowest quarter, sorts them in place
+static uint16_t burstMean(uint16_t *v, uint8_t n){
+  for (uint8_t i = 1; i < n; i++) {
+    uint16_t t = v[i];
+    uint8_t j = i;
+    while (j && v[j - 1] > t) { v[j] = v[j - 1]; j--; }
+    v[j] = t;
+  }
+  uint8_t drop = n > 2 ? (n + 2) / 4 : 0;
+  uint32_t sum = 0;
+  for (uint8_t i = drop; i < n - drop; i++) sum += v[i];
+  return (sum + (n - 2 * drop) / 2) / (n - 2 * drop);
+}
+
+uint16_t TFT_eSPI::getTouchRawBurst(uint16_t *x, uint16_t *y, uint8_t samples){
+  if (samples < 1) samples = 1;
+  if (samples > _BURST_MAX) samples = _BURST_MAX;
+
+  // Command i goes out in byte 2*i, its 12 bit result comes back in the next two
+  // bytes and the following command rides on the second of them, as in getTouchRaw().
+  // The first conversion of each axis is made while the drivers settle and is dropped.
+  uint8_t n = samples + 1;
+  uint8_t conversions = 2 * n + 2;
+  uint8_t buf[2 * (2 * _BURST_MAX + 4) + 1];
+  uint8_t len = 2 * conversions + 1;
+  for (uint8_t i = 0; i < len; i++) buf[i] = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    buf[2 * i] = 0xd0;                   // YP conversion for x
+    buf[2 * (n + i)] = 0x90;             // XP conversion for y
+  }
+  buf[2 * (2 * n)] = 0xb0;               // Z1
+  buf[2 * (2 * n + 1)] = 0xc0;           // Z2, the last byte powers down
+
+  begin_touch_read_write();
+  spi.transfer(buf, len);
+  end_touch_read_write();
+
+  uint16_t v[2 * _BURST_MAX + 4];
+  for (uint8_t i = 0; i < conversions; i++)
+    v[i] = (buf[2 * i + 1] << 5) | (buf[2 * i + 2] >> 3);
+
+  *x = burstMean(v + 1, samples);
+  *y = burstMean(v + n + 1, samples);
+
+  int16_t tz = 0xFFF + v[2 * n] - v[2 * n + 1];
+  if (tz == 4095) tz = 0;
+
+  return (uint16_t)tz;
+}
+
 /***************************************************************************************
 ** Function name:           validTouch
 ** Description:             read validated position. Return false if not pressed. 
@@ -6,6 +6,10 @@
   uint8_t  getTouchRaw(uint16_t *x, uint16_t *y);
            // Get raw z (i.e. pressure) ADC value from touch controller
   uint16_t getTouchRawZ(void);
+           // Get raw x,y and z in one bus transaction. x and y are the mean of "samples"
+           // conversions each (up to 8) after outliers are dropped, z is converted last
+           // so a finger lifting during the burst shows as a low z. Returns z.
+  uint16_t getTouchRawBurst(uint16_t *x, uint16_t *y, uint8_t samples = 4);
            // Convert raw x,y values to calibrated and correctly rotated screen coordinates
   void     convertRawXY(uint16_t *x, uint16_t *y);
            // Get the screen touch coordinates, returns true if screen has been touched
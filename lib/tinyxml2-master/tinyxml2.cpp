@@ -114,6 +114,22 @@ distribution.
 	#define TIXML_FTELL ftell
 #endif
 
+#if !defined(TINYXML2_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define TIXML_SSE2
+	#include <emmintrin.h>
+#endif
+
+// The block scanners read whole aligned blocks past the terminating null,
+// which AddressSanitizer would report. Those reads are safe: a block is
+// aligned to its own size, so one that starts on a valid byte never crosses
+// into the next page, and the null ends the scan before any byte after it
+// can count.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+	#define TIXML_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+	#define TIXML_NO_SANITIZE_ADDRESS
+#endif
+
 
 static const char LINE_FEED				= static_cast<char>(0x0a);			// all line endings are normalized to LF
 static const char LF = LINE_FEED;
@@ -149,6 +165,71 @@ static const Entity entities[NUM_ENTITIES] = {
 };
 
 
+// The scanners below test a block of bytes per step: an SSE2 vector where
+// available, otherwise a machine word. They only load aligned blocks, which
+// may extend past the terminating null but never into the next page.
+#if defined(TIXML_SSE2)
+static const size_t SCAN_BLOCK = 16;
+#else
+static const size_t SCAN_BLOCK = sizeof( size_t );
+static const size_t SWAR_ONES = ~static_cast<size_t>( 0 ) / 0xff;
+static const size_t SWAR_HIGHS = SWAR_ONES * 0x80;
+
+// Nonzero if any byte of 'v' is zero
+static inline size_t SwarHasZero( size_t v )
+{
+    return ( v - SWAR_ONES ) & ~v & SWAR_HIGHS;
+}
+
+// The high bit of exactly the bytes of 'v' that are zero
+static inline size_t SwarZeroBytes( size_t v )
+{
+    return ~( ( ( v & ~SWAR_HIGHS ) + ~SWAR_HIGHS ) | v | ~SWAR_HIGHS );
+}
+#endif
+
+
+// Returns the first of 'a', 'b', 'c' or the null at or after 'p'.
+TIXML_NO_SANITIZE_ADDRESS
+static const char* FindAny( const char* p, char a, char b, char c )
+{
+    for( ; reinterpret_cast<uintptr_t>( p ) & ( SCAN_BLOCK - 1 ); ++p ) {
+        if ( *p == a || *p == b || *p == c || !*p ) {
+            return p;
+        }
+    }
+#if defined(TIXML_SSE2)
+    const __m128i va = _mm_set1_epi8( a );
+    const __m128i vb = _mm_set1_epi8( b );
+    const __m128i vc = _mm_set1_epi8( c );
+    const __m128i zero = _mm_setzero_si128();
+    for( ;; p += SCAN_BLOCK ) {
+        const __m128i v = _mm_load_si128( reinterpret_cast<const __m128i*>( p ) );
+        const __m128i hit = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, va ), _mm_cmpeq_epi8( v, vb ) ),
+                                          _mm_or_si128( _mm_cmpeq_epi8( v, vc ), _mm_cmpeq_epi8( v, zero ) ) );
+        if ( _mm_movemask_epi8( hit ) ) {
+            break;
+        }
+    }
+#else
+    const size_t va = SWAR_ONES * static_cast<unsigned char>( a );
+    const size_t vb = SWAR_ONES * static_cast<unsigned char>( b );
+    const size_t vc = SWAR_ONES * static_cast<unsigned char>( c );
+    for( ;; p += SCAN_BLOCK ) {
+        size_t v;
+        memcpy( &v, p, sizeof( v ) );
+        if ( SwarHasZero( v ) | SwarHasZero( v ^ va ) | SwarHasZero( v ^ vb ) | SwarHasZero( v ^ vc ) ) {
+            break;
+        }
+    }
+#endif
+    while ( *p != a && *p != b && *p != c && *p ) {
+        ++p;
+    }
+    return p;
+}
+
+
 StrPair::~StrPair()
 {
     Reset();
@@ -215,7 +296,11 @@ char* StrPair::ParseText( char* p, const char* endTag, int strFlags, int* curLin
     size_t length = strlen( endTag );
 
     // Inner loop of text parsing.
-    while ( *p ) {
+    for( ;; ) {
+        p = const_cast<char*>( FindAny( p, endChar, LF, LF ) );
+        if ( !*p ) {
+            return 0;
+        }
         if ( *p == endChar && strncmp( p, endTag, length ) == 0 ) {
             Set( start, p, strFlags );
             return p + length;
@@ -225,7 +310,6 @@ char* StrPair::ParseText( char* p, const char* endTag, int strFlags, int* curLin
         ++p;
         TIXMLASSERT( p );
     }
-    return 0;
 }
 
 
@@ -289,6 +373,10 @@ const char* StrPair::GetStr()
         if ( _flags ) {
             const char* p = _start;	// the read pointer
             char* q = _start;	// the write pointer
+            // The characters that need work, null when not in use
+            const char amp = ( _flags & NEEDS_ENTITY_PROCESSING ) ? '&' : 0;
+            const char cr = ( _flags & NEEDS_NEWLINE_NORMALIZATION ) ? CR : 0;
+            const char lf = ( _flags & NEEDS_NEWLINE_NORMALIZATION ) ? LF : 0;
 
             while( p < _end ) {
                 if ( (_flags & NEEDS_NEWLINE_NORMALIZATION) && *p == CR ) {
@@ -360,9 +448,14 @@ const char* StrPair::GetStr()
                     }
                 }
                 else {
-                    *q = *p;
-                    ++p;
-                    ++q;
+                    // Copy the run up to the next character that needs work
+                    const char* next = FindAny( p + 1, amp, cr, lf );
+                    const size_t run = next - p;
+                    if ( q != p ) {
+                        memmove( q, p, run );
+                    }
+                    p += run;
+                    q += run;
                 }
             }
             *q = 0;
@@ -383,6 +476,64 @@ const char* StrPair::GetStr()
 
 // --------- XMLUtil ----------- //
 
+TIXML_NO_SANITIZE_ADDRESS
+const char* XMLUtil::SkipWhiteSpaceRun( const char* p, int* curLineNumPtr )
+{
+    int lines = 0;
+    for( ; reinterpret_cast<uintptr_t>( p ) & ( SCAN_BLOCK - 1 ); ++p ) {
+        if ( !IsWhiteSpace( *p ) ) {
+            break;
+        }
+        lines += ( *p == LF );
+    }
+    if ( IsWhiteSpace( *p ) ) {
+        // Whole blocks of spaces, tabs, CR and LF
+#if defined(TIXML_SSE2)
+        const __m128i sp = _mm_set1_epi8( ' ' );
+        const __m128i tab = _mm_set1_epi8( '\t' );
+        const __m128i vcr = _mm_set1_epi8( CR );
+        const __m128i vlf = _mm_set1_epi8( LF );
+        for( ;; p += SCAN_BLOCK ) {
+            const __m128i v = _mm_load_si128( reinterpret_cast<const __m128i*>( p ) );
+            const __m128i eol = _mm_cmpeq_epi8( v, vlf );
+            const __m128i ws = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, sp ), _mm_cmpeq_epi8( v, tab ) ),
+                                             _mm_or_si128( _mm_cmpeq_epi8( v, vcr ), eol ) );
+            if ( _mm_movemask_epi8( ws ) != 0xffff ) {
+                break;
+            }
+            for( int m = _mm_movemask_epi8( eol ); m; m &= m - 1 ) {
+                ++lines;
+            }
+        }
+#else
+        const size_t sp = SWAR_ONES * ' ';
+        const size_t tab = SWAR_ONES * '\t';
+        const size_t vcr = SWAR_ONES * CR;
+        const size_t vlf = SWAR_ONES * LF;
+        for( ;; p += SCAN_BLOCK ) {
+            size_t v;
+            memcpy( &v, p, sizeof( v ) );
+            const size_t eol = SwarZeroBytes( v ^ vlf );
+            if ( ( SwarZeroBytes( v ^ sp ) | SwarZeroBytes( v ^ tab ) | SwarZeroBytes( v ^ vcr ) | eol ) != SWAR_HIGHS ) {
+                break;
+            }
+            for( size_t m = eol; m; m &= m - 1 ) {
+                ++lines;
+            }
+        }
+#endif
+        while ( IsWhiteSpace( *p ) ) {
+            lines += ( *p == LF );
+            ++p;
+        }
+    }
+    if ( curLineNumPtr ) {
+        *curLineNumPtr += lines;
+    }
+    return p;
+}
+
+
 const char* XMLUtil::writeBoolTrue  = "true";
 const char* XMLUtil::writeBoolFalse = "false";
 
@@ -860,6 +1011,9 @@ void XMLNode::SetValue( const char* str, bool staticMem )
     else {
         _value.SetStr( str );
     }
+    if ( _parent ) {
+        _parent->ChildrenChanged();
+    }
 }
 
 XMLNode* XMLNode::DeepClone(XMLDocument* target) const
@@ -906,6 +1060,7 @@ void XMLNode::Unlink( XMLNode* child )
 	child->_next = 0;
 	child->_prev = 0;
 	child->_parent = 0;
+    ChildrenChanged();
 }
 
 
@@ -1023,6 +1178,12 @@ XMLNode* XMLNode::InsertAfterChild( XMLNode* afterThis, XMLNode* addThis )
 
 const XMLElement* XMLNode::FirstChildElement( const char* name ) const
 {
+    if ( name ) {
+        const XMLElement* self = ToElement();
+        if ( self && self->_childIndexEnabled ) {
+            return self->IndexedChildElement( name );
+        }
+    }
     for( const XMLNode* node = _firstChild; node; node = node->_next ) {
         const XMLElement* element = node->ToElementWithName( name );
         if ( element ) {
@@ -1212,6 +1373,16 @@ void XMLNode::InsertChildPreamble( XMLNode* insertThis ) const
 		insertThis->_document->MarkInUse(insertThis);
         insertThis->_memPool->SetTracked();
 	}
+    ChildrenChanged();
+}
+
+
+void XMLNode::ChildrenChanged() const
+{
+    const XMLElement* element = ToElement();
+    if ( element && element->_childIndex ) {
+        element->DropChildIndex();
+    }
 }
 
 const XMLElement* XMLNode::ToElementWithName( const char* name ) const
@@ -1598,7 +1769,9 @@ void XMLAttribute::SetAttribute( float v )
 // --------- XMLElement ---------- //
 XMLElement::XMLElement( XMLDocument* doc ) : XMLNode( doc ),
     _closingType( OPEN ),
-    _rootAttribute( 0 )
+    _rootAttribute( 0 ),
+    _childIndex( 0 ),
+    _childIndexEnabled( false )
 {
 }
 
@@ -1610,6 +1783,138 @@ XMLElement::~XMLElement()
         DeleteAttribute( _rootAttribute );
         _rootAttribute = next;
     }
+    DropChildIndex();
+}
+
+
+// Open addressed table of the first child element per name. 'slots' is
+// over-allocated to mask+1 entries; an empty slot has a null element.
+// With an arena on the document the table comes from there and is only
+// released when the arena is rewound.
+struct XMLElement::ChildIndex
+{
+    struct Slot {
+        unsigned			hash;
+        const XMLElement*	element;
+    };
+    unsigned	mask;
+    bool		onHeap;
+    Slot		slots[1];
+};
+
+
+// FNV-1a, good enough for short tag names
+static unsigned HashName( const char* p )
+{
+    unsigned h = 2166136261u;
+    while ( *p ) {
+        h = ( h ^ static_cast<unsigned char>( *p++ ) ) * 16777619u;
+    }
+    return h;
+}
+
+
+void XMLElement::SetChildIndex( bool enable )
+{
+    _childIndexEnabled = enable;
+    if ( !enable ) {
+        DropChildIndex();
+    }
+}
+
+
+void XMLElement::DropChildIndex() const
+{
+    if ( _childIndex && _childIndex->onHeap ) {
+        delete [] reinterpret_cast<char*>( _childIndex );
+    }
+    _childIndex = 0;
+}
+
+
+const XMLElement* XMLElement::IndexedChildElement( const char* name ) const
+{
+    TIXMLASSERT( name );
+    if ( !_childIndex ) {
+        unsigned count = 0;
+        for( const XMLNode* node = _firstChild; node; node = node->_next ) {
+            if ( node->ToElement() ) {
+                ++count;
+            }
+        }
+        // Keep the load factor at or below one half
+        unsigned size = 8;
+        while ( size < count * 2 ) {
+            size *= 2;
+        }
+        const size_t bytes = sizeof( ChildIndex ) + ( size - 1 ) * sizeof( ChildIndex::Slot );
+        void* mem = _document->Arena() ? _document->Arena()->Alloc( bytes ) : 0;
+        const bool onHeap = !mem;
+        if ( onHeap ) {
+            mem = new char[bytes];
+        }
+        _childIndex = static_cast<ChildIndex*>( mem );
+        memset( _childIndex, 0, bytes );
+        _childIndex->mask = size - 1;
+        _childIndex->onHeap = onHeap;
+
+        for( const XMLNode* node = _firstChild; node; node = node->_next ) {
+            const XMLElement* element = node->ToElement();
+            if ( !element ) {
+                continue;
+            }
+            const unsigned hash = HashName( element->Name() );
+            for( unsigned i = hash & _childIndex->mask; ; i = ( i + 1 ) & _childIndex->mask ) {
+                ChildIndex::Slot& slot = _childIndex->slots[i];
+                if ( !slot.element ) {
+                    slot.hash = hash;
+                    slot.element = element;
+                    break;
+                }
+                // Only the first child of a given name is indexed
+                if ( slot.hash == hash && XMLUtil::StringEqual( slot.element->Name(), element->Name() ) ) {
+                    break;
+                }
+            }
+        }
+    }
+
+    const unsigned hash = HashName( name );
+    for( unsigned i = hash & _childIndex->mask; ; i = ( i + 1 ) & _childIndex->mask ) {
+        const ChildIndex::Slot& slot = _childIndex->slots[i];
+        if ( !slot.element ) {
+            return 0;
+        }
+        if ( slot.hash == hash && XMLUtil::StringEqual( slot.element->Name(), name ) ) {
+            return slot.element;
+        }
+    }
+}
+
+
+int XMLElement::ExtractChildElements( XMLChildBinding* bindings, int count ) const
+{
+    TIXMLASSERT( bindings || count == 0 );
+    for( int i = 0; i < count; ++i ) {
+        bindings[i].element = 0;
+        bindings[i].hash = bindings[i].name ? HashName( bindings[i].name ) : 0;
+    }
+    int found = 0;
+    for( const XMLNode* node = _firstChild; node && found < count; node = node->_next ) {
+        const XMLElement* element = node->ToElement();
+        if ( !element ) {
+            continue;
+        }
+        const unsigned hash = HashName( element->Name() );
+        for( int i = 0; i < count; ++i ) {
+            XMLChildBinding& b = bindings[i];
+            if ( !b.element && b.name && b.hash == hash && XMLUtil::StringEqual( b.name, element->Name() ) ) {
+                b.element = element;
+                ++found;
+            }
+        }
+    }
+    return found;
 }
 
 
@@ -2189,6 +2494,8 @@ XMLDocument::XMLDocument( bool processEntities, Whitespace whitespaceMode ) :
     _errorStr(),
     _errorLineNum( 0 ),
     _charBuffer( 0 ),
+    _charBufferOwned( true ),
+    _arena( 0 ),
     _parseCurLineNum( 0 ),
 	_parsingDepth(0),
     _unlinked(),
@@ -2233,10 +2540,23 @@ void XMLDocument::Clear()
 #endif
     ClearError();
 
-    delete [] _charBuffer;
+    if ( _charBufferOwned ) {
+        delete [] _charBuffer;
+    }
     _charBuffer = 0;
+    _charBufferOwned = true;
 	_parsingDepth = 0;
 
+    if ( _arena ) {
+        // Every node is gone, so drop the free lists that point into the
+        // arena before rewinding it.
+        _elementPool.Clear();
+        _attributePool.Clear();
+        _textPool.Clear();
+        _commentPool.Clear();
+        _arena->Reset();
+    }
+
 #if 0
     _textPool.Trace( "text" );
     _elementPool.Trace( "element" );
@@ -2475,6 +2795,51 @@ XMLError XMLDocument::Parse( const char* xml, size_t nBytes )
 }
 
 
+XMLError XMLDocument::ParseInSitu( char* xml, size_t nBytes )
+{
+    Clear();
+
+    if ( nBytes == 0 || !xml || !*xml ) {
+        SetError( XML_ERROR_EMPTY_DOCUMENT, 0, 0 );
+        return _errorID;
+    }
+    if ( nBytes != static_cast<size_t>(-1) ) {
+        xml[nBytes] = 0;
+    }
+    TIXMLASSERT( _charBuffer == 0 );
+    _charBuffer = xml;
+    _charBufferOwned = false;
+
+    Parse();
+    if ( Error() ) {
+        DeleteChildren();
+        _elementPool.Clear();
+        _attributePool.Clear();
+        _textPool.Clear();
+        _commentPool.Clear();
+    }
+    return _errorID;
+}
+
+
+void XMLDocument::SetArena( XMLArena* arena )
+{
+    Clear();
+    _elementPool.Clear();
+    _attributePool.Clear();
+    _textPool.Clear();
+    _commentPool.Clear();
+    _arena = arena;
+    _elementPool.SetArena( arena );
+    _attributePool.SetArena( arena );
+    _textPool.SetArena( arena );
+    _commentPool.SetArena( arena );
+    if ( arena ) {
+        arena->Reset();
+    }
+}
+
+
 void XMLDocument::Print( XMLPrinter* streamer ) const
 {
     if ( streamer ) {
@@ -2577,6 +2942,865 @@ void XMLDocument::PopDepth()
 	--_parsingDepth;
 }
 
+// --------- XMLReader ----------- //
+
+static int CountNewlines( const char* p, const char* q )
+{
+    int n = 0;
+    for( ; p < q; ++p ) {
+        if ( *p == '\n' ) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+
+XMLReader::XMLReader( char* mem, size_t size, int maxDepth ) :
+    _mem( mem ),
+    _size( size ),
+    _stack( 0 ),
+    _maxDepth( 0 )
+{
+    TIXMLASSERT( mem );
+    TIXMLASSERT( size > 1 );
+    // The element stack lives at the aligned end of the buffer.
+    const size_t stackBytes = maxDepth * sizeof( unsigned ) + sizeof( unsigned ) - 1;
+    if ( maxDepth > 0 && stackBytes + 1 < size ) {
+        char* stack = mem + size - stackBytes;
+        stack += ( sizeof( unsigned ) - reinterpret_cast<uintptr_t>( stack ) % sizeof( unsigned ) ) % sizeof( unsigned );
+        _stack = reinterpret_cast<unsigned*>( stack );
+        _maxDepth = maxDepth;
+        _size = size - stackBytes;
+    }
+    Reset();
+}
+
+
+void XMLReader::Reset()
+{
+    _namesEnd = _mem;
+    _pos = 0;
+    _len = 0;
+    _mem[0] = 0;
+    _restore = 0;
+    _restoreChar = 0;
+    _finished = false;
+    _started = false;
+    _sawElement = false;
+    _pendingEnd = false;
+    _event = NEED_INPUT;
+    _depth = 0;
+    _lineNum = 1;
+    _eventLineNum = 0;
+    _name = 0;
+    _text = 0;
+    _cdata = false;
+    _attributes = 0;
+    _attributeCount = 0;
+    _errorID = XML_SUCCESS;
+}
+
+
+size_t XMLReader::Feed( const char* data, size_t len )
+{
+    TIXMLASSERT( !_finished );
+    const size_t room = _size - 1 - _len;
+    if ( len > room ) {
+        len = room;
+    }
+    memcpy( _mem + _len, data, len );
+    _len += len;
+    _mem[_len] = 0;
+    return len;
+}
+
+
+void XMLReader::Consume( char* p )
+{
+    TIXMLASSERT( p >= _mem + _pos && p <= _mem + _len );
+    _lineNum += CountNewlines( _mem + _pos, p );
+    _pos = p - _mem;
+}
+
+
+XMLReader::Event XMLReader::SetError( XMLError error )
+{
+    _errorID = error;
+    _name = 0;
+    _text = 0;
+    _attributeCount = 0;
+    return _event = READ_ERROR;
+}
+
+
+XMLReader::Event XMLReader::NeedInput( char* p )
+{
+    // Nothing between the names and 'p' is needed any more: make room for
+    // Feed().
+    Consume( p );
+    const size_t names = _namesEnd - _mem;
+    memmove( _namesEnd, _mem + _pos, _len - _pos );
+    _len -= _pos - names;
+    _pos = names;
+    _mem[_len] = 0;
+    if ( _len + 1 >= _size ) {
+        // A tag or text run larger than the buffer.
+        _eventLineNum = _lineNum;
+        return SetError( XML_ERROR_PARSING );
+    }
+    return _event = NEED_INPUT;
+}
+
+
+XMLReader::Event XMLReader::Next()
+{
+    if ( _event == READ_ERROR || _event == END_DOCUMENT ) {
+        return _event;
+    }
+    if ( _restore ) {
+        *_restore = _restoreChar;
+        _restore = 0;
+    }
+    _text = 0;
+    _cdata = false;
+    _attributes = 0;
+    _attributeCount = 0;
+    if ( _pendingEnd ) {
+        // _name still points at the self closing tag
+        _pendingEnd = false;
+        --_depth;
+        return _event = END_ELEMENT;
+    }
+    _name = 0;
+
+    for( ;; ) {
+        char* p = _mem + _pos;
+        char* const end = _mem + _len;
+        if ( !_started ) {
+            if ( end - p < 3 && !_finished ) {
+                return NeedInput( p );
+            }
+            bool hasBOM;
+            p = const_cast<char*>( XMLUtil::ReadBOM( p, &hasBOM ) );
+            _pos = p - _mem;
+            _started = true;
+        }
+
+        char* const q = XMLUtil::SkipWhiteSpace( p, 0 );
+        if ( q == end ) {
+            if ( !_finished ) {
+                // Keep the whitespace, it may be the start of a text.
+                return NeedInput( p );
+            }
+            Consume( q );
+            _eventLineNum = _lineNum;
+            if ( _depth > 0 ) {
+                return SetError( XML_ERROR_MISMATCHED_ELEMENT );
+            }
+            if ( !_sawElement ) {
+                return SetError( XML_ERROR_EMPTY_DOCUMENT );
+            }
+            return _event = END_DOCUMENT;
+        }
+
+        if ( *q != '<' ) {
+            // Text, including its leading whitespace. It is complete
+            // once the '<' that follows it has arrived.
+            char* const lt = strchr( q, '<' );
+            _eventLineNum = _lineNum + CountNewlines( p, q );
+            if ( !lt ) {
+                return _finished ? SetError( XML_ERROR_PARSING_TEXT ) : NeedInput( p );
+            }
+            Consume( lt );
+            StrPair text;
+            text.Set( p, lt, StrPair::TEXT_ELEMENT );
+            _restore = lt;
+            _restoreChar = *lt;
+            _text = text.GetStr();
+            return _event = TEXT;
+        }
+
+        // Long enough to tell the markup apart
+        if ( end - q < 9 && !_finished ) {
+            return NeedInput( q );
+        }
+        Consume( q );
+        _eventLineNum = _lineNum;
+        if ( XMLUtil::StringEqual( q, "<?", 2 ) ) {
+            char* const e = strstr( q + 2, "?>" );
+            if ( !e ) {
+                return _finished ? SetError( XML_ERROR_PARSING_DECLARATION ) : NeedInput( q );
+            }
+            Consume( e + 2 );
+        }
+        else if ( XMLUtil::StringEqual( q, "<!--", 4 ) ) {
+            char* const e = strstr( q + 4, "-->" );
+            if ( !e ) {
+                return _finished ? SetError( XML_ERROR_PARSING_COMMENT ) : NeedInput( q );
+            }
+            Consume( e + 3 );
+        }
+        else if ( XMLUtil::StringEqual( q, "<![CDATA[", 9 ) ) {
+            char* const e = strstr( q + 9, "]]>" );
+            if ( !e ) {
+                return _finished ? SetError( XML_ERROR_PARSING_CDATA ) : NeedInput( q );
+            }
+            Consume( e + 3 );
+            StrPair text;
+            text.Set( q + 9, e, StrPair::NEEDS_NEWLINE_NORMALIZATION );
+            _text = text.GetStr();
+            _cdata = true;
+            return _event = TEXT;
+        }
+        else if ( XMLUtil::StringEqual( q, "<!", 2 ) ) {
+            char* const e = strchr( q + 2, '>' );
+            if ( !e ) {
+                return _finished ? SetError( XML_ERROR_PARSING_UNKNOWN ) : NeedInput( q );
+            }
+            Consume( e + 1 );
+        }
+        else if ( q[1] == '/' ) {
+            return ReadEndElement( q );
+        }
+        else {
+            return ReadElement( q );
+        }
+    }
+}
+
+
+XMLReader::Event XMLReader::ReadElement( char* q )
+{
+    // Find the '>' closing the tag, skipping any inside attribute values.
+    char* e = q + 1;
+    char quote = 0;
+    for( ; *e; ++e ) {
+        if ( quote ) {
+            if ( *e == quote ) {
+                quote = 0;
+            }
+        }
+        else if ( *e == '"' || *e == '\'' ) {
+            quote = *e;
+        }
+        else if ( *e == '>' ) {
+            break;
+        }
+    }
+    if ( !*e ) {
+        return _finished ? SetError( XML_ERROR_PARSING_ELEMENT ) : NeedInput( q );
+    }
+
+    char* const name = q + 1;
+    if ( !XMLUtil::IsNameStartChar( static_cast<unsigned char>( *name ) ) ) {
+        return SetError( XML_ERROR_PARSING );
+    }
+    char* p = name + 1;
+    while ( XMLUtil::IsNameChar( static_cast<unsigned char>( *p ) ) ) {
+        ++p;
+    }
+    char* const nameEnd = p;
+
+    // Normalize the attributes and pack them as name\0value\0 pairs right
+    // after the name. The write position always trails the read position.
+    char* w = nameEnd + 1;
+    int count = 0;
+    bool closed = false;
+    for( ;; ) {
+        p = XMLUtil::SkipWhiteSpace( p, 0 );
+        if ( p == e ) {
+            break;
+        }
+        if ( *p == '/' && p + 1 == e ) {
+            closed = true;
+            break;
+        }
+        if ( !XMLUtil::IsNameStartChar( static_cast<unsigned char>( *p ) ) ) {
+            return SetError( XML_ERROR_PARSING_ATTRIBUTE );
+        }
+        char* const attrName = p;
+        while ( XMLUtil::IsNameChar( static_cast<unsigned char>( *p ) ) ) {
+            ++p;
+        }
+        const size_t attrNameLen = p - attrName;
+        // The same name twice in one tag is an error, as in XMLDocument.
+        for( const char* a = nameEnd + 1; a < w; ) {
+            const size_t len = strlen( a );
+            if ( len == attrNameLen && memcmp( a, attrName, len ) == 0 ) {
+                return SetError( XML_ERROR_PARSING_ATTRIBUTE );
+            }
+            a += len + 1;
+            a += strlen( a ) + 1;
+        }
+        p = XMLUtil::SkipWhiteSpace( p, 0 );
+        if ( *p != '=' ) {
+            return SetError( XML_ERROR_PARSING_ATTRIBUTE );
+        }
+        p = XMLUtil::SkipWhiteSpace( p + 1, 0 );
+        const char valueQuote = *p;
+        char* const valueEnd = ( valueQuote == '"' || valueQuote == '\'' ) ? strchr( p + 1, valueQuote ) : 0;
+        if ( !valueEnd || valueEnd > e ) {
+            return SetError( XML_ERROR_PARSING_ATTRIBUTE );
+        }
+        memmove( w, attrName, attrNameLen );
+        w += attrNameLen;
+        *w++ = 0;
+        StrPair value;
+        value.Set( p + 1, valueEnd, StrPair::ATTRIBUTE_VALUE );
+        const char* str = value.GetStr();
+        const size_t len = strlen( str ) + 1;
+        memmove( w, str, len );
+        w += len;
+        p = valueEnd + 1;
+        ++count;
+    }
+
+    if ( _depth >= _maxDepth ) {
+        return SetError( XML_ELEMENT_DEPTH_EXCEEDED );
+    }
+    Consume( e + 1 );
+    *nameEnd = 0;
+    _stack[_depth++] = HashName( name );
+    _name = name;
+    if ( !closed ) {
+        // Keep the name for the end tag, down over consumed input. The
+        // copy ends before the attributes, and becomes the one reported.
+        const size_t len = nameEnd - name + 1;
+        memmove( _namesEnd, name, len );
+        _name = _namesEnd;
+        _namesEnd += len;
+    }
+    _sawElement = true;
+    _attributes = nameEnd + 1;
+    _attributeCount = count;
+    _pendingEnd = closed;
+    return _event = START_ELEMENT;
+}
+
+
+XMLReader::Event XMLReader::ReadEndElement( char* q )
+{
+    char* const e = strchr( q, '>' );
+    if ( !e ) {
+        return _finished ? SetError( XML_ERROR_PARSING_ELEMENT ) : NeedInput( q );
+    }
+    char* const name = q + 2;
+    char* p = name;
+    while ( XMLUtil::IsNameChar( static_cast<unsigned char>( *p ) ) ) {
+        ++p;
+    }
+    char* const nameEnd = p;
+    if ( nameEnd == name || XMLUtil::SkipWhiteSpace( nameEnd, 0 ) != e ) {
+        return SetError( XML_ERROR_PARSING_ELEMENT );
+    }
+    *nameEnd = 0;
+    // The hash rules out most mismatches, the kept name the rest.
+    const size_t len = nameEnd - name + 1;
+    if ( _depth == 0 || _stack[_depth - 1] != HashName( name ) || len > static_cast<size_t>( _namesEnd - _mem ) ) {
+        return SetError( XML_ERROR_MISMATCHED_ELEMENT );
+    }
+    const char* const open = _namesEnd - len;
+    if ( ( open > _mem && open[-1] ) || memcmp( open, name, len ) != 0 ) {
+        return SetError( XML_ERROR_MISMATCHED_ELEMENT );
+    }
+    Consume( e + 1 );
+    _namesEnd -= len;
+    --_depth;
+    _name = name;
+    return _event = END_ELEMENT;
+}
+
+
+const char* XMLReader::AttributeName( int index ) const
+{
+    if ( index < 0 || index >= _attributeCount ) {
+        return 0;
+    }
+    const char* p = _attributes;
+    for( int i = 0; i < index; ++i ) {
+        p += strlen( p ) + 1;
+        p += strlen( p ) + 1;
+    }
+    return p;
+}
+
+
+const char* XMLReader::AttributeValue( int index ) const
+{
+    const char* name = AttributeName( index );
+    return name ? name + strlen( name ) + 1 : 0;
+}
+
+
+const char* XMLReader::Attribute( const char* name, const char* value ) const
+{
+    const char* p = _attributes;
+    for( int i = 0; i < _attributeCount; ++i ) {
+        const char* v = p + strlen( p ) + 1;
+        if ( XMLUtil::StringEqual( p, name ) ) {
+            if ( !value || XMLUtil::StringEqual( v, value ) ) {
+                return v;
+            }
+            return 0;
+        }
+        p = v + strlen( v ) + 1;
+    }
+    return 0;
+}
+
+
+const char* XMLReader::ErrorName() const
+{
+    return XMLDocument::ErrorIDToName( _errorID );
+}
+
+
+// --------- XMLSnapshot ----------- //
+
+struct XMLSnapshot::Header
+{
+    char			magic[4];
+    unsigned char	version;
+    unsigned char	pointerSize;
+    unsigned char	hasBOM;
+    unsigned char	loaded;
+    uint32_t		size;
+    uint32_t		nodeCount;
+    uint32_t		attributeCount;
+    uint32_t		strings;	// offset of the string table
+};
+
+static const char SNAPSHOT_MAGIC[4] = { 'T', 'X', 'S', 'N' };
+static const unsigned char SNAPSHOT_VERSION = 1;
+
+// The node records follow the header, aligned for a pointer
+const size_t XMLSnapshot::NODES = ( sizeof( XMLSnapshot::Header ) + sizeof( void* ) - 1 ) & ~( sizeof( void* ) - 1 );
+
+
+// Distinct strings of a document being saved, and their offsets in the
+// string table.
+class SnapshotStrings
+{
+public:
+    SnapshotStrings( size_t count ) : _mask( 15 ), _bytes( 0 ) {
+        while ( _mask < count * 2 ) {
+            _mask = _mask * 2 + 1;
+        }
+        _slots = new Slot[_mask + 1];
+        memset( _slots, 0, ( _mask + 1 ) * sizeof( Slot ) );
+    }
+    ~SnapshotStrings() {
+        delete [] _slots;
+    }
+
+    // Offset of 'str' in the table, adding it the first time
+    size_t Intern( const char* str ) {
+        const unsigned hash = HashName( str );
+        for( size_t i = hash & _mask; ; i = ( i + 1 ) & _mask ) {
+            Slot& slot = _slots[i];
+            if ( !slot.str ) {
+                slot.str = str;
+                slot.hash = hash;
+                slot.offset = _bytes;
+                _bytes += strlen( str ) + 1;
+                return slot.offset;
+            }
+            if ( slot.hash == hash && XMLUtil::StringEqual( slot.str, str ) ) {
+                return slot.offset;
+            }
+        }
+    }
+    size_t Bytes() const {
+        return _bytes;
+    }
+    // Copy the table to 'out'
+    void Write( char* out ) const {
+        for( size_t i = 0; i <= _mask; ++i ) {
+            if ( _slots[i].str ) {
+                memcpy( out + _slots[i].offset, _slots[i].str, strlen( _slots[i].str ) + 1 );
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        const char*	str;
+        size_t		offset;
+        unsigned	hash;
+    };
+    Slot*	_slots;
+    size_t	_mask;
+    size_t	_bytes;
+
+    SnapshotStrings( const SnapshotStrings& );	// not supported
+    void operator=( const SnapshotStrings& );	// not supported
+};
+
+
+// Pre-order walk of the nodes under 'root'
+static const XMLNode* NextInDocument( const XMLNode* node, const XMLNode* root )
+{
+    if ( node->FirstChild() ) {
+        return node->FirstChild();
+    }
+    while ( node != root ) {
+        if ( node->NextSibling() ) {
+            return node->NextSibling();
+        }
+        node = node->Parent();
+    }
+    return 0;
+}
+
+
+// Records hold offsets from the start of the block until loaded
+template< class T > static T* SnapshotOffset( size_t offset )
+{
+    return reinterpret_cast<T*>( static_cast<uintptr_t>( offset ) );
+}
+
+template< class T > static size_t SnapshotOffsetOf( T* p )
+{
+    return static_cast<size_t>( reinterpret_cast<uintptr_t>( p ) );
+}
+
+
+size_t XMLSnapshot::Save( const XMLDocument& doc, char* buffer, size_t size )
+{
+    size_t nodeCount = 0;
+    size_t attributeCount = 0;
+    for( const XMLNode* node = &doc; node; node = NextInDocument( node, &doc ) ) {
+        ++nodeCount;
+        if ( const XMLElement* element = node->ToElement() ) {
+            for( const XMLAttribute* a = element->FirstAttribute(); a; a = a->Next() ) {
+                ++attributeCount;
+            }
+        }
+    }
+    SnapshotStrings strings( nodeCount + 2 * attributeCount );
+    for( const XMLNode* node = &doc; node; node = NextInDocument( node, &doc ) ) {
+        if ( node->Value() ) {
+            strings.Intern( node->Value() );
+        }
+        if ( const XMLElement* element = node->ToElement() ) {
+            for( const XMLAttribute* a = element->FirstAttribute(); a; a = a->Next() ) {
+                strings.Intern( a->Name() );
+                strings.Intern( a->Value() );
+            }
+        }
+    }
+
+    const size_t attributesAt = NODES + nodeCount * sizeof( Node );
+    const size_t stringsAt = attributesAt + attributeCount * sizeof( Attribute );
+    const size_t total = stringsAt + strings.Bytes();
+    if ( !buffer || size < total ) {
+        return total;
+    }
+    TIXMLASSERT( reinterpret_cast<uintptr_t>( buffer ) % sizeof( void* ) == 0 );
+    memset( buffer, 0, stringsAt );
+    strings.Write( buffer + stringsAt );
+
+    Header* header = reinterpret_cast<Header*>( buffer );
+    memcpy( header->magic, SNAPSHOT_MAGIC, sizeof( header->magic ) );
+    header->version = SNAPSHOT_VERSION;
+    header->pointerSize = sizeof( void* );
+    header->hasBOM = doc.HasBOM();
+    header->size = static_cast<uint32_t>( total );
+    header->nodeCount = static_cast<uint32_t>( nodeCount );
+    header->attributeCount = static_cast<uint32_t>( attributeCount );
+    header->strings = static_cast<uint32_t>( stringsAt );
+
+    // Walk the document again, linking each record to its parent and to
+    // its previous sibling or parent as it is written.
+    Node* nodes = reinterpret_cast<Node*>( buffer + NODES );
+    Attribute* attributes = reinterpret_cast<Attribute*>( buffer + attributesAt );
+    size_t n = 0;
+    size_t a = 0;
+    const XMLNode* node = &doc;
+    Node* record = 0;
+    for( ;; ) {
+        Node* next = &nodes[n++];
+        next->_type = Node::DOCUMENT;
+        if ( node->ToElement() ) {
+            next->_type = Node::ELEMENT;
+            next->_attributes = SnapshotOffset<Attribute>( attributesAt + a * sizeof( Attribute ) );
+            for( const XMLAttribute* attr = node->ToElement()->FirstAttribute(); attr; attr = attr->Next() ) {
+                attributes[a].name = SnapshotOffset<const char>( stringsAt + strings.Intern( attr->Name() ) );
+                attributes[a].value = SnapshotOffset<const char>( stringsAt + strings.Intern( attr->Value() ) );
+                ++a;
+                ++next->_attributeCount;
+            }
+        }
+        else if ( node->ToText() ) {
+            next->_type = Node::TEXT;
+            next->_cdata = node->ToText()->CData();
+        }
+        else if ( node->ToComment() ) {
+            next->_type = Node::COMMENT;
+        }
+        else if ( node->ToDeclaration() ) {
+            next->_type = Node::DECLARATION;
+        }
+        else if ( node->ToUnknown() ) {
+            next->_type = Node::UNKNOWN;
+        }
+        if ( node->Value() ) {
+            next->_value = SnapshotOffset<const char>( stringsAt + strings.Intern( node->Value() ) );
+        }
+        next->_lineNum = node->GetLineNum();
+
+        const size_t offset = reinterpret_cast<char*>( next ) - buffer;
+        if ( record && node->Parent() && node->Parent()->FirstChild() == node ) {
+            // first child of 'record'
+            next->_parent = SnapshotOffset<const Node>( reinterpret_cast<char*>( record ) - buffer );
+            record->_firstChild = SnapshotOffset<const Node>( offset );
+        }
+        else if ( record ) {
+            // next sibling of 'record'
+            next->_parent = record->_parent;
+            record->_next = SnapshotOffset<const Node>( offset );
+        }
+        record = next;
+
+        if ( node->FirstChild() ) {
+            node = node->FirstChild();
+            continue;
+        }
+        while ( node != &doc && !node->NextSibling() ) {
+            node = node->Parent();
+            record = reinterpret_cast<Node*>( buffer + SnapshotOffsetOf( record->_parent ) );
+        }
+        if ( node == &doc ) {
+            break;
+        }
+        node = node->NextSibling();
+    }
+    TIXMLASSERT( n == nodeCount && a == attributeCount );
+    return total;
+}
+
+
+bool XMLSnapshot::Load( char* block, size_t size )
+{
+    _root = 0;
+    _size = 0;
+    _hasBOM = false;
+    if ( !block || size < NODES || reinterpret_cast<uintptr_t>( block ) % sizeof( void* ) ) {
+        return false;
+    }
+    // Sizes from the header are checked by division, as the products can
+    // wrap around with a 32 bit size_t.
+    Header* header = reinterpret_cast<Header*>( block );
+    if ( memcmp( header->magic, SNAPSHOT_MAGIC, sizeof( header->magic ) ) != 0
+            || header->version != SNAPSHOT_VERSION || header->pointerSize != sizeof( void* )
+            || header->loaded || header->size != size || header->nodeCount == 0
+            || header->nodeCount > ( size - NODES ) / sizeof( Node ) ) {
+        return false;
+    }
+    const size_t attributesAt = NODES + header->nodeCount * sizeof( Node );
+    if ( header->attributeCount > ( size - attributesAt ) / sizeof( Attribute ) ) {
+        return false;
+    }
+    const size_t stringsAt = attributesAt + header->attributeCount * sizeof( Attribute );
+    if ( header->strings != stringsAt || stringsAt >= size || block[size - 1] != 0 ) {
+        return false;
+    }
+
+    // Check every offset before changing anything. The block ends with a
+    // null, so any offset into the string table is a terminated string.
+    // Save() writes the nodes in document order, so children and siblings
+    // come after a node and its parent before it; holding blobs to that,
+    // and to the parent links agreeing with the child and sibling links,
+    // rules out loops and leaves only the root without a parent.
+    Node* nodes = reinterpret_cast<Node*>( block + NODES );
+    Attribute* attributes = reinterpret_cast<Attribute*>( block + attributesAt );
+    for( size_t i = 0; i < header->nodeCount; ++i ) {
+        const Node& node = nodes[i];
+        const size_t self = NODES + i * sizeof( Node );
+        const size_t parent = SnapshotOffsetOf( node._parent );
+        const size_t links[3] = { parent, SnapshotOffsetOf( node._firstChild ), SnapshotOffsetOf( node._next ) };
+        for( int j = 0; j < 3; ++j ) {
+            if ( links[j] && ( links[j] < NODES || links[j] >= attributesAt || ( links[j] - NODES ) % sizeof( Node ) ) ) {
+                return false;
+            }
+        }
+        if ( ( i == 0 ) != ( parent == 0 ) || parent >= self
+                || ( links[1] && ( links[1] <= self || SnapshotOffsetOf( nodes[( links[1] - NODES ) / sizeof( Node )]._parent ) != self ) )
+                || ( links[2] && ( i == 0 || links[2] <= self || SnapshotOffsetOf( nodes[( links[2] - NODES ) / sizeof( Node )]._parent ) != parent ) ) ) {
+            return false;
+        }
+        const size_t value = SnapshotOffsetOf( node._value );
+        const size_t attrs = SnapshotOffsetOf( node._attributes );
+        if ( ( value && ( value < stringsAt || value >= size ) )
+                || node._type > Node::UNKNOWN
+                || node._attributeCount < 0
+                || ( node._attributeCount && ( attrs < attributesAt || attrs > stringsAt || ( attrs - attributesAt ) % sizeof( Attribute )
+                        || static_cast<size_t>( node._attributeCount ) > ( stringsAt - attrs ) / sizeof( Attribute ) ) ) ) {
+            return false;
+        }
+    }
+    // A walk from the root then visits each node once at most; stop at
+    // nodeCount visits all the same.
+    size_t visits = 0;
+    for( size_t i = 0; ; ) {
+        if ( ++visits > header->nodeCount ) {
+            return false;
+        }
+        size_t link = SnapshotOffsetOf( nodes[i]._firstChild );
+        while ( !link && i != 0 ) {
+            link = SnapshotOffsetOf( nodes[i]._next );
+            if ( !link ) {
+                i = ( SnapshotOffsetOf( nodes[i]._parent ) - NODES ) / sizeof( Node );
+            }
+        }
+        if ( !link ) {
+            break;
+        }
+        i = ( link - NODES ) / sizeof( Node );
+    }
+    for( size_t i = 0; i < header->attributeCount; ++i ) {
+        const size_t name = SnapshotOffsetOf( attributes[i].name );
+        const size_t value = SnapshotOffsetOf( attributes[i].value );
+        if ( name < stringsAt || name >= size || value < stringsAt || value >= size ) {
+            return false;
+        }
+    }
+
+    for( size_t i = 0; i < header->nodeCount; ++i ) {
+        Node& node = nodes[i];
+        if ( node._value ) {
+            node._value = block + SnapshotOffsetOf( node._value );
+        }
+        if ( node._parent ) {
+            node._parent = reinterpret_cast<const Node*>( block + SnapshotOffsetOf( node._parent ) );
+        }
+        if ( node._firstChild ) {
+            node._firstChild = reinterpret_cast<const Node*>( block + SnapshotOffsetOf( node._firstChild ) );
+        }
+        if ( node._next ) {
+            node._next = reinterpret_cast<const Node*>( block + SnapshotOffsetOf( node._next ) );
+        }
+        if ( node._attributeCount ) {
+            node._attributes = reinterpret_cast<const Attribute*>( block + SnapshotOffsetOf( node._attributes ) );
+        }
+        else {
+            node._attributes = 0;
+        }
+    }
+    for( size_t i = 0; i < header->attributeCount; ++i ) {
+        attributes[i].name = block + SnapshotOffsetOf( attributes[i].name );
+        attributes[i].value = block + SnapshotOffsetOf( attributes[i].value );
+    }
+    header->loaded = 1;
+    _root = nodes;
+    _size = size;
+    _hasBOM = header->hasBOM != 0;
+    return true;
+}
+
+
+void XMLSnapshot::Print( XMLPrinter* printer, bool compact ) const
+{
+    TIXMLASSERT( printer );
+    if ( !_root ) {
+        return;
+    }
+    if ( _hasBOM ) {
+        printer->PushHeader( true, false );
+    }
+    const Node* node = _root->_firstChild;
+    while ( node ) {
+        switch( node->_type ) {
+            case Node::ELEMENT:
+                printer->OpenElement( node->_value, compact );
+                for( int i = 0; i < node->_attributeCount; ++i ) {
+                    printer->PushAttribute( node->_attributes[i].name, node->_attributes[i].value );
+                }
+                break;
+            case Node::TEXT:
+                printer->PushText( node->_value, node->CData() );
+                break;
+            case Node::COMMENT:
+                printer->PushComment( node->_value );
+                break;
+            case Node::DECLARATION:
+                printer->PushDeclaration( node->_value );
+                break;
+            case Node::UNKNOWN:
+                printer->PushUnknown( node->_value );
+                break;
+            default:
+                break;
+        }
+        if ( node->_type == Node::ELEMENT && node->_firstChild ) {
+            node = node->_firstChild;
+            continue;
+        }
+        // Close elements on the way up to the next sibling
+        for( ;; ) {
+            if ( node->_type == Node::ELEMENT ) {
+                printer->CloseElement( compact );
+            }
+            if ( node->_next ) {
+                node = node->_next;
+                break;
+            }
+            node = node->_parent;
+            if ( node == _root ) {
+                node = 0;
+                break;
+            }
+        }
+    }
+}
+
+
+const XMLSnapshot::Node* XMLSnapshot::Node::FirstChildElement( const char* name ) const
+{
+    for( const Node* node = _firstChild; node; node = node->_next ) {
+        if ( node->_type == ELEMENT && ( !name || XMLUtil::StringEqual( node->_value, name ) ) ) {
+            return node;
+        }
+    }
+    return 0;
+}
+
+
+const XMLSnapshot::Node* XMLSnapshot::Node::NextSiblingElement( const char* name ) const
+{
+    for( const Node* node = _next; node; node = node->_next ) {
+        if ( node->_type == ELEMENT && ( !name || XMLUtil::StringEqual( node->_value, name ) ) ) {
+            return node;
+        }
+    }
+    return 0;
+}
+
+
+const char* XMLSnapshot::Node::GetText() const
+{
+    if ( _firstChild && _firstChild->_type == TEXT ) {
+        return _firstChild->_value;
+    }
+    return 0;
+}
+
+
+const char* XMLSnapshot::Node::Attribute( const char* name, const char* value ) const
+{
+    for( int i = 0; i < _attributeCount; ++i ) {
+        if ( XMLUtil::StringEqual( _attributes[i].name, name ) ) {
+            if ( !value || XMLUtil::StringEqual( _attributes[i].value, value ) ) {
+                return _attributes[i].value;
+            }
+            return 0;
+        }
+    }
+    return 0;
+}
+
+
 XMLPrinter::XMLPrinter( FILE* file, bool compact, int depth, EscapeAposCharsInAttributes aposInAttributes ) :
     _elementJustOpened( false ),
     _stack(),
@@ -335,6 +335,69 @@ public:
 };
 
 
+/**
+	A fixed region of caller-owned memory that the node pools of an
+	XMLDocument carve nodes from, one at a time, instead of allocating
+	4k blocks from the heap. Use it together with XMLDocument::ParseInSitu()
+	to parse a document with a single, up front memory reservation:
+
+	@verbatim
+	static char nodeMem[8 * 1024];
+	XMLArena arena( nodeMem, sizeof(nodeMem) );
+	XMLDocument doc;
+	doc.SetArena( &arena );
+	doc.ParseInSitu( buffer, length );
+	@endverbatim
+
+	If the arena runs out the pools fall back to allocating heap blocks,
+	and Overflows() counts how many times that happened. The arena is rewound whenever the document
+	is cleared; it must outlive the document, and must not be shared between
+	documents.
+*/
+class XMLArena
+{
+public:
+    XMLArena( void* mem, size_t size ) : _mem( static_cast<char*>( mem ) ), _size( size ), _used( 0 ), _highWater( 0 ), _overflows( 0 ) {}
+
+    /// Returns 'size' bytes, or null if the arena is exhausted.
+    void* Alloc( size_t size ) {
+        static const size_t ALIGN = sizeof( double ) > sizeof( void* ) ? sizeof( double ) : sizeof( void* );
+        const size_t start = ( reinterpret_cast<size_t>( _mem + _used ) + ALIGN - 1 ) & ~( ALIGN - 1 );
+        const size_t offset = start - reinterpret_cast<size_t>( _mem );
+        if ( offset > _size || size > _size - offset ) {
+            ++_overflows;
+            return 0;
+        }
+        _used = offset + size;
+        if ( _used > _highWater ) {
+            _highWater = _used;
+        }
+        return _mem + offset;
+    }
+    /// Rewind the arena. Everything allocated from it is released.
+    void Reset() {
+        _used = 0;
+    }
+
+    size_t Capacity() const     { return _size; }
+    size_t Used() const         { return _used; }
+    /// The largest Used() value seen since construction.
+    size_t HighWater() const    { return _highWater; }
+    /// Number of allocations that did not fit (the pool used the heap instead).
+    size_t Overflows() const    { return _overflows; }
+
+private:
+    XMLArena( const XMLArena& ); // not supported
+    void operator=( const XMLArena& ); // not supported
+
+    char*  _mem;
+    size_t _size;
+    size_t _used;
+    size_t _highWater;
+    size_t _overflows;
+};
+
+
 /*
 	Template child class to create pools of the correct type.
 */
@@ -342,7 +405,7 @@ template< size_t ITEM_SIZE >
 class MemPoolT : public MemPool
 {
 public:
-    MemPoolT() : _blockPtrs(), _root(0), _currentAllocs(0), _nAllocs(0), _maxAllocs(0), _nUntracked(0)	{}
+    MemPoolT() : _blockPtrs(), _root(0), _arena(0), _currentAllocs(0), _nAllocs(0), _maxAllocs(0), _nUntracked(0)	{}
     ~MemPoolT() {
         MemPoolT< ITEM_SIZE >::Clear();
     }
@@ -367,7 +430,19 @@ public:
         return _currentAllocs;
     }
 
+    /// Take new items from 'arena' (may be null) before allocating blocks.
+    void SetArena( XMLArena* arena ) {
+        _arena = arena;
+    }
+
     virtual void* Alloc() override{
+        if ( !_root && _arena ) {
+            Item* item = static_cast<Item*>( _arena->Alloc( sizeof( Item ) ) );
+            if ( item ) {
+                item->next = 0;
+                _root = item;
+            }
+        }
         if ( !_root ) {
             // Need a new block.
             Block* block = new Block;
@@ -445,6 +520,7 @@ private:
     };
     DynArray< Block*, 10 > _blockPtrs;
     Item* _root;
+    XMLArena* _arena;
 
     size_t _currentAllocs;
     size_t _nAllocs;
@@ -549,7 +625,11 @@ public:
     static const char* SkipWhiteSpace( const char* p, int* curLineNumPtr )	{
         TIXMLASSERT( p );
 
-        while( IsWhiteSpace(*p) ) {
+        // Short runs here, long ones (indentation) a block at a time.
+        for( int n = 0; IsWhiteSpace(*p); ++n ) {
+            if ( n == 4 ) {
+                return SkipWhiteSpaceRun( p, curLineNumPtr );
+            }
             if (curLineNumPtr && *p == '\n') {
                 ++(*curLineNumPtr);
             }
@@ -561,6 +641,7 @@ public:
     static char* SkipWhiteSpace( char* const p, int* curLineNumPtr ) {
         return const_cast<char*>( SkipWhiteSpace( const_cast<const char*>(p), curLineNumPtr ) );
     }
+    static const char* SkipWhiteSpaceRun( const char* p, int* curLineNumPtr );
 
     // Anything in the high order range of UTF-8 is assumed to not be whitespace. This isn't
     // correct, but simple, and usually works.
@@ -970,6 +1051,7 @@ private:
     void Unlink( XMLNode* child );
     static void DeleteNode( XMLNode* node );
     void InsertChildPreamble( XMLNode* insertThis ) const;
+    void ChildrenChanged() const;
     const XMLElement* ToElementWithName( const char* name ) const;
 
     XMLNode( const XMLNode& );	// not supported
@@ -1258,6 +1340,18 @@ private:
 };
 
 
+/** One slot of the table passed to XMLElement::ExtractChildElements().
+	Set 'name' to the element name to look for; 'element' receives the
+	first child with that name, or null.
+*/
+struct XMLChildBinding
+{
+    const char*			name;
+    const XMLElement*	element;
+    unsigned			hash;		// internal, filled in by ExtractChildElements()
+};
+
+
 /** The element is a container class. It has a value, the element name,
 	and can contain other elements, text, comments, and unknowns.
 	Elements also contain an arbitrary number of attributes.
@@ -1265,6 +1359,7 @@ private:
 class TINYXML2_LIB XMLElement : public XMLNode
 {
     friend class XMLDocument;
+    friend class XMLNode;
 public:
     /// Get the name of an element (which is the Value() of the node.)
     const char* Name() const		{
@@ -1667,6 +1762,31 @@ public:
     /// See InsertNewChildElement()
     XMLUnknown* InsertNewUnknown(const char* text);
 
+    /** Index the child elements of this element by name, so that
+    	FirstChildElement(name) is a hash lookup instead of a walk over
+    	the children. The index is built on the first lookup and dropped
+    	whenever a child is added, removed or renamed, then rebuilt on the
+    	next lookup. Worth it for elements with many children that are
+    	queried by name repeatedly; it costs one allocation of about
+    	two pointers per child element, taken from the document's
+    	XMLArena when it has one.
+    */
+    void SetChildIndex( bool enable );
+    bool HasChildIndex() const	{
+        return _childIndexEnabled;
+    }
+
+    /** Look up a whole table of child elements by name in a single pass
+    	over the children. Each binding receives the first child element
+    	with a matching name, or null. Does not allocate, and does not
+    	need SetChildIndex(). Returns the number of bindings found.
+
+    	@verbatim
+    	XMLChildBinding fields[] = { { "solarflux", 0, 0 }, { "sunspots", 0, 0 } };
+    	ele->ExtractChildElements( fields, 2 );
+    	@endverbatim
+    */
+    int ExtractChildElements( XMLChildBinding* bindings, int count ) const;
 
     // internal:
     enum ElementClosingType {
@@ -1693,6 +1813,10 @@ private:
     char* ParseAttributes( char* p, int* curLineNumPtr );
     static void DeleteAttribute( XMLAttribute* attribute );
     XMLAttribute* CreateAttribute();
+    const XMLElement* IndexedChildElement( const char* name ) const;
+    void DropChildIndex() const;
+
+    struct ChildIndex;
 
     enum { BUF_SIZE = 200 };
     ElementClosingType _closingType;
@@ -1700,6 +1824,9 @@ private:
     // because the list needs to be scanned for dupes before adding
     // a new attribute.
     XMLAttribute* _rootAttribute;
+    // Name index of the child elements, built lazily when enabled.
+    mutable ChildIndex* _childIndex;
+    bool _childIndexEnabled;
 };
 
 
@@ -1751,6 +1878,27 @@ public:
     */
     XMLError Parse( const char* xml, size_t nBytes=static_cast<size_t>(-1) );
 
+    /**
+    	Parse an XML document in place, without copying it. The buffer is
+    	modified by the parse (names and text are null terminated and have
+    	entities and newlines normalized in place) and the document keeps
+    	pointing into it, so it must stay valid and unchanged until the
+    	document is cleared, re-parsed or destroyed.
+
+    	If 'nBytes' is given, xml[nBytes] must be writable; it is set to
+    	the null terminator. Otherwise 'xml' must be null terminated.
+    */
+    XMLError ParseInSitu( char* xml, size_t nBytes=static_cast<size_t>(-1) );
+
+    /**
+    	Allocate nodes from 'arena' instead of the heap, see XMLArena.
+    	Clears the document. Pass null to go back to heap blocks.
+    */
+    void SetArena( XMLArena* arena );
+    XMLArena* Arena() const {
+        return _arena;
+    }
+
     /**
     	Load an XML file from disk.
     	Returns XML_SUCCESS (0) on success, or
@@ -1940,6 +2088,8 @@ private:
     mutable StrPair	_errorStr;
     int             _errorLineNum;
     char*			_charBuffer;
+    bool			_charBufferOwned;	// false for ParseInSitu()
+    XMLArena*		_arena;
     int				_parseCurLineNum;
 	int				_parsingDepth;
 	// Memory tracking does add some overhead.
@@ -2194,6 +2344,306 @@ private:
 };
 
 
+/**
+	A pull parser. Where XMLDocument builds a tree of the whole document,
+	the XMLReader reports it as a sequence of events that the caller pulls
+	one at a time with Next(), and it accepts the input in chunks of any
+	size as they arrive, for example from a socket.
+
+	All the memory it uses is a single buffer given to the constructor,
+	which holds the names of the open elements, the unconsumed input and
+	the open element stack. The only limit this puts on the document is
+	that one tag, or one run of text, has to fit in what the names leave
+	of the buffer.
+
+	@verbatim
+	char mem[2048];
+	XMLReader reader( mem, sizeof( mem ) );
+	while ( ( n = ReadSome( chunk, sizeof( chunk ) ) ) > 0 ) {
+		for ( size_t used = 0; used < n; ) {
+			used += reader.Feed( chunk + used, n - used );
+			while ( ( event = reader.Next() ) != XMLReader::NEED_INPUT ) {
+				...
+			}
+		}
+	}
+	reader.Finish();
+	while ( ( event = reader.Next() ) != XMLReader::END_DOCUMENT ) {
+		...
+	}
+	@endverbatim
+
+	Events match the nodes XMLDocument would create with the default
+	PRESERVE_WHITESPACE: whitespace only text is dropped, entities and
+	newlines are normalized, and a self closing tag reports a
+	START_ELEMENT followed by an END_ELEMENT. As in XMLDocument, an end
+	tag has to match the open element, and an attribute may not appear
+	twice in a tag. Declarations, comments and
+	DTDs are skipped. The strings returned by Name(), Text() and the
+	attribute accessors point into the buffer, and are only valid until
+	the next call to Next().
+*/
+class TINYXML2_LIB XMLReader
+{
+public:
+    enum Event {
+        START_ELEMENT,
+        END_ELEMENT,
+        TEXT,
+        NEED_INPUT,		// Feed() more input, or Finish() at the end of it
+        END_DOCUMENT,
+        READ_ERROR		// see ErrorID(); Next() keeps returning READ_ERROR
+    };
+
+    /** Parse using 'size' bytes at 'mem', with room for 'maxDepth'
+    	nested elements.
+    */
+    XMLReader( char* mem, size_t size, int maxDepth = 32 );
+
+    /** Append input. Returns how much of it fit in the buffer, which is
+    	less than 'len' when the buffer is full; call Next() until it asks
+    	for input, then feed the rest.
+    */
+    size_t Feed( const char* data, size_t len );
+    /// There is no more input.
+    void Finish() {
+        _finished = true;
+    }
+    /// Read the next event.
+    Event Next();
+    /// Start over with a new document, in the same buffer.
+    void Reset();
+
+    /// The element name, for START_ELEMENT and END_ELEMENT.
+    const char* Name() const {
+        return _name;
+    }
+    /// The text, for TEXT.
+    const char* Text() const {
+        return _text;
+    }
+    /// True if the TEXT was a CDATA section.
+    bool CData() const {
+        return _cdata;
+    }
+    /// Number of enclosing elements, 0 for the root element.
+    int Depth() const {
+        return _event == START_ELEMENT ? _depth - 1 : _depth;
+    }
+    /// Line the current event starts on.
+    int LineNum() const {
+        return _eventLineNum;
+    }
+
+    /// Number of attributes of the START_ELEMENT.
+    int AttributeCount() const {
+        return _attributeCount;
+    }
+    /// Name of the attribute 'index', or null.
+    const char* AttributeName( int index ) const;
+    /// Value of the attribute 'index', or null.
+    const char* AttributeValue( int index ) const;
+    /** Value of the attribute 'name', or null. If 'value' is given,
+    	only returns a value if it matches, like XMLElement::Attribute().
+    */
+    const char* Attribute( const char* name, const char* value=0 ) const;
+
+    XMLError ErrorID() const {
+        return _errorID;
+    }
+    const char* ErrorName() const;
+    /// Line the error was found on.
+    int ErrorLineNum() const {
+        return _errorID != XML_SUCCESS ? _eventLineNum : 0;
+    }
+
+private:
+    Event SetError( XMLError error );
+    Event NeedInput( char* p );
+    void Consume( char* p );
+    Event ReadElement( char* p );
+    Event ReadEndElement( char* p );
+
+    char*		_mem;
+    size_t		_size;		// bytes of input the buffer can hold, plus the terminator
+    unsigned*	_stack;		// hash of each open element name
+    char*		_namesEnd;	// the open element names are packed from _mem up to here,
+							// the input follows them
+    int			_maxDepth;
+
+    size_t		_pos;		// start of the unconsumed input
+    size_t		_len;		// end of the input, always followed by a null
+    char*		_restore;	// character overwritten by the terminator of a TEXT
+    char		_restoreChar;
+    bool		_finished;
+    bool		_started;
+    bool		_sawElement;
+    bool		_pendingEnd;	// END_ELEMENT of a self closing tag still to report
+
+    Event		_event;
+    int			_depth;
+    int			_lineNum;
+    int			_eventLineNum;
+    const char*	_name;
+    const char*	_text;
+    bool		_cdata;
+    const char*	_attributes;	// packed name\0value\0 pairs
+    int			_attributeCount;
+    XMLError	_errorID;
+
+    XMLReader( const XMLReader& );	// not supported
+    void operator=( const XMLReader& );	// not supported
+};
+
+
+/**
+	A compact binary copy of a document, for keeping parsed documents
+	around without the cost of parsing them again.
+
+	Save() lays out the document as one block: a header, a record per
+	node and per attribute, and a table of the distinct strings, linked
+	by offsets. Load() turns the offsets of such a block into pointers
+	in place, after which it is read as a tree of XMLSnapshot::Node that
+	mirrors the XMLNode accessors. Loading allocates nothing and touches
+	every record once.
+
+	@verbatim
+	size_t size = XMLSnapshot::Save( doc, 0, 0 );
+	char* block = new char[size];
+	XMLSnapshot::Save( doc, block, size );
+	...
+	XMLSnapshot snapshot;
+	if ( snapshot.Load( block, size ) ) {
+		const char* muf = snapshot.RootElement()->FirstChildElement( "solardata" )
+		                          ->FirstChildElement( "muf" )->GetText();
+	}
+	@endverbatim
+
+	A block is tied to the pointer size of the machine that saved it,
+	and is changed by Load(): keep a copy to save it to storage.
+*/
+class TINYXML2_LIB XMLSnapshot
+{
+public:
+    struct Attribute {
+        const char* name;
+        const char* value;
+    };
+
+    /// A node of a loaded snapshot.
+    class TINYXML2_LIB Node
+    {
+        friend class XMLSnapshot;
+    public:
+        enum Type {
+            DOCUMENT,
+            ELEMENT,
+            TEXT,
+            COMMENT,
+            DECLARATION,
+            UNKNOWN
+        };
+
+        Type NodeType() const {
+            return static_cast<Type>( _type );
+        }
+        /// Element name, text, or the contents of other nodes.
+        const char* Value() const {
+            return _value;
+        }
+        const char* Name() const {
+            return _value;
+        }
+        bool CData() const {
+            return _cdata != 0;
+        }
+        int GetLineNum() const {
+            return _lineNum;
+        }
+
+        const Node* Parent() const {
+            return _parent;
+        }
+        const Node* FirstChild() const {
+            return _firstChild;
+        }
+        const Node* NextSibling() const {
+            return _next;
+        }
+        /// First child element, optionally with the given name.
+        const Node* FirstChildElement( const char* name = 0 ) const;
+        /// Next sibling element, optionally with the given name.
+        const Node* NextSiblingElement( const char* name = 0 ) const;
+        /// Text of the first child if it is text, like XMLElement::GetText().
+        const char* GetText() const;
+
+        int AttributeCount() const {
+            return _attributeCount;
+        }
+        const XMLSnapshot::Attribute* Attributes() const {
+            return _attributes;
+        }
+        /** Value of the attribute 'name', or null. If 'value' is given,
+        	only returns a value if it matches, like XMLElement::Attribute().
+        */
+        const char* Attribute( const char* name, const char* value=0 ) const;
+
+    private:
+        // Offsets from the start of the block until loaded
+        const char*						_value;
+        const Node*						_parent;
+        const Node*						_firstChild;
+        const Node*						_next;
+        const XMLSnapshot::Attribute*	_attributes;
+        int								_attributeCount;
+        int								_lineNum;
+        unsigned char					_type;
+        unsigned char					_cdata;
+    };
+
+    XMLSnapshot() : _root( 0 ), _size( 0 ), _hasBOM( false ) {}
+
+    /** Write 'doc' into 'buffer'. Returns the size of the snapshot, and
+    	writes nothing if that is more than 'size'; pass a null buffer to
+    	just measure.
+    */
+    static size_t Save( const XMLDocument& doc, char* buffer, size_t size );
+
+    /** Attach to a block written by Save(), converting it in place.
+    	Returns false, and leaves the block alone, if it is not a valid
+    	snapshot for this machine or was already loaded.
+    */
+    bool Load( char* block, size_t size );
+
+    /// The document node, or null if nothing is loaded.
+    const Node* Root() const {
+        return _root;
+    }
+    const Node* RootElement() const {
+        return _root ? _root->FirstChildElement() : 0;
+    }
+    bool HasBOM() const {
+        return _hasBOM;
+    }
+    size_t Size() const {
+        return _size;
+    }
+
+    /** Print the snapshot, with the same output as printing the
+    	document it was saved from to a printer in the same mode.
+    */
+    void Print( XMLPrinter* printer, bool compact = false ) const;
+
+private:
+    struct Header;
+    static const size_t NODES;	// offset of the node records
+
+    const Node*	_root;
+    size_t		_size;
+    bool		_hasBOM;
+};
+
+
 /**
 	Printing functionality. The XMLPrinter gives you more
 	options than the XMLDocument::Print() method.
@@ -9,6 +9,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <new>
 
 #if defined( _MSC_VER ) || defined (WIN32)
 	#include <crtdbg.h>
@@ -26,6 +27,29 @@ using namespace std;
 int gPass = 0;
 int gFail = 0;
 
+// Count heap allocations, so tests can check that a parse does not allocate.
+// The build passes -fno-builtin, or the compiler sees free() on memory from new.
+static size_t gAllocCount = 0;
+
+void* operator new( size_t size )
+{
+	++gAllocCount;
+	void* p = malloc( size ? size : 1 );
+	if ( !p )
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete( void* p ) noexcept
+{
+	free( p );
+}
+
+void operator delete( void* p, size_t ) noexcept
+{
+	free( p );
+}
+
 
 bool XMLTest (const char* testString, const char* expected, const char* found, bool echo=true, bool extraNL=false )
 {
@@ -112,6 +136,90 @@ void NullLineEndings( char* p )
 }
 
 
+// Prints only what an XMLReader reports: elements, attributes and text.
+class ReaderEventsPrinter : public XMLPrinter
+{
+public:
+	ReaderEventsPrinter() : XMLPrinter( 0, true ) {}
+	virtual bool VisitEnter( const XMLDocument& ) override		{ return true; }
+	virtual bool Visit( const XMLDeclaration& ) override		{ return true; }
+	virtual bool Visit( const XMLComment& ) override			{ return true; }
+	virtual bool Visit( const XMLUnknown& ) override			{ return true; }
+};
+
+
+// Reads every text and attribute value, which is when StrPair normalizes them.
+class ValueReader : public XMLVisitor
+{
+public:
+	ValueReader() : total( 0 ) {}
+	virtual bool VisitEnter( const XMLElement&, const XMLAttribute* attr ) override {
+		for( ; attr; attr = attr->Next() ) {
+			total += strlen( attr->Value() );
+		}
+		return true;
+	}
+	virtual bool Visit( const XMLText& text ) override {
+		total += strlen( text.Value() );
+		return true;
+	}
+	size_t total;
+};
+
+
+// Feeds 'xml' to an XMLReader 'chunk' bytes at a time, replaying the events
+// into 'printer' when given. Returns the reader's error.
+XMLError ReadInChunks( const char* xml, size_t len, size_t chunk, char* mem, size_t memSize, XMLPrinter* printer, int* events=0 )
+{
+	XMLReader reader( mem, memSize );
+	size_t fed = 0;
+	int count = 0;
+	// XMLPrinter keeps the element name pointers until CloseElement()
+	static char names[32][64];
+	for( ;; ) {
+		const XMLReader::Event event = reader.Next();
+		++count;
+		switch( event ) {
+		case XMLReader::NEED_INPUT:
+			if ( fed == len ) {
+				reader.Finish();
+			}
+			else {
+				fed += reader.Feed( xml + fed, len - fed < chunk ? len - fed : chunk );
+			}
+			break;
+		case XMLReader::START_ELEMENT:
+			if ( printer && reader.Depth() < 32 ) {
+				char* name = names[reader.Depth()];
+				strncpy( name, reader.Name(), sizeof( names[0] ) - 1 );
+				name[sizeof( names[0] ) - 1] = 0;
+				printer->OpenElement( name, true );
+				for( int i = 0; i < reader.AttributeCount(); ++i ) {
+					printer->PushAttribute( reader.AttributeName( i ), reader.AttributeValue( i ) );
+				}
+			}
+			break;
+		case XMLReader::END_ELEMENT:
+			if ( printer ) {
+				printer->CloseElement( true );
+			}
+			break;
+		case XMLReader::TEXT:
+			if ( printer ) {
+				printer->PushText( reader.Text(), reader.CData() );
+			}
+			break;
+		case XMLReader::END_DOCUMENT:
+		case XMLReader::READ_ERROR:
+			if ( events ) {
+				*events = count;
+			}
+			return reader.ErrorID();
+		}
+	}
+}
+
+
 int example_1()
 {
 	XMLDocument doc;
@@ -2730,6 +2838,593 @@ int main( int argc, const char ** argv )
 		}
 	}
 	
+	// ----------- In-situ parsing and node arena --------------
+	{
+		FILE* fp = fopen( "resources/solarxml.xml", "rb" );
+		XMLTest( "Open solarxml.xml", true, fp != 0 );
+		fseek( fp, 0, SEEK_END );
+		const size_t len = ftell( fp );
+		fseek( fp, 0, SEEK_SET );
+		char* xml = new char[len + 1];
+		XMLTest( "Read solarxml.xml", true, fread( xml, 1, len, fp ) == len );
+		fclose( fp );
+		xml[len] = 0;
+
+		XMLDocument refDoc;
+		refDoc.Parse( xml, len );
+		XMLPrinter refPrinter;
+		refDoc.Print( &refPrinter );
+
+		char* buffer = new char[len + 1];
+		memcpy( buffer, xml, len );
+		static char nodeMem[16 * 1024];
+		XMLArena arena( nodeMem, sizeof( nodeMem ) );
+		XMLDocument doc;
+		doc.SetArena( &arena );
+
+		const size_t allocsBefore = gAllocCount;
+		doc.ParseInSitu( buffer, len );
+		const size_t allocs = gAllocCount - allocsBefore;
+		XMLTest( "ParseInSitu solarxml.xml", false, doc.Error() );
+		XMLTest( "ParseInSitu with an arena does not allocate", 0, (int)allocs );
+		XMLTest( "Arena did not overflow", 0, (int)arena.Overflows() );
+
+		const XMLElement* muf = doc.RootElement()->FirstChildElement( "solardata" )->FirstChildElement( "muf" );
+		XMLTest( "ParseInSitu text", "22.48", muf->GetText() );
+		XMLTest( "ParseInSitu text lives in the caller's buffer", true, muf->GetText() >= buffer && muf->GetText() < buffer + len );
+
+		XMLPrinter printer;
+		doc.Print( &printer );
+		XMLTest( "ParseInSitu matches Parse", refPrinter.CStr(), printer.CStr(), false );
+
+		// Parsing again rewinds the arena instead of growing it.
+		const size_t used = arena.Used();
+		memcpy( buffer, xml, len );
+		doc.ParseInSitu( buffer, len );
+		XMLTest( "Re-parse reuses the arena", (int)used, (int)arena.Used() );
+		XMLTest( "Arena high water", (int)used, (int)arena.HighWater() );
+
+		// A too small arena falls back to heap blocks.
+		char tinyMem[256];
+		XMLArena tinyArena( tinyMem, sizeof( tinyMem ) );
+		XMLDocument tinyDoc;
+		tinyDoc.SetArena( &tinyArena );
+		memcpy( buffer, xml, len );
+		tinyDoc.ParseInSitu( buffer, len );
+		XMLTest( "ParseInSitu with an exhausted arena", false, tinyDoc.Error() );
+		XMLTest( "Exhausted arena overflows", true, tinyArena.Overflows() > 0 );
+		XMLPrinter tinyPrinter;
+		tinyDoc.Print( &tinyPrinter );
+		XMLTest( "Exhausted arena matches Parse", refPrinter.CStr(), tinyPrinter.CStr(), false );
+
+		// nBytes: the byte after the document is overwritten with the terminator,
+		// and entities are translated in place.
+		char partial[] = "<a>x &amp; y</a>JUNK";
+		XMLDocument partialDoc;
+		partialDoc.ParseInSitu( partial, 16 );
+		XMLTest( "ParseInSitu with nBytes", false, partialDoc.Error() );
+		XMLTest( "ParseInSitu entities", "x & y", partialDoc.FirstChildElement( "a" )->GetText() );
+		XMLTest( "ParseInSitu terminates at nBytes", 0, (int)partial[16] );
+
+		char empty[] = "";
+		XMLTest( "ParseInSitu empty document", XML_ERROR_EMPTY_DOCUMENT, partialDoc.ParseInSitu( empty ) );
+
+		delete[] buffer;
+		delete[] xml;
+	}
+
+	// ----------- Child element index --------------
+	{
+		XMLDocument doc;
+		doc.Parse( "<r><a>1</a><!--c--><b>2</b><a>3</a>text<c>4</c></r>" );
+		XMLElement* r = doc.RootElement();
+		r->SetChildIndex( true );
+		XMLTest( "Child index enabled", true, r->HasChildIndex() );
+		XMLTest( "Indexed lookup", "1", r->FirstChildElement( "a" )->GetText() );
+		XMLTest( "Indexed lookup c", "4", r->FirstChildElement( "c" )->GetText() );
+		XMLTest( "Indexed lookup miss", true, r->FirstChildElement( "d" ) == 0 );
+		XMLTest( "Unnamed lookup ignores the index", "a", r->FirstChildElement()->Name() );
+
+		// Every change to the children invalidates the index.
+		r->InsertFirstChild( doc.NewElement( "c" ) );
+		XMLTest( "Index after InsertFirstChild", true, r->FirstChildElement( "c" ) == r->FirstChild() );
+		XMLTest( "Index after InsertFirstChild, new name", true, r->FirstChildElement( "d" ) == 0 );
+		r->InsertEndChild( doc.NewElement( "d" ) );
+		XMLTest( "Index after InsertEndChild", true, r->FirstChildElement( "d" ) == r->LastChild() );
+		r->DeleteChild( r->FirstChildElement( "a" ) );
+		XMLTest( "Index after DeleteChild", "3", r->FirstChildElement( "a" )->GetText() );
+		r->FirstChildElement( "b" )->SetName( "e" );
+		XMLTest( "Index after rename, old name", true, r->FirstChildElement( "b" ) == 0 );
+		XMLTest( "Index after rename, new name", "2", r->FirstChildElement( "e" )->GetText() );
+		XMLElement* moved = r->FirstChildElement( "e" );
+		doc.InsertEndChild( moved );
+		XMLTest( "Index after moving a child away", true, r->FirstChildElement( "e" ) == 0 );
+		r->DeleteChildren();
+		XMLTest( "Index after DeleteChildren", true, r->FirstChildElement( "a" ) == 0 );
+		r->SetChildIndex( false );
+		XMLTest( "Child index disabled", false, r->HasChildIndex() );
+
+		XMLDocument extractDoc;
+		extractDoc.Parse( "<r><x>1</x><y>2</y><x>3</x><z/></r>" );
+		XMLChildBinding bindings[] = { { "x", 0, 0 }, { "q", 0, 0 }, { "z", 0, 0 }, { "x", 0, 0 } };
+		const int found = extractDoc.RootElement()->ExtractChildElements( bindings, 4 );
+		XMLTest( "ExtractChildElements count", 3, found );
+		XMLTest( "ExtractChildElements first of name", "1", bindings[0].element->GetText() );
+		XMLTest( "ExtractChildElements miss", true, bindings[1].element == 0 );
+		XMLTest( "ExtractChildElements empty element", "z", bindings[2].element->Name() );
+		XMLTest( "ExtractChildElements repeated name", true, bindings[3].element == bindings[0].element );
+
+		// With an arena the index comes from it, not the heap.
+		static char nodeMem[4 * 1024];
+		XMLArena arena( nodeMem, sizeof( nodeMem ) );
+		XMLDocument arenaDoc;
+		arenaDoc.SetArena( &arena );
+		arenaDoc.Parse( "<r><a>1</a><b>2</b><c>3</c></r>" );
+		XMLElement* ar = arenaDoc.RootElement();
+		ar->SetChildIndex( true );
+		const size_t arenaUsed = arena.Used();
+		const size_t indexAllocs = gAllocCount;
+		XMLTest( "Indexed lookup with an arena", "2", ar->FirstChildElement( "b" )->GetText() );
+		XMLTest( "Child index with an arena does not allocate", 0, (int)( gAllocCount - indexAllocs ) );
+		XMLTest( "Child index is taken from the arena", true, arena.Used() > arenaUsed );
+		ar->InsertEndChild( arenaDoc.NewElement( "d" ) );
+		XMLTest( "Arena index rebuilt after a change", true, ar->FirstChildElement( "d" ) == ar->LastChild() );
+		arenaDoc.Clear();
+		XMLTest( "Arena rewound with the index", 0, (int)arena.Used() );
+	}
+	{
+		// Benchmark: a synthetic wide element, and the hamqsl solardata layout.
+		static const int WIDE = 500;
+		static const int ROUNDS = 50;
+		XMLDocument doc;
+		XMLElement* wide = doc.NewElement( "wide" );
+		doc.InsertEndChild( wide );
+		char names[WIDE][8];
+		XMLChildBinding wideBindings[WIDE];
+		for ( int i = 0; i < WIDE; ++i ) {
+			names[i][0] = 'f';
+			XMLUtil::ToStr( i, names[i] + 1, sizeof( names[i] ) - 1 );
+			wide->InsertNewChildElement( names[i] )->SetText( i );
+			wideBindings[i].name = names[i];
+		}
+
+		int checksum[3] = { 0, 0, 0 };
+		clock_t ticks[3] = { 0, 0, 0 };
+		clock_t t = clock();
+		for ( int n = 0; n < ROUNDS; ++n ) {
+			for ( int i = 0; i < WIDE; ++i ) {
+				checksum[0] += wide->FirstChildElement( names[i] )->IntText();
+			}
+		}
+		ticks[0] = clock() - t;
+		wide->SetChildIndex( true );
+		t = clock();
+		for ( int n = 0; n < ROUNDS; ++n ) {
+			for ( int i = 0; i < WIDE; ++i ) {
+				checksum[1] += wide->FirstChildElement( names[i] )->IntText();
+			}
+		}
+		ticks[1] = clock() - t;
+		t = clock();
+		for ( int n = 0; n < ROUNDS; ++n ) {
+			wide->ExtractChildElements( wideBindings, WIDE );
+			for ( int i = 0; i < WIDE; ++i ) {
+				checksum[2] += wideBindings[i].element->IntText();
+			}
+		}
+		ticks[2] = clock() - t;
+		XMLTest( "Indexed lookups on a wide element", checksum[0], checksum[1] );
+		XMLTest( "ExtractChildElements on a wide element", checksum[0], checksum[2] );
+		printf( "%d children, %d lookups: linear %.3f, indexed %.3f, extract %.3f milli-seconds\n",
+			WIDE, WIDE, 1000.0 * (double)ticks[0] / CLOCKS_PER_SEC / ROUNDS,
+			1000.0 * (double)ticks[1] / CLOCKS_PER_SEC / ROUNDS, 1000.0 * (double)ticks[2] / CLOCKS_PER_SEC / ROUNDS );
+
+		static const char* solarFields[] = {
+			"source", "updated", "solarflux", "aindex", "kindex", "kindexnt", "xray", "sunspots",
+			"heliumline", "protonflux", "electonflux", "aurora", "normalization", "latdegree",
+			"solarwind", "magneticfield", "geomagfield", "signalnoise", "fof2", "muffactor", "muf",
+			"calculatedconditions", "calculatedvhfconditions"
+		};
+		static const int FIELDS = sizeof( solarFields ) / sizeof( solarFields[0] );
+		static const int SOLAR_ROUNDS = 20000;
+		XMLDocument solarDoc;
+		solarDoc.LoadFile( "resources/solarxml.xml" );
+		XMLElement* solardata = solarDoc.RootElement()->FirstChildElement( "solardata" );
+		XMLChildBinding solarBindings[FIELDS];
+		for ( int i = 0; i < FIELDS; ++i ) {
+			solarBindings[i].name = solarFields[i];
+		}
+		const XMLElement* sink[3] = { 0, 0, 0 };
+		t = clock();
+		for ( int n = 0; n < SOLAR_ROUNDS; ++n ) {
+			for ( int i = 0; i < FIELDS; ++i ) {
+				sink[0] = solardata->FirstChildElement( solarFields[i] );
+			}
+		}
+		ticks[0] = clock() - t;
+		solardata->SetChildIndex( true );
+		t = clock();
+		for ( int n = 0; n < SOLAR_ROUNDS; ++n ) {
+			for ( int i = 0; i < FIELDS; ++i ) {
+				sink[1] = solardata->FirstChildElement( solarFields[i] );
+			}
+		}
+		ticks[1] = clock() - t;
+		int solarFound = 0;
+		t = clock();
+		for ( int n = 0; n < SOLAR_ROUNDS; ++n ) {
+			solarFound = solardata->ExtractChildElements( solarBindings, FIELDS );
+		}
+		ticks[2] = clock() - t;
+		sink[2] = solarBindings[FIELDS - 1].element;
+		XMLTest( "ExtractChildElements solardata", FIELDS, solarFound );
+		XMLTest( "Indexed lookups solardata", true, sink[0] == sink[1] && sink[1] == sink[2] );
+		printf( "solardata, %d lookups: linear %.2f, indexed %.2f, extract %.2f micro-seconds\n",
+			FIELDS, 1e6 * (double)ticks[0] / CLOCKS_PER_SEC / SOLAR_ROUNDS,
+			1e6 * (double)ticks[1] / CLOCKS_PER_SEC / SOLAR_ROUNDS, 1e6 * (double)ticks[2] / CLOCKS_PER_SEC / SOLAR_ROUNDS );
+	}
+
+	// ----------- Pull parser --------------
+	{
+		static const char* inputs[] = {
+			"<a x='1' y=\"&lt;&gt;\">t&amp;u<b/>\r\nline2\rline3<![CDATA[<raw>&amp;\r\n]]></a>",
+			"<?xml version='1.0'?><!DOCTYPE x><!-- <c> --><r a = '>' b=\"'\"><e/>  <e2 />x &#x41;&#66;</r>",
+			"\xef\xbb\xbf<doc>\n  <p>  lead and trail  </p>\n  <q></q>\n</doc>\n",
+			"<a>&unknown; &amp</a><!-- trailing -->",
+			"<x:y z:w='&quot;'><![CDATA[]]></x:y>",
+		};
+		static const char* files[] = {
+			"resources/dream.xml", "resources/utf8test.xml", "resources/solarxml.xml"
+		};
+		static const size_t chunks[] = { 1, 2, 3, 7, 64, 1460, 1 << 20 };
+		static const int NUM_INPUTS = sizeof( inputs ) / sizeof( inputs[0] );
+		static const int NUM_FILES = sizeof( files ) / sizeof( files[0] );
+		static const size_t MEM = 4096;
+		char* mem = new char[MEM];
+
+		for( int i = 0; i < NUM_INPUTS + NUM_FILES; ++i ) {
+			XMLDocument doc;
+			const char* name = i < NUM_INPUTS ? inputs[i] : files[i - NUM_INPUTS];
+			if ( i < NUM_INPUTS ) {
+				doc.Parse( inputs[i] );
+			}
+			else {
+				doc.LoadFile( files[i - NUM_INPUTS] );
+			}
+			XMLTest( "Pull parser input parses", false, doc.Error() );
+			ReaderEventsPrinter expected;
+			doc.Print( &expected );
+
+			const char* xml = inputs[i < NUM_INPUTS ? i : 0];
+			size_t len = strlen( xml );
+			char* fileData = 0;
+			if ( i >= NUM_INPUTS ) {
+				FILE* fp = fopen( name, "rb" );
+				fseek( fp, 0, SEEK_END );
+				len = ftell( fp );
+				fseek( fp, 0, SEEK_SET );
+				fileData = new char[len];
+				XMLTest( "Pull parser reads file", true, fread( fileData, 1, len, fp ) == len, false );
+				fclose( fp );
+				xml = fileData;
+			}
+			for( size_t c = 0; c < sizeof( chunks ) / sizeof( chunks[0] ); ++c ) {
+				XMLPrinter found( 0, true );
+				const XMLError error = ReadInChunks( xml, len, chunks[c], mem, MEM, &found );
+				bool pass = error == XML_SUCCESS && strcmp( expected.CStr(), found.CStr() ) == 0;
+				if ( !pass ) {
+					printf( "Pull parser: '%s' in chunks of %d (%s)\n", name, (int)chunks[c], XMLDocument::ErrorIDToName( error ) );
+				}
+				XMLTest( "Pull parser events match the DOM", true, pass, false );
+			}
+			delete[] fileData;
+		}
+
+		// Errors agree with XMLDocument
+		// gckxr and ydtrd share a name hash; only the names tell them apart
+		static const char* bad[] = { "", "   ", "<a>", "<a></b>", "<a><b></a>", "<a/>x", "<a x=1/>", "<1/>", "<a><!-- x</a>", "<a><![CDATA[x</a>",
+			"<gckxr></ydtrd>", "<r><gckxr><ydtrd/></ydtrd></r>", "<a x='1' x='2'/>", "<a x='1' y='2' x='1'></a>" };
+		for( size_t i = 0; i < sizeof( bad ) / sizeof( bad[0] ); ++i ) {
+			XMLDocument doc;
+			doc.Parse( bad[i] );
+			for( size_t c = 0; c < 2; ++c ) {
+				const XMLError error = ReadInChunks( bad[i], strlen( bad[i] ), c ? 1 : 1 << 20, mem, MEM, 0 );
+				XMLTest( bad[i], doc.ErrorID(), error, false );
+			}
+		}
+
+		// Bounded memory: a tag or a text larger than the buffer is an error,
+		// and so is nesting deeper than the element stack.
+		char small[192];
+		const char* longText = "<a>The quick brown fox jumps over the lazy dog, twice: the quick brown fox jumps over the lazy dog</a>";
+		XMLTest( "Pull parser text larger than the buffer", XML_ERROR_PARSING, ReadInChunks( longText, strlen( longText ), 16, small, sizeof( small ), 0 ) );
+		const char* longAttr = "<a b='The quick brown fox jumps over the lazy dog' c='the quick brown fox jumps over the lazy dog'/>";
+		XMLTest( "Pull parser tag larger than the buffer", XML_ERROR_PARSING, ReadInChunks( longAttr, strlen( longAttr ), 16, small, sizeof( small ), 0 ) );
+		const char* nested = "<a><a><a><a></a></a></a></a>";
+		{
+			XMLReader reader( small, sizeof( small ), 3 );
+			reader.Feed( nested, strlen( nested ) );
+			reader.Finish();
+			XMLReader::Event event;
+			int depth = 0;
+			while ( ( event = reader.Next() ) == XMLReader::START_ELEMENT ) {
+				XMLTest( "Pull parser depth", depth++, reader.Depth(), false );
+			}
+			XMLTest( "Pull parser element stack", (int)XMLReader::READ_ERROR, (int)event );
+			XMLTest( "Pull parser element stack error", XML_ELEMENT_DEPTH_EXCEEDED, reader.ErrorID() );
+			XMLTest( "Pull parser stays in error", (int)XMLReader::READ_ERROR, (int)reader.Next() );
+		}
+		{
+			// The open element names share the buffer with the input: with
+			// the input filling it, each start tag moves what is left down
+			// to make room for its name.
+			const char* deep = "<element_number_one><element_number_two><element_number_three>"
+				"<element_number_four>x</element_number_four></element_number_three></element_number_two></element_number_one>";
+			char mem[384];
+			XMLPrinter found( 0, true );
+			const XMLError error = ReadInChunks( deep, strlen( deep ), 1 << 20, mem, sizeof( mem ), &found );
+			XMLTest( "Pull parser names in a full buffer", XML_SUCCESS, error );
+			XMLDocument doc;
+			doc.Parse( deep );
+			ReaderEventsPrinter expected;
+			doc.Print( &expected );
+			XMLTest( "Pull parser names in a full buffer", expected.CStr(), found.CStr() );
+			XMLTest( "Pull parser names and a tag larger than the buffer", XML_ERROR_PARSING,
+				ReadInChunks( deep, strlen( deep ), 1 << 20, mem, 200, 0 ) );
+		}
+		{
+			// Accessors, line numbers, and Reset() reusing the buffer
+			const char* xml = "<root>\n<item id='7' kind=\"a&amp;b\"/>\n<item id='8'>text</item>\n</root>";
+			XMLReader reader( small, sizeof( small ) );
+			for( int pass = 0; pass < 2; ++pass ) {
+				reader.Reset();
+				const size_t len = strlen( xml );
+				XMLReader::Event event = XMLReader::NEED_INPUT;
+				for( size_t fed = 0; fed < len && event != XMLReader::READ_ERROR; ) {
+					fed += reader.Feed( xml + fed, len - fed < 5 ? len - fed : 5 );
+					while ( ( event = reader.Next() ) != XMLReader::NEED_INPUT && event != XMLReader::READ_ERROR ) {
+						if ( reader.Name() && XMLUtil::StringEqual( reader.Name(), "item" ) && reader.AttributeCount() == 2 ) {
+							XMLTest( "Pull parser attribute count", 2, reader.AttributeCount() );
+							XMLTest( "Pull parser attribute", "a&b", reader.Attribute( "kind" ) );
+							XMLTest( "Pull parser attribute value match", "7", reader.Attribute( "id", "7" ) );
+							XMLTest( "Pull parser attribute value mismatch", true, reader.Attribute( "id", "8" ) == 0 );
+							XMLTest( "Pull parser attribute by index", "kind", reader.AttributeName( 1 ) );
+							XMLTest( "Pull parser attribute out of range", true, reader.AttributeName( 2 ) == 0 );
+							XMLTest( "Pull parser line", 2, reader.LineNum() );
+							XMLTest( "Pull parser element depth", 1, reader.Depth() );
+						}
+						else if ( reader.Text() ) {
+							XMLTest( "Pull parser text", "text", reader.Text() );
+							XMLTest( "Pull parser text line", 3, reader.LineNum() );
+							XMLTest( "Pull parser text depth", 2, reader.Depth() );
+						}
+					}
+				}
+				reader.Finish();
+				while ( ( event = reader.Next() ) == XMLReader::END_ELEMENT ) {
+				}
+				XMLTest( "Pull parser end of document", (int)XMLReader::END_DOCUMENT, (int)event );
+			}
+		}
+		delete[] mem;
+	}
+
+	// ----------- Binary snapshots --------------
+	{
+		static const char* inputs[] = {
+			"<a x='1' y=\"&lt;&gt;\">t&amp;u<b/>\r\nline2\rline3<![CDATA[<raw>&amp;\r\n]]></a>",
+			"<?xml version='1.0'?><!DOCTYPE x><!-- <c> --><r a = '>' b=\"'\"><e/>  <e2 />x &#x41;&#66;</r>",
+			"\xef\xbb\xbf<doc>\n  <p>  lead and trail  </p>\n  <q></q>\n</doc>\n",
+			"<a><b><c><d/></c></b><e/></a><!-- trailing -->",
+		};
+		static const char* files[] = {
+			"resources/dream.xml", "resources/utf8test.xml", "resources/solarxml.xml"
+		};
+		static const int NUM_INPUTS = sizeof( inputs ) / sizeof( inputs[0] );
+		static const int NUM_FILES = sizeof( files ) / sizeof( files[0] );
+
+		for( int i = 0; i < NUM_INPUTS + NUM_FILES; ++i ) {
+			XMLDocument doc;
+			if ( i < NUM_INPUTS ) {
+				doc.Parse( inputs[i] );
+			}
+			else {
+				doc.LoadFile( files[i - NUM_INPUTS] );
+			}
+			XMLTest( "Snapshot input parses", false, doc.Error() );
+			const size_t size = XMLSnapshot::Save( doc, 0, 0 );
+			// void* keeps the block aligned for the node records
+			void* block = new void*[size / sizeof( void* ) + 1];
+			XMLTest( "Snapshot saves", (int)size, (int)XMLSnapshot::Save( doc, (char*)block, size ) );
+			XMLSnapshot snapshot;
+			XMLTest( "Snapshot loads", true, snapshot.Load( (char*)block, size ) );
+			XMLTest( "Snapshot size", (int)size, (int)snapshot.Size() );
+			XMLTest( "Snapshot BOM", doc.HasBOM(), snapshot.HasBOM() );
+
+			for( int compact = 0; compact < 2; ++compact ) {
+				XMLPrinter expected( 0, compact != 0 );
+				doc.Print( &expected );
+				XMLPrinter found( 0, compact != 0 );
+				snapshot.Print( &found, compact != 0 );
+				const bool pass = strcmp( expected.CStr(), found.CStr() ) == 0;
+				if ( !pass ) {
+					printf( "Snapshot: '%s'\n%s\n", i < NUM_INPUTS ? inputs[i] : files[i - NUM_INPUTS], found.CStr() );
+				}
+				XMLTest( "Snapshot prints like the document", true, pass, false );
+			}
+			delete[] (void**)block;
+		}
+
+		XMLDocument doc;
+		doc.LoadFile( "resources/solarxml.xml" );
+		const size_t size = XMLSnapshot::Save( doc, 0, 0 );
+		const size_t words = size / sizeof( void* ) + 1;
+		void** saved = new void*[words];
+		void** block = new void*[words];
+		XMLSnapshot::Save( doc, (char*)saved, size );
+
+		// Too small a buffer is left alone
+		memset( block, 0x5a, words * sizeof( void* ) );
+		XMLTest( "Snapshot buffer too small", (int)size, (int)XMLSnapshot::Save( doc, (char*)block, size - 1 ) );
+		XMLTest( "Snapshot buffer untouched", true, ((unsigned char*)block)[0] == 0x5a && ((unsigned char*)block)[size - 2] == 0x5a );
+
+		// Loading allocates nothing and the view reads like the document
+		memcpy( block, saved, size );
+		XMLSnapshot snapshot;
+		const size_t allocs = gAllocCount;
+		XMLTest( "Snapshot load", true, snapshot.Load( (char*)block, size ) );
+		XMLTest( "Snapshot load does not allocate", 0, (int)( gAllocCount - allocs ) );
+		const XMLSnapshot::Node* solardata = snapshot.RootElement()->FirstChildElement( "solardata" );
+		XMLTest( "Snapshot root element", "solar", snapshot.RootElement()->Name() );
+		XMLTest( "Snapshot declaration", (int)XMLSnapshot::Node::DECLARATION, (int)snapshot.Root()->FirstChild()->NodeType() );
+		XMLTest( "Snapshot element text", "22.48", solardata->FirstChildElement( "muf" )->GetText() );
+		XMLTest( "Snapshot line number", 41, solardata->FirstChildElement( "muf" )->GetLineNum() );
+		XMLTest( "Snapshot parent", true, solardata->FirstChildElement( "muf" )->Parent() == solardata );
+		XMLTest( "Snapshot missing element", true, solardata->FirstChildElement( "nothing" ) == 0 );
+		const XMLSnapshot::Node* band = solardata->FirstChildElement( "calculatedconditions" )->FirstChildElement( "band" );
+		XMLTest( "Snapshot attribute count", 2, band->AttributeCount() );
+		XMLTest( "Snapshot attribute", "80m-40m", band->Attribute( "name" ) );
+		XMLTest( "Snapshot attribute value match", "day", band->Attribute( "time", "day" ) );
+		XMLTest( "Snapshot attribute value mismatch", true, band->Attribute( "time", "night" ) == 0 );
+		XMLTest( "Snapshot attribute by index", "time", band->Attributes()[1].name );
+		XMLTest( "Snapshot sibling element", "30m-20m", band->NextSiblingElement( "band" )->Attribute( "name" ) );
+		int bands = 0;
+		for( const XMLSnapshot::Node* b = band; b; b = b->NextSiblingElement( "band" ) ) {
+			++bands;
+		}
+		XMLTest( "Snapshot sibling count", 8, bands );
+
+		// A block is only loaded once, and damaged blocks are rejected
+		XMLSnapshot other;
+		XMLTest( "Snapshot loads once", false, other.Load( (char*)block, size ) );
+		memcpy( block, saved, size );
+		XMLTest( "Snapshot truncated", false, other.Load( (char*)block, size - 1 ) );
+		((char*)block)[0] = 'X';
+		XMLTest( "Snapshot bad magic", false, other.Load( (char*)block, size ) );
+		memcpy( block, saved, size );
+		// The node records follow the header, and make up most of the block
+		for( size_t w = 3; w < words / 4; ++w ) {
+			block[w] = (void*)~(uintptr_t)0;
+		}
+		XMLTest( "Snapshot bad offset", false, other.Load( (char*)block, size ) );
+		XMLTest( "Snapshot rejected block is empty", true, other.Root() == 0 && other.RootElement() == 0 );
+		memcpy( block, saved, size );
+		XMLTest( "Snapshot reloads from a copy", true, other.Load( (char*)block, size ) );
+		delete[] block;
+		delete[] saved;
+
+		// Damaged links and counts that would loop or read past the block.
+		// Before Load() the links are offsets, the node records start past
+		// the header at NODES, in document order: r, a, b, c, d.
+		{
+			XMLDocument small;
+			small.Parse( "<r><a><b/><c/></a><d/></r>" );
+			const size_t smallSize = XMLSnapshot::Save( small, 0, 0 );
+			void** original = new void*[smallSize / sizeof( void* ) + 1];
+			void** damaged = new void*[smallSize / sizeof( void* ) + 1];
+			XMLSnapshot::Save( small, (char*)original, smallSize );
+			const size_t nodes = ( 24 + sizeof( void* ) - 1 ) & ~( sizeof( void* ) - 1 );
+			struct Damage {
+				const char* what;
+				int node;		// record to change
+				int from;		// the link to this node
+				int to;			// points to this one instead, -1 for none
+			} damages[] = {
+				{ "Snapshot sibling linked to itself", 3, 4, 3 },
+				{ "Snapshot child linked to itself", 2, 3, 2 },
+				{ "Snapshot child linked back", 2, 3, 1 },
+				{ "Snapshot parent linked forward", 3, 2, 4 },
+				{ "Snapshot non-root without a parent", 3, 2, -1 },
+				{ "Snapshot child of another parent", 2, 3, 5 },
+				{ "Snapshot sibling that is a child", 2, 5, 4 },
+			};
+			for( size_t i = 0; i < sizeof( damages ) / sizeof( damages[0] ); ++i ) {
+				memcpy( damaged, original, smallSize );
+				const Damage& d = damages[i];
+				void** record = (void**)( (char*)damaged + nodes + d.node * sizeof( XMLSnapshot::Node ) );
+				const uintptr_t from = nodes + d.from * sizeof( XMLSnapshot::Node );
+				const uintptr_t to = d.to < 0 ? 0 : nodes + d.to * sizeof( XMLSnapshot::Node );
+				int changed = 0;
+				for( size_t w = 0; w < sizeof( XMLSnapshot::Node ) / sizeof( void* ); ++w ) {
+					if ( (uintptr_t)record[w] == from ) {
+						record[w] = (void*)to;
+						++changed;
+					}
+				}
+				XMLSnapshot damagedSnapshot;
+				XMLTest( d.what, true, changed == 1 && !damagedSnapshot.Load( (char*)damaged, smallSize ) );
+			}
+			memcpy( damaged, original, smallSize );
+			XMLSnapshot undamaged;
+			XMLTest( "Snapshot undamaged", true, undamaged.Load( (char*)damaged, smallSize ) );
+
+			// A node count whose record size wraps around a 32 bit size_t
+			memcpy( damaged, original, smallSize );
+			uint32_t count = (uint32_t)( ( (uint64_t)1 << 32 ) / sizeof( XMLSnapshot::Node ) + 1 );
+			memcpy( (char*)damaged + 12, &count, sizeof( count ) );
+			XMLSnapshot wrapped;
+			XMLTest( "Snapshot wrapped node count", false, wrapped.Load( (char*)damaged, smallSize ) );
+			count = 0xffffffff;
+			memcpy( damaged, original, smallSize );
+			memcpy( (char*)damaged + 16, &count, sizeof( count ) );
+			XMLTest( "Snapshot wrapped attribute count", false, wrapped.Load( (char*)damaged, smallSize ) );
+			delete[] original;
+			delete[] damaged;
+		}
+
+		// Load time of a saved copy against parsing the text
+		{
+			FILE* fp = fopen( "resources/dream.xml", "rb" );
+			fseek( fp, 0, SEEK_END );
+			const size_t len = ftell( fp );
+			fseek( fp, 0, SEEK_SET );
+			char* xml = new char[len + 1];
+			XMLTest( "Read snapshot benchmark file", true, fread( xml, 1, len, fp ) == len, false );
+			fclose( fp );
+			xml[len] = 0;
+
+			XMLDocument dream;
+			dream.Parse( xml, len );
+			const size_t dreamSize = XMLSnapshot::Save( dream, 0, 0 );
+			const size_t dreamWords = dreamSize / sizeof( void* ) + 1;
+			void** dreamSaved = new void*[dreamWords];
+			void** dreamBlock = new void*[dreamWords];
+			XMLSnapshot::Save( dream, (char*)dreamSaved, dreamSize );
+
+			static const int PASSES = 20;
+			double best[2] = { 1e9, 1e9 };
+			bool failed = false;
+			for( int pass = 0; pass < PASSES; ++pass ) {
+				clock_t t = clock();
+				for( int r = 0; r < 10; ++r ) {
+					XMLDocument parsed;
+					parsed.Parse( xml, len );
+					failed = failed || parsed.Error();
+				}
+				const double parseSeconds = (double)( clock() - t ) / CLOCKS_PER_SEC / 10;
+				if ( parseSeconds < best[0] ) {
+					best[0] = parseSeconds;
+				}
+				t = clock();
+				for( int r = 0; r < 10; ++r ) {
+					memcpy( dreamBlock, dreamSaved, dreamSize );
+					XMLSnapshot loaded;
+					failed = failed || !loaded.Load( (char*)dreamBlock, dreamSize );
+				}
+				const double loadSeconds = (double)( clock() - t ) / CLOCKS_PER_SEC / 10;
+				if ( loadSeconds < best[1] ) {
+					best[1] = loadSeconds;
+				}
+			}
+			XMLTest( "Snapshot benchmark", false, failed );
+			printf( "\nSnapshot of dream.xml: %d bytes (XML %d bytes), parse %.3f ms, copy and load %.3f ms\n",
+					(int)dreamSize, (int)len, best[0] * 1000.0, best[1] * 1000.0 );
+			delete[] dreamBlock;
+			delete[] dreamSaved;
+			delete[] xml;
+		}
+	}
+
     // ----------- Performance tracking --------------
 	{
 #if defined( _MSC_VER )
@@ -2769,6 +3464,62 @@ int main( int argc, const char ** argv )
 #endif
 		XMLTest( "Parse dream.xml", false, parseDreamXmlFailed );
 
+		// In-situ parse into a node arena, compared with Parse().
+		const size_t arenaSize = 8 * size;
+		char* arenaMem = new char[arenaSize];
+		char* insitu = new char[size + 1];
+		XMLArena arena( arenaMem, arenaSize );
+		size_t parseAllocs = 0;
+		size_t insituAllocs = 0;
+		clock_t parseTicks = 0;
+		clock_t insituTicks = 0;
+		bool parseInSituFailed = false;
+		for (int i = 0; i < COUNT; ++i) {
+			{
+				const size_t allocs = gAllocCount;
+				const clock_t t = clock();
+				XMLDocument doc;
+				doc.Parse(mem);
+				parseTicks += clock() - t;
+				parseAllocs = gAllocCount - allocs;
+			}
+			memcpy(insitu, mem, size + 1);
+			{
+				XMLDocument doc;
+				doc.SetArena(&arena);
+				const size_t allocs = gAllocCount;
+				const clock_t t = clock();
+				doc.ParseInSitu(insitu, size);
+				insituTicks += clock() - t;
+				insituAllocs = gAllocCount - allocs;
+				parseInSituFailed = parseInSituFailed || doc.Error();
+			}
+		}
+		XMLTest( "ParseInSitu dream.xml", false, parseInSituFailed );
+		XMLTest( "ParseInSitu dream.xml does not allocate", 0, (int)insituAllocs );
+		printf("Parse:       %.3f milli-seconds, %d allocations\n",
+			1000.0 * (double)parseTicks / CLOCKS_PER_SEC / COUNT, (int)parseAllocs);
+		printf("ParseInSitu: %.3f milli-seconds, %d allocations, arena %dk of %dk\n",
+			1000.0 * (double)insituTicks / CLOCKS_PER_SEC / COUNT, (int)insituAllocs,
+			(int)(arena.HighWater() / 1024), (int)(arenaSize / 1024));
+		delete[] insitu;
+		delete[] arenaMem;
+
+		// Pull parser over the same text in network sized chunks, with a
+		// 4k buffer.
+		char readerMem[4096];
+		clock_t readerTicks = 0;
+		int readerEvents = 0;
+		bool readDreamXmlFailed = false;
+		for (int i = 0; i < COUNT; ++i) {
+			const clock_t t = clock();
+			readDreamXmlFailed = readDreamXmlFailed || ReadInChunks(mem, size, 1460, readerMem, sizeof(readerMem), 0, &readerEvents) != XML_SUCCESS;
+			readerTicks += clock() - t;
+		}
+		XMLTest( "XMLReader dream.xml", false, readDreamXmlFailed );
+		printf("XMLReader:   %.3f milli-seconds, %d events, %d byte buffer\n",
+			1000.0 * (double)readerTicks / CLOCKS_PER_SEC / COUNT, readerEvents, (int)sizeof(readerMem));
+
 		delete[] mem;
 
 		static const char* note =
@@ -2786,6 +3537,159 @@ int main( int argc, const char ** argv )
 		printf("\nParsing dream.xml (%s): %.3f milli-seconds\n", note, duration);
 	}
 
+	// ----------- Block scanners --------------
+	{
+		// Entities, line ends and whitespace runs at every offset from a
+		// block boundary, in heap buffers of every alignment.
+		static const char* body = "&lt;\r\nq&amp;\rr";
+		const int bodyLen = (int)strlen( body );
+		char expected[160];
+		bool textPass = true;
+		bool linePass = true;
+		for( int pad = 0; pad < 40; ++pad ) {
+			for( int ws = 0; ws < 40; ws += 3 ) {
+				char* mem = new char[pad + ws + 96];
+				char* x = mem + ( pad & 15 );
+				int n = 0;
+				x[n++] = '<'; x[n++] = 'a'; x[n++] = '>';
+				for( int i = 0; i < pad; ++i ) {
+					x[n++] = 'p';
+				}
+				memcpy( x + n, body, bodyLen );
+				n += bodyLen;
+				for( int i = 0; i < ws; ++i ) {
+					x[n++] = ( i % 5 == 4 ) ? '\n' : ( i % 3 ? ' ' : '\t' );
+				}
+				strcpy( x + n, "</a>" );
+				memset( expected, 'p', pad );
+				strcpy( expected + pad, "<\nq&\nr" );
+				int e = (int)strlen( expected );
+				for( int i = 0; i < ws; ++i ) {
+					expected[e++] = x[3 + pad + bodyLen + i];
+				}
+				expected[e] = 0;
+
+				XMLDocument doc;
+				doc.Parse( x );
+				textPass = textPass && !doc.Error() && strcmp( doc.RootElement()->GetText(), expected ) == 0;
+
+				// The same whitespace between elements, counted as lines
+				n = 0;
+				for( int i = 0; i < pad; ++i ) {
+					x[n++] = ' ';
+				}
+				x[n++] = '<'; x[n++] = 'r'; x[n++] = '>';
+				int lines = 1;
+				for( int i = 0; i < ws + pad; ++i ) {
+					x[n] = ( i % 7 == 6 ) ? '\n' : ( i % 2 ? ' ' : '\r' );
+					lines += x[n++] == '\n';
+				}
+				strcpy( x + n, "<b/></r>" );
+				doc.Parse( x );
+				linePass = linePass && !doc.Error() && doc.RootElement()->FirstChildElement( "b" )->GetLineNum() == lines;
+				delete[] mem;
+			}
+		}
+		XMLTest( "Text scanning at every alignment", true, textPass );
+		XMLTest( "Whitespace scanning at every alignment", true, linePass );
+
+		// Whitespace that is not space, tab, CR or LF inside a long run
+		XMLDocument doc;
+		doc.Parse( "<r>\n        \v\f      \n\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t<b/></r>" );
+		XMLTest( "Whitespace scanning vertical tab", 3, doc.RootElement()->FirstChildElement( "b" )->GetLineNum() );
+	}
+
+	// ----------- Scanning throughput --------------
+	{
+		// Parse and read back all the values of generated documents that
+		// stress the text and whitespace scanners:
+		// deeply indented markup with CRLF line ends, and long text runs
+		// with entities.
+		static const size_t GEN_SIZE = 1 << 20;
+		char* indented = new char[GEN_SIZE + 256];
+		char* prose = new char[GEN_SIZE + 4096];
+		size_t n = 0;
+		n += strlen( strcpy( indented, "<root>\r\n" ) );
+		for( int i = 0; n < GEN_SIZE; ++i ) {
+			const int depth = 1 + i % 12;
+			memset( indented + n, ' ', depth * 4 );
+			n += depth * 4;
+			n += strlen( strcpy( indented + n, "<item id=\"42\" name='x'>value</item>\r\n" ) );
+		}
+		strcpy( indented + n, "</root>" );
+
+		static const char* sentence = "Over hill, over dale, thorough bush, thorough brier, over park &amp; pale, thorough flood, thorough fire.\r\n";
+		const size_t sentenceLen = strlen( sentence );
+		n = 0;
+		n += strlen( strcpy( prose, "<play>" ) );
+		while ( n < GEN_SIZE ) {
+			n += strlen( strcpy( prose + n, "<speech>" ) );
+			for( int i = 0; i < 24; ++i ) {
+				memcpy( prose + n, sentence, sentenceLen );
+				n += sentenceLen;
+			}
+			n += strlen( strcpy( prose + n, "</speech>\n" ) );
+		}
+		strcpy( prose + n, "</play>" );
+
+		XMLDocument check;
+		check.Parse( prose );
+		XMLTest( "Parse generated prose", false, check.Error() );
+		const char* speech = check.RootElement()->FirstChildElement()->GetText();
+		XMLTest( "Generated prose is normalized", true, strlen( speech ) == 24 * ( sentenceLen - 5 ) && strstr( speech, "park & pale" ) && !strchr( speech, '\r' ) );
+		check.Parse( indented );
+		XMLTest( "Parse generated markup", false, check.Error() );
+		XMLTest( "Generated markup line numbers", 2, check.RootElement()->FirstChildElement()->GetLineNum() );
+		XMLTest( "Generated markup last line", check.RootElement()->LastChildElement()->GetLineNum(), check.RootElement()->ChildElementCount() + 1 );
+
+		struct {
+			const char* name;
+			char* xml;
+		} docs[] = {
+			{ "indented", indented }, { "prose", prose }, { "dream.xml", 0 }, { "utf8test.xml", 0 }, { "solarxml.xml", 0 }
+		};
+		for( size_t d = 0; d < sizeof( docs ) / sizeof( docs[0] ); ++d ) {
+			char* fileData = 0;
+			if ( !docs[d].xml ) {
+				char path[64] = "resources/";
+				strcat( path, docs[d].name );
+				FILE* fp = fopen( path, "rb" );
+				fseek( fp, 0, SEEK_END );
+				const size_t len = ftell( fp );
+				fseek( fp, 0, SEEK_SET );
+				fileData = new char[len + 1];
+				XMLTest( "Read scanning benchmark file", true, fread( fileData, 1, len, fp ) == len, false );
+				fclose( fp );
+				fileData[len] = 0;
+				docs[d].xml = fileData;
+			}
+			const size_t len = strlen( docs[d].xml );
+			// Repeat small documents so each pass is a comparable amount of work
+			const int reps = len < 4096 ? 200 : 1;
+			double best = 1e9;
+			bool failed = false;
+			for( int pass = 0; pass < 10; ++pass ) {
+				const clock_t t = clock();
+				for( int r = 0; r < reps; ++r ) {
+					XMLDocument doc;
+					doc.Parse( docs[d].xml, len );
+					ValueReader values;
+					doc.Accept( &values );
+					failed = failed || doc.Error() || values.total == 0;
+				}
+				const double seconds = (double)( clock() - t ) / CLOCKS_PER_SEC;
+				if ( seconds < best ) {
+					best = seconds;
+				}
+			}
+			XMLTest( "Parse scanning benchmark document", false, failed, false );
+			printf( "Parse %-13s %8d bytes: %7.1f MB/s\n", docs[d].name, (int)len, best > 0 ? (double)len * reps / best / 1e6 : 0.0 );
+			delete[] fileData;
+		}
+		delete[] indented;
+		delete[] prose;
+	}
+
 #if defined( _MSC_VER ) &&  defined( TINYXML2_DEBUG )
 	{
 		_CrtMemCheckpoint( &endMemState );
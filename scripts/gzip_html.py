@@ -0,0 +1,72 @@
+# Build step: gzip the configuration portal page and tag it with an ETag
+#
+# Reads the raw string literal out of include/html_page.h and writes
+# include/html_page_gz.h with the compressed bytes, their length and a
+# strong ETag derived from the uncompressed page. The page is then served
+# straight from flash with Content-Encoding: gzip, see serveStatic_P().
+#
+# Runs before every PlatformIO build (extra_scripts = pre:...) and can also
+# be run by hand:  python3 scripts/gzip_html.py
+# The header is only rewritten when its content changes, so an unchanged
+# page does not trigger a rebuild.
+
+import gzip
+import hashlib
+import os
+import re
+
+ASSETS = [
+    # (source header, literal name, output header, array name)
+    ("include/html_page.h", "index_html", "include/html_page_gz.h", "index_html_gz"),
+]
+
+
+def extract_literal(text, name):
+    m = re.search(r'\b' + name + r'\[\]\s*PROGMEM\s*=\s*R"(\w*)\((.*?)\)\1"', text, re.S)
+    if m is None:
+        raise RuntimeError("no raw string literal named %s" % name)
+    return m.group(2).encode("utf-8")
+
+
+def render(src, name, data):
+    # mtime=0 keeps the output (and the build) reproducible
+    packed = gzip.compress(data, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(data).hexdigest()[:16]
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by scripts/gzip_html.py from %s, do not edit." % os.path.basename(src),
+        "// %d bytes of HTML, %d bytes gzipped" % (len(data), len(packed)),
+        "",
+        '#define %s_ETAG "\\"%s\\""' % (name.upper(), etag),
+        "",
+        "const uint8_t %s[] PROGMEM = {" % name,
+    ]
+    for i in range(0, len(packed), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in packed[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    return "\n".join(lines), len(data), len(packed)
+
+
+def build(root):
+    for src, literal, dst, name in ASSETS:
+        with open(os.path.join(root, src), encoding="utf-8") as f:
+            data = extract_literal(f.read(), literal)
+        out, raw, packed = render(src, name, data)
+        path = os.path.join(root, dst)
+        old = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                old = f.read()
+        if old != out:
+            with open(path, "w", encoding="utf-8", newline="\n") as f:
+                f.write(out)
+            print("gzip_html: %s %d -> %d bytes" % (dst, raw, packed))
+
+
+try:
+    Import("env")  # noqa: F821 (provided by PlatformIO)
+    build(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    build(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
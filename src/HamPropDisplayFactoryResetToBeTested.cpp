@@ -11,6 +11,7 @@
 #include "factoryReset.h" // Image is stored here in an 8-bit array  https://notisrac.github.io/FileToCArray/ (select treat as binary)
 
 #include "html_page.h"
+#include "html_page_gz.h" // generated from html_page.h by scripts/gzip_html.py
 #include <JetBrainsMono_Bold15pt7b.h> //  https://rop.nl/truetype2gfx/
 #include <JetBrainsMono_Bold11pt7b.h>
 #include <JetBrainsMono_Light13pt7b.h>
@@ -19,17 +20,28 @@
 #include <HB97DIGITS12pt7b.h>
 #include <UbuntuMono_Regular8pt7b.h>
 #include <time.h>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <driver/ledc.h>
+#include <driver/gpio.h>
+#include <esp_netif_net_stack.h>
+#include <lwip/dhcp.h>
+#include <lwip/tcpip.h>
 
 //-------------------------------------------------------------------------------
 
 // UTC Offset
 int UTCoffset = 2; // will be updated when configuring with portal taking the time from the phone
+String timeZone;   // POSIX TZ rule from the portal, else a fixed one made from UTCoffset
 
 //-------------------------------------------------------------------------------
 
 const char *solarDataUrl = "https://www.hamqsl.com/solarxml.php";
 int currentPage = 0;
-int scanCount = 0;
 AsyncWebServer server(80);
 Preferences prefs;
 PNG png; // PNG decoder instance
@@ -37,15 +49,298 @@ PNG png; // PNG decoder instance
 static const uint8_t MAX_WIFI_REBOOTS = 3;
 static const uint32_t CONNECT_TIMEOUT_MS = 10000;
 
+// Touch input: the touch job calls serviceTouch() on every pass. Between polls it costs
+// nothing; every TOUCH_POLL_MS it reads the pressure (5 bytes on the bus) while the
+// panel is idle, and while pressed one burst of position and pressure (TOUCH_BURST
+// conversions per axis, 25 bytes). A press or a release only counts after TOUCH_DEBOUNCE
+// polls in a row agree. The resulting events queue up until the UI drains them with
+// readTouchEvent(), so nothing waits on the controller. Once nothing is going on the
+// job slows down to TOUCH_IDLE_POLL_MS; with TOUCH_IRQ set to the pin wired to the
+// XPT2046 PENIRQ output it stops altogether until the pin goes low.
+#define TOUCH_POLL_MS 10
+#define TOUCH_IDLE_POLL_MS 40
+#define TOUCH_DEBOUNCE 2
+#define TOUCH_Z_PRESS 600   // as the getTouch() default
+#define TOUCH_Z_RELEASE 200 // lower, so a light hold does not flicker
+#define TOUCH_MOVE_PX 4     // smaller moves of a held finger are not reported
+#define TOUCH_BURST 4       // conversions averaged per axis, the extremes dropped
+#define TOUCH_QUEUE_SIZE 16
+
+enum TouchEventType : uint8_t
+{
+  TOUCH_DOWN,
+  TOUCH_MOVE,
+  TOUCH_UP
+};
+
+struct TouchEvent
+{
+  TouchEventType type;
+  uint16_t x, y; // screen coordinates, for TOUCH_UP where the finger was last seen
+  uint32_t ms;   // millis() of the poll that produced it
+};
+
+// Gestures are recognized from the touch events by readGesture(). A tap is held
+// back for GESTURE_DOUBLE_TAP_MS, so that a second tap can turn it into a double tap.
+#define GESTURE_TAP_SLOP_PX 12 // a press that wanders further is no tap
+#define GESTURE_LONG_PRESS_MS 700
+#define GESTURE_DOUBLE_TAP_MS 300
+#define GESTURE_SWIPE_MIN_PX 60
+#define GESTURE_SWIPE_MAX_MS 600
+#define GESTURE_QUEUE_SIZE 4
+
+enum GestureType : uint8_t
+{
+  GESTURE_TAP,
+  GESTURE_DOUBLE_TAP,
+  GESTURE_LONG_PRESS,
+  GESTURE_SWIPE_LEFT,
+  GESTURE_SWIPE_RIGHT
+};
+
+struct Gesture
+{
+  GestureType type;
+  uint16_t x, y;     // where the (first) press landed
+  uint32_t ms;       // millis() of that press
+  uint32_t duration; // until the gesture was recognized
+};
+
+// Library default calibration, with both axes mirrored for setRotation(3): the
+// defaults assume rotation 1, which is the same panel turned by 180 degrees.
+uint16_t touchCalibration[5] = {300, 3600, 300, 3600, 0x01 | 0x04};
+
+// Raw to screen mapping in Q16 fixed point, fitted by calibrateTouch() from three
+// touched targets and kept in Preferences ("touch"/"affine"):
+//   x = (a * rawX + b * rawY + c) >> 16,  y = (d * rawX + e * rawY + f) >> 16
+// The matrix takes care of swapped, mirrored and skewed axes by itself.
+struct TouchAffine
+{
+  int32_t a, b, c, d, e, f;
+  uint8_t rotation; // setRotation() the targets were shown in
+};
+TouchAffine touchAffine;
+#define TOUCH_CAL_TOLERANCE 10 // px, for the check target after the fit
+
+// Cooperative scheduler: loop() runs the jobs that are due and sleeps until the next
+// deadline. Jobs hang in a timer wheel of SCHED_SLOTS slots SCHED_TICK_US apart, by
+// deadline, so a pass only looks at the slots of the ticks that went by; a deadline
+// more than a turn away stays in its slot until the wheel comes round to it.
+#define SCHED_MAX_JOBS 8
+#define SCHED_SLOTS 32
+#define SCHED_TICK_US 10000
+#define SCHED_STATS_MS (15 * 60 * 1000UL) // job statistics to the serial log
+
+struct SchedJob
+{
+  const char *name;
+  void (*run)();
+  uint32_t period; // us, 0 for a one-shot
+  uint32_t due;    // us
+  bool armed;      // in the wheel
+  bool pending;    // taken out of the wheel to run in this pass
+  bool regular;    // due is a period after the last run, so the interval counts as jitter
+  int8_t next;     // next job in the same slot, -1 at the end
+  // accounting, in us
+  uint32_t runs, missed, intervals, lastStart;
+  uint32_t runMax, latencyMax, jitterMax;
+  uint64_t runTotal, latencyTotal, jitterTotal;
+};
+int8_t jobSolar = -1, jobBacklight = -1; // re-armed from the touch job
+int8_t jobTouch = -1;                     // re-armed by the touch interrupt
+int8_t jobClock = -1;                     // re-arms itself for each second
+int8_t jobNtp = -1;                       // re-arms itself
+
+// Clock: the clock job arms itself for the next second boundary of the system time
+// (gettimeofday()), so the display turns over with the time base rather than a second
+// after the job happened to start. A second it comes too late for is counted as
+// skipped and the display jumps to the current one; when it wakes before the boundary
+// (the time base runs slewed against micros() while NTP corrects it) nothing is drawn
+// twice, it only waits for the boundary again. How late after the boundary each
+// redraw finished goes into a histogram of CLOCK_HIST_BINS bins.
+#define CLOCK_HIST_BINS 10
+const uint16_t clockHistMs[CLOCK_HIST_BINS - 1] = {1, 2, 5, 10, 20, 50, 100, 200, 500}; // upper bounds
+#define CLOCK_STEP_S 60 // a bigger jump is the time being set, not seconds skipped
+
+// Time zone: the local time follows a POSIX TZ rule such as "CET-1CEST,M3.5.0,M10.5.0/3"
+// or "<+0530>-5:30", which the portal page works out from the phone. The offset and the
+// next change of it are looked up once; in between, formatClock() only steps the
+// HH:MM:SS digits of both clocks, with no gmtime()/mktime() each second.
+struct TzChange
+{
+  char form;          // 'M' month.week.weekday, 'J' day 1-365 without Feb 29, 'D' day 0-365
+  uint8_t month, week, weekday;
+  uint16_t day;
+  int32_t at;         // seconds after local midnight, may be negative or past 24h
+};
+struct TzRule
+{
+  int32_t stdOffset, dstOffset; // seconds east of UTC
+  bool hasDst;
+  TzChange start, end;
+};
+TzRule tzRule = {0, 0, false, {}, {}};
+struct ClockText
+{
+  time_t shown, until; // second in the strings; the offset holds before until
+  int32_t offset;
+  char utcDigits[9], localDigits[9];
+};
+
+// Time: an NTP client runs as a job instead of setup() waiting for the first answer.
+// Until one comes, the system time is what the RTC kept over a CPU reset, else the time
+// last saved to flash, running on from boot. An offset up to NTP_STEP_MS is slewed out
+// with adjtime() so the clock never jumps, a larger one is stepped. The answer is polled
+// for every NTP_LISTEN_MS, which adds up to that much to the measured round trip and
+// half of it to the offset.
+#define NTP_PORT 123
+#define NTP_LOCAL_PORT 2390
+#define NTP_LISTEN_MS 5
+#define NTP_WAIT_MS 1500                    // for an answer, then the next server
+#define NTP_RETRY_MS 15000UL                // after no answer, doubling up to NTP_POLL_MS
+#define NTP_POLL_MS (30 * 60 * 1000UL)
+#define NTP_STEP_MS 128
+#define NTP_DELAY_MAX_MS 500                // answers with a longer round trip are dropped
+#define NTP_UNIX_EPOCH 2208988800LL         // 1970 in NTP seconds since 1900
+#define TIME_VALID_S 1700000000             // earlier is a system time never set
+#define TIME_SAVE_S 3600                    // the time is saved at most this often
+const char *ntpServers[] = {"pool.ntp.org", "time.nist.gov"};
+enum TimeSource : uint8_t
+{
+  TIME_NONE,
+  TIME_RTC,
+  TIME_SAVED,
+  TIME_NTP
+};
+const char *timeSourceNames[] = {"none", "RTC", "saved time", "NTP"};
+TimeSource timeSource = TIME_NONE;
+struct NtpState
+{
+  uint8_t server;    // index into ntpServers
+  IPAddress address; // of the server, looked up again after it stops answering
+  uint8_t sent[8];   // our transmit timestamp, which the answer has to echo
+  int64_t sentUs;    // when, on the system time
+  uint32_t sentMs;
+  bool waiting;
+  uint32_t retryMs;
+  uint32_t syncs, steps, timeouts, rejected;
+  int64_t offsetUs, delayUs; // of the last answer taken
+  uint8_t stratum;
+  uint32_t syncedMs;
+  time_t savedAt;
+};
+
+// Wi-Fi: the BSSID, channel and DHCP lease of the last connection are kept, and the next
+// boot joins that AP directly, which skips the scan of all channels. While the lease has
+// not run out it is taken as a static address, which skips DHCP too; the lease job then
+// hands over to DHCP before it runs out, as the router would give the address to another.
+// Should the AP not answer within WIFI_FAST_WAIT_MS, the usual scan and DHCP follow, and
+// what they find is kept for next time.
+#define WIFI_FAST_WAIT_MS 3000
+#define WIFI_FULL_WAIT_MS 10000
+#define WIFI_POLL_MS 20
+#define WIFI_LEASE_MARGIN_S 300 // the kept lease is given up this long before it runs out
+#define WIFI_LEASE_CHECK_MS 60000
+struct WiFiCache
+{
+  uint8_t bssid[6];
+  uint8_t channel;                   // 0 for nothing kept
+  uint32_t ip, gateway, subnet, dns; // the lease, 0 for DHCP
+  uint32_t leaseEnds;                // system time it runs out, 0 for not known
+};
+enum WiFiPath : uint8_t
+{
+  WIFI_NONE,
+  WIFI_FAST,
+  WIFI_FULL
+};
+const char *wifiPathNames[] = {"not connected", "fast path", "scan and DHCP"};
+bool wifiOnKeptLease = false; // the static address from the cache, DHCP not running
+uint32_t wifiLeaseEnds = 0;   // as kept in the cache
+struct WiFiConnectStats
+{
+  WiFiPath path;
+  uint32_t fastMs, fullMs; // spent in each attempt, 0 when not made
+  uint32_t connectedMs;    // since boot
+};
+WiFiConnectStats wifiStats = {WIFI_NONE, 0, 0, 0};
+
+#define SOLAR_REFRESH_MS (15 * 60 * 1000UL)
+#define BACKLIGHT_DIM_MS (10 * 60 * 1000UL) // without a touch
+#define BACKLIGHT_CHANNEL LEDC_CHANNEL_0    // for the backlight PWM
+#define BACKLIGHT_FULL 255
+#define BACKLIGHT_DIM 24
+
+// Power: loop() blocks between jobs, and with power management in the firmware the
+// idle task then drops the CPU to PM_MIN_MHZ and light-sleeps the chip until the next
+// deadline, the touch interrupt or the radio wakes it. The radio itself modem-sleeps
+// between the beacons of the AP. Jobs run with the CPU held at PM_MAX_MHZ.
+#define PM_MAX_MHZ 240
+#define PM_MIN_MHZ 80
+#define DUTY_WINDOW_MS 10000 // the share of time loop() spends in jobs is measured over this
+esp_pm_lock_handle_t jobsPmLock = nullptr; // only with power management
+#ifdef TOUCH_IRQ
+volatile bool touchIrqFired = false;
+TaskHandle_t loopTask = nullptr; // woken by the touch interrupt
+#endif
+
 // Prototypes
-void drawQRCode(const char *text, int x, int y, int scale);
+void drawQRCode(const char *text, int x, int y, int box);
+QRCode *getCachedQRCode(const char *text, uint8_t maxVersion, uint8_t ecc);
+void qrCacheReport();
 void drawQRcodeInstructions();
 void startConfigurationPortal();
+bool publishScanResults(int count);
+void serviceWiFiScan();
 bool tryConnectSavedWiFi();
+bool connectWiFi(const char *ssid, const char *pass);
+void wifiReport();
+uint32_t dhcpLeaseEnds();
+void leaseJob();
 void displaySplashScreen();
 void pngDraw(PNGDRAW *pDraw);
 void fadeSplashToBlack(int steps = 50000, int delayMicros = 0);
 void fetchSolarData();
+void startLiveFeed();
+void publishSolarData();
+void publishLiveStatus(const char *utc, const char *localTime);
+void serviceTouch();
+bool readTouchEvent(TouchEvent &event);
+bool readGesture(Gesture &gesture);
+int8_t schedAdd(const char *name, void (*run)(), uint32_t periodMs, uint32_t firstMs);
+void schedAt(int8_t id, uint32_t inMs);
+void schedAtUs(int8_t id, uint32_t inUs);
+void schedCancel(int8_t id);
+void schedPeriod(int8_t id, uint32_t periodMs);
+uint32_t schedRun();
+uint16_t schedDuty();
+void schedReport();
+void touchJob();
+void clockJob();
+void clockReport();
+bool parseTzRule(const char *tz, TzRule &rule);
+int32_t tzOffsetAt(time_t now, time_t &until);
+void formatClock(time_t now);
+void statsJob();
+void ntpJob();
+void ntpReport();
+void startTimeService();
+void loadTimeZone();
+void rssiJob();
+void solarJob();
+void backlightJob();
+void drawCurrentPage();
+void startBacklightPwm();
+void setBacklight(uint32_t duty);
+void startPowerManagement();
+#ifdef TOUCH_IRQ
+void armTouchIrq();
+#endif
+bool fitTouchAffine(const uint16_t raw[3][2], const int16_t screen[3][2], TouchAffine &m);
+void applyTouchAffine(const TouchAffine &m, uint16_t rawX, uint16_t rawY, int32_t &x, int32_t &y);
+bool touchToScreen(uint16_t &x, uint16_t &y);
+bool loadTouchCalibration();
+void calibrateTouch();
 void drawSolarSummaryPage0();
 String formatUpdatedTimestampToUTC(const String &raw);
 void drawSolarSummaryPage1();
@@ -59,12 +354,8 @@ void drawUTCTime(const String &timeStr, int x, int y, uint16_t digitColor, uint1
 void updateWiFiSignalDisplay();
 void displayFactoryResetScreen();
 void wipeAllPreferences();
-// Time update interval
-unsigned long lastPrint = 0;
-
 // For elaborated time display (non flickering)
 // Previous time string
-int previousPage = -1;                // -1 means "no page shown yet"
 String LOCALlastTimeStr = "        "; // 8 characters: HH:MM:SS
 String UTClastTimeStr = "        ";   // 8 characters: HH:MM:SS
 uint16_t LOCALdigitColor = TFT_LIGHTGREY;
@@ -135,6 +426,11 @@ void setup()
   // delay(4000);
   tft.init();
   tft.setRotation(3);
+  tft.setTouch(touchCalibration);
+  // Without a saved calibration the library default mapping is used; holding a finger
+  // on the screen at power-on offers calibrateTouch()
+  if (!loadTouchCalibration())
+    Serial.println("👆 Touch uncalibrated, hold the screen at power-on to calibrate");
   tft.fillScreen(TFT_BLACK);
   tft.setTextSize(1);
   tft.setTextColor(TFT_WHITE);
@@ -142,17 +438,19 @@ void setup()
   // Backlight pin setup
   pinMode(TFT_BLP, OUTPUT);
   digitalWrite(TFT_BLP, HIGH); // Turn backlight ON permanently
+#ifdef TOUCH_IRQ
+  pinMode(TOUCH_IRQ, INPUT_PULLUP); // PENIRQ is open drain
+#endif
 
   uint16_t x, y;
   if (tft.getTouch(&x, &y))
   {
     displayFactoryResetScreen();
 
-    while (tft.getTouch(&x, &y))
+    while (tft.getTouchRawZ() > TOUCH_Z_RELEASE)
     {
-      delay(1000); // wait for finger is reelased
+      delay(TOUCH_POLL_MS); // wait for finger is reelased
     }
-    delay(1000);
     // Hardcoded rectangles
     const uint16_t R1_X = 0, R1_Y = 95, R1_W = 320, R1_H = 50;  // top
     const uint16_t R2_X = 0, R2_Y = 180, R2_W = 320, R2_H = 60; // bottom
@@ -161,37 +459,30 @@ void setup()
     // tft.drawRect(R1_X, R1_Y, R1_W, R1_H, TFT_WHITE);
     // tft.drawRect(R2_X, R2_Y, R2_W, R2_H, TFT_WHITE);
 
-    for (;;)
+    Gesture gesture;
+    while (!readGesture(gesture) || (gesture.type != GESTURE_TAP && gesture.type != GESTURE_LONG_PRESS))
     {
-      uint16_t x, y;
-      if (tft.getTouch(&x, &y))
-      {
+      delay(TOUCH_POLL_MS);
+    }
 
-        // Invert Y
-        y = 240 - y;
-
-        if (y < 160)
-        { // upper half (after inversion)
-          Serial.println("UPPER");
-          wipeAllPreferences();
-          tft.fillScreen(TFT_NAVY);
-          tft.setFreeFont(&JetBrainsMono_Medium13pt7b);
-          tft.setTextColor(TFT_WHITE);
-          tft.drawCentreString("REBOOTING", 160, 110, 4);
-          ESP.restart();
-        }
-        else
-        { // lower half (after inversion)
-          Serial.println("DOWN");
-          break;
-        }
-
-        while (tft.getTouch(&x, &y))
-        {
-          yield();
-        } // wait for release
-      }
-      yield();
+    if (gesture.type == GESTURE_LONG_PRESS)
+    { // held anywhere: a badly calibrated screen may be why the taps miss
+      Serial.println("CALIBRATE");
+      calibrateTouch();
+    }
+    else if (gesture.y < 160)
+    { // upper half
+      Serial.println("UPPER");
+      wipeAllPreferences();
+      tft.fillScreen(TFT_NAVY);
+      tft.setFreeFont(&JetBrainsMono_Medium13pt7b);
+      tft.setTextColor(TFT_WHITE);
+      tft.drawCentreString("REBOOTING", 160, 110, 4);
+      ESP.restart();
+    }
+    else
+    { // lower half
+      Serial.println("DOWN");
     }
   }
 
@@ -203,189 +494,51 @@ void setup()
     startConfigurationPortal();
   }
 
-  // Configure NTP (UTC only)
-  configTime(0, 0, "pool.ntp.org", "time.nist.gov");
-
-  // Wait for NTP sync
-  tft.setFreeFont(&JetBrainsMono_Light7pt7b);
-  tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
-  // tft.drawCentreString("Waiting for NTP synch...", 160, 110, 1);
-  Serial.print("⏳ Waiting for NTP");
-  while (time(nullptr) < 100000)
-  {
-    delay(500);
-    Serial.print(".");
-  }
-  Serial.println("\n🕓 Time synced via NTP");
-
-  // ⏱️ Check if UTCoffset is already saved
-  prefs.begin("time", true);
-  bool hasSavedOffset = prefs.isKey("UTCoffset");
-  prefs.end();
-
-  if (hasSavedOffset)
-  {
-    // ✅ Load previously saved offset
-    prefs.begin("time", true);
-    UTCoffset = prefs.getInt("UTCoffset", 2);
-    prefs.end();
-    Serial.printf("✅ Loaded saved UTCoffset: %d\n", UTCoffset);
-  }
-  else
-  {
-    // 🕓 Attempt to calculate from phone time
-    prefs.begin("time", true);
-    String timeStr = prefs.getString("localTime", "");
-    prefs.end();
-
-    if (timeStr.length() >= 5)
-    {
-      struct tm timeinfo;
-      if (getLocalTime(&timeinfo))
-      {
-        int userHour = timeStr.substring(0, 2).toInt();
-        int utcHour = timeinfo.tm_hour;
-        int offset = userHour - utcHour;
-
-        if (offset < -12)
-          offset += 24;
-        if (offset > 12)
-          offset -= 24;
-
-        UTCoffset = offset;
-
-        prefs.begin("time", false);
-        prefs.putInt("UTCoffset", UTCoffset);
-        prefs.end();
-
-        Serial.printf("📱 Phone time: %s | 🌍 UTC: %02d:%02d\n", timeStr.c_str(), utcHour, timeinfo.tm_min);
-        Serial.printf("🧭 Calculated and saved UTCoffset = %d\n", UTCoffset);
-      }
-      else
-      {
-        Serial.println("❌ getLocalTime failed, using fallback UTCoffset = 2");
-        UTCoffset = 2;
-      }
-    }
-    else
-    {
-      Serial.println("⚠️ No phone time found, using default UTCoffset = 2");
-      UTCoffset = 2;
-    }
-  }
+  // The UI starts now; NTP corrects the time whenever it answers
+  startTimeService();
+  loadTimeZone();
 
+  startLiveFeed();
   fetchSolarData();
   fadeSplashToBlack();
 
   drawIntroPage(false); // set to true to force
   delay(500);
   drawSolarSummaryPage0();
+
+  // PWM on the backlight from here on, so that it can be dimmed
+  startBacklightPwm();
+
+  jobTouch = schedAdd("touch", touchJob, TOUCH_POLL_MS, 0);
+  jobClock = schedAdd("clock", clockJob, 0, 0);
+  schedAdd("rssi", rssiJob, 1000, 0);
+  schedAdd("lease", leaseJob, WIFI_LEASE_CHECK_MS, WIFI_LEASE_CHECK_MS);
+  jobSolar = schedAdd("solar", solarJob, SOLAR_REFRESH_MS, SOLAR_REFRESH_MS);
+  jobBacklight = schedAdd("backlight", backlightJob, 0, BACKLIGHT_DIM_MS);
+  schedAdd("stats", statsJob, SCHED_STATS_MS, SCHED_STATS_MS);
+  jobNtp = schedAdd("ntp", ntpJob, 0, 0);
+  startPowerManagement();
 }
 void loop()
 {
-  static int previousPage = -1;
-  unsigned long nowMillis = millis();
-
-  // Page switch detection
-  if (currentPage != previousPage)
-  {
-    if (currentPage == 0)
-    {
-      UTClastTimeStr = "        ";
-      LOCALlastTimeStr = "        ";
-    }
-    previousPage = currentPage;
-  }
-
-  // Time update every second
-  if (nowMillis - lastPrint >= 1000)
-  {
-    lastPrint = nowMillis;
-
-    time_t now = time(nullptr);
-    struct tm *utc_tm = gmtime(&now);
-
-    char utcStr[9];
-    strftime(utcStr, sizeof(utcStr), "%H:%M:%S", utc_tm);
-
-    struct tm local_tm = *utc_tm;
-    local_tm.tm_hour += UTCoffset;
-    mktime(&local_tm);
-
-    char localStr[9];
-    strftime(localStr, sizeof(localStr), "%H:%M:%S", &local_tm);
-
-    if (currentPage == 0)
-    {
-      drawLOCALTime(String(localStr), 30, 205, LOCALdigitColor, TFT_BLACK, blinkingDot);
-      drawUTCTime(String(utcStr), 30 + 160, 205, UTCdigitColor, TFT_BLACK, blinkingDot);
-    }
-
-    // 💡 Update live Wi-Fi signal when on page 4
-    if (currentPage == 4)
-    {
-      updateWiFiSignalDisplay();
-    }
-  }
-
-  // Solar data refresh
-  static unsigned long lastSolarFetch = 0;
-  const unsigned long refreshInterval = 15 * 60 * 1000UL;
-
-  if (nowMillis - lastSolarFetch > refreshInterval)
-  {
-    Serial.println("🔄 Refreshing solar data...");
-    fetchSolarData();
-
-    switch (currentPage)
-    {
-    case 0:
-      UTClastTimeStr = "        ";
-      LOCALlastTimeStr = "        ";
-      drawSolarSummaryPage0();
-      break;
-    case 1:
-      drawSolarSummaryPage1();
-      break;
-    case 2:
-      drawSolarSummaryPage2();
-      break;
-    case 3:
-      drawSolarSummaryPage3();
-      break;
-    case 4:
-      drawSolarSummaryPage4();
-      break;
-    }
-    lastSolarFetch = nowMillis;
-  }
-
-  // Touch page switch
-  uint16_t x, y;
-  if (tft.getTouch(&x, &y))
+#ifdef TOUCH_IRQ
+  if (touchIrqFired)
   {
-    delay(200);
-    currentPage = (currentPage + 1) % 5;
-
-    switch (currentPage)
-    {
-    case 0:
-      drawSolarSummaryPage0();
-      break;
-    case 1:
-      drawSolarSummaryPage1();
-      break;
-    case 2:
-      drawSolarSummaryPage2();
-      break;
-    case 3:
-      drawSolarSummaryPage3();
-      break;
-    case 4:
-      drawSolarSummaryPage4();
-      break;
-    }
+    touchIrqFired = false;
+    gpio_wakeup_disable((gpio_num_t)TOUCH_IRQ); // the pin stays low while pressed
+    schedAt(jobTouch, 0);
   }
+#endif
+  if (jobsPmLock)
+    esp_pm_lock_acquire(jobsPmLock);
+  uint32_t idle = schedRun();
+  if (jobsPmLock)
+    esp_pm_lock_release(jobsPmLock);
+  // the idle task runs (and may light-sleep) meanwhile. The first tick of the wait is
+  // a partial one, hence rounding up and the + 1, so that it never ends before the
+  // deadline; the touch interrupt ends it at once.
+  if (idle)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS((idle + 999) / 1000 + 1));
 }
 
 void displaySplashScreen()
@@ -436,6 +589,75 @@ void displayFactoryResetScreen()
   digitalWrite(TFT_BLP, HIGH);
 }
 
+// Raw position of one press: the median of its bursts, so the slips as the finger
+// lands and lifts do not count
+void readCalibrationPoint(uint16_t &x, uint16_t &y)
+{
+  uint16_t vx[16], vy[16];
+  uint8_t n = 0;
+  while (n < 3)
+  {
+    n = 0;
+    while (tft.getTouchRawZ() <= TOUCH_Z_PRESS)
+      delay(TOUCH_POLL_MS);
+    while (n < 16 && tft.getTouchRawBurst(&vx[n], &vy[n], TOUCH_BURST) > TOUCH_Z_RELEASE)
+    {
+      n++;
+      delay(TOUCH_POLL_MS);
+    }
+    while (tft.getTouchRawZ() > TOUCH_Z_RELEASE)
+      delay(TOUCH_POLL_MS);
+  }
+  std::nth_element(vx, vx + n / 2, vx + n);
+  std::nth_element(vy, vy + n / 2, vy + n);
+  x = vx[n / 2];
+  y = vy[n / 2];
+}
+
+void calibrateTouch()
+{
+  int16_t w = tft.width(), h = tft.height();
+  // three corners of a large triangle for the fit, then the centre to check it
+  const int16_t target[4][2] = {{int16_t(w / 10), int16_t(h / 10)}, {int16_t(w * 9 / 10), int16_t(h / 2)},
+                                {int16_t(w / 10), int16_t(h * 9 / 10)}, {int16_t(w / 2), int16_t(h / 2)}};
+  uint16_t raw[4][2];
+  const char *prompt = "Touch the centre of each cross";
+  TouchAffine m;
+
+  while (tft.getTouchRawZ() > TOUCH_Z_RELEASE)
+    delay(TOUCH_POLL_MS); // the press that asked for this may still be down
+  while (true)
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      tft.fillScreen(TFT_BLACK);
+      tft.setFreeFont(&JetBrainsMono_Light7pt7b);
+      tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+      tft.drawCentreString(prompt, w / 2, h / 4, 1);
+      tft.drawFastHLine(target[i][0] - 10, target[i][1], 21, TFT_WHITE);
+      tft.drawFastVLine(target[i][0], target[i][1] - 10, 21, TFT_WHITE);
+      tft.drawCircle(target[i][0], target[i][1], 6, TFT_RED);
+      readCalibrationPoint(raw[i][0], raw[i][1]);
+    }
+    int32_t x, y;
+    if (fitTouchAffine(raw, target, m))
+    {
+      applyTouchAffine(m, raw[3][0], raw[3][1], x, y);
+      if (abs(x - target[3][0]) <= TOUCH_CAL_TOLERANCE && abs(y - target[3][1]) <= TOUCH_CAL_TOLERANCE)
+        break;
+    }
+    Serial.println("⚠️ Touch calibration check missed, again");
+    prompt = "Missed, once more please";
+  }
+  m.rotation = tft.getRotation();
+  touchAffine = m;
+  prefs.begin("touch", false);
+  prefs.putBytes("affine", &m, sizeof(m));
+  prefs.end();
+  Serial.printf("✅ Touch calibration saved: %ld %ld %ld / %ld %ld %ld\n", (long)m.a, (long)m.b, (long)m.c, (long)m.d, (long)m.e, (long)m.f);
+  tft.fillScreen(TFT_BLACK);
+}
+
 void pngDraw(PNGDRAW *pDraw)
 {
   uint16_t lineBuffer[480];
@@ -486,8 +708,15 @@ void fetchSolarData()
   }
 
   String payload = http.getString();
+
+  // Parse in place over the payload buffer (no copy of the document) with the
+  // DOM nodes and the child index below carved from a static arena instead of
+  // the heap; the hamqsl document takes about 11.4k of nodes and 1k of index
+  static char xmlNodeMem[16 * 1024];
+  static tinyxml2::XMLArena xmlArena(xmlNodeMem, sizeof(xmlNodeMem));
   tinyxml2::XMLDocument doc;
-  doc.Parse(payload.c_str());
+  doc.SetArena(&xmlArena);
+  doc.ParseInSitu(payload.begin(), payload.length());
   if (doc.ErrorID() != 0)
   {
     Serial.print("XML parse error: ");
@@ -496,6 +725,9 @@ void fetchSolarData()
   }
 
   tinyxml2::XMLElement *solardataXML = doc.RootElement()->FirstChildElement("solardata");
+  // ~25 lookups by name below: hash them instead of walking the children each time,
+  // with the table taken from the arena
+  solardataXML->SetChildIndex(true);
 
   auto get = [&](const char *tag)
   {
@@ -527,77 +759,1426 @@ void fetchSolarData()
   solarData.mufFactor = get("muffactor");
   solarData.muf = get("muf");
 
-  // Parse band conditions
-  int bIndex = 0;
-  tinyxml2::XMLElement *band = solardataXML->FirstChildElement("calculatedconditions")->FirstChildElement("band");
-  while (band && bIndex < 8)
+  // Parse band conditions
+  int bIndex = 0;
+  tinyxml2::XMLElement *band = solardataXML->FirstChildElement("calculatedconditions")->FirstChildElement("band");
+  while (band && bIndex < 8)
+  {
+    solarData.bandConditions[bIndex].name = band->Attribute("name");
+    solarData.bandConditions[bIndex].time = band->Attribute("time");
+    solarData.bandConditions[bIndex].condition = band->GetText();
+    band = band->NextSiblingElement("band");
+    bIndex++;
+  }
+
+  // Parse VHF conditions
+  int vIndex = 0;
+  tinyxml2::XMLElement *phen = solardataXML->FirstChildElement("calculatedvhfconditions")->FirstChildElement("phenomenon");
+  while (phen && vIndex < 5)
+  {
+    solarData.vhfConditions[vIndex].name = phen->Attribute("name");
+    solarData.vhfConditions[vIndex].location = phen->Attribute("location");
+    solarData.vhfConditions[vIndex].condition = phen->GetText();
+    phen = phen->NextSiblingElement("phenomenon");
+    vIndex++;
+  }
+
+  http.end();
+
+  // --- Serial Debug Output ---
+  Serial.println("\n=== Solar Data ===");
+  Serial.println("Source: " + solarData.source);
+  Serial.println("Updated: " + solarData.updated);
+  Serial.printf("Solar Flux: %d\n", solarData.solarFlux);
+  Serial.printf("A Index: %d\n", solarData.aIndex);
+  Serial.printf("K Index: %d\n", solarData.kIndex);
+  Serial.println("K Index NT: " + solarData.kIndexNT);
+  Serial.println("X-Ray: " + solarData.xRay);
+  Serial.printf("Sunspots: %d\n", solarData.sunspots);
+  Serial.printf("Helium Line: %.1f\n", solarData.heliumLine);
+  Serial.println("Proton Flux: " + solarData.protonFlux);
+  Serial.println("Electron Flux: " + solarData.electronFlux);
+  Serial.printf("Aurora: %d\n", solarData.aurora);
+  Serial.printf("Normalization: %.2f\n", solarData.normalization);
+  Serial.printf("Lat Degree: %.2f\n", solarData.latDegree);
+  Serial.printf("Solar Wind: %.1f\n", solarData.solarWind);
+  Serial.printf("Magnetic Field: %.1f\n", solarData.magneticField);
+  Serial.println("Geomagnetic Field: " + solarData.geomagneticField);
+  Serial.println("Signal Noise: " + solarData.signalNoise);
+  Serial.println("foF2: " + solarData.fof2);
+  Serial.println("MUF Factor: " + solarData.mufFactor);
+  Serial.println("MUF: " + solarData.muf);
+
+  Serial.println("--- Band Conditions ---");
+  for (int i = 0; i < 8; i++)
+  {
+    if (solarData.bandConditions[i].name.isEmpty())
+      break;
+    Serial.printf("[%s] %s: %s\n",
+                  solarData.bandConditions[i].time.c_str(),
+                  solarData.bandConditions[i].name.c_str(),
+                  solarData.bandConditions[i].condition.c_str());
+  }
+
+  Serial.println("--- VHF Conditions ---");
+  for (int i = 0; i < 5; i++)
+  {
+    if (solarData.vhfConditions[i].name.isEmpty())
+      break;
+    Serial.printf("%s (%s): %s\n",
+                  solarData.vhfConditions[i].name.c_str(),
+                  solarData.vhfConditions[i].location.c_str(),
+                  solarData.vhfConditions[i].condition.c_str());
+  }
+
+  publishSolarData();
+}
+
+// Live feed: in station mode the display serves /events (Server-Sent Events) so
+// dashboards on the LAN can mirror it without each polling hamqsl.com. "solar" is
+// sent after every fetch and to each new client, "clock", "rssi" and "duty" (percent
+// of the time loop() spends in jobs) every second.
+// Coalescing keeps only the newest event of each kind queued for a slow client.
+AsyncEventSource liveEvents("/events");
+std::shared_ptr<const String> solarJson; // serialized once per fetch
+portMUX_TYPE liveMux = portMUX_INITIALIZER_UNLOCKED;
+
+void appendJsonString(String &out, const String &value)
+{
+  out += '"';
+  for (const char *p = value.c_str(); *p; p++)
+  {
+    if (*p == '"' || *p == '\\')
+    {
+      out += '\\';
+      out += *p;
+    }
+    else if ((uint8_t)*p < 0x20)
+    {
+      char esc[7];
+      snprintf(esc, sizeof(esc), "\\u%04x", *p);
+      out += esc;
+    }
+    else
+      out += *p;
+  }
+  out += '"';
+}
+
+void publishSolarData()
+{
+  String *json = new String();
+  json->reserve(1024);
+  auto text = [&](const char *name, const String &value)
+  {
+    *json += json->length() > 1 ? ",\"" : "\"";
+    *json += name;
+    *json += "\":";
+    appendJsonString(*json, value);
+  };
+  auto number = [&](const char *name, float value)
+  {
+    char num[48];
+    snprintf(num, sizeof(num), "%s\"%s\":%g", json->length() > 1 ? "," : "", name, value);
+    *json += num;
+  };
+
+  *json += '{';
+  text("source", solarData.source);
+  text("updated", solarData.updated);
+  number("solarFlux", solarData.solarFlux);
+  number("aIndex", solarData.aIndex);
+  number("kIndex", solarData.kIndex);
+  text("kIndexNT", solarData.kIndexNT);
+  text("xRay", solarData.xRay);
+  number("sunspots", solarData.sunspots);
+  number("heliumLine", solarData.heliumLine);
+  text("protonFlux", solarData.protonFlux);
+  text("electronFlux", solarData.electronFlux);
+  number("aurora", solarData.aurora);
+  number("normalization", solarData.normalization);
+  number("latDegree", solarData.latDegree);
+  number("solarWind", solarData.solarWind);
+  number("magneticField", solarData.magneticField);
+  text("geomagneticField", solarData.geomagneticField);
+  text("signalNoise", solarData.signalNoise);
+  text("fof2", solarData.fof2);
+  text("mufFactor", solarData.mufFactor);
+  text("muf", solarData.muf);
+
+  *json += ",\"bands\":[";
+  for (int i = 0; i < 8 && !solarData.bandConditions[i].name.isEmpty(); i++)
+  {
+    *json += i ? ",{\"name\":" : "{\"name\":";
+    appendJsonString(*json, solarData.bandConditions[i].name);
+    *json += ",\"time\":";
+    appendJsonString(*json, solarData.bandConditions[i].time);
+    *json += ",\"condition\":";
+    appendJsonString(*json, solarData.bandConditions[i].condition);
+    *json += '}';
+  }
+  *json += "],\"vhf\":[";
+  for (int i = 0; i < 5 && !solarData.vhfConditions[i].name.isEmpty(); i++)
+  {
+    *json += i ? ",{\"name\":" : "{\"name\":";
+    appendJsonString(*json, solarData.vhfConditions[i].name);
+    *json += ",\"location\":";
+    appendJsonString(*json, solarData.vhfConditions[i].location);
+    *json += ",\"condition\":";
+    appendJsonString(*json, solarData.vhfConditions[i].condition);
+    *json += '}';
+  }
+  *json += "]}";
+
+  std::shared_ptr<const String> snap(json);
+  portENTER_CRITICAL(&liveMux);
+  solarJson = snap;
+  portEXIT_CRITICAL(&liveMux);
+  liveEvents.send(snap->c_str(), "solar");
+}
+
+// Called from the one second tick; cheap when nobody is listening
+void publishLiveStatus(const char *utc, const char *localTime)
+{
+  char msg[48];
+  snprintf(msg, sizeof(msg), "{\"utc\":\"%s\",\"local\":\"%s\"}", utc, localTime);
+  liveEvents.send(msg, "clock");
+  snprintf(msg, sizeof(msg), "{\"rssi\":%d}", WiFi.RSSI());
+  liveEvents.send(msg, "rssi");
+  snprintf(msg, sizeof(msg), "{\"duty\":%u.%u}", schedDuty() / 10, schedDuty() % 10);
+  liveEvents.send(msg, "duty");
+}
+
+void startLiveFeed()
+{
+  liveEvents.setCoalescing(true);
+  liveEvents.onConnect([](AsyncEventSourceClient *client)
+                       {
+    // a new dashboard gets the current data right away instead of at the next fetch
+    portENTER_CRITICAL(&liveMux);
+    std::shared_ptr<const String> snap = solarJson;
+    portEXIT_CRITICAL(&liveMux);
+    if (snap)
+      client->send(snap->c_str(), "solar", 0, 5000); });
+  DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*"); // dashboards live on other hosts
+  server.addHandler(&liveEvents);
+  server.begin();
+  Serial.printf("📡 Live feed at http://%s/events\n", WiFi.localIP().toString().c_str());
+}
+
+// Only loop() touches these, so no locking
+TouchEvent touchQueue[TOUCH_QUEUE_SIZE];
+uint8_t touchHead = 0, touchCount = 0;
+bool touchPressed = false; // debounced state
+uint8_t touchDisagree = 0; // polls in a row that contradict touchPressed
+uint16_t touchX = 0, touchY = 0;
+uint32_t lastTouchPoll = 0; // micros()
+
+// Position filter over the raw readings of one press: the median of the last
+// TOUCH_MEDIAN drops spikes, then an IIR with a gain of 1/2 smooths the jitter left
+#define TOUCH_MEDIAN 5
+uint16_t touchWinX[TOUCH_MEDIAN], touchWinY[TOUCH_MEDIAN];
+uint8_t touchWinLen = 0, touchWinPos = 0;
+uint16_t touchFiltX, touchFiltY;
+
+uint16_t touchMedian(const uint16_t *window, uint8_t n)
+{
+  uint16_t v[TOUCH_MEDIAN];
+  std::copy(window, window + n, v);
+  std::nth_element(v, v + n / 2, v + n);
+  return v[n / 2];
+}
+
+void filterTouchSample(uint16_t &x, uint16_t &y)
+{
+  touchWinX[touchWinPos] = x;
+  touchWinY[touchWinPos] = y;
+  touchWinPos = (touchWinPos + 1) % TOUCH_MEDIAN;
+  if (touchWinLen < TOUCH_MEDIAN)
+    touchWinLen++;
+  if (touchWinLen == 1)
+  {
+    touchFiltX = x;
+    touchFiltY = y;
+  }
+  else
+  {
+    touchFiltX = (touchFiltX + touchMedian(touchWinX, touchWinLen) + 1) / 2;
+    touchFiltY = (touchFiltY + touchMedian(touchWinY, touchWinLen) + 1) / 2;
+  }
+  x = touchFiltX;
+  y = touchFiltY;
+}
+
+// The matrix taking three raw readings to the targets they were taken at, false if
+// the readings are too close together or the matrix does not fit Q16
+bool fitTouchAffine(const uint16_t raw[3][2], const int16_t screen[3][2], TouchAffine &m)
+{
+  // Cramer's rule, once per calibration, so floating point is fine here
+  double x0 = raw[0][0], y0 = raw[0][1], x1 = raw[1][0], y1 = raw[1][1], x2 = raw[2][0], y2 = raw[2][1];
+  double det = (x0 - x2) * (y1 - y2) - (x1 - x2) * (y0 - y2);
+  if (fabs(det) < 10000)
+    return false; // the points are too close together or in a line
+  int32_t *row[2] = {&m.a, &m.d};
+  for (int k = 0; k < 2; k++)
+  {
+    double s0 = screen[0][k], s1 = screen[1][k], s2 = screen[2][k];
+    double p = ((s0 - s2) * (y1 - y2) - (s1 - s2) * (y0 - y2)) / det;
+    double q = ((x0 - x2) * (s1 - s2) - (x1 - x2) * (s0 - s2)) / det;
+    double c = s2 - p * x2 - q * y2;
+    if (fabs(p) >= 32768 || fabs(q) >= 32768 || fabs(c) >= 32768)
+      return false;
+    row[k][0] = lround(p * 65536);
+    row[k][1] = lround(q * 65536);
+    row[k][2] = lround(c * 65536);
+  }
+  return true;
+}
+
+void applyTouchAffine(const TouchAffine &m, uint16_t rawX, uint16_t rawY, int32_t &x, int32_t &y)
+{
+  x = ((int64_t)m.a * rawX + (int64_t)m.b * rawY + m.c + 0x8000) >> 16;
+  y = ((int64_t)m.d * rawX + (int64_t)m.e * rawY + m.f + 0x8000) >> 16;
+}
+
+// Raw reading to screen coordinates in place, false if it lands off the screen
+bool touchToScreen(uint16_t &x, uint16_t &y)
+{
+  int32_t sx, sy;
+  applyTouchAffine(touchAffine, x, y, sx, sy);
+  if (sx < 0 || sy < 0 || sx >= tft.width() || sy >= tft.height())
+    return false;
+  x = sx;
+  y = sy;
+  return true;
+}
+
+// Stored calibration, or false with the library default mapping fitted instead
+bool loadTouchCalibration()
+{
+  TouchAffine m;
+  prefs.begin("touch", true);
+  bool ok = prefs.getBytesLength("affine") == sizeof(m) && prefs.getBytes("affine", &m, sizeof(m)) == sizeof(m);
+  prefs.end();
+  if (ok && m.rotation != tft.getRotation())
+  {
+    if ((m.rotation ^ tft.getRotation()) == 2)
+    { // half a turn turns x into width - 1 - x and y into height - 1 - y
+      m.a = -m.a, m.b = -m.b, m.c = ((int32_t)(tft.width() - 1) << 16) - m.c;
+      m.d = -m.d, m.e = -m.e, m.f = ((int32_t)(tft.height() - 1) << 16) - m.f;
+      m.rotation = tft.getRotation();
+    }
+    else
+      ok = false; // which way a quarter turn goes depends on the panel driver
+  }
+  if (ok)
+  {
+    touchAffine = m;
+    return true;
+  }
+  uint16_t raw[3][2] = {{300, 300}, {3600, 300}, {300, 3600}};
+  int16_t screen[3][2];
+  for (int i = 0; i < 3; i++)
+  {
+    uint16_t x = raw[i][0], y = raw[i][1];
+    tft.convertRawXY(&x, &y);
+    screen[i][0] = (int16_t)x;
+    screen[i][1] = (int16_t)y;
+  }
+  fitTouchAffine(raw, screen, touchAffine);
+  touchAffine.rotation = tft.getRotation();
+  return false;
+}
+
+void pushTouchEvent(TouchEventType type, uint32_t ms)
+{
+  if (touchCount && type == TOUCH_MOVE)
+  {
+    // a newer position replaces a move the UI has not read yet
+    TouchEvent &last = touchQueue[(touchHead + touchCount - 1) % TOUCH_QUEUE_SIZE];
+    if (last.type == TOUCH_MOVE)
+    {
+      last = {type, touchX, touchY, ms};
+      return;
+    }
+  }
+  if (touchCount == TOUCH_QUEUE_SIZE)
+  {
+    // nobody is reading, the oldest event is the least useful
+    touchHead = (touchHead + 1) % TOUCH_QUEUE_SIZE;
+    touchCount--;
+  }
+  touchQueue[(touchHead + touchCount) % TOUCH_QUEUE_SIZE] = {type, touchX, touchY, ms};
+  touchCount++;
+}
+
+bool readTouchEvent(TouchEvent &event)
+{
+  if (!touchCount)
+    return false;
+  event = touchQueue[touchHead];
+  touchHead = (touchHead + 1) % TOUCH_QUEUE_SIZE;
+  touchCount--;
+  return true;
+}
+
+void serviceTouch()
+{
+  // the touch job runs every TOUCH_POLL_MS give or take the 1 ms tick it sleeps in,
+  // this only holds back callers that spin
+  if (micros() - lastTouchPoll < (TOUCH_POLL_MS - 1) * 1000UL)
+    return;
+  lastTouchPoll = micros();
+  uint32_t now = millis();
+#ifdef TOUCH_IRQ
+  // PENIRQ is low while the panel is pressed
+  if (!touchPressed && !touchDisagree && digitalRead(TOUCH_IRQ) == HIGH)
+    return;
+#endif
+
+  uint16_t x = 0, y = 0;
+  bool down = touchPressed || tft.getTouchRawZ() > TOUCH_Z_PRESS;
+  // the burst converts the pressure after the position: positions read while the
+  // finger lifts are garbage, as in validTouch()
+  if (down)
+    down = tft.getTouchRawBurst(&x, &y, TOUCH_BURST) > TOUCH_Z_RELEASE;
+  if (down)
+  {
+    filterTouchSample(x, y);
+    if (!touchToScreen(x, y))
+    {
+      // pressure decides when a press ends, a stray position only does not move it
+      if (!touchPressed)
+        down = false;
+      x = touchX;
+      y = touchY;
+    }
+  }
+
+  if (down != touchPressed)
+  {
+    if (++touchDisagree < TOUCH_DEBOUNCE)
+      return;
+    touchDisagree = 0;
+    touchPressed = down;
+    if (down)
+    {
+      touchX = x;
+      touchY = y;
+    }
+    else
+      touchWinLen = touchWinPos = 0;
+    pushTouchEvent(down ? TOUCH_DOWN : TOUCH_UP, now);
+    return;
+  }
+  touchDisagree = 0;
+  if (!down)
+    touchWinLen = touchWinPos = 0; // a bounce that never became a press
+  if (down && (abs(x - touchX) >= TOUCH_MOVE_PX || abs(y - touchY) >= TOUCH_MOVE_PX))
+  {
+    touchX = x;
+    touchY = y;
+    pushTouchEvent(TOUCH_MOVE, now);
+  }
+}
+
+// Gesture state, fed only from readGesture()
+Gesture gestureQueue[GESTURE_QUEUE_SIZE];
+uint8_t gestureHead = 0, gestureCount = 0;
+TouchEvent gestureDown;       // the press being followed
+bool gesturePressed = false;  // between its TOUCH_DOWN and TOUCH_UP
+bool gestureMoved = false;    // left the tap slop, so no tap or long press
+bool gestureLong = false;     // long press already reported
+bool tapPending = false;      // a tap waiting for a possible second one
+TouchEvent pendingTap;        // its TOUCH_DOWN
+uint32_t pendingTapUp = 0;    // millis() of its TOUCH_UP
+
+void pushGesture(GestureType type, const TouchEvent &from, uint32_t until)
+{
+  if (gestureCount == GESTURE_QUEUE_SIZE)
+  {
+    gestureHead = (gestureHead + 1) % GESTURE_QUEUE_SIZE;
+    gestureCount--;
+  }
+  gestureQueue[(gestureHead + gestureCount) % GESTURE_QUEUE_SIZE] = {type, from.x, from.y, from.ms, until - from.ms};
+  gestureCount++;
+}
+
+bool nearPress(const TouchEvent &a, const TouchEvent &b, int slop)
+{
+  return abs(a.x - b.x) <= slop && abs(a.y - b.y) <= slop;
+}
+
+// Reports a held back tap before anything that happens after it
+void flushPendingTap()
+{
+  if (!tapPending)
+    return;
+  tapPending = false;
+  pushGesture(GESTURE_TAP, pendingTap, pendingTapUp);
+}
+
+void recognizeGesture(const TouchEvent &event)
+{
+  switch (event.type)
+  {
+  case TOUCH_DOWN:
+    if (tapPending && event.ms - pendingTapUp > GESTURE_DOUBLE_TAP_MS)
+      flushPendingTap();
+    gestureDown = event;
+    gesturePressed = true;
+    gestureMoved = gestureLong = false;
+    break;
+
+  case TOUCH_MOVE:
+    if (!nearPress(event, gestureDown, GESTURE_TAP_SLOP_PX))
+      gestureMoved = true;
+    break;
+
+  case TOUCH_UP:
+  {
+    gesturePressed = false;
+    if (gestureLong)
+      break;
+    int dx = event.x - gestureDown.x, dy = event.y - gestureDown.y;
+    if (abs(dx) >= GESTURE_SWIPE_MIN_PX && abs(dx) > 2 * abs(dy) && event.ms - gestureDown.ms <= GESTURE_SWIPE_MAX_MS)
+    {
+      flushPendingTap();
+      pushGesture(dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT, gestureDown, event.ms);
+      break;
+    }
+    if (gestureMoved || !nearPress(event, gestureDown, GESTURE_TAP_SLOP_PX))
+    {
+      flushPendingTap();
+      break;
+    }
+    if (tapPending && nearPress(gestureDown, pendingTap, 2 * GESTURE_TAP_SLOP_PX))
+    {
+      tapPending = false;
+      pushGesture(GESTURE_DOUBLE_TAP, pendingTap, event.ms);
+      break;
+    }
+    flushPendingTap();
+    tapPending = true;
+    pendingTap = gestureDown;
+    pendingTapUp = event.ms;
+    break;
+  }
+  }
+}
+
+// Polls the touch controller and returns the next gesture, if any. Never blocks.
+bool readGesture(Gesture &gesture)
+{
+  serviceTouch();
+  TouchEvent event;
+  while (gestureCount == 0 && readTouchEvent(event))
+    recognizeGesture(event);
+
+  uint32_t now = millis();
+  if (gesturePressed && !gestureMoved && !gestureLong && now - gestureDown.ms >= GESTURE_LONG_PRESS_MS)
+  {
+    flushPendingTap();
+    gestureLong = true;
+    pushGesture(GESTURE_LONG_PRESS, gestureDown, now);
+  }
+  if (tapPending && !gesturePressed && now - pendingTapUp > GESTURE_DOUBLE_TAP_MS)
+    flushPendingTap();
+
+  if (gestureCount == 0)
+    return false;
+  gesture = gestureQueue[gestureHead];
+  gestureHead = (gestureHead + 1) % GESTURE_QUEUE_SIZE;
+  gestureCount--;
+  return true;
+}
+
+// Scheduler state, only loop() and the jobs it runs touch it
+SchedJob schedJobs[SCHED_MAX_JOBS];
+uint8_t schedJobCount = 0;
+int8_t schedWheel[SCHED_SLOTS];
+uint32_t schedLast = 0; // when the wheel was last walked
+int8_t schedRunning = -1;
+bool schedRearm = false; // the running job was not cancelled or moved while it ran
+uint32_t schedBusy = 0;   // us spent in schedRun() in the current duty window
+uint32_t schedWindow = 0; // when that window started
+uint16_t schedDutyLast = 0;
+
+void schedLink(int8_t id)
+{
+  SchedJob &job = schedJobs[id];
+  uint8_t slot = (job.due / SCHED_TICK_US) % SCHED_SLOTS;
+  job.next = schedWheel[slot];
+  schedWheel[slot] = id;
+  job.armed = true;
+}
+
+void schedUnlink(int8_t id)
+{
+  SchedJob &job = schedJobs[id];
+  if (!job.armed)
+    return;
+  int8_t *link = &schedWheel[(job.due / SCHED_TICK_US) % SCHED_SLOTS];
+  while (*link != id)
+    link = &schedJobs[*link].next;
+  *link = job.next;
+  job.armed = false;
+}
+
+// Periodic job (periodMs > 0) or one-shot, first due in firstMs; -1 if the table is full
+int8_t schedAdd(const char *name, void (*run)(), uint32_t periodMs, uint32_t firstMs)
+{
+  if (schedJobCount == 0)
+  {
+    memset(schedWheel, -1, sizeof(schedWheel));
+    schedLast = schedWindow = micros();
+  }
+  if (schedJobCount == SCHED_MAX_JOBS)
+    return -1;
+  int8_t id = schedJobCount++;
+  schedJobs[id] = {};
+  schedJobs[id].name = name;
+  schedJobs[id].run = run;
+  schedJobs[id].period = periodMs * 1000;
+  schedAt(id, firstMs);
+  return id;
+}
+
+// (Re)arms a job to run in inMs, a periodic one keeps its period from there
+void schedAt(int8_t id, uint32_t inMs)
+{
+  schedAtUs(id, inMs * 1000);
+}
+
+void schedAtUs(int8_t id, uint32_t inUs)
+{
+  if (id < 0)
+    return;
+  schedCancel(id);
+  schedJobs[id].due = micros() + inUs;
+  schedJobs[id].regular = false;
+  schedLink(id);
+}
+
+void schedCancel(int8_t id)
+{
+  if (id < 0)
+    return;
+  schedUnlink(id);
+  schedJobs[id].pending = false;
+  if (id == schedRunning)
+    schedRearm = false;
+}
+
+// For a periodic job, from its next deadline on
+void schedPeriod(int8_t id, uint32_t periodMs)
+{
+  if (id >= 0)
+    schedJobs[id].period = periodMs * 1000;
+}
+
+// Runs what is due, earliest deadline first. Returns the us to the next deadline.
+uint32_t schedRun()
+{
+  uint32_t now = micros(), passStart = now;
+  int8_t ready[SCHED_MAX_JOBS];
+  uint8_t count = 0;
+
+  // the slots of every tick since the last walk, or all of them after a full turn
+  // or when micros() wrapped (the slot numbering is not continuous there)
+  uint32_t ticks = now / SCHED_TICK_US - schedLast / SCHED_TICK_US;
+  if (now < schedLast || ticks >= SCHED_SLOTS)
+    ticks = SCHED_SLOTS - 1;
+  for (uint32_t t = 0; t <= ticks; t++)
+  {
+    int8_t *link = &schedWheel[(now / SCHED_TICK_US - t) % SCHED_SLOTS];
+    while (*link >= 0)
+    {
+      SchedJob &job = schedJobs[*link];
+      if ((int32_t)(now - job.due) >= 0)
+      {
+        ready[count++] = *link;
+        *link = job.next;
+        job.armed = false;
+        job.pending = true;
+      }
+      else
+        link = &job.next;
+    }
+  }
+  schedLast = now;
+  std::sort(ready, ready + count, [](int8_t a, int8_t b)
+            { return (int32_t)(schedJobs[a].due - schedJobs[b].due) < 0; });
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    SchedJob &job = schedJobs[ready[i]];
+    if (!job.pending)
+      continue; // cancelled or moved by a job that ran before it
+    job.pending = false;
+    uint32_t start = micros();
+    uint32_t latency = start - job.due;
+    job.latencyTotal += latency;
+    job.latencyMax = std::max(job.latencyMax, latency);
+    if (job.regular)
+    {
+      uint32_t jitter = abs((int32_t)(start - job.lastStart - job.period));
+      job.intervals++;
+      job.jitterTotal += jitter;
+      job.jitterMax = std::max(job.jitterMax, jitter);
+    }
+    job.lastStart = start;
+
+    schedRunning = ready[i];
+    schedRearm = true;
+    job.run();
+    schedRunning = -1;
+
+    uint32_t end = micros();
+    job.runs++;
+    job.runTotal += end - start;
+    job.runMax = std::max(job.runMax, end - start);
+    if (schedRearm && !job.armed && job.period)
+    {
+      // same phase as before; deadlines that went by during a long run are skipped
+      job.due += job.period;
+      job.regular = true;
+      while ((int32_t)(end - job.due) >= 0)
+      {
+        job.due += job.period;
+        job.missed++;
+        job.regular = false;
+      }
+      schedLink(ready[i]);
+    }
+  }
+
+  now = micros();
+  schedBusy += now - passStart;
+  if (now - schedWindow >= DUTY_WINDOW_MS * 1000UL)
+  {
+    schedDutyLast = (uint64_t)schedBusy * 1000 / (now - schedWindow);
+    schedBusy = 0;
+    schedWindow = now;
+  }
+
+  uint32_t idle = UINT32_MAX;
+  for (uint8_t id = 0; id < schedJobCount; id++)
+    if (schedJobs[id].armed)
+      idle = std::min(idle, (int32_t)(schedJobs[id].due - now) > 0 ? schedJobs[id].due - now : 0);
+  return idle;
+}
+
+// Share of the last duty window loop() spent running jobs, in permille; the rest the
+// CPU idled (or slept) apart from the network tasks
+uint16_t schedDuty()
+{
+  return schedDutyLast;
+}
+
+void schedReport()
+{
+  Serial.printf("⏱️ loop duty %u.%u%% over the last %lu s\n", schedDuty() / 10, schedDuty() % 10, (unsigned long)(DUTY_WINDOW_MS / 1000));
+  Serial.println("⏱️ job        runs missed   run avg/max us   latency avg/max us  jitter avg/max us");
+  for (uint8_t id = 0; id < schedJobCount; id++)
+  {
+    SchedJob &job = schedJobs[id];
+    uint32_t runs = job.runs ? job.runs : 1, intervals = job.intervals ? job.intervals : 1;
+    Serial.printf("   %-10s %6lu %6lu %8lu/%-8lu %8lu/%-8lu %8lu/%-8lu\n", job.name, (unsigned long)job.runs, (unsigned long)job.missed,
+                  (unsigned long)(job.runTotal / runs), (unsigned long)job.runMax,
+                  (unsigned long)(job.latencyTotal / runs), (unsigned long)job.latencyMax,
+                  (unsigned long)(job.jitterTotal / intervals), (unsigned long)job.jitterMax);
+  }
+}
+
+// Only the jobs touch these
+bool backlightDimmed = false;
+uint32_t backlightWokeMs = 0; // gestures of the press that woke the screen are dropped
+time_t clockShown = 0;        // second on the display
+uint32_t clockSkipped = 0, clockEarly = 0, clockSteps = 0;
+uint32_t clockHist[CLOCK_HIST_BINS];
+ClockText clockText = {0, 0, 0, "", ""};
+NtpState ntp;
+WiFiUDP ntpUdp;
+
+void drawCurrentPage()
+{
+  switch (currentPage)
+  {
+  case 0:
+    UTClastTimeStr = "        ";
+    LOCALlastTimeStr = "        ";
+    drawSolarSummaryPage0();
+    break;
+  case 1:
+    drawSolarSummaryPage1();
+    break;
+  case 2:
+    drawSolarSummaryPage2();
+    break;
+  case 3:
+    drawSolarSummaryPage3();
+    break;
+  case 4:
+    drawSolarSummaryPage4();
+    break;
+  }
+}
+
+// Touch navigation: tap or swipe left for the next page, swipe right to go back,
+// double tap for the first page, long press to refresh the solar data now. A touch
+// on a dimmed screen only brings the backlight back.
+void touchJob()
+{
+  Gesture gesture;
+  while (readGesture(gesture))
+  {
+    if ((int32_t)(gesture.ms - backlightWokeMs) <= 0)
+      continue;
+    if (gesture.type == GESTURE_LONG_PRESS)
+    {
+      schedAt(jobSolar, 0);
+      continue;
+    }
+    if (gesture.type == GESTURE_SWIPE_RIGHT)
+      currentPage = (currentPage + 4) % 5;
+    else if (gesture.type == GESTURE_DOUBLE_TAP)
+      currentPage = 0;
+    else
+      currentPage = (currentPage + 1) % 5;
+    drawCurrentPage();
+  }
+  if (touchPressed)
+  {
+    if (backlightDimmed)
+    {
+      setBacklight(BACKLIGHT_FULL);
+      backlightDimmed = false;
+      backlightWokeMs = millis();
+    }
+    schedAt(jobBacklight, BACKLIGHT_DIM_MS);
+  }
+
+  // full rate only while a press, a bounce or a tap that may get a second one is on
+  bool busy = touchPressed || touchDisagree || gesturePressed || tapPending;
+#ifdef TOUCH_IRQ
+  if (!busy)
+  {
+    schedCancel(jobTouch);
+    armTouchIrq();
+  }
+#else
+  schedPeriod(jobTouch, busy ? TOUCH_POLL_MS : TOUCH_IDLE_POLL_MS);
+#endif
+}
+
+// Days since 1970-01-01 of a date in the proleptic Gregorian calendar
+int32_t daysFromCivil(int32_t year, uint8_t month, uint8_t day)
+{
+  year -= month <= 2;
+  int32_t era = (year >= 0 ? year : year - 399) / 400;
+  uint32_t yearOfEra = year - era * 400;
+  uint32_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // from March 1st
+  return era * 146097 + int32_t(yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear) - 719468;
+}
+
+// A name is three or more letters, or anything up to '>' in <>
+const char *tzName(const char *p)
+{
+  if (*p == '<')
+  {
+    const char *end = strchr(p, '>');
+    return end ? end + 1 : nullptr;
+  }
+  const char *q = p;
+  while (isalpha((unsigned char)*q))
+    q++;
+  return q - p >= 3 ? q : nullptr;
+}
+
+// [+-]hh[:mm[:ss]] in seconds
+const char *tzTime(const char *p, int32_t &secs)
+{
+  int32_t sign = *p == '-' ? -1 : 1;
+  if (*p == '+' || *p == '-')
+    p++;
+  secs = 0;
+  for (int32_t unit = 3600; unit; unit /= 60)
+  {
+    if (!isdigit((unsigned char)*p))
+      return nullptr;
+    int32_t part = 0;
+    for (uint8_t digits = 0; isdigit((unsigned char)*p) && digits < 3; digits++)
+      part = part * 10 + (*p++ - '0');
+    secs += part * unit;
+    if (*p != ':' || unit == 1)
+      break;
+    p++;
+  }
+  secs *= sign;
+  return p;
+}
+
+const char *tzNumber(const char *p, uint16_t &n, uint16_t lo, uint16_t hi)
+{
+  if (!isdigit((unsigned char)*p))
+    return nullptr;
+  n = 0;
+  for (uint8_t digits = 0; isdigit((unsigned char)*p) && digits < 3; digits++)
+    n = n * 10 + (*p++ - '0');
+  return n >= lo && n <= hi ? p : nullptr;
+}
+
+// Mm.w.d, Jn or n, then an optional /time (02:00 without)
+const char *tzChangeOf(const char *p, TzChange &change)
+{
+  uint16_t month, week, weekday;
+  change = {'D', 0, 0, 0, 0, 7200};
+  if (*p == 'M')
+  {
+    change.form = 'M';
+    if (!(p = tzNumber(p + 1, month, 1, 12)) || *p != '.' || !(p = tzNumber(p + 1, week, 1, 5)) || *p != '.' ||
+        !(p = tzNumber(p + 1, weekday, 0, 6)))
+      return nullptr;
+    change.month = month;
+    change.week = week;
+    change.weekday = weekday;
+  }
+  else if (*p == 'J')
+  {
+    change.form = 'J';
+    if (!(p = tzNumber(p + 1, change.day, 1, 365)))
+      return nullptr;
+  }
+  else if (!(p = tzNumber(p, change.day, 0, 365)))
+    return nullptr;
+  if (*p == '/')
+    p = tzTime(p + 1, change.at);
+  return p;
+}
+
+// std offset [dst [offset] ,start[/time] ,end[/time]]; POSIX counts offsets west of UTC
+bool parseTzRule(const char *tz, TzRule &rule)
+{
+  int32_t secs;
+  const char *p = tzName(tz);
+  if (!p || !(p = tzTime(p, secs)))
+    return false;
+  rule = {-secs, -secs + 3600, false, {}, {}};
+  if (!*p)
+    return true;
+  if (!(p = tzName(p)))
+    return false;
+  if (*p && *p != ',')
+  {
+    if (!(p = tzTime(p, secs)))
+      return false;
+    rule.dstOffset = -secs;
+  }
+  if (*p != ',' || !(p = tzChangeOf(p + 1, rule.start)) || *p != ',' || !(p = tzChangeOf(p + 1, rule.end)) || *p)
+    return false;
+  rule.hasDst = true;
+  return true;
+}
+
+// Day since the epoch of a change in a year
+int32_t tzChangeDay(int32_t year, const TzChange &change)
+{
+  int32_t jan1 = daysFromCivil(year, 1, 1);
+  if (change.form == 'D')
+    return jan1 + change.day;
+  if (change.form == 'J')
+  {
+    bool leap = daysFromCivil(year, 3, 1) - daysFromCivil(year, 2, 28) == 2;
+    return jan1 + change.day - 1 + (leap && change.day >= 60);
+  }
+  int32_t first = daysFromCivil(year, change.month, 1);
+  int32_t next = change.month == 12 ? daysFromCivil(year + 1, 1, 1) : daysFromCivil(year, change.month + 1, 1);
+  int32_t day = first + (change.weekday - (first % 7 + 11) % 7 + 7) % 7 + (change.week - 1) * 7; // 1970-01-01 was a Thursday
+  while (day >= next) // week 5 is the last one
+    day -= 7;
+  return day;
+}
+
+// Offset of the local time at now, and until when it holds. The changes of the years
+// either side are looked at too, so a change around New Year's Eve or a rule with
+// the summer over New Year (southern hemisphere) needs nothing special.
+int32_t tzOffsetAt(time_t now, time_t &until)
+{
+  until = std::numeric_limits<time_t>::max();
+  if (!tzRule.hasDst)
+    return tzRule.stdOffset;
+  struct tm utc;
+  gmtime_r(&now, &utc);
+  time_t passed = std::numeric_limits<time_t>::min();
+  int32_t offset = tzRule.stdOffset;
+  for (int32_t year = utc.tm_year + 1899; year <= utc.tm_year + 1901; year++)
+    for (bool toDst : {true, false})
+    {
+      const TzChange &change = toDst ? tzRule.start : tzRule.end;
+      time_t at = (time_t)tzChangeDay(year, change) * 86400 + change.at - (toDst ? tzRule.stdOffset : tzRule.dstOffset);
+      if (at <= now && at > passed)
+      {
+        passed = at;
+        offset = toDst ? tzRule.dstOffset : tzRule.stdOffset;
+      }
+      else if (at > now && at < until)
+        until = at;
+    }
+  return offset;
+}
+
+void writeDigits(char *text, time_t t)
+{
+  int32_t secs = t % 86400;
+  if (secs < 0)
+    secs += 86400;
+  snprintf(text, 9, "%02ld:%02ld:%02ld", (long)(secs / 3600), (long)(secs / 60 % 60), (long)(secs % 60));
+}
+
+// HH:MM:SS one second on, carrying from the right
+void tickDigits(char *text)
+{
+  static const char top[8] = {'2', '9', ':', '5', '9', ':', '5', '9'};
+  for (int8_t i = 7; i >= 0; i--)
+  {
+    if (text[i] == ':')
+      continue;
+    if (text[i] < top[i])
+    {
+      text[i]++;
+      break;
+    }
+    text[i] = '0';
+  }
+  if (text[0] == '2' && text[1] == '4')
+    text[0] = text[1] = '0';
+}
+
+// Both clocks in clockText for now: the digits are stepped when now is the second after
+// the last one and the offset still holds, else written out after a new lookup
+void formatClock(time_t now)
+{
+  ClockText &text = clockText;
+  if (now == text.shown + 1 && now < text.until)
+  {
+    tickDigits(text.utcDigits);
+    tickDigits(text.localDigits);
+  }
+  else
+  {
+    text.offset = tzOffsetAt(now, text.until);
+    writeDigits(text.utcDigits, now);
+    writeDigits(text.localDigits, now + text.offset);
+  }
+  text.shown = now;
+}
+
+void clockJob()
+{
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  time_t now = tv.tv_sec;
+  if (now == clockShown)
+  {
+    clockEarly++;
+    schedAtUs(jobClock, 1000000 - tv.tv_usec);
+    return;
+  }
+  if (clockShown && now - clockShown > 1 && now - clockShown <= CLOCK_STEP_S)
+  {
+    clockSkipped += now - clockShown - 1;
+    Serial.printf("⏰ Clock skipped %ld s\n", (long)(now - clockShown - 1));
+  }
+  else if (clockShown && now - clockShown != 1)
+    clockSteps++;
+  clockShown = now;
+  formatClock(now);
+  publishLiveStatus(clockText.utcDigits, clockText.localDigits);
+
+  if (currentPage == 0)
+  {
+    drawLOCALTime(String(clockText.localDigits), 30, 205, LOCALdigitColor, TFT_BLACK, blinkingDot);
+    drawUTCTime(String(clockText.utcDigits), 30 + 160, 205, UTCdigitColor, TFT_BLACK, blinkingDot);
+  }
+
+  gettimeofday(&tv, nullptr);
+  int64_t late = (int64_t)(tv.tv_sec - now) * 1000000 + tv.tv_usec;
+  uint8_t bin = 0;
+  while (bin < CLOCK_HIST_BINS - 1 && late >= clockHistMs[bin] * 1000LL)
+    bin++;
+  clockHist[bin]++;
+  // the next boundary, at once if the drawing took us past it
+  schedAtUs(jobClock, late < 1000000 ? 1000000 - tv.tv_usec : 0);
+}
+
+void clockReport()
+{
+  Serial.printf("⏰ clock: %lu skipped, %lu early wake-ups, %lu time steps; drawn within ms:", (unsigned long)clockSkipped,
+                (unsigned long)clockEarly, (unsigned long)clockSteps);
+  for (uint8_t bin = 0; bin < CLOCK_HIST_BINS; bin++)
+  {
+    if (bin < CLOCK_HIST_BINS - 1)
+      Serial.printf(" <%u:%lu", clockHistMs[bin], (unsigned long)clockHist[bin]);
+    else
+      Serial.printf(" more:%lu", (unsigned long)clockHist[bin]);
+  }
+  Serial.println();
+}
+
+void statsJob()
+{
+  schedReport();
+  clockReport();
+  ntpReport();
+  wifiReport();
+  qrCacheReport();
+}
+
+int64_t systemUs()
+{
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+void setSystemUs(int64_t us)
+{
+  struct timeval tv = {time_t(us / 1000000), suseconds_t(us % 1000000)};
+  settimeofday(&tv, nullptr);
+}
+
+// NTP timestamps are big-endian seconds since 1900 and 2^-32 fractions; from 2036 the
+// seconds wrap, so those with the top bit clear are taken to be in the next era
+int64_t ntpToUs(const uint8_t *p)
+{
+  uint32_t secs = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+  uint32_t frac = (uint32_t)p[4] << 24 | (uint32_t)p[5] << 16 | (uint32_t)p[6] << 8 | p[7];
+  int64_t era = secs & 0x80000000 ? 0 : 1LL << 32;
+  return (era + secs - NTP_UNIX_EPOCH) * 1000000 + (int64_t)(((uint64_t)frac * 1000000) >> 32);
+}
+
+void usToNtp(int64_t us, uint8_t *p)
+{
+  uint32_t secs = uint32_t(us / 1000000 + NTP_UNIX_EPOCH);
+  uint32_t frac = uint32_t(((uint64_t)(us % 1000000) << 32) / 1000000);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    p[i] = secs >> (24 - 8 * i);
+    p[4 + i] = frac >> (24 - 8 * i);
+  }
+}
+
+// Offset of the server's time from ours and the round trip, from an answer received at
+// receivedUs; false when it is not a usable answer to the request last sent
+bool ntpEvaluate(const uint8_t *packet, int len, int64_t receivedUs, int64_t &offsetUs, int64_t &delayUs)
+{
+  if (len < 48 || (packet[0] & 7) != 4 || packet[0] >> 6 == 3 || packet[1] == 0 || packet[1] > 15 ||
+      memcmp(packet + 24, ntp.sent, 8) != 0)
+    return false; // not a server, not synchronised, a kiss-o'-death or not our request
+  int64_t t0 = ntp.sentUs, t1 = ntpToUs(packet + 32), t2 = ntpToUs(packet + 40), t3 = receivedUs;
+  offsetUs = ((t1 - t0) + (t2 - t3)) / 2;
+  delayUs = (t3 - t0) - (t2 - t1);
+  return delayUs >= 0 && delayUs <= NTP_DELAY_MAX_MS * 1000LL;
+}
+
+// The time survives reboots in flash, so it is roughly right before NTP answers
+void saveTime(bool now)
+{
+  time_t t = time(nullptr);
+  if (t < TIME_VALID_S || (!now && t - ntp.savedAt < TIME_SAVE_S))
+    return;
+  prefs.begin("time", false);
+  prefs.putLong64("lastTime", t);
+  prefs.end();
+  ntp.savedAt = t;
+}
+
+void ntpApply(int64_t offsetUs, int64_t delayUs, uint8_t stratum)
+{
+  bool first = timeSource != TIME_NTP;
+  bool step = offsetUs > NTP_STEP_MS * 1000LL || offsetUs < -NTP_STEP_MS * 1000LL;
+  if (step)
+  {
+    setSystemUs(systemUs() + offsetUs);
+    ntp.steps++;
+  }
+  else
+  {
+    struct timeval delta = {time_t(offsetUs / 1000000), suseconds_t(offsetUs % 1000000)};
+    adjtime(&delta, nullptr);
+  }
+  timeSource = TIME_NTP;
+  ntp.syncs++;
+  ntp.offsetUs = offsetUs;
+  ntp.delayUs = delayUs;
+  ntp.stratum = stratum;
+  ntp.syncedMs = millis();
+  ntp.retryMs = NTP_RETRY_MS;
+  Serial.printf("🕓 NTP from %s: %s %+lld ms, round trip %lld ms, stratum %u\n", ntpServers[ntp.server], step ? "stepped" : "slewing",
+                (long long)(offsetUs / 1000), (long long)(delayUs / 1000), stratum);
+  saveTime(step);
+  if (first) // the phone time of an older setup gives the offset now
+    loadTimeZone();
+}
+
+// Sends a request, then polls for the answer until NTP_WAIT_MS; the DNS lookup of a
+// server blocks, but only happens again after it stopped answering
+void ntpJob()
+{
+  if (!ntp.waiting)
+  {
+    saveTime(false);
+    if (WiFi.status() != WL_CONNECTED)
+    {
+      schedAt(jobNtp, NTP_RETRY_MS);
+      return;
+    }
+    if (uint32_t(ntp.address) == 0 && !WiFi.hostByName(ntpServers[ntp.server], ntp.address))
+    {
+      ntp.address = IPAddress();
+      ntp.server = (ntp.server + 1) % (sizeof(ntpServers) / sizeof(ntpServers[0]));
+      schedAt(jobNtp, NTP_RETRY_MS);
+      return;
+    }
+    uint8_t packet[48] = {0x23}; // version 4, client
+    ntp.sentUs = systemUs();
+    usToNtp(ntp.sentUs, packet + 40);
+    memcpy(ntp.sent, packet + 40, 8);
+    ntpUdp.beginPacket(ntp.address, NTP_PORT);
+    ntpUdp.write(packet, sizeof(packet));
+    ntpUdp.endPacket();
+    ntp.sentMs = millis();
+    ntp.waiting = true;
+    schedAt(jobNtp, NTP_LISTEN_MS);
+    return;
+  }
+
+  while (ntpUdp.parsePacket() > 0)
+  {
+    int64_t receivedUs = systemUs(), offsetUs, delayUs;
+    uint8_t packet[48];
+    int len = ntpUdp.read(packet, sizeof(packet));
+    if (!ntpEvaluate(packet, len, receivedUs, offsetUs, delayUs))
+    {
+      ntp.rejected++;
+      continue;
+    }
+    ntp.waiting = false;
+    ntpApply(offsetUs, delayUs, packet[1]);
+    schedAt(jobNtp, NTP_POLL_MS);
+    return;
+  }
+  if (millis() - ntp.sentMs < NTP_WAIT_MS)
+  {
+    schedAt(jobNtp, NTP_LISTEN_MS);
+    return;
+  }
+
+  // no answer: the other server, after a longer wait each time
+  ntp.waiting = false;
+  ntp.timeouts++;
+  Serial.printf("🕓 No NTP answer from %s, next try in %lu s\n", ntpServers[ntp.server], (unsigned long)(ntp.retryMs / 1000));
+  ntp.address = IPAddress();
+  ntp.server = (ntp.server + 1) % (sizeof(ntpServers) / sizeof(ntpServers[0]));
+  schedAt(jobNtp, ntp.retryMs);
+  ntp.retryMs = std::min<uint32_t>(ntp.retryMs * 2, NTP_POLL_MS);
+}
+
+void ntpReport()
+{
+  Serial.printf("🕓 time from %s; NTP %lu syncs (%lu stepped), %lu timeouts, %lu rejected", timeSourceNames[timeSource],
+                (unsigned long)ntp.syncs, (unsigned long)ntp.steps, (unsigned long)ntp.timeouts, (unsigned long)ntp.rejected);
+  if (ntp.syncs)
+    Serial.printf("; last offset %+lld us, round trip %lld us, stratum %u, %lu s ago", (long long)ntp.offsetUs,
+                  (long long)ntp.delayUs, ntp.stratum, (unsigned long)((millis() - ntp.syncedMs) / 1000));
+  Serial.println();
+}
+
+// Sets the system time from what outlives a reboot, until NTP answers
+void startTimeService()
+{
+  if (time(nullptr) >= TIME_VALID_S)
+    timeSource = TIME_RTC; // only the CPU was reset
+  else
+  {
+    prefs.begin("time", true);
+    int64_t saved = prefs.getLong64("lastTime", 0);
+    prefs.end();
+    if (saved >= TIME_VALID_S)
+    {
+      setSystemUs(saved * 1000000);
+      timeSource = TIME_SAVED;
+    }
+  }
+  Serial.printf("🕓 Time from %s until NTP answers\n", timeSourceNames[timeSource]);
+  ntp.retryMs = NTP_RETRY_MS;
+  ntpUdp.begin(NTP_LOCAL_PORT);
+}
+
+// 🌍 The time zone rule from the portal. Older setups only saved the phone time, and
+// the whole-hour offset from it is worked out once NTP gives the UTC time.
+void loadTimeZone()
+{
+  prefs.begin("time", true);
+  timeZone = prefs.getString("tz", "");
+  bool hasSavedOffset = prefs.isKey("UTCoffset");
+  String timeStr = prefs.getString("localTime", "");
+  prefs.end();
+
+  if (!timeZone.isEmpty() && parseTzRule(timeZone.c_str(), tzRule))
   {
-    solarData.bandConditions[bIndex].name = band->Attribute("name");
-    solarData.bandConditions[bIndex].time = band->Attribute("time");
-    solarData.bandConditions[bIndex].condition = band->GetText();
-    band = band->NextSiblingElement("band");
-    bIndex++;
+    Serial.printf("🌍 Time zone %s\n", timeZone.c_str());
+    return;
   }
 
-  // Parse VHF conditions
-  int vIndex = 0;
-  tinyxml2::XMLElement *phen = solardataXML->FirstChildElement("calculatedvhfconditions")->FirstChildElement("phenomenon");
-  while (phen && vIndex < 5)
+  if (hasSavedOffset)
   {
-    solarData.vhfConditions[vIndex].name = phen->Attribute("name");
-    solarData.vhfConditions[vIndex].location = phen->Attribute("location");
-    solarData.vhfConditions[vIndex].condition = phen->GetText();
-    phen = phen->NextSiblingElement("phenomenon");
-    vIndex++;
+    // ✅ Load previously saved offset
+    prefs.begin("time", true);
+    UTCoffset = prefs.getInt("UTCoffset", 2);
+    prefs.end();
+    Serial.printf("✅ Loaded saved UTCoffset: %d\n", UTCoffset);
   }
+  else if (timeStr.length() >= 5 && timeSource == TIME_NTP)
+  {
+    // 🕓 Calculate from phone time
+    time_t now = time(nullptr);
+    struct tm timeinfo;
+    gmtime_r(&now, &timeinfo);
+    int userHour = timeStr.substring(0, 2).toInt();
+    int utcHour = timeinfo.tm_hour;
+    int offset = userHour - utcHour;
 
-  http.end();
+    if (offset < -12)
+      offset += 24;
+    if (offset > 12)
+      offset -= 24;
 
-  // --- Serial Debug Output ---
-  Serial.println("\n=== Solar Data ===");
-  Serial.println("Source: " + solarData.source);
-  Serial.println("Updated: " + solarData.updated);
-  Serial.printf("Solar Flux: %d\n", solarData.solarFlux);
-  Serial.printf("A Index: %d\n", solarData.aIndex);
-  Serial.printf("K Index: %d\n", solarData.kIndex);
-  Serial.println("K Index NT: " + solarData.kIndexNT);
-  Serial.println("X-Ray: " + solarData.xRay);
-  Serial.printf("Sunspots: %d\n", solarData.sunspots);
-  Serial.printf("Helium Line: %.1f\n", solarData.heliumLine);
-  Serial.println("Proton Flux: " + solarData.protonFlux);
-  Serial.println("Electron Flux: " + solarData.electronFlux);
-  Serial.printf("Aurora: %d\n", solarData.aurora);
-  Serial.printf("Normalization: %.2f\n", solarData.normalization);
-  Serial.printf("Lat Degree: %.2f\n", solarData.latDegree);
-  Serial.printf("Solar Wind: %.1f\n", solarData.solarWind);
-  Serial.printf("Magnetic Field: %.1f\n", solarData.magneticField);
-  Serial.println("Geomagnetic Field: " + solarData.geomagneticField);
-  Serial.println("Signal Noise: " + solarData.signalNoise);
-  Serial.println("foF2: " + solarData.fof2);
-  Serial.println("MUF Factor: " + solarData.mufFactor);
-  Serial.println("MUF: " + solarData.muf);
+    UTCoffset = offset;
 
-  Serial.println("--- Band Conditions ---");
-  for (int i = 0; i < 8; i++)
+    prefs.begin("time", false);
+    prefs.putInt("UTCoffset", UTCoffset);
+    prefs.end();
+
+    Serial.printf("📱 Phone time: %s | 🌍 UTC: %02d:%02d\n", timeStr.c_str(), utcHour, timeinfo.tm_min);
+    Serial.printf("🧭 Calculated and saved UTCoffset = %d\n", UTCoffset);
+  }
+  else if (timeStr.length() >= 5)
   {
-    if (solarData.bandConditions[i].name.isEmpty())
-      break;
-    Serial.printf("[%s] %s: %s\n",
-                  solarData.bandConditions[i].time.c_str(),
-                  solarData.bandConditions[i].name.c_str(),
-                  solarData.bandConditions[i].condition.c_str());
+    Serial.println("⏳ Using UTCoffset = 2 until NTP gives the time for the phone time");
+    UTCoffset = 2;
+  }
+  else
+  {
+    Serial.println("⚠️ No phone time found, using default UTCoffset = 2");
+    UTCoffset = 2;
   }
 
-  Serial.println("--- VHF Conditions ---");
-  for (int i = 0; i < 5; i++)
+  // without a rule the offset holds all year
+  char fixed[16];
+  snprintf(fixed, sizeof(fixed), "<%+03d>%d", UTCoffset, -UTCoffset);
+  timeZone = fixed;
+  parseTzRule(fixed, tzRule);
+  Serial.printf("🌍 Time zone %s\n", timeZone.c_str());
+}
+
+// 💡 Update live Wi-Fi signal when on page 4
+void rssiJob()
+{
+  if (currentPage == 4)
+    updateWiFiSignalDisplay();
+}
+
+// Blocks for the HTTP request; the accounting shows how long
+void solarJob()
+{
+  Serial.println("🔄 Refreshing solar data...");
+  fetchSolarData();
+  drawCurrentPage();
+}
+
+void backlightJob()
+{
+  setBacklight(BACKLIGHT_DIM);
+  backlightDimmed = true;
+}
+
+// The PWM runs from the 8 MHz RTC oscillator, which is kept on in light sleep, so
+// the backlight does not go dark each time the chip naps
+void startBacklightPwm()
+{
+  ledc_timer_config_t timer = {};
+  timer.speed_mode = LEDC_LOW_SPEED_MODE;
+  timer.duty_resolution = LEDC_TIMER_8_BIT;
+  timer.timer_num = LEDC_TIMER_0;
+  timer.freq_hz = 5000;
+  timer.clk_cfg = LEDC_USE_RTC8M_CLK;
+  ledc_timer_config(&timer);
+
+  ledc_channel_config_t channel = {};
+  channel.gpio_num = TFT_BLP;
+  channel.speed_mode = LEDC_LOW_SPEED_MODE;
+  channel.channel = BACKLIGHT_CHANNEL;
+  channel.timer_sel = LEDC_TIMER_0;
+  channel.duty = BACKLIGHT_FULL;
+  ledc_channel_config(&channel);
+}
+
+void setBacklight(uint32_t duty)
+{
+  ledc_set_duty(LEDC_LOW_SPEED_MODE, BACKLIGHT_CHANNEL, duty);
+  ledc_update_duty(LEDC_LOW_SPEED_MODE, BACKLIGHT_CHANNEL);
+}
+
+#ifdef TOUCH_IRQ
+// PENIRQ went low: the touch job polls from here until the panel is left alone
+void IRAM_ATTR onTouchIrq()
+{
+  gpio_intr_disable((gpio_num_t)TOUCH_IRQ);
+  touchIrqFired = true;
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(loopTask, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+
+// Level triggered, so a press that is already on fires at once. Also a light sleep
+// wake-up source.
+void armTouchIrq()
+{
+  gpio_wakeup_enable((gpio_num_t)TOUCH_IRQ, GPIO_INTR_LOW_LEVEL);
+  gpio_intr_enable((gpio_num_t)TOUCH_IRQ);
+}
+#endif
+
+void startPowerManagement()
+{
+  WiFi.setSleep(WIFI_PS_MIN_MODEM);
+  esp_sleep_pd_config(ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_ON); // backlight PWM clock
+#ifdef TOUCH_IRQ
+  loopTask = xTaskGetCurrentTaskHandle();
+  attachInterrupt(TOUCH_IRQ, onTouchIrq, ONLOW);
+  esp_sleep_enable_gpio_wakeup();
+  armTouchIrq();
+#endif
+
+  // light sleep needs a firmware built with tickless idle; without, the CPU clock
+  // still scales
+  esp_pm_config_esp32_t pm = {PM_MAX_MHZ, PM_MIN_MHZ, true};
+  esp_err_t err = esp_pm_configure(&pm);
+  if (err != ESP_OK)
   {
-    if (solarData.vhfConditions[i].name.isEmpty())
-      break;
-    Serial.printf("%s (%s): %s\n",
-                  solarData.vhfConditions[i].name.c_str(),
-                  solarData.vhfConditions[i].location.c_str(),
-                  solarData.vhfConditions[i].condition.c_str());
+    Serial.printf("🔋 No light sleep (%s), the firmware lacks tickless idle\n", esp_err_to_name(err));
+    pm.light_sleep_enable = false;
+    err = esp_pm_configure(&pm);
   }
+  if (err == ESP_OK)
+    err = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "jobs", &jobsPmLock);
+  if (err == ESP_OK)
+    Serial.printf("🔋 CPU %d-%d MHz%s between jobs\n", PM_MIN_MHZ, PM_MAX_MHZ, pm.light_sleep_enable ? ", light sleep" : "");
+  else
+    Serial.printf("🔋 No power management in this firmware (%s), idling at full clock\n", esp_err_to_name(err));
 }
 
 void drawSolarSummaryPage0()
@@ -1041,32 +2622,209 @@ void drawIntroPage(bool forceDisplay)
   unsigned long timeout = millis() + 10000;
   while (millis() < timeout)
   {
-    uint16_t tx, ty;
-    if (tft.getTouch(&tx, &ty))
+    Gesture gesture;
+    if (readGesture(gesture))
     {
       prefs.putBool("showAbout", false);
       break;
     }
-    delay(20);
+    delay(TOUCH_POLL_MS);
   }
 
   prefs.end();
 }
 
-void drawQRCode(const char *text, int x, int y, int scale)
+// Light border around each code, in modules. The standard asks for 4, but 2 is
+// plenty for phone cameras and leaves more of the box to the modules.
+#define QR_QUIET_ZONE 2
+
+// Largest code drawn; 57 modules still get 2 px each in the portal's 132 px boxes
+#define QR_MAX_VERSION 10
+
+// Bytes of the module bitmap of the largest code
+#define QR_MAX_BYTES (((4 * QR_MAX_VERSION + 17) * (4 * QR_MAX_VERSION + 17) + 7) / 8)
+
+// Finished codes are cached, so that redrawing a screen skips the encoder. They are
+// also saved to NVS, so that the portal codes are not encoded again after a reboot.
+#define QR_CACHE_ENTRIES 4
+#define QR_CACHE_PERSIST true
+
+struct QRCacheEntry
 {
+  uint64_t key;          // hash of payload, max version and ECC level, 0 when unused
+  uint16_t length;       // of the payload, as a check on the hash
+  uint32_t lastUsed;
+  uint32_t encodeMicros; // what a hit saves
   QRCode qrcode;
-  uint8_t qrcodeData[qrcode_getBufferSize(3)];
-  qrcode_initText(&qrcode, qrcodeData, 3, ECC_LOW, text);
+  uint8_t modules[QR_MAX_BYTES];
+};
+
+// A cached code as saved to NVS, followed by the length bytes of the payload and
+// then qrcode_getBufferSize(version) bytes. The payload, max version and ECC level
+// are compared on load, so that a record is never taken for another text.
+struct QRCacheRecord
+{
+  uint16_t length;
+  uint8_t version;
+  uint8_t ecc;
+  uint8_t mode;
+  uint8_t mask;
+  uint8_t maxVersion;
+  uint32_t encodeMicros;
+};
+
+QRCacheEntry qrCache[QR_CACHE_ENTRIES];
+uint32_t qrCacheUses = 0;
+uint32_t qrCacheHits = 0;
+uint32_t qrCacheLoads = 0; // misses found in NVS
+uint32_t qrCacheMisses = 0;
+uint32_t qrCacheSavedMicros = 0;
+
+uint64_t qrCacheKey(const char *text, uint8_t maxVersion, uint8_t ecc)
+{
+  uint64_t hash = 14695981039346656037ull; // FNV-1a
+  for (const char *p = text; *p; p++)
+    hash = (hash ^ (uint8_t)*p) * 1099511628211ull;
+  hash = (hash ^ maxVersion) * 1099511628211ull;
+  hash = (hash ^ ecc) * 1099511628211ull;
+  return hash ? hash : 1;
+}
+
+// Returns the code for the text in the smallest version up to maxVersion (at most
+// QR_MAX_VERSION), encoding it only if it is neither cached nor saved. Null if the
+// text does not fit.
+QRCode *getCachedQRCode(const char *text, uint8_t maxVersion, uint8_t ecc)
+{
+  uint64_t key = qrCacheKey(text, maxVersion, ecc);
+  uint16_t length = strlen(text);
+  QRCacheEntry *entry = &qrCache[0];
+  for (int i = 0; i < QR_CACHE_ENTRIES; i++)
+  {
+    if (qrCache[i].key == key && qrCache[i].length == length)
+    {
+      qrCache[i].lastUsed = ++qrCacheUses;
+      qrCacheHits++;
+      qrCacheSavedMicros += qrCache[i].encodeMicros;
+      return &qrCache[i].qrcode;
+    }
+    if (qrCache[i].lastUsed < entry->lastUsed)
+      entry = &qrCache[i]; // least recently used, or unused
+  }
+
+  entry->key = 0;
+  entry->qrcode.modules = entry->modules;
+  char name[16];
+  snprintf(name, sizeof(name), "qr%012llx", (unsigned long long)(key >> 16));
+  QRCacheRecord record;
+  static uint8_t buffer[sizeof(record) + QRCODE_AUTO_MAX_LENGTH + QR_MAX_BYTES]; // off the loop stack
+  bool loaded = false;
+  if (QR_CACHE_PERSIST && length <= QRCODE_AUTO_MAX_LENGTH)
+  {
+    prefs.begin("qrcache", true);
+    size_t size = prefs.getBytesLength(name);
+    if (size > sizeof(record) && size <= sizeof(buffer) && prefs.getBytes(name, buffer, sizeof(buffer)) == size)
+    {
+      memcpy(&record, buffer, sizeof(record));
+      loaded = record.length == length && record.maxVersion == maxVersion && record.ecc == ecc &&
+               record.version >= 1 && record.version <= maxVersion &&
+               size == sizeof(record) + length + qrcode_getBufferSize(record.version) &&
+               memcmp(buffer + sizeof(record), text, length) == 0;
+      if (loaded)
+        memcpy(entry->modules, buffer + sizeof(record) + length, qrcode_getBufferSize(record.version));
+    }
+    prefs.end();
+  }
+
+  if (loaded)
+  {
+    entry->qrcode.version = record.version;
+    entry->qrcode.size = record.version * 4 + 17;
+    entry->qrcode.ecc = record.ecc;
+    entry->qrcode.mode = record.mode;
+    entry->qrcode.mask = record.mask;
+    entry->encodeMicros = record.encodeMicros;
+    qrCacheLoads++;
+    qrCacheSavedMicros += record.encodeMicros;
+  }
+  else
+  {
+    uint32_t start = micros();
+    if (qrcode_initTextAuto(&entry->qrcode, entry->modules, maxVersion, ecc, text) != 0)
+      return NULL;
+    entry->encodeMicros = micros() - start;
+    qrCacheMisses++;
+
+    if (QR_CACHE_PERSIST)
+    {
+      record.length = length;
+      record.version = entry->qrcode.version;
+      record.ecc = entry->qrcode.ecc;
+      record.mode = entry->qrcode.mode;
+      record.mask = entry->qrcode.mask;
+      record.maxVersion = maxVersion;
+      record.encodeMicros = entry->encodeMicros;
+      memcpy(buffer, &record, sizeof(record));
+      memcpy(buffer + sizeof(record), text, length);
+      memcpy(buffer + sizeof(record) + length, entry->modules, qrcode_getBufferSize(record.version));
+      prefs.begin("qrcache", false);
+      prefs.putBytes(name, buffer, sizeof(record) + length + qrcode_getBufferSize(record.version));
+      prefs.end();
+    }
+  }
+
+  entry->key = key;
+  entry->length = length;
+  entry->lastUsed = ++qrCacheUses;
+  return &entry->qrcode;
+}
+
+void qrCacheReport()
+{
+  Serial.printf("🔳 QR cache: %lu hits, %lu loaded, %lu misses, %lu us of encoding saved\n",
+                (unsigned long)qrCacheHits, (unsigned long)qrCacheLoads, (unsigned long)qrCacheMisses,
+                (unsigned long)qrCacheSavedMicros);
+}
+
+// Draws the code with its quiet zone as large as it fits, centered in the square
+// box of 'box' pixels at (x, y): one white square, then one rect per horizontal
+// run of dark modules, all inside a single SPI transaction. The smallest version
+// that holds the text is used, so shorter payloads get larger modules.
+void drawQRCode(const char *text, int x, int y, int box)
+{
+  QRCode *code = getCachedQRCode(text, QR_MAX_VERSION, ECC_LOW);
+  if (code == NULL)
+  {
+    Serial.printf("❌ QR code payload too long: %s\n", text);
+    return;
+  }
+  QRCode &qrcode = *code;
+
+  int scale = box / (qrcode.size + 2 * QR_QUIET_ZONE);
+  int side = (qrcode.size + 2 * QR_QUIET_ZONE) * scale;
+  x += (box - side) / 2;
+  y += (box - side) / 2;
+  tft.startWrite();
+  tft.fillRect(x, y, side, side, TFT_WHITE);
+  x += QR_QUIET_ZONE * scale;
+  y += QR_QUIET_ZONE * scale;
 
   for (uint8_t row = 0; row < qrcode.size; row++)
   {
-    for (uint8_t col = 0; col < qrcode.size; col++)
+    uint8_t col = 0;
+    while (col < qrcode.size)
     {
-      int color = qrcode_getModule(&qrcode, col, row) ? TFT_BLACK : TFT_WHITE;
-      tft.fillRect(x + col * scale, y + row * scale, scale, scale, color);
+      if (!qrcode_getModule(&qrcode, col, row))
+      {
+        col++;
+        continue;
+      }
+      uint8_t start = col;
+      while (col < qrcode.size && qrcode_getModule(&qrcode, col, row))
+        col++;
+      tft.fillRect(x + start * scale, y + row * scale, (col - start) * scale, scale, TFT_BLACK);
     }
   }
+  tft.endWrite();
 }
 void drawQRcodeInstructions()
 {
@@ -1083,11 +2841,188 @@ void drawQRcodeInstructions()
   tft.setTextColor(TFT_WHITE, TFT_BLACK);
 
   tft.drawCentreString("Scan to Join", 80, 85, 2);
-  drawQRCode("WIFI:T:nopass;S:HB9IIUSetup;;", 80 - 116 / 2, 105, 4);
+  drawQRCode("WIFI:T:nopass;S:HB9IIUSetup;;", 80 - 132 / 2, 101, 132);
 
   tft.drawCentreString("Open config page", 240, 85, 2);
-  drawQRCode("http://192.168.4.1", 240 - 116 / 2, 105, 4);
+  drawQRCode("http://192.168.4.1", 240 - 132 / 2, 101, 132);
+}
+// The portal's /scan list is serialized once per scan into a pooled buffer and every
+// request is served from that snapshot. While the portal waits, the list is refreshed
+// by an asynchronous rescan every SCAN_REFRESH_MS.
+#define SCAN_REFRESH_MS 30000
+
+struct ScanSnapshot
+{
+  char *json = nullptr;
+  size_t length = 0;
+  size_t capacity = 0; // buffers only grow, so later scans reuse them
+  char etag[12];       // quoted FNV-1a of the JSON
+  int networks = 0;
+};
+
+// Two buffers: one is published, the other is rebuilt. A response holds its snapshot
+// until the last byte is sent, so a buffer is only reused once nobody reads it.
+std::shared_ptr<ScanSnapshot> scanPool[2] = {std::make_shared<ScanSnapshot>(), std::make_shared<ScanSnapshot>()};
+std::shared_ptr<ScanSnapshot> scanCurrent;
+portMUX_TYPE scanMux = portMUX_INITIALIZER_UNLOCKED;
+uint32_t lastScanMillis = 0;
+bool scanRunning = false;
+
+const char *authModeName(wifi_auth_mode_t mode)
+{
+  switch (mode)
+  {
+  case WIFI_AUTH_OPEN:
+    return "open";
+  case WIFI_AUTH_WEP:
+    return "WEP";
+  case WIFI_AUTH_WPA_PSK:
+    return "WPA";
+  case WIFI_AUTH_WPA2_PSK:
+  case WIFI_AUTH_WPA_WPA2_PSK:
+    return "WPA2";
+  case WIFI_AUTH_WPA2_ENTERPRISE:
+    return "WPA2-EAP";
+  case WIFI_AUTH_WPA3_PSK:
+  case WIFI_AUTH_WPA2_WPA3_PSK:
+    return "WPA3";
+  default:
+    return "other";
+  }
+}
+
+// Writes one {"ssid":..} object at out, or only measures it when out is NULL.
+// SSIDs are escaped: quotes, backslashes and control bytes.
+size_t writeScanEntry(char *out, const wifi_ap_record_t *ap)
+{
+  size_t n = 0;
+  auto put = [&](char c)
+  {
+    if (out)
+      out[n] = c;
+    n++;
+  };
+  for (const char *p = "{\"ssid\":\""; *p; p++)
+    put(*p);
+  for (const uint8_t *s = ap->ssid; s < ap->ssid + sizeof(ap->ssid) && *s; s++)
+  {
+    if (*s == '"' || *s == '\\')
+    {
+      put('\\');
+      put(*s);
+    }
+    else if (*s < 0x20)
+    {
+      char esc[7];
+      snprintf(esc, sizeof(esc), "\\u%04x", *s);
+      for (char *e = esc; *e; e++)
+        put(*e);
+    }
+    else
+      put(*s);
+  }
+  char tail[48];
+  int len = snprintf(tail, sizeof(tail), "\",\"rssi\":%d,\"ch\":%d,\"sec\":\"%s\"}", ap->rssi, ap->primary,
+                     authModeName(ap->authmode));
+  for (int i = 0; i < len; i++)
+    put(tail[i]);
+  return n;
+}
+
+// Serializes the finished scan: strongest first, one entry per SSID, hidden networks
+// left out. Returns false when both buffers are still being sent, try again later.
+bool publishScanResults(int count)
+{
+  std::shared_ptr<ScanSnapshot> snap;
+  portENTER_CRITICAL(&scanMux);
+  snap = scanPool[scanCurrent == scanPool[0] ? 1 : 0];
+  portEXIT_CRITICAL(&scanMux);
+  if (snap.use_count() > 2) // the pool, this copy, and someone still sending it
+    return false;
+
+  std::vector<const wifi_ap_record_t *> aps;
+  aps.reserve(count);
+  for (int i = 0; i < count; i++)
+  {
+    const wifi_ap_record_t *ap = (const wifi_ap_record_t *)WiFi.getScanInfoByIndex(i);
+    if (ap && ap->ssid[0])
+      aps.push_back(ap);
+  }
+  // group by SSID with the strongest first, keep that one, then order by signal
+  std::sort(aps.begin(), aps.end(), [](const wifi_ap_record_t *a, const wifi_ap_record_t *b)
+            {
+              int c = strncmp((const char *)a->ssid, (const char *)b->ssid, sizeof(a->ssid));
+              return c != 0 ? c < 0 : a->rssi > b->rssi; });
+  aps.erase(std::unique(aps.begin(), aps.end(), [](const wifi_ap_record_t *a, const wifi_ap_record_t *b)
+                        { return strncmp((const char *)a->ssid, (const char *)b->ssid, sizeof(a->ssid)) == 0; }),
+            aps.end());
+  std::stable_sort(aps.begin(), aps.end(), [](const wifi_ap_record_t *a, const wifi_ap_record_t *b)
+                   { return a->rssi > b->rssi; });
+
+  size_t length = 2; // []
+  for (size_t i = 0; i < aps.size(); i++)
+    length += writeScanEntry(NULL, aps[i]) + (i > 0);
+  if (length > snap->capacity)
+  {
+    char *json = (char *)realloc(snap->json, length);
+    if (json == NULL)
+      return false;
+    snap->json = json;
+    snap->capacity = length;
+  }
+
+  char *out = snap->json;
+  *out++ = '[';
+  for (size_t i = 0; i < aps.size(); i++)
+  {
+    if (i > 0)
+      *out++ = ',';
+    out += writeScanEntry(out, aps[i]);
+  }
+  *out++ = ']';
+  snap->length = out - snap->json;
+  snap->networks = aps.size();
+
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < snap->length; i++)
+    hash = (hash ^ (uint8_t)snap->json[i]) * 16777619u;
+  snprintf(snap->etag, sizeof(snap->etag), "\"%08lx\"", (unsigned long)hash);
+
+  portENTER_CRITICAL(&scanMux);
+  scanCurrent = snap;
+  portEXIT_CRITICAL(&scanMux);
+  return true;
+}
+
+std::shared_ptr<ScanSnapshot> currentScan()
+{
+  portENTER_CRITICAL(&scanMux);
+  std::shared_ptr<ScanSnapshot> snap = scanCurrent;
+  portEXIT_CRITICAL(&scanMux);
+  return snap;
+}
+
+// Call from the portal's wait loop: publishes a finished scan and starts the next one
+void serviceWiFiScan()
+{
+  if (scanRunning)
+  {
+    int count = WiFi.scanComplete();
+    if (count == WIFI_SCAN_RUNNING || (count >= 0 && !publishScanResults(count)))
+      return;
+    if (count >= 0)
+      Serial.printf("📶 Rescan found %d networks\n", currentScan()->networks);
+    WiFi.scanDelete();
+    scanRunning = false;
+    lastScanMillis = millis();
+  }
+  else if (millis() - lastScanMillis >= SCAN_REFRESH_MS)
+  {
+    scanRunning = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+    lastScanMillis = millis();
+  }
 }
+
 void startConfigurationPortal()
 {
   Serial.println("🌐 Starting Captive Portal...");
@@ -1100,47 +3035,70 @@ void startConfigurationPortal()
   Serial.println("📡 Scanning for networks...");
   WiFi.scanDelete();
 
-  scanCount = WiFi.scanNetworks();
-  Serial.printf("📶 Found %d networks\n", scanCount);
+  int count = WiFi.scanNetworks();
+  if (count >= 0 && publishScanResults(count))
+    Serial.printf("📶 Found %d networks\n", currentScan()->networks);
+  WiFi.scanDelete();
+  lastScanMillis = millis();
 
   // Routes
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest *request)
-
-            { request->send_P(200, "text/html", index_html); });
+  // Portal page is gzipped at build time (scripts/gzip_html.py); phones revalidate with
+  // If-None-Match and get a bare 304 on reload instead of the whole page again
+  server.serveStatic_P("/", "text/html", index_html_gz, sizeof(index_html_gz), INDEX_HTML_GZ_ETAG, "no-cache")
+      .setIdentity((const uint8_t *)index_html, strlen_P(index_html));
 
   server.on("/scan", HTTP_GET, [](AsyncWebServerRequest *request)
             {
-              Serial.println("Returning scan list");
-    String json = "[";
-    for (int i = 0; i < scanCount; i++) {
-      if (i > 0) json += ",";
-      json += "\"" + WiFi.SSID(i) + "\"";
+    std::shared_ptr<ScanSnapshot> snap = currentScan();
+    if (!snap) {
+      request->send(200, "application/json", "[]");
+      return;
     }
-    json += "]";
-    request->send(200, "application/json", json); });
+    const char *match = request->headerValue("If-None-Match");
+    if (match && strcmp(match, snap->etag) == 0) {
+      AsyncWebServerResponse *response = request->beginResponse(304);
+      response->addHeader("ETag", snap->etag);
+      request->send(response);
+      return;
+    }
+    // streamed straight out of the snapshot as the TCP window opens
+    AsyncWebServerResponse *response = request->beginResponse("application/json", snap->length,
+        [snap](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+          size_t n = std::min(maxLen, snap->length - index);
+          memcpy(buffer, snap->json + index, n);
+          return n;
+        });
+    response->addHeader("ETag", snap->etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response); });
   server.on("/save", HTTP_POST, [](AsyncWebServerRequest *request)
             {
 
                             Serial.println("Saving");
 
-  if (request->hasParam("ssid", true) &&
-      request->hasParam("password", true) &&
-      request->hasParam("time", true)) {
-
-    String ssid = request->getParam("ssid", true)->value();
-    String pass = request->getParam("password", true)->value();
-    String timeStr = request->getParam("time", true)->value();  // "14:35"
+  // read in place from the request, no String copies
+  const char *ssid = request->paramValue("ssid", true);
+  const char *pass = request->paramValue("password", true);
+  const char *timeStr = request->paramValue("time", true);  // "14:35"
+  const char *tz = request->paramValue("tz", true);         // "<+01>-1<+02>-2,M3.5.0,M10.5.0/3", optional
+  TzRule rule;
+  if (ssid && pass && timeStr) {
 
     prefs.begin("wifi", false);
     prefs.putString("ssid", ssid);
     prefs.putString("pass", pass);
+    prefs.remove("cache"); // of the old network
     prefs.end();
 
     prefs.begin("time", false);
     prefs.putString("localTime", timeStr);  // Save user’s local time string
+    if (tz && parseTzRule(tz, rule))
+      prefs.putString("tz", tz);
+    else
+      prefs.remove("tz");
     prefs.end();
 
-    Serial.printf("✅ Saved WiFi and phone time: %s\n", timeStr.c_str());
+    Serial.printf("✅ Saved WiFi and phone time: %s (%s)\n", timeStr, tz ? tz : "no time zone");
 
     request->send(200, "text/html", "<h3>✅ WiFi and time saved. Rebooting...</h3>");
     delay(1000);
@@ -1154,6 +3112,7 @@ void startConfigurationPortal()
   // 🔁 Wait here until Wi-Fi is connected
   while (WiFi.status() != WL_CONNECTED)
   {
+    serviceWiFiScan();
     delay(500);
   }
 
@@ -1178,22 +3137,144 @@ bool tryConnectSavedWiFi()
   Serial.printf("🔐 Found Password: %s\n", pass.c_str());
 
   Serial.printf("🔌 Connecting to WiFi: %s...\n", ssid.c_str());
-  WiFi.begin(ssid.c_str(), pass.c_str());
+  if (connectWiFi(ssid.c_str(), pass.c_str()))
+  {
+    Serial.println("✅ Connected to WiFi!");
+    Serial.print("📶 IP Address: ");
+    Serial.println(WiFi.localIP());
+    return true;
+  }
+  Serial.println("\n❌ Failed to connect to saved WiFi.");
+  startConfigurationPortal();
+}
+
+bool waitForWiFi(uint32_t timeoutMs, uint32_t &tookMs)
+{
+  uint32_t start = millis();
+  while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs)
+    delay(WIFI_POLL_MS);
+  tookMs = millis() - start;
+  return WiFi.status() == WL_CONNECTED;
+}
+
+// The fast path with what the last connection used, else a scan and DHCP
+bool connectWiFi(const char *ssid, const char *pass)
+{
+  WiFiCache cache = {};
+  prefs.begin("wifi", true);
+  bool cached = prefs.getBytes("cache", &cache, sizeof(cache)) == sizeof(cache) && cache.channel;
+  prefs.end();
 
-  for (int i = 0; i < 20; i++)
+  // The system time is only known here when it was kept over a restart of the CPU; the
+  // one saved in flash says nothing of how long the power was off
+  time_t now = time(nullptr);
+  wifiOnKeptLease = cached && cache.ip && now >= TIME_VALID_S && now + WIFI_LEASE_MARGIN_S < cache.leaseEnds;
+  wifiStats = {WIFI_NONE, 0, 0, 0};
+  if (cached)
   {
-    if (WiFi.status() == WL_CONNECTED)
+    Serial.printf("⚡ Joining %02X:%02X:%02X:%02X:%02X:%02X on channel %u as %s\n", cache.bssid[0], cache.bssid[1], cache.bssid[2],
+                  cache.bssid[3], cache.bssid[4], cache.bssid[5], cache.channel,
+                  wifiOnKeptLease ? IPAddress(cache.ip).toString().c_str() : "DHCP");
+    if (wifiOnKeptLease)
+      WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+    WiFi.begin(ssid, pass, cache.channel, cache.bssid);
+    if (waitForWiFi(WIFI_FAST_WAIT_MS, wifiStats.fastMs))
+      wifiStats.path = WIFI_FAST;
+    else
     {
-      Serial.println("✅ Connected to WiFi!");
-      Serial.print("📶 IP Address: ");
-      Serial.println(WiFi.localIP());
-      return true;
+      Serial.printf("⚠️ Fast path failed after %lu ms, scanning\n", (unsigned long)wifiStats.fastMs);
+      WiFi.disconnect();
+      WiFi.config(IPAddress(), IPAddress(), IPAddress()); // back to DHCP
+      wifiOnKeptLease = false;
     }
-    Serial.print(".");
-    delay(500);
   }
-  Serial.println("\n❌ Failed to connect to saved WiFi.");
-  startConfigurationPortal();
+  if (wifiStats.path == WIFI_NONE)
+  {
+    WiFi.begin(ssid, pass);
+    if (!waitForWiFi(WIFI_FULL_WAIT_MS, wifiStats.fullMs))
+      return false;
+    wifiStats.path = WIFI_FULL;
+  }
+  wifiStats.connectedMs = millis();
+  Serial.printf("⏱️ Wi-Fi by %s in %lu ms, %lu ms after boot\n", wifiPathNames[wifiStats.path],
+                (unsigned long)(wifiStats.fastMs + wifiStats.fullMs), (unsigned long)wifiStats.connectedMs);
+
+  // keep what this connection used, when it changed
+  WiFiCache used = {};
+  if (const uint8_t *bssid = WiFi.BSSID())
+    memcpy(used.bssid, bssid, sizeof(used.bssid));
+  used.channel = WiFi.channel();
+  used.ip = WiFi.localIP();
+  used.gateway = WiFi.gatewayIP();
+  used.subnet = WiFi.subnetMask();
+  used.dns = WiFi.dnsIP(0);
+  used.leaseEnds = wifiOnKeptLease ? cache.leaseEnds : dhcpLeaseEnds(); // else the lease job keeps it later
+  wifiLeaseEnds = used.leaseEnds;
+  if (!cached || memcmp(&used, &cache, sizeof(used)) != 0)
+  {
+    prefs.begin("wifi", false);
+    prefs.putBytes("cache", &used, sizeof(used));
+    prefs.end();
+  }
+  return true;
+}
+
+// When the DHCP lease of the station runs out, from lwIP; 0 without one or without the
+// system time. An infinite lease is taken as a year. The tcpip task renews the lease,
+// so it is read under the core lock (a no-op in firmware built without core locking).
+uint32_t dhcpLeaseEnds()
+{
+  time_t now = time(nullptr);
+  if (now < TIME_VALID_S)
+    return 0;
+  esp_netif_t *sta = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+  struct netif *netif = sta ? (struct netif *)esp_netif_get_netif_impl(sta) : nullptr;
+  uint32_t leaseS = 0, usedS = 0;
+  LOCK_TCPIP_CORE();
+  struct dhcp *dhcp = netif ? netif_dhcp_data(netif) : nullptr;
+  if (dhcp && (dhcp->state == DHCP_STATE_BOUND || dhcp->state == DHCP_STATE_RENEWING || dhcp->state == DHCP_STATE_REBINDING))
+  {
+    leaseS = std::min<uint32_t>(dhcp->offered_t0_lease, 365 * 86400UL);
+    usedS = dhcp->lease_used * DHCP_COARSE_TIMER_SECS;
+  }
+  UNLOCK_TCPIP_CORE();
+  return leaseS ? now - usedS + leaseS : 0;
+}
+
+// On the kept lease, hands over to DHCP before it runs out. On a lease from DHCP, keeps
+// when it runs out once the system time is known, and again each time it is renewed.
+void leaseJob()
+{
+  if (WiFi.status() != WL_CONNECTED)
+    return;
+  if (wifiOnKeptLease)
+  {
+    if (time(nullptr) + WIFI_LEASE_MARGIN_S < wifiLeaseEnds)
+      return;
+    Serial.println("📶 Kept lease running out, back to DHCP");
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    wifiOnKeptLease = false;
+    return;
+  }
+  uint32_t ends = dhcpLeaseEnds();
+  if (!ends || (ends > wifiLeaseEnds ? ends - wifiLeaseEnds : wifiLeaseEnds - ends) <= DHCP_COARSE_TIMER_SECS)
+    return; // lease_used only counts whole minutes
+  WiFiCache cache;
+  prefs.begin("wifi", false);
+  if (prefs.getBytes("cache", &cache, sizeof(cache)) == sizeof(cache))
+  {
+    cache.leaseEnds = ends;
+    prefs.putBytes("cache", &cache, sizeof(cache));
+  }
+  prefs.end();
+  wifiLeaseEnds = ends;
+}
+
+void wifiReport()
+{
+  Serial.printf("📶 Wi-Fi by %s, %lu ms after boot (fast path %lu ms, scan and DHCP %lu ms)%s\n", wifiPathNames[wifiStats.path],
+                (unsigned long)wifiStats.connectedMs, (unsigned long)wifiStats.fastMs, (unsigned long)wifiStats.fullMs,
+                wifiOnKeptLease ? ", on the kept lease" : "");
 }
 
 void drawLOCALTime(const String &timeStr, int x, int y, uint16_t digitColor, uint16_t backgroundColor, bool blinkColon)
@@ -1409,5 +3490,15 @@ void wipeAllPreferences()
   prefs.clear();
   prefs.end();
 
+  // Wipe saved QR codes
+  prefs.begin("qrcache", false);
+  prefs.clear();
+  prefs.end();
+
+  // Wipe touch calibration
+  prefs.begin("touch", false);
+  prefs.clear();
+  prefs.end();
+
   Serial.println("✅ All Preferences cleared!");
 }
\ No newline at end of file
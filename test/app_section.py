@@ -0,0 +1,89 @@
+# Cut a section out of the sketch for a host test
+#
+# The sketch is one file that only builds for the ESP32, so a test includes the
+# part it exercises and supplies the few things that part calls. A section is
+# one or more spans, each from the line holding its start text up to, but not
+# including, the line holding its end text. A span may name another file of the
+# tree, for library code a test runs against a mock of the hardware. #line
+# directives keep compiler messages and debuggers pointing into the sources.
+#
+#   python3 app_section.py scan > scan_section.inc
+
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SKETCH = os.path.join(ROOT, "src", "HamPropDisplayFactoryResetToBeTested.cpp")
+
+SECTIONS = {
+    # Wi-Fi scan snapshot, and the /scan route from startConfigurationPortal()
+    "scan": [("// The portal's /scan list is serialized once per scan", "void startConfigurationPortal()")],
+    "scan_route": [('  server.on("/scan", HTTP_GET,', '  server.on("/save", HTTP_POST,')],
+    # SolarData and the /events live feed
+    "live": [("// Struct to store all parsed solar data", "void setup()"),
+             ("// Live feed: in station mode", "// Only loop() touches these")],
+    # touch engine, calibration and gestures, without the scheduler between them
+    "touch": [("// Touch input: the touch job calls", "// Cooperative scheduler:"),
+              ("// Only loop() touches these, so no locking", "// Scheduler state, only loop()")],
+    # the calibration matrix: its fit, Q16 mapping and loading
+    "touch_affine": [("// Raw to screen mapping in Q16 fixed point", "// Cooperative scheduler:"),
+                     ("// The matrix taking three raw readings", "void pushTouchEvent(")],
+    # the timer wheel scheduler and its duty cycle
+    "sched": [("// Cooperative scheduler:", "int8_t jobSolar = -1"),
+              ("#define DUTY_WINDOW_MS", "esp_pm_lock_handle_t jobsPmLock"),
+              ("// Scheduler state, only loop()", "// Only the jobs touch these")],
+    # the scheduler again, with the touch job's poll rates loop() sleeps between
+    "power": [("#define TOUCH_POLL_MS", "#define TOUCH_DEBOUNCE"),
+              ("// Cooperative scheduler:", "int8_t jobSolar = -1"),
+              ("#define DUTY_WINDOW_MS", "esp_pm_lock_handle_t jobsPmLock"),
+              ("// Scheduler state, only loop()", "// Only the jobs touch these")],
+    # the clock job with the time zone lookup it formats with, on the scheduler
+    "clock": [("// Cooperative scheduler:", "int8_t jobSolar = -1"),
+              ("#define DUTY_WINDOW_MS", "esp_pm_lock_handle_t jobsPmLock"),
+              ("// Clock: the clock job arms itself", "// Wi-Fi: the BSSID, channel"),
+              ("// Scheduler state, only loop()", "void drawCurrentPage()"),
+              ("// Days since 1970-01-01", "void statsJob()")],
+    # the time zone rules and the clock strings formatted with them
+    "tz": [("// Time zone: the local time follows", "// Time: an NTP client runs"),
+           ("ClockText clockText =", "NtpState ntp;"),
+           ("// Days since 1970-01-01", "void clockJob()")],
+    # the NTP client job and the time kept over reboots
+    "ntp": [("// Time: an NTP client runs", "// Wi-Fi: the BSSID, channel"),
+            ("NtpState ntp;", "void drawCurrentPage()"),
+            ("int64_t systemUs()", "// 🌍 The time zone rule from the portal")],
+    # joining the kept AP on the kept lease, the lease job and the cache behind them
+    "wifi": [("#define TIME_VALID_S", "#define TIME_SAVE_S"),
+             ("// Wi-Fi: the BSSID, channel", "#define SOLAR_REFRESH_MS"),
+             ("bool waitForWiFi(", "void wifiReport()")],
+    # TFT_eSPI's XPT2046 reads, for the SPI mock of touch_burst_test
+    "touch_reads": [("uint8_t TFT_eSPI::getTouchRaw(", "#define _RAWERR", "lib/TFT_eSPI/Extensions/Touch.cpp")],
+}
+
+
+def cut(lines, start, end):
+    first = next((i for i in range(len(lines)) if start in lines[i]), None)
+    if first is None:
+        raise RuntimeError("start of section not found: %r" % start)
+    last = next((i for i in range(first + 1, len(lines)) if end in lines[i]), None)
+    if last is None:
+        raise RuntimeError("end of section not found: %r" % end)
+    return first, last
+
+
+def main(name):
+    out = ["// Generated by test/app_section.py %s, do not edit." % name]
+    for span in SECTIONS[name]:
+        start, end = span[:2]
+        path = os.path.join(ROOT, span[2]) if len(span) > 2 else SKETCH
+        with open(path, encoding="utf-8") as f:
+            lines = f.read().split("\n")
+        first, last = cut(lines, start, end)
+        out.append('#line %d "%s"' % (first + 1, os.path.relpath(path)))
+        out.extend(lines[first:last])
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2 or sys.argv[1] not in SECTIONS:
+        sys.exit("usage: app_section.py {%s}" % ",".join(sorted(SECTIONS)))
+    main(sys.argv[1])
@@ -0,0 +1,24 @@
+// Shared by the host tests: CHECK() reports a failed condition and carries on, and
+// main() returns checkResult() so that "make check" stops at the first failing test
+#pragma once
+#include <cstdio>
+
+static int checkFails = 0;
+
+#define CHECK(cond, ...) \
+  do \
+  { \
+    if (!(cond)) \
+    { \
+      checkFails++; \
+      printf("%s:%d: FAIL %s: ", __FILE__, __LINE__, #cond); \
+      printf(__VA_ARGS__); \
+      printf("\n"); \
+    } \
+  } while (0)
+
+static inline int checkResult(const char *test)
+{
+  printf("%s: %s\n", test, checkFails ? "FAILED" : "all passed");
+  return checkFails != 0;
+}
@@ -0,0 +1,195 @@
+// The clock job cut from the sketch on the scheduler, with a virtual micros() and a
+// system time that NTP slews against it by up to 200 ppm: a day in which every
+// second is put up once, the wrap of micros(), fetches that block for seconds, and
+// the time being set
+#include "check.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <sys/time.h>
+#include <vector>
+
+static uint64_t vt = 0;     // what micros() reads, in 64 bits so that a day fits
+static int64_t systemUs = 0; // the system time, us since the epoch
+static int ppm = 0;          // its rate against micros()
+static int64_t ppmRest = 0;
+static void advance(uint64_t us)
+{
+  vt += us;
+  ppmRest += (int64_t)us * ppm;
+  systemUs += us + ppmRest / 1000000;
+  ppmRest %= 1000000;
+}
+static uint32_t micros() { return (uint32_t)vt; }
+static int virtualTimeOfDay(struct timeval *tv, void *)
+{
+  tv->tv_sec = systemUs / 1000000;
+  tv->tv_usec = systemUs % 1000000;
+  return 0;
+}
+#define gettimeofday virtualTimeOfDay
+
+// What the section needs of the sketch and the core
+struct
+{
+  bool quiet = false;
+  template <class... Args>
+  void printf(const char *format, Args... args)
+  {
+    if (!quiet)
+      ::printf(format, args...);
+  }
+  void println(const char *s = "") { puts(s); }
+} Serial;
+struct String
+{
+  String(const char *) {}
+};
+struct IPAddress
+{
+};
+struct WiFiUDP
+{
+};
+#define TFT_BLACK 0
+static int currentPage = 0;
+static bool blinkingDot = false;
+static uint16_t LOCALdigitColor, UTCdigitColor;
+static const uint32_t DRAW_US = 3000; // both clocks
+static void drawLOCALTime(const String &, int, int, uint16_t, uint16_t, bool) { advance(DRAW_US / 2); }
+static void drawUTCTime(const String &, int, int, uint16_t, uint16_t, bool) { advance(DRAW_US / 2); }
+static std::vector<std::pair<time_t, int64_t>> shown; // second of day put up, and when on the system time
+static void publishLiveStatus(const char *utc, const char *)
+{
+  int h, m, s;
+  sscanf(utc, "%d:%d:%d", &h, &m, &s);
+  shown.push_back({h * 3600 + m * 60 + s, systemUs});
+}
+static int8_t jobClock;
+void schedAt(int8_t id, uint32_t inMs);
+void schedAtUs(int8_t id, uint32_t inUs);
+void schedCancel(int8_t id);
+#include "clock.inc"
+
+static uint32_t solarMin = 300000, solarMax = 950000; // us a fetch blocks
+static void touchJob() { advance(60); }
+static void rssiJob() { advance(200); }
+static void solarJob() { advance(solarMin + rand() % (solarMax - solarMin + 1)); }
+static void statsJob() { advance(5000); }
+
+// loop(): the wait is in whole 1 ms ticks, the first one partial
+static void loopPass()
+{
+  uint32_t idle = schedRun();
+  advance(15);
+  if (idle)
+    advance(((idle + 999) / 1000 + 1) * 1000 - rand() % 1000);
+}
+
+struct Result
+{
+  uint32_t repeated, jumps, jumpedSeconds, steps;
+  int64_t lateMedian, lateMax; // after the second boundary, us
+};
+
+// Runs the sketch's jobs for span us; steps are {when, by how much} the time is set
+static Result run(uint64_t start, int64_t epochUs, uint64_t span, std::vector<std::pair<uint64_t, int64_t>> steps = {})
+{
+  schedJobCount = 0;
+  vt = start;
+  systemUs = epochUs;
+  ppmRest = 0;
+  clockShown = 0;
+  clockSkipped = clockEarly = clockSteps = 0;
+  memset(clockHist, 0, sizeof(clockHist));
+  clockText = {0, 0, 0, "", ""};
+  shown.clear();
+  srand(47);
+  schedAdd("touch", touchJob, 40, 0);
+  jobClock = schedAdd("clock", clockJob, 0, 0);
+  schedAdd("rssi", rssiJob, 1000, 0);
+  schedAdd("solar", solarJob, 15 * 60 * 1000, 15 * 60 * 1000);
+  schedAdd("stats", statsJob, 15 * 60 * 1000, 15 * 60 * 1000);
+  size_t step = 0;
+  while (vt < start + span)
+  {
+    // the slew changes every ten minutes
+    ppm = (int)((vt - start) / 600000000 * 7919 % 401) - 200;
+    if (step < steps.size() && vt - start >= steps[step].first)
+      systemUs += steps[step++].second;
+    loopPass();
+  }
+
+  Result r = {};
+  for (size_t i = 1; i < shown.size(); i++)
+  {
+    time_t d = (shown[i].first - shown[i - 1].first + 86400) % 86400;
+    if (d == 0)
+      r.repeated++;
+    else if (d > 1 && d <= CLOCK_STEP_S)
+    {
+      r.jumps++;
+      r.jumpedSeconds += d - 1;
+    }
+    else if (d != 1)
+      r.steps++;
+  }
+  std::vector<int64_t> late;
+  for (auto &s : shown)
+    late.push_back(s.second % 1000000);
+  std::sort(late.begin(), late.end());
+  r.lateMedian = late[late.size() / 2];
+  r.lateMax = late.back();
+  return r;
+}
+
+int main()
+{
+  const uint64_t DAY = 86400ull * 1000000;
+  const int64_t EPOCH = 1760000000ll * 1000000 + 123457; // not on a second
+
+  // fetches shorter than a second: every second of the day up once
+  Result r = run(1000000, EPOCH, DAY);
+  printf("a day:           %zu redraws, %u repeated, %u skipped (%u counted), %u early wake-ups, "
+         "drawn %lld us after the second (median), %lld at most\n",
+         shown.size(), r.repeated, r.jumpedSeconds, clockSkipped, clockEarly, (long long)r.lateMedian,
+         (long long)r.lateMax);
+  clockReport();
+  CHECK(r.repeated == 0 && r.jumps == 0 && r.steps == 0 && clockSkipped == 0,
+        "%u seconds repeated, %u skipped (%u counted), %u steps", r.repeated, r.jumpedSeconds, clockSkipped, r.steps);
+  CHECK(shown.size() >= 86399 && shown.size() <= 86401, "%zu redraws", shown.size());
+  CHECK(clockEarly > 0, "the slew never woke the clock job early"); // so that path ran
+  CHECK(r.lateMedian < 5000, "drawn %lld us after the second", (long long)r.lateMedian);
+
+  // from just before the wrap of micros()
+  r = run(0xFFFFFFFFull - 20000000, EPOCH + 500000, DAY / 24);
+  printf("across the wrap: %zu redraws, %u repeated, %u skipped\n", shown.size(), r.repeated, r.jumpedSeconds);
+  CHECK(r.repeated == 0 && r.jumps == 0, "across the wrap: %u seconds repeated, %u skipped", r.repeated,
+        r.jumpedSeconds);
+
+  // fetches blocking for 1.5 to 3.5 s: the seconds lost are counted, none is repeated
+  solarMin = 1500000, solarMax = 3500000;
+  Serial.quiet = true; // a line per skip
+  r = run(1000000, EPOCH, DAY);
+  Serial.quiet = false;
+  printf("slow fetches:    %u repeated, %u jumps over %u s (%u counted)\n", r.repeated, r.jumps, r.jumpedSeconds,
+         clockSkipped);
+  CHECK(r.repeated == 0, "slow fetches: %u seconds repeated", r.repeated);
+  CHECK(r.jumps > 0 && r.jumpedSeconds == clockSkipped, "slow fetches: %u skipped, %u counted", r.jumpedSeconds,
+        clockSkipped);
+  solarMin = 300000, solarMax = 950000;
+
+  // the time set an hour forward, then ten minutes back: steps, not skipped seconds
+  r = run(1000000, EPOCH, DAY / 4, {{3600ull * 1000000, 3600ll * 1000000}, {7200ull * 1000000, -600ll * 1000000}});
+  printf("time set twice:  %u repeated, %u skipped, %u steps (%u counted)\n", r.repeated, r.jumpedSeconds, r.steps,
+         clockSteps);
+  CHECK(clockSteps == 2 && r.steps == 2 && clockSkipped == 0, "%u steps (%u counted), %u skipped", r.steps, clockSteps,
+        clockSkipped);
+
+  return checkResult("clock_test");
+}
@@ -0,0 +1,244 @@
+// The /events live feed under load: an hour of the one second tick to fast, slow and
+// stalled dashboards at once. Every queue stays within the message and byte bounds,
+// slow clients skip to the newest events instead of falling behind, and fast ones
+// miss nothing.
+#include <memory>
+#include <string>
+#include <vector>
+#define private public // the event source's client list
+#include "web.h"
+#undef private
+#include "check.h"
+
+// What the section needs of the sketch and the core
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(m) ((void)(m))
+#define portEXIT_CRITICAL(m) ((void)(m))
+AsyncWebServer server(80);
+static unsigned duty = 0;
+static unsigned schedDuty() { return duty; }
+#include "live.inc"
+
+enum Kind { FAST, SLOW, STALLED };
+static const char *kindName[] = {"fast", "slow", "stalled"};
+
+struct Dashboard
+{
+  AsyncClient *client;
+  Kind kind;
+  size_t bytes = 0;
+  std::vector<int> seconds; // of each clock event, in order
+  std::string solar;
+  int solars = 0;
+};
+
+static AsyncClient *connect(AsyncWebServer &on, const char *path)
+{
+  AsyncClient *client = new AsyncClient;
+  new AsyncWebServerRequest(&on, client);
+  client->feed(std::string("GET ") + path + " HTTP/1.1\r\nHost: d\r\nAccept: text/event-stream\r\n\r\n");
+  client->peerAck(); // the head is acknowledged, the request becomes an event source client
+  return client;
+}
+
+static AsyncEventSourceClient *sourceClient(AsyncEventSource &source, AsyncClient *client)
+{
+  for (auto c : source._clients)
+    if (c->client() == client)
+      return c;
+  return nullptr;
+}
+
+static std::string field(const std::string &event, const char *name)
+{
+  std::string tag = std::string(name) + ": ";
+  size_t p = event.rfind(tag);
+  if (p == std::string::npos)
+    return "";
+  p += tag.size();
+  return event.substr(p, event.find("\r\n", p) - p);
+}
+
+// Takes the complete events off the wire
+static void drain(Dashboard &d)
+{
+  std::string &wire = d.client->wire;
+  size_t p = 0;
+  for (size_t end; (end = wire.find("\r\n\r\n", p)) != std::string::npos; p = end + 4)
+  {
+    std::string event = wire.substr(p, end + 2 - p);
+    std::string name = field(event, "event");
+    if (name == "clock")
+    {
+      std::string utc = field(event, "data");
+      int h, m, s;
+      if (sscanf(utc.c_str(), "{\"utc\":\"%d:%d:%d\"", &h, &m, &s) == 3)
+        d.seconds.push_back(h * 3600 + m * 60 + s);
+    }
+    else if (name == "solar")
+    {
+      d.solar = field(event, "data");
+      d.solars++;
+    }
+  }
+  d.bytes += p;
+  wire.erase(0, p);
+}
+
+static bool increasing(const std::vector<int> &v)
+{
+  for (size_t i = 1; i < v.size(); i++)
+    if (v[i] <= v[i - 1])
+      return false;
+  return true;
+}
+
+static void setSolar(int fetch)
+{
+  solarData.source = "N0NBH";
+  solarData.updated = "18 Oct 2026 " + String(fetch) + "00 GMT";
+  solarData.solarFlux = 150 + fetch;
+  solarData.kIndexNT = "No \"Report\"";
+  const char *bands[] = {"80m-40m", "30m-20m", "17m-15m", "12m-10m"};
+  for (int i = 0; i < 8; i++)
+  {
+    solarData.bandConditions[i].name = bands[i % 4];
+    solarData.bandConditions[i].time = i < 4 ? "day" : "night";
+    solarData.bandConditions[i].condition = "Good";
+  }
+  for (int i = 0; i < 5; i++)
+  {
+    solarData.vhfConditions[i].name = "E-Skip";
+    solarData.vhfConditions[i].location = "europe_6m";
+    solarData.vhfConditions[i].condition = "Band Closed";
+  }
+}
+
+int main()
+{
+  setSolar(0);
+  publishSolarData(); // the fetch at boot, before anyone listens
+  startLiveFeed();
+
+  std::vector<Dashboard> dashboards;
+  for (int i = 0; i < 64; i++)
+  {
+    Kind kind = i % 4 == 3 ? STALLED : i % 4 == 2 ? SLOW : FAST;
+    Dashboard d = {connect(server, "/events"), kind};
+    if (kind == SLOW)
+      d.client->window = 700;
+    dashboards.push_back(d);
+  }
+  CHECK(liveEvents.count() == dashboards.size(), "%zu clients", liveEvents.count());
+  for (auto &d : dashboards)
+  {
+    drain(d);
+    CHECK(d.solars == 1, "%s client got %d solar events on connecting", kindName[d.kind], d.solars);
+  }
+
+  const int TICKS = 3600;
+  size_t peakPackets = 0, peakBytes = 0;
+  for (int t = 0; t < TICKS; t++)
+  {
+    char utc[16], local[16];
+    snprintf(utc, sizeof(utc), "%02d:%02d:%02d", t / 3600, t / 60 % 60, t % 60);
+    snprintf(local, sizeof(local), "%02d:%02d:%02d", t / 3600 + 2, t / 60 % 60, t % 60);
+    WiFi.rssi = -50 - t % 20;
+    duty = t % 1000;
+    publishLiveStatus(utc, local);
+    if (t % 900 == 899)
+    {
+      setSolar(t / 900 + 1);
+      publishSolarData();
+    }
+    for (auto &d : dashboards)
+    {
+      if (d.kind == FAST || (d.kind == SLOW && t % 10 == 9))
+        d.client->peerAck();
+      drain(d);
+      AsyncEventSourceClient *c = sourceClient(liveEvents, d.client);
+      CHECK(c->packetsWaiting() <= SSE_MAX_QUEUED_MESSAGES, "tick %d: %zu queued", t, c->packetsWaiting());
+      CHECK(c->bytesWaiting() <= SSE_MAX_QUEUED_BYTES, "tick %d: %zu bytes queued", t, c->bytesWaiting());
+      peakPackets = std::max(peakPackets, c->packetsWaiting());
+      peakBytes = std::max(peakBytes, c->bytesWaiting());
+    }
+  }
+  for (int r = 0; r < 20; r++)
+    for (auto &d : dashboards)
+      if (d.kind != STALLED)
+      {
+        d.client->peerAck();
+        drain(d);
+      }
+
+  std::string newestSolar = solarJson->c_str();
+  size_t bytes[3] = {}, dropped[3] = {};
+  int n[3] = {};
+  for (auto &d : dashboards)
+  {
+    AsyncEventSourceClient *c = sourceClient(liveEvents, d.client);
+    bytes[d.kind] += d.bytes;
+    dropped[d.kind] += c->messagesDropped();
+    n[d.kind]++;
+    if (d.kind == STALLED)
+    {
+      CHECK(d.bytes + d.client->wire.size() <= 5744, "stalled client got %zu bytes", d.bytes);
+      continue;
+    }
+    CHECK(increasing(d.seconds), "%s client got the clock out of order", kindName[d.kind]);
+    CHECK(!d.seconds.empty() && d.seconds.back() == TICKS - 1, "%s client ends at second %d", kindName[d.kind],
+          d.seconds.empty() ? -1 : d.seconds.back());
+    CHECK(d.solar == newestSolar, "%s client ends on an old solar event", kindName[d.kind]);
+    if (d.kind == FAST)
+    {
+      CHECK(d.seconds.size() == (size_t)TICKS, "fast client got %zu of %d seconds", d.seconds.size(), TICKS);
+      CHECK(c->messagesDropped() == 0, "fast client dropped %u", c->messagesDropped());
+    }
+  }
+  CHECK(dropped[SLOW] > 0 && dropped[STALLED] > 0, "slow clients dropped nothing");
+  for (int k = FAST; k <= STALLED; k++)
+    printf("%-7s client: %6zu bytes, %5zu events dropped\n", kindName[k], bytes[k] / n[k], dropped[k] / n[k]);
+  printf("peak queue: %zu events, %zu bytes\n", peakPackets, peakBytes);
+
+  // a dashboard that connects now gets the newest solar data at once
+  Dashboard late = {connect(server, "/events"), FAST};
+  drain(late);
+  CHECK(late.solars == 1 && late.solar == newestSolar, "late client got %d solar events", late.solars);
+  dashboards.push_back(late);
+
+  // Without coalescing the bounds alone hold a stalled client's queue: by count for
+  // small events, by bytes for large ones, and it keeps the newest
+  AsyncEventSource raw("/raw");
+  server.addHandler(&raw);
+  AsyncClient *stalled = connect(server, "/raw");
+  stalled->window = 0;
+  AsyncEventSourceClient *c = sourceClient(raw, stalled);
+  for (int i = 0; i < 100; i++)
+    raw.send(("{\"n\":" + std::to_string(i) + "}").c_str(), "small");
+  CHECK(c->packetsWaiting() == SSE_MAX_QUEUED_MESSAGES, "%zu small events queued", c->packetsWaiting());
+  CHECK(c->messagesDropped() == 100 - SSE_MAX_QUEUED_MESSAGES, "%u dropped", c->messagesDropped());
+  std::string large(900, 'x');
+  for (int i = 0; i < 100; i++)
+  {
+    large[0] = '0' + i % 10;
+    raw.send(large.c_str(), "large");
+    CHECK(c->bytesWaiting() <= SSE_MAX_QUEUED_BYTES, "%zu bytes queued", c->bytesWaiting());
+  }
+  CHECK(c->bytesWaiting() > SSE_MAX_QUEUED_BYTES - 1000, "only %zu bytes queued", c->bytesWaiting());
+  stalled->window = 5744;
+  c->_onPoll(); // as the TCP stack polls a connection with room again
+  for (int r = 0; r < 10; r++)
+    stalled->peerAck();
+  CHECK(field(stalled->wire, "data") == large, "the newest large event was dropped");
+  CHECK(stalled->wire.find("data: {\"n\":") == std::string::npos, "small events outlived large ones");
+
+  // hanging up frees every client
+  stalled->discCb(stalled->discArg, stalled);
+  for (auto &d : dashboards)
+    d.client->discCb(d.client->discArg, d.client);
+  CHECK(liveEvents.count() == 0 && raw.count() == 0, "%zu clients left", liveEvents.count() + raw.count());
+  server.removeHandler(&raw);
+
+  return checkResult("event_source_test");
+}
@@ -0,0 +1,73 @@
+// Recorded touch traces replayed through the touch engine and the gesture recognizer
+// cut from the sketch, with loop() coming round every 0.2, 1 and 10 ms. Each trace
+// names the gestures it must give, in order; see traces/traces.py.
+#include "touch_sim.h"
+#include "check.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "touch.inc"
+
+static const char *gestureName[] = {"TAP", "DOUBLE_TAP", "LONG_PRESS", "SWIPE_LEFT", "SWIPE_RIGHT"};
+static const char *traces[] = {"tap", "noisy_tap", "double_tap", "two_taps", "long_press",
+                               "swipe_left", "swipe_right", "slow_drag", "scroll_up", "tap_swipe"};
+
+struct Sample
+{
+  uint16_t z, x, y;
+};
+
+int main()
+{
+  loadTouchCalibration();
+  for (const char *name : traces)
+  {
+    std::ifstream in(std::string("traces/trace_") + name + ".txt");
+    std::string line;
+    std::getline(in, line);
+    CHECK(line.rfind("# expect:", 0) == 0, "%s: no expect line", name);
+    std::string expect = line.substr(line.find(':') + 1);
+    expect.erase(0, expect.find_first_not_of(' '));
+    std::vector<Sample> trace;
+    while (std::getline(in, line))
+    {
+      Sample s;
+      std::istringstream(line) >> s.z >> s.x >> s.y;
+      trace.push_back(s);
+    }
+    CHECK(trace.size() > 1000, "%s: %zu samples", name, trace.size());
+
+    for (uint64_t pass : {200, 1000, 10000})
+    {
+      uint64_t t0 = vt_us, end = t0 + trace.size() * 1000ull;
+      finger = [&](uint64_t now, uint16_t &x, uint16_t &y, uint16_t &z)
+      {
+        size_t ms = (now - t0) / 1000;
+        if (ms >= trace.size() || !trace[ms].z)
+          return false;
+        z = trace[ms].z;
+        x = trace[ms].x;
+        y = trace[ms].y;
+        return true;
+      };
+      std::string got;
+      while (vt_us < end)
+      {
+        vt_us += pass;
+        Gesture g;
+        while (readGesture(g))
+        {
+          got += std::string(got.empty() ? "" : " ") + gestureName[g.type];
+          CHECK(g.ms >= t0 / 1000 && g.ms + g.duration <= millis(), "%s: %s at %u ms for %u ms, now %u", name,
+                gestureName[g.type], g.ms, g.duration, millis());
+          CHECK(g.x < tft.width() && g.y < tft.height(), "%s: %s at %u,%u", name, gestureName[g.type], g.x, g.y);
+        }
+      }
+      CHECK(got == expect, "%s, a pass every %llu us: got [%s], expected [%s]", name, (unsigned long long)pass,
+            got.c_str(), expect.c_str());
+    }
+    printf("%-12s [%s]\n", name, expect.c_str());
+  }
+  return checkResult("gesture_trace_test");
+}
@@ -0,0 +1,462 @@
+// The NTP job cut from the sketch against an NTP stand-in on a local UDP port, with a
+// virtual system time behind gettimeofday(), settimeofday() and adjtime(). A request
+// is answered after real one-way delays; the waits in between with nothing on the wire
+// are skipped. Covers the boot cases, an offset above NTP_STEP_MS stepped and one
+// below it slewed, the answers that must be turned down, a silent server and Wi-Fi
+// being down.
+#include "check.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <netinet/in.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Real time plus the waits skipped, and the true time on it
+static std::atomic<int64_t> skippedUs{0};
+static int64_t realUs()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+static int64_t monoUs() { return realUs() + skippedUs; }
+static const int64_t TRUTH = 1760000000LL * 1000000; // the true time at monoUs() 0
+static int64_t trueUs() { return TRUTH + monoUs(); }
+
+// The device's system time, monoUs() plus an offset; adjtime() slews a delta in at 5 %
+static std::mutex deviceLock;
+static int64_t deviceOffset = 0, slewLeft = 0, slewFrom = 0;
+static int adjtimes = 0;
+static void slew()
+{
+  int64_t now = monoUs(), can = (now - slewFrom) / 20;
+  int64_t take = slewLeft > 0 ? std::min(slewLeft, can) : std::max(slewLeft, -can);
+  deviceOffset += take;
+  slewLeft -= take;
+  slewFrom = now;
+}
+static int64_t deviceUs()
+{
+  std::lock_guard<std::mutex> hold(deviceLock);
+  slew();
+  return monoUs() + deviceOffset;
+}
+static int deviceGettimeofday(struct timeval *tv, void *)
+{
+  int64_t t = deviceUs();
+  tv->tv_sec = t / 1000000;
+  tv->tv_usec = t % 1000000;
+  return 0;
+}
+static int deviceSettimeofday(const struct timeval *tv, void *)
+{
+  std::lock_guard<std::mutex> hold(deviceLock);
+  deviceOffset = tv->tv_sec * 1000000LL + tv->tv_usec - monoUs();
+  slewLeft = 0;
+  return 0;
+}
+static int deviceAdjtime(const struct timeval *delta, struct timeval *)
+{
+  std::lock_guard<std::mutex> hold(deviceLock);
+  slew();
+  slewLeft = delta->tv_sec * 1000000LL + delta->tv_usec;
+  adjtimes++;
+  return 0;
+}
+static time_t deviceTime(time_t *) { return deviceUs() / 1000000; }
+static uint32_t millis() { return (uint32_t)(monoUs() / 1000); }
+
+// What the section needs of the sketch and the core
+struct String
+{
+  std::string s;
+  String(const char *c = "") : s(c) {}
+};
+struct
+{
+  template <class... Args>
+  void printf(const char *format, Args... args) {}
+  void println(const char * = "") {}
+} Serial;
+struct IPAddress
+{
+  uint32_t a = 0;
+  IPAddress() {}
+  IPAddress(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3) : a(b0 | b1 << 8 | b2 << 16 | (uint32_t)b3 << 24) {}
+  operator uint32_t() const { return a; }
+};
+enum
+{
+  WL_CONNECTED = 3,
+  WL_DISCONNECTED = 6
+};
+static int lookups = 0;
+struct
+{
+  int state = WL_CONNECTED;
+  int status() { return state; }
+  int hostByName(const char *, IPAddress &ip)
+  {
+    lookups++;
+    ip = IPAddress(127, 0, 0, 1);
+    return 1;
+  }
+} WiFi;
+static std::map<std::string, int64_t> nvs;
+struct
+{
+  const char *space;
+  void begin(const char *name, bool) { space = name; }
+  void end() {}
+  void putLong64(const char *key, int64_t v) { nvs[std::string(space) + "/" + key] = v; }
+  int64_t getLong64(const char *key, int64_t otherwise)
+  {
+    auto it = nvs.find(std::string(space) + "/" + key);
+    return it == nvs.end() ? otherwise : it->second;
+  }
+} prefs;
+
+// Requests sent and not yet answered or dropped by the stand-in
+static std::atomic<int> inFlight{0};
+static const uint16_t SERVER_PORT = 12373; // for NTP_PORT, which needs root
+class WiFiUDP
+{
+  int fd = -1;
+  uint8_t buf[512];
+  int len = 0, pos = 0;
+  sockaddr_in to;
+  std::vector<uint8_t> out;
+
+public:
+  uint8_t begin(uint16_t port)
+  {
+    if (fd >= 0)
+      return 1; // once per boot on the device, once per run here
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in a = {};
+    a.sin_family = AF_INET;
+    a.sin_port = htons(port);
+    a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (sockaddr *)&a, sizeof(a)))
+    {
+      perror("bind");
+      exit(1);
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    return 1;
+  }
+  int beginPacket(IPAddress ip, uint16_t)
+  {
+    to = {};
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = ip.a;
+    to.sin_port = htons(SERVER_PORT);
+    out.clear();
+    return 1;
+  }
+  size_t write(const uint8_t *p, size_t n)
+  {
+    out.insert(out.end(), p, p + n);
+    return n;
+  }
+  int endPacket()
+  {
+    inFlight++;
+    return sendto(fd, out.data(), out.size(), 0, (sockaddr *)&to, sizeof(to)) > 0;
+  }
+  int parsePacket()
+  {
+    len = recv(fd, buf, sizeof(buf), 0);
+    pos = 0;
+    return len > 0 ? len : 0;
+  }
+  int read(uint8_t *p, size_t n)
+  {
+    int k = std::min((int)n, len - pos);
+    memcpy(p, buf + pos, k);
+    pos += k;
+    return k;
+  }
+  bool pending()
+  {
+    uint8_t b;
+    return recv(fd, &b, 1, MSG_PEEK) > 0;
+  }
+};
+
+// The scheduler, as far as the job uses it
+static int8_t jobNtp = 0;
+static int64_t dueUs = 0;
+static void schedAt(int8_t, uint32_t inMs) { dueUs = monoUs() + inMs * 1000LL; }
+static int zoneLoads = 0;
+void loadTimeZone() { zoneLoads++; }
+
+#define gettimeofday deviceGettimeofday
+#define settimeofday deviceSettimeofday
+#define adjtime deviceAdjtime
+#define time(t) deviceTime(t)
+#include "ntp.inc"
+#undef time
+
+// The stand-in: the true time, after a delay each way, or a fault
+enum Fault
+{
+  GOOD,
+  SILENT,
+  WRONG_ORIGIN,
+  CLIENT_MODE,
+  KISS,
+  ALARM,
+  SHORT,
+  TWICE
+};
+static std::atomic<int> fault{GOOD}, inMs{20}, outMs{20}, served{0};
+static void serve(int fd)
+{
+  for (;;)
+  {
+    uint8_t q[64];
+    sockaddr_in from;
+    socklen_t fromLen = sizeof(from);
+    int n = recvfrom(fd, q, sizeof(q), 0, (sockaddr *)&from, &fromLen);
+    if (n < 48)
+      continue;
+    int f = fault;
+    std::this_thread::sleep_for(std::chrono::milliseconds(inMs));
+    if (f == SILENT)
+    {
+      inFlight--;
+      continue;
+    }
+    uint8_t r[48] = {};
+    r[0] = (f == ALARM ? 3 << 6 : 0) | 4 << 3 | (f == CLIENT_MODE ? 3 : 4);
+    r[1] = f == KISS ? 0 : 2;
+    memcpy(r + 24, q + 40, 8);
+    if (f == WRONG_ORIGIN)
+      r[31] ^= 1;
+    usToNtp(trueUs(), r + 32);
+    usToNtp(trueUs() + 50, r + 40);
+    std::this_thread::sleep_for(std::chrono::milliseconds(outMs));
+    sendto(fd, r, f == SHORT ? 40 : 48, 0, (sockaddr *)&from, fromLen);
+    if (f == TWICE)
+      sendto(fd, r, 48, 0, (sockaddr *)&from, fromLen);
+    served++;
+    inFlight--;
+  }
+}
+
+// Runs the job as loop() would until stop() or for seconds of device time. A wait is
+// skipped unless the job listens and a request is out or an answer waits to be read.
+static int64_t jobMaxUs = 0;
+template <class Stop>
+static bool runUntil(Stop stop, double seconds)
+{
+  int64_t end = monoUs() + seconds * 1e6;
+  while (monoUs() < end)
+  {
+    if (stop())
+      return true;
+    int64_t wait = dueUs - monoUs();
+    if (wait > 0)
+    {
+      if (ntp.waiting && (inFlight || ntpUdp.pending()))
+        std::this_thread::sleep_for(std::chrono::microseconds(wait));
+      else
+        skippedUs += wait;
+    }
+    int64_t t = realUs();
+    ntpJob();
+    jobMaxUs = std::max(jobMaxUs, realUs() - t);
+  }
+  return stop();
+}
+
+// A boot with the system time deviceError off the truth, or unset
+static void boot(int64_t deviceError, bool timeKept)
+{
+  while (inFlight)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  uint8_t stale[64];
+  while (ntpUdp.parsePacket() > 0)
+    ntpUdp.read(stale, sizeof(stale));
+  {
+    std::lock_guard<std::mutex> hold(deviceLock);
+    deviceOffset = timeKept ? TRUTH + deviceError : -monoUs() + 1000000;
+    slewLeft = 0;
+    slewFrom = monoUs();
+  }
+  ntp = NtpState();
+  timeSource = TIME_NONE;
+  dueUs = monoUs();
+  adjtimes = zoneLoads = 0;
+  jobMaxUs = 0;
+  fault = GOOD;
+  inMs = outMs = 20;
+  startTimeService();
+}
+
+static double errorMs() { return (deviceUs() - trueUs()) / 1000.0; }
+
+int main()
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in a = {};
+  a.sin_family = AF_INET;
+  a.sin_port = htons(SERVER_PORT);
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(fd, (sockaddr *)&a, sizeof(a)))
+  {
+    perror("bind");
+    return 1;
+  }
+  std::thread(serve, fd).detach();
+  ntpUdp.begin(NTP_LOCAL_PORT);
+  const double LISTEN_ERROR_MS = NTP_LISTEN_MS / 2.0 + 1; // an answer waits up to NTP_LISTEN_MS
+
+  // timestamps both ways, either side of the 2036 wrap
+  for (int64_t us : {0LL, 1760000000123456LL, 2085978495999999LL, 2085978496000000LL, 4000000000000001LL})
+  {
+    uint8_t p[8];
+    usToNtp(us, p);
+    CHECK(llabs(ntpToUs(p) - us) <= 1, "%lld us comes back as %lld", (long long)us, (long long)ntpToUs(p));
+  }
+
+  // a cold boot with nothing kept: the first answer is stepped in and saved
+  nvs.clear();
+  boot(0, false);
+  CHECK(timeSource == TIME_NONE, "time from %s at a cold boot", timeSourceNames[timeSource]);
+  bool synced = runUntil([] { return timeSource == TIME_NTP; }, 5);
+  printf("cold boot:          synced %d, %u steps, %+.2f ms off, round trip %.2f ms (40 on the wire), "
+         "the job ran %lld us at most\n",
+         synced, ntp.steps, errorMs(), ntp.delayUs / 1000.0, (long long)jobMaxUs);
+  CHECK(synced && ntp.steps == 1 && adjtimes == 0, "cold boot: synced %d, %u steps, %d slews", synced, ntp.steps,
+        adjtimes);
+  CHECK(fabs(errorMs()) < LISTEN_ERROR_MS, "cold boot: %.2f ms off", errorMs());
+  CHECK(ntp.delayUs >= 40000 && ntp.delayUs < 40000 + NTP_LISTEN_MS * 1000 + 2000, "cold boot: round trip %lld us",
+        (long long)ntp.delayUs);
+  CHECK(zoneLoads == 1, "the time zone loaded %d times", zoneLoads);
+  CHECK(llabs(nvs["time/lastTime"] - trueUs() / 1000000) <= 1, "saved %lld", (long long)nvs["time/lastTime"]);
+
+  // after a power cut the saved time runs on from boot until NTP steps it
+  nvs["time/lastTime"] = trueUs() / 1000000 - 3 * 3600;
+  boot(0, false);
+  double before = errorMs();
+  CHECK(timeSource == TIME_SAVED && fabs(before + 3 * 3600e3) < 1000, "time from %s, %.0f ms off",
+        timeSourceNames[timeSource], before);
+  synced = runUntil([] { return timeSource == TIME_NTP; }, 5);
+  printf("from the saved time: %.0f s off at boot, synced %d, %u steps, %+.2f ms off\n", before / 1000, synced,
+         ntp.steps, errorMs());
+  CHECK(synced && ntp.steps == 1 && fabs(errorMs()) < LISTEN_ERROR_MS, "saved time: %u steps, %.2f ms off", ntp.steps,
+        errorMs());
+
+  // the time kept over a CPU reset: an offset above NTP_STEP_MS is stepped, one below
+  // it is slewed out by adjtime()
+  for (int64_t offMs : {-400, -200, 200, 400, -120, -40, 40, 120})
+  {
+    boot(offMs * 1000, true);
+    CHECK(timeSource == TIME_RTC, "time from %s after a CPU reset", timeSourceNames[timeSource]);
+    synced = runUntil([] { return timeSource == TIME_NTP; }, 5);
+    double measured = ntp.offsetUs / 1000.0;
+    skippedUs += 10 * 1000000; // for the slew to finish
+    bool stepped = ntp.steps == 1 && adjtimes == 0, slewed = ntp.steps == 0 && adjtimes == 1;
+    printf("%+5lld ms off:        measured %+8.2f ms, %s, %+.2f ms off after\n", (long long)offMs, measured,
+           stepped ? "stepped" : slewed ? "slewed" : "?", errorMs());
+    CHECK(synced && (llabs(offMs) > NTP_STEP_MS ? stepped : slewed), "%+lld ms off: %u steps, %d slews",
+          (long long)offMs, ntp.steps, adjtimes);
+    CHECK(fabs(measured + offMs) < LISTEN_ERROR_MS && fabs(errorMs()) < LISTEN_ERROR_MS,
+          "%+lld ms off: measured %+.2f ms, %.2f ms off after", (long long)offMs, measured, errorMs());
+  }
+
+  // 60 ms out and 10 back: NTP is off by half the difference, and the round trip shows it
+  boot(0, true);
+  inMs = 60, outMs = 10;
+  runUntil([] { return ntp.syncs > 0; }, 5);
+  printf("60/10 ms each way:   offset %+.2f ms (+25 in theory), round trip %.2f ms\n", ntp.offsetUs / 1000.0,
+         ntp.delayUs / 1000.0);
+  CHECK(fabs(ntp.offsetUs / 1000.0 - 25) < LISTEN_ERROR_MS + 0.5, "asymmetric: offset %lld us",
+        (long long)ntp.offsetUs);
+  CHECK(ntp.delayUs >= 70000 && ntp.delayUs < 70000 + NTP_LISTEN_MS * 1000 + 2000, "asymmetric: round trip %lld us",
+        (long long)ntp.delayUs);
+
+  // answers that must not be taken, the echo of another request among them
+  const char *faultNames[] = {"", "", "wrong origin", "client mode", "kiss-o'-death", "alarm", "short", ""};
+  for (int f : {WRONG_ORIGIN, CLIENT_MODE, KISS, ALARM, SHORT})
+  {
+    boot(0, false);
+    fault = f;
+    runUntil([] { return ntp.timeouts > 0 || ntp.syncs > 0; }, 5);
+    printf("%-20s %u rejected, %u synced\n", faultNames[f], ntp.rejected, ntp.syncs);
+    CHECK(ntp.syncs == 0 && ntp.rejected == 1 && ntp.timeouts == 1, "%s: %u synced, %u rejected, %u timeouts",
+          faultNames[f], ntp.syncs, ntp.rejected, ntp.timeouts);
+  }
+  boot(0, false);
+  inMs = outMs = 300; // over NTP_DELAY_MAX_MS
+  runUntil([] { return ntp.timeouts > 0 || ntp.syncs > 0; }, 5);
+  CHECK(ntp.syncs == 0 && ntp.rejected == 1, "600 ms round trip: %u synced, %u rejected", ntp.syncs, ntp.rejected);
+  boot(0, false);
+  fault = TWICE; // the duplicate is stale by the next poll
+  runUntil([] { return ntp.syncs >= 2; }, 2 * 3600);
+  CHECK(ntp.syncs == 2 && ntp.rejected == 1, "duplicated answers: %u synced, %u rejected", ntp.syncs, ntp.rejected);
+
+  // no answer: the servers take turns, the retries back off, the job never blocks
+  nvs.clear();
+  boot(0, false);
+  fault = SILENT;
+  std::vector<int64_t> retries;
+  int servers[2] = {};
+  uint32_t timeouts = 0;
+  runUntil([&]
+           {
+             if (ntp.timeouts != timeouts)
+             {
+               timeouts = ntp.timeouts;
+               servers[ntp.server]++;
+               retries.push_back(dueUs - monoUs());
+             }
+             return ntp.timeouts >= 9; },
+           24 * 3600);
+  printf("silent server:       %u timeouts, retries after", ntp.timeouts);
+  for (int64_t r : retries)
+    printf(" %lld", (long long)((r + 500000) / 1000000));
+  printf(" s, the job ran %lld us at most\n", (long long)jobMaxUs);
+  CHECK(timeSource == TIME_NONE && ntp.syncs == 0, "silent server: time from %s", timeSourceNames[timeSource]);
+  CHECK(retries.size() == 9 && llabs(retries[0] - (int64_t)NTP_RETRY_MS * 1000) < 100000 &&
+            llabs(retries[8] - (int64_t)NTP_POLL_MS * 1000) < 100000,
+        "silent server: %zu retries", retries.size());
+  CHECK(abs(servers[0] - servers[1]) <= 1, "silent server: %d and %d tries", servers[0], servers[1]);
+  CHECK(jobMaxUs < 2000, "the job ran %lld us", (long long)jobMaxUs);
+  fault = GOOD;
+  synced = runUntil([] { return ntp.syncs > 0; }, 3600);
+  CHECK(synced && ntp.retryMs == NTP_RETRY_MS, "after the silence: synced %d, retry in %lu ms", synced,
+        (unsigned long)ntp.retryMs);
+
+  // Wi-Fi down: no request goes out, and the time is still saved hourly
+  nvs.clear();
+  nvs["time/lastTime"] = TRUTH / 1000000;
+  boot(0, false);
+  WiFi.state = WL_DISCONNECTED;
+  int servedBefore = served;
+  runUntil([] { return false; }, 3 * 3600 + 60);
+  int64_t behind = deviceUs() / 1000000 - nvs["time/lastTime"];
+  CHECK(served == servedBefore && behind <= (int64_t)(TIME_SAVE_S + NTP_RETRY_MS / 1000),
+        "Wi-Fi down: %d requests answered, saved time %lld s behind", served - servedBefore, (long long)behind);
+  WiFi.state = WL_CONNECTED;
+
+  return checkResult("ntp_test");
+}
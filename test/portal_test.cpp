@@ -0,0 +1,71 @@
+// The configuration portal page as the sketch serves it: the gzipped blob with its
+// ETag to clients that take gzip, a bare 304 on revalidation, and the plain page,
+// untouched by template processing, to clients that do not
+#include "web.h"
+#include "check.h"
+#include "html_page.h"
+#include "html_page_gz.h"
+
+static const std::string gzipped((const char *)index_html_gz, sizeof(index_html_gz));
+static const std::string plain(index_html);
+
+int main()
+{
+  AsyncWebServer server(80);
+  // as in startConfigurationPortal()
+  server.serveStatic_P("/", "text/html", index_html_gz, sizeof(index_html_gz), INDEX_HTML_GZ_ETAG, "no-cache")
+      .setIdentity((const uint8_t *)index_html, strlen_P(index_html));
+
+  for (size_t window : {5744u, 1436u, 100u})
+  {
+    Reply r = fetch(server, "GET / HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip, deflate\r\n\r\n", window);
+    CHECK(r.head.rfind("HTTP/1.1 200 OK\r\n", 0) == 0, "window %zu: %s", window, r.head.c_str());
+    CHECK(r.body == gzipped, "window %zu: %zu bytes of body", window, r.body.size());
+    CHECK(hasHeader(r, "Content-Encoding: gzip"), "window %zu", window);
+    CHECK(hasHeader(r, "Content-Length: " + std::to_string(sizeof(index_html_gz))), "window %zu", window);
+    CHECK(hasHeader(r, "ETag: " INDEX_HTML_GZ_ETAG), "window %zu", window);
+    CHECK(hasHeader(r, "Cache-Control: no-cache"), "window %zu", window);
+    CHECK(hasHeader(r, "Vary: Accept-Encoding"), "window %zu", window);
+    if (window == 100)
+      CHECK(r.acks >= sizeof(index_html_gz) / 100, "%zu acks", r.acks);
+
+    // the page is sent as it is, '%' and all
+    r = fetch(server, "GET / HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip;q=0, identity\r\n\r\n", window);
+    CHECK(r.body == plain, "window %zu: %zu bytes of body", window, r.body.size());
+    CHECK(r.head.find("Content-Encoding") == std::string::npos, "window %zu", window);
+    CHECK(r.head.find("ETag") == std::string::npos, "the tag names the gzipped bytes");
+    CHECK(hasHeader(r, "Vary: Accept-Encoding"), "window %zu", window);
+  }
+
+  // revalidation, with the tag alone or in a list, or any tag
+  for (const char *match : {INDEX_HTML_GZ_ETAG, "\"0badcafe\", " INDEX_HTML_GZ_ETAG, "*"})
+  {
+    Reply r = fetch(server, std::string("GET / HTTP/1.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: ") + match + "\r\n\r\n");
+    CHECK(r.head.rfind("HTTP/1.1 304 Not Modified\r\n", 0) == 0, "%s: %s", match, r.head.c_str());
+    CHECK(r.body.empty(), "%s: %zu bytes of body", match, r.body.size());
+    CHECK(hasHeader(r, "ETag: " INDEX_HTML_GZ_ETAG), "%s", match);
+    CHECK(hasHeader(r, "Cache-Control: no-cache"), "%s", match);
+  }
+
+  // an old tag gets the page again
+  Reply r = fetch(server, "GET / HTTP/1.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: \"0badcafe\"\r\n\r\n");
+  CHECK(r.body == gzipped, "%zu bytes of body", r.body.size());
+
+  // a tag does not stand for the plain page
+  r = fetch(server, "GET / HTTP/1.1\r\nIf-None-Match: " INDEX_HTML_GZ_ETAG "\r\n\r\n");
+  CHECK(r.head.rfind("HTTP/1.1 200 OK\r\n", 0) == 0, "%s", r.head.c_str());
+  CHECK(r.body == plain, "%zu bytes of body", r.body.size());
+
+  // no Accept-Encoding at all
+  r = fetch(server, "GET / HTTP/1.0\r\n\r\n");
+  CHECK(r.body == plain, "%zu bytes of body", r.body.size());
+
+  // other methods and paths are not the page's
+  r = fetch(server, "POST / HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+  CHECK(r.head.rfind("HTTP/1.1 200", 0) != 0 && r.body.empty(), "%s", r.head.c_str());
+  r = fetch(server, "GET /index.html HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n");
+  CHECK(r.head.rfind("HTTP/1.1 200", 0) != 0 && r.body.empty(), "%s", r.head.c_str());
+
+  printf("portal page: %zu bytes gzipped, %zu plain\n", gzipped.size(), plain.size());
+  return checkResult("portal_test");
+}
@@ -0,0 +1,229 @@
+// loop() and the scheduler cut from the sketch on a virtual clock, with the idle task
+// light-sleeping through the waits between jobs: an hour of a touch every 20 to 60 s,
+// polled and with TOUCH_IRQ, from boot and across the wrap of micros(). loop() never
+// wakes before a deadline nor much after it, every press is seen, and the measured
+// duty cycle matches the time the jobs took.
+#include "check.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static uint32_t vt = 0; // what micros() reads
+static uint32_t micros() { return vt; }
+struct
+{
+  template <class... Args>
+  void printf(const char *format, Args... args) { ::printf(format, args...); }
+  void println(const char *s) { puts(s); }
+} Serial;
+void schedAt(int8_t id, uint32_t inMs);
+void schedAtUs(int8_t id, uint32_t inUs);
+void schedCancel(int8_t id);
+#include "power.inc"
+
+#define SLEEP_MIN_US 3000 // CONFIG_FREERTOS_IDLE_TIME_BEFORE_SLEEP, 3 ticks
+#define SLEEP_EXIT_US 400 // from light sleep until the task runs again
+
+static int8_t jobTouch, jobClock;
+static bool useIrq;
+static uint32_t idlePoll = TOUCH_IDLE_POLL_MS;
+static bool irqArmed, irqFired;
+static std::vector<std::pair<uint32_t, uint32_t>> presses; // [down, up) in us from the start
+static uint32_t t0, lastUp;
+static uint64_t busyUs, sleepUs, wakeups;
+static std::vector<uint32_t> detectLatency;
+static uint32_t earlyWakes, lateWakeMax;
+static bool detected;
+
+static bool fingerDown(uint32_t at)
+{
+  uint32_t t = at - t0;
+  for (auto &p : presses)
+    if (t >= p.first && t < p.second)
+      return true;
+  return false;
+}
+
+// In us from the start, UINT32_MAX if none
+static uint32_t nextPressAfter(uint32_t at)
+{
+  uint32_t t = at - t0;
+  for (auto &p : presses)
+    if (p.first > t)
+      return p.first;
+  return UINT32_MAX;
+}
+
+static void cost(uint32_t us)
+{
+  vt += us;
+  busyUs += us;
+}
+
+// The sketch's touch job as far as the scheduler sees it: a burst read while pressed
+// and the pressure only while not, and the idle poll rate or the interrupt once a tap
+// has had time for a second one
+static void touchJob()
+{
+  bool down = fingerDown(vt);
+  cost(down ? 300 : 60);
+  if (down && !detected)
+  {
+    uint32_t t = vt - t0;
+    for (auto &p : presses)
+      if (t >= p.first && t < p.second)
+        detectLatency.push_back(t - p.first);
+    detected = true;
+  }
+  if (!down && detected)
+  {
+    detected = false;
+    lastUp = vt;
+  }
+  bool busy = down || vt - lastUp < 300000;
+  if (!useIrq)
+    schedPeriod(jobTouch, busy ? TOUCH_POLL_MS : idlePoll);
+  else if (!busy)
+  {
+    schedCancel(jobTouch);
+    irqArmed = true;
+  }
+}
+static void clockJob() { cost(3000); }
+static void rssiJob() { cost(200); }
+static void solarJob() { cost(1800000); }
+static void statsJob() { cost(5000); }
+
+static uint32_t nextDue()
+{
+  uint32_t best = UINT32_MAX;
+  for (uint8_t id = 0; id < schedJobCount; id++)
+    if (schedJobs[id].armed)
+      best = std::min(best, schedJobs[id].due - vt);
+  return vt + best;
+}
+
+// loop(), with ulTaskNotifyTake() on a 1 ms tick; the idle task light-sleeps through
+// waits of SLEEP_MIN_US or more, and the touch interrupt ends a wait at once
+static void loopPass()
+{
+  if (irqFired)
+  {
+    irqFired = false;
+    schedAt(jobTouch, 0);
+  }
+  uint32_t idle = schedRun();
+  vt += 15; // the pass itself
+  wakeups++;
+  if (!idle)
+    return;
+  uint32_t due = nextDue();
+  uint32_t end = vt + ((idle + 999) / 1000 + 1) * 1000 - rand() % 1000;
+  bool irq = false;
+  if (irqArmed)
+  {
+    uint32_t press = nextPressAfter(vt);
+    if (fingerDown(vt))
+      end = vt + 5, irq = true;
+    else if (press != UINT32_MAX && (int32_t)(t0 + press - end) < 0)
+      end = t0 + press, irq = true;
+  }
+  uint32_t wait = end - vt;
+  if (wait >= SLEEP_MIN_US)
+  {
+    sleepUs += wait - SLEEP_MIN_US / 3;
+    wait += SLEEP_EXIT_US;
+  }
+  vt += wait;
+  if (irq)
+  {
+    irqArmed = false;
+    irqFired = true;
+    return;
+  }
+  if ((int32_t)(vt - due) < 0)
+    earlyWakes++;
+  else
+    lateWakeMax = std::max(lateWakeMax, vt - due);
+}
+
+static void runHour(bool irq, uint32_t start)
+{
+  const uint64_t HOUR = 3600000000ull;
+  schedJobCount = 0;
+  schedBusy = 0;
+  vt = t0 = start;
+  useIrq = irq;
+  irqArmed = irqFired = detected = false;
+  lastUp = 0;
+  busyUs = sleepUs = wakeups = 0;
+  earlyWakes = lateWakeMax = 0;
+  detectLatency.clear();
+  presses.clear();
+  srand(46);
+  for (uint32_t t = 2000000; t < HOUR - 5000000; t += 20000000 + rand() % 40000000)
+    presses.push_back({t, t + 80000 + rand() % 900000});
+  jobTouch = schedAdd("touch", touchJob, TOUCH_POLL_MS, 0);
+  jobClock = schedAdd("clock", clockJob, 1000, 0);
+  schedAdd("rssi", rssiJob, 1000, 0);
+  schedAdd("solar", solarJob, 15 * 60 * 1000, 15 * 60 * 1000);
+  schedAdd("stats", statsJob, 15 * 60 * 1000, 15 * 60 * 1000);
+
+  uint64_t elapsed = 0, windows = 0, windowsOff = 0, busyBefore = 0;
+  uint32_t window = schedWindow;
+  while (elapsed < HOUR)
+  {
+    uint32_t before = vt;
+    loopPass();
+    elapsed += vt - before;
+    if (schedWindow != window)
+    {
+      // a duty window closed in this pass; the jobs' time lags by the few us of the
+      // pass after schedRun(), hence to 0.1 %
+      uint32_t truth = (busyUs - busyBefore) * 1000 / (schedWindow - window);
+      windows++;
+      windowsOff += abs((int)truth - (int)schedDuty()) > 1;
+      busyBefore = busyUs;
+      window = schedWindow;
+    }
+  }
+  std::sort(detectLatency.begin(), detectLatency.end());
+  const char *mode = irq ? "TOUCH_IRQ" : idlePoll == TOUCH_POLL_MS ? "polled at 10 ms" : "polled";
+  printf("%-15s from %08x: %6llu wake-ups/h, asleep %4.1f%%, duty %4.2f%%, a press seen after %u ms at worst\n", mode,
+         start, (unsigned long long)wakeups, 100.0 * sleepUs / HOUR, 100.0 * busyUs / HOUR,
+         detectLatency.empty() ? 0 : detectLatency.back() / 1000);
+  if (idlePoll == TOUCH_POLL_MS)
+    return; // what it was before, for comparison
+  CHECK(detectLatency.size() == presses.size(), "%s: %zu of %zu presses seen", mode, detectLatency.size(), presses.size());
+  CHECK(earlyWakes == 0, "%s from %08x: %u wake-ups before the deadline", mode, start, earlyWakes);
+  CHECK(lateWakeMax <= 2000 + SLEEP_EXIT_US + 15, "%s from %08x: woke %u us late", mode, start, lateWakeMax);
+  CHECK(windowsOff == 0, "%s from %08x: duty off in %llu of %llu windows", mode, start, (unsigned long long)windowsOff,
+        (unsigned long long)windows);
+  CHECK(schedJobs[jobClock].missed <= 4, "%s from %08x: the clock missed %u", mode, start, schedJobs[jobClock].missed);
+  if (irq)
+  {
+    // behind a clock redraw at worst
+    CHECK(detectLatency.back() <= 3000 + 2000 + SLEEP_EXIT_US, "%s: a press seen after %u us", mode, detectLatency.back());
+    CHECK(wakeups < 3 * 3600 + 40000, "%s from %08x: %llu wake-ups", mode, start, (unsigned long long)wakeups);
+  }
+  else
+  {
+    CHECK(detectLatency.back() <= (TOUCH_IDLE_POLL_MS + 2) * 1000, "%s: a press seen after %u us", mode,
+          detectLatency.back());
+    CHECK(wakeups < 3600000 / TOUCH_IDLE_POLL_MS + 3 * 3600 + 40000, "%s from %08x: %llu wake-ups", mode, start,
+          (unsigned long long)wakeups);
+  }
+}
+
+int main()
+{
+  for (uint32_t start : {1000000u, 0xFFFFFFFFu - 30000000u})
+    for (bool irq : {false, true})
+      runHour(irq, start);
+  idlePoll = TOUCH_POLL_MS;
+  runHour(false, 1000000u);
+  return checkResult("power_test");
+}
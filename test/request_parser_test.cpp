@@ -0,0 +1,163 @@
+// Recorded requests replayed through the in-place request parser, whole and in small
+// pieces, and requests that fill its arena to the byte. Prints what parsing costs.
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#define private public // the arena's free space, to fill it exactly
+#include "web.h"
+#undef private
+#include "check.h"
+
+extern "C" void *__real_malloc(size_t);
+static size_t allocs = 0;
+extern "C" void *__wrap_malloc(size_t n)
+{
+  allocs++;
+  return __real_malloc(n);
+}
+void *operator new(size_t n) { return __wrap_malloc(n); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+static const char *PHONE_GET =
+    "GET /scan HTTP/1.1\r\nHost: 192.168.4.1\r\nConnection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (Linux; Android 14; Pixel 7) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/126.0 Mobile Safari/537.36\r\n"
+    "Accept: */*\r\nReferer: http://192.168.4.1/\r\nAccept-Encoding: gzip, deflate\r\nAccept-Language: en-US,en;q=0.9,de;q=0.8\r\n"
+    "If-None-Match: \"0badcafe\"\r\nSec-Fetch-Site: same-origin\r\nSec-Fetch-Mode: cors\r\nSec-Fetch-Dest: empty\r\n"
+    "Cache-Control: no-cache\r\nPragma: no-cache\r\n\r\n";
+static const char *QUERY_GET = "GET /q%20x?a=1&b=hello+world&c=%41%42&flag HTTP/1.1\r\nHost: h\r\nAccept: */*\r\n\r\n";
+
+static std::string post(const std::string &body, const std::string &pad = "")
+{
+  return "POST /save HTTP/1.1\r\nHost: 192.168.4.1\r\nContent-Type: application/x-www-form-urlencoded\r\n" + pad +
+         "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+}
+
+// what the handlers saw
+static std::string seen;
+static const char *s(const char *p) { return p ? p : "(null)"; }
+
+static std::string status(const Reply &r) { return r.head.substr(0, r.head.find("\r\n")); }
+
+// free arena bytes once the start of a request is parsed
+static size_t arenaFreeAfter(AsyncWebServer &server, const std::string &start)
+{
+  AsyncClient *client = new AsyncClient;
+  AsyncWebServerRequest *request = new AsyncWebServerRequest(&server, client);
+  client->feed(start);
+  size_t free = request->_arenaFree();
+  client->discCb(client->discArg, client);
+  return free;
+}
+
+int main()
+{
+  AsyncWebServer server(80);
+  server.on("/scan", HTTP_GET, [](AsyncWebServerRequest *r)
+            {
+    seen = std::string("inm=") + s(r->headerValue("If-None-Match")) + " host=" + r->host().c_str() +
+           " headers=" + std::to_string(r->headers());
+    r->send(200, "text/plain", "ok"); });
+  server.on("/q x", HTTP_GET, [](AsyncWebServerRequest *r)
+            {
+    seen = std::string("url=") + r->url().c_str() + " a=" + s(r->paramValue("a")) + " b=" + s(r->paramValue("b")) +
+           " c=" + s(r->paramValue("c")) + " flag=" + (r->hasParam("flag") ? "y" : "n") + " n=" + std::to_string(r->params()) +
+           " arg(b)=" + r->arg("b").c_str();
+    r->send(200, "text/plain", "ok"); });
+  server.on("/save", HTTP_POST, [](AsyncWebServerRequest *r)
+            {
+    seen = std::string("ssid=") + s(r->paramValue("ssid", true)) + " pw=" + s(r->paramValue("password", true)) +
+           " time=" + s(r->paramValue("time", true)) + " n=" + std::to_string(r->params());
+    r->send(200, "text/plain", "saved"); });
+  server.on("/p", HTTP_GET, [](AsyncWebServerRequest *r)
+            {
+    seen = "ok";
+    r->send(200, "text/plain", "ok"); });
+  server.begin();
+
+  std::string form = "ssid=My+Home%20WiFi&password=p%26ss%3Dw0rd&time=24";
+  struct
+  {
+    const char *name;
+    std::string request, seen;
+  } replays[] = {
+      {"phone GET", PHONE_GET, "inm=\"0badcafe\" host=192.168.4.1 headers=13"},
+      {"query GET", QUERY_GET, "url=/q x a=1 b=hello world c=AB flag=y n=4 arg(b)=hello world"},
+      {"POST /save", post(form), "ssid=My Home WiFi pw=p&ss=w0rd time=24 n=3"},
+  };
+  for (auto &replay : replays)
+  {
+    for (size_t split : {0, 1, 2, 3, 5, 7, 64})
+    {
+      seen.clear();
+      Reply r = fetch(server, replay.request, 5744, split);
+      CHECK(status(r) == "HTTP/1.1 200 OK", "%s, split %zu: %s", replay.name, split, status(r).c_str());
+      CHECK(seen == replay.seen, "%s, split %zu: %s", replay.name, split, seen.c_str());
+    }
+    const int runs = 2000;
+    size_t a0 = allocs;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+      fetch(server, replay.request);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    printf("%-12s %5.2f us, %5.1f allocations per request and reply\n", replay.name, us / runs, (allocs - a0) / (double)runs);
+  }
+
+  // A head that fills the arena to the byte, and one a byte longer. The padding
+  // header keeps its entry until the blank line ends the head.
+  std::string start = "GET /p HTTP/1.1\r\nX-Pad: ";
+  size_t headFree = arenaFreeAfter(server, start + "x\r\n") + 1; // with an empty pad
+  std::string exact = start + std::string(headFree - 2, 'x') + "\r\n\r\n";
+  CHECK(arenaFreeAfter(server, exact.substr(0, exact.size() - 2)) == 2, "%zu", arenaFreeAfter(server, exact.substr(0, exact.size() - 2)));
+  seen.clear();
+  Reply r = fetch(server, exact);
+  CHECK(status(r) == "HTTP/1.1 200 OK" && seen == "ok", "full head: %s", status(r).c_str());
+  r = fetch(server, start + std::string(headFree - 1, 'x') + "\r\n\r\n");
+  CHECK(status(r).rfind("HTTP/1.1 431", 0) == 0, "head a byte over: %s", status(r).c_str());
+
+  // A field of F - 7 bytes takes the F bytes free after the head exactly: the field,
+  // its terminator and its 6 byte entry. One byte more does not fit. The head is
+  // measured with a Content-Length of as many digits as the field's.
+  std::string sized = post(std::string(1000, 'x'));
+  size_t bodyFree = arenaFreeAfter(server, sized.substr(0, sized.size() - 1000));
+  std::string fill = "ssid=" + std::string(bodyFree - 12, 'v');
+  std::string fillSeen = "ssid=" + std::string(bodyFree - 12, 'v') + " pw=(null) time=(null) n=1";
+  sized = post(std::string(fill.size(), 'x'));
+  CHECK(arenaFreeAfter(server, sized.substr(0, sized.size() - fill.size())) == bodyFree, "content length changed the head");
+  for (std::string end : {"", "&"})
+  {
+    seen.clear();
+    r = fetch(server, post(fill + end));
+    CHECK(status(r) == "HTTP/1.1 200 OK", "full body, then '%s': %s", end.c_str(), status(r).c_str());
+    CHECK(seen == fillSeen, "%.40s", seen.c_str());
+  }
+  r = fetch(server, post(fill + "v"));
+  CHECK(status(r).rfind("HTTP/1.1 413", 0) == 0, "body a byte over: %s", status(r).c_str());
+
+  // with the arena full to the byte, an empty field's terminator has no room
+  for (std::string tail : {std::string("&"), std::string("&&"), std::string("&time=24"), std::string(1, '\0')})
+  {
+    for (size_t split : {0, 1})
+    {
+      seen.clear();
+      r = fetch(server, post(fill + "&" + tail), 5744, split);
+      CHECK(status(r).rfind("HTTP/1.1 413", 0) == 0, "full, then %zu more bytes, split %zu: %s", tail.size(), split,
+            status(r).c_str());
+      CHECK(seen.empty(), "handler ran: %.40s", seen.c_str());
+    }
+  }
+
+  // a head too long for the arena
+  std::string big = "GET /p HTTP/1.1\r\n";
+  for (int i = 0; i < 60; i++)
+    big += "X-Filler-" + std::to_string(i) + ": " + std::string(40, 'x') + "\r\n";
+  r = fetch(server, big + "\r\n");
+  CHECK(status(r).rfind("HTTP/1.1 431", 0) == 0, "%s", status(r).c_str());
+
+  printf("arena of %d bytes: %zu free for the pad of an empty GET, %zu for the body of POST /save\n",
+         ASYNCWEBSERVER_ARENA_SIZE, headFree, bodyFree);
+  return checkResult("request_parser_test");
+}
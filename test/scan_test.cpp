@@ -0,0 +1,207 @@
+// The portal's /scan service: hundreds of networks serialized once into a pooled
+// snapshot, streamed from it with an ETag, and refreshed by the rescan timer
+#include "web.h"
+#include "check.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+// every heap allocation, the library's and the String stub's alike
+extern "C" void *__real_malloc(size_t);
+extern "C" void *__real_realloc(void *, size_t);
+static size_t allocs = 0;
+extern "C" void *__wrap_malloc(size_t n)
+{
+  allocs++;
+  return __real_malloc(n);
+}
+extern "C" void *__wrap_realloc(void *p, size_t n)
+{
+  allocs++;
+  return __real_realloc(p, n);
+}
+void *operator new(size_t n) { return __wrap_malloc(n); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+// What the section needs of the ESP32 Wi-Fi driver and the core
+typedef enum { WIFI_AUTH_OPEN, WIFI_AUTH_WEP, WIFI_AUTH_WPA_PSK, WIFI_AUTH_WPA2_PSK, WIFI_AUTH_WPA_WPA2_PSK,
+               WIFI_AUTH_WPA2_ENTERPRISE, WIFI_AUTH_WPA3_PSK, WIFI_AUTH_WPA2_WPA3_PSK, WIFI_AUTH_WAPI_PSK } wifi_auth_mode_t;
+typedef struct { uint8_t bssid[6]; uint8_t ssid[33]; uint8_t primary; int second; int8_t rssi; wifi_auth_mode_t authmode; } wifi_ap_record_t;
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(m) ((void)(m))
+#define portEXIT_CRITICAL(m) ((void)(m))
+
+struct ScanWiFi
+{
+  std::vector<wifi_ap_record_t> list;
+  int state = WIFI_SCAN_FAILED;
+  int scans = 0;
+  void *getScanInfoByIndex(int i) { return i < (int)list.size() ? &list[i] : nullptr; }
+  int scanComplete() { return state; }
+  int16_t scanNetworks(bool async = false)
+  {
+    scans++;
+    return state = async ? WIFI_SCAN_RUNNING : (int)list.size();
+  }
+  void scanDelete() { state = WIFI_SCAN_FAILED; }
+} scanWiFi;
+static uint32_t now = 0;
+#define WiFi scanWiFi
+#define millis() now
+#include "scan.inc"
+#undef millis
+
+static void addScanRoute(AsyncWebServer &server)
+{
+#include "scan_route.inc"
+}
+
+static wifi_ap_record_t network(const char *ssid, int rssi, int channel, wifi_auth_mode_t auth)
+{
+  wifi_ap_record_t ap = {};
+  memcpy(ap.ssid, ssid, std::min(strlen(ssid), sizeof(ap.ssid)));
+  ap.rssi = rssi;
+  ap.primary = channel;
+  ap.authmode = auth;
+  return ap;
+}
+
+// signal levels of the entries in order
+static std::vector<int> levels(const std::string &json)
+{
+  std::vector<int> rssi;
+  for (size_t p = json.find("\"rssi\":"); p != std::string::npos; p = json.find("\"rssi\":", p + 1))
+    rssi.push_back(atoi(json.c_str() + p + 7));
+  return rssi;
+}
+
+static size_t count(const std::string &s, const std::string &what)
+{
+  size_t n = 0;
+  for (size_t p = s.find(what); p != std::string::npos; p = s.find(what, p + 1))
+    n++;
+  return n;
+}
+
+static double microsSince(std::chrono::steady_clock::time_point t0)
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main()
+{
+  srand(37);
+  int hidden = 0;
+  for (int i = 0; i < 400; i++)
+  {
+    char name[40];
+    if (i % 10 == 3)
+      snprintf(name, sizeof(name), "Shared-%d", i % 7); // one AP of each is kept
+    else if (i % 97 == 5)
+      name[0] = 0, hidden++;
+    else
+      snprintf(name, sizeof(name), "Network-%03d-%08x", i, rand());
+    scanWiFi.list.push_back(network(name, -30 - rand() % 60, 1 + i % 13, (wifi_auth_mode_t)(i % 9)));
+  }
+  scanWiFi.list[7] = network("quote\"back\\slash\ttab", -20, 6, WIFI_AUTH_WPA2_PSK);
+  scanWiFi.list[8] = network("", -21, 6, WIFI_AUTH_OPEN);
+  memset(scanWiFi.list[8].ssid, 'Z', 32); // all 32 bytes used, no terminator
+  int shared = 7;
+  int expected = 400 - 40 + shared - hidden;
+
+  AsyncWebServer server(80);
+  addScanRoute(server);
+
+  // before the first scan
+  Reply r = fetch(server, "GET /scan HTTP/1.1\r\n\r\n");
+  CHECK(r.body == "[]", "%s", r.body.c_str());
+
+  size_t a0 = allocs;
+  auto t0 = std::chrono::steady_clock::now();
+  CHECK(publishScanResults(scanWiFi.list.size()), "first publish");
+  double publishUs = microsSince(t0);
+  size_t publishAllocs = allocs - a0;
+  std::shared_ptr<ScanSnapshot> snap = currentScan();
+  std::string json(snap->json, snap->length);
+  CHECK(snap->networks == expected, "%d networks, expected %d", snap->networks, expected);
+  CHECK(count(json, "{\"ssid\":") == (size_t)expected, "%zu entries", count(json, "{\"ssid\":"));
+  CHECK(count(json, "\"Shared-3\"") == 1, "duplicates kept");
+  CHECK(json.find("\"ssid\":\"\"") == std::string::npos, "hidden network listed");
+  CHECK(json.rfind("[{\"ssid\":\"quote\\\"back\\\\slash\\u0009tab\",\"rssi\":-20,\"ch\":6,\"sec\":\"WPA2\"},", 0) == 0,
+        "%.80s", json.c_str());
+  CHECK(json.find("{\"ssid\":\"" + std::string(32, 'Z') + "\",\"rssi\":-21,") != std::string::npos, "32 byte SSID");
+  std::vector<int> rssi = levels(json);
+  CHECK(std::is_sorted(rssi.rbegin(), rssi.rend()), "not strongest first");
+  CHECK(json.back() == ']', "%s", json.c_str() + json.size() - 20);
+
+  // served from the snapshot, whatever the window
+  for (size_t window : {5744u, 1436u, 100u})
+  {
+    a0 = allocs;
+    t0 = std::chrono::steady_clock::now();
+    r = fetch(server, "GET /scan HTTP/1.1\r\n\r\n", window);
+    double us = microsSince(t0);
+    CHECK(r.body == json, "window %zu: %zu bytes", window, r.body.size());
+    CHECK(hasHeader(r, std::string("ETag: ") + snap->etag), "window %zu", window);
+    CHECK(hasHeader(r, "Content-Length: " + std::to_string(json.size())), "window %zu", window);
+    printf("GET /scan, window %4zu: %zu bytes, %zu allocations, %.0f us\n", window, r.body.size(), allocs - a0, us);
+  }
+
+  r = fetch(server, std::string("GET /scan HTTP/1.1\r\nIf-None-Match: ") + snap->etag + "\r\n\r\n");
+  CHECK(r.head.rfind("HTTP/1.1 304", 0) == 0 && r.body.empty(), "%s", r.head.c_str());
+  r = fetch(server, "GET /scan HTTP/1.1\r\nIf-None-Match: \"0badcafe\"\r\n\r\n");
+  CHECK(r.body == json, "stale tag: %zu bytes", r.body.size());
+
+  // serving does not build anything per network, and once the buffers are large
+  // enough a publish only allocates the list of entries and the sort's scratch
+  a0 = allocs;
+  fetch(server, "GET /scan HTTP/1.1\r\n\r\n");
+  CHECK(allocs - a0 < 50, "%zu allocations for %d networks", allocs - a0, expected);
+  snap.reset();
+  CHECK(publishScanResults(scanWiFi.list.size()), "second publish");
+  a0 = allocs;
+  CHECK(publishScanResults(scanWiFi.list.size()), "third publish");
+  CHECK(allocs - a0 <= 2, "%zu allocations to publish into a used buffer", allocs - a0);
+  printf("publish: %d networks, %zu bytes, %zu allocations, %.0f us\n", expected, json.size(), publishAllocs, publishUs);
+
+  // a response still being sent keeps its buffer, the next scan goes into the other
+  snap = currentScan();
+  const char *held = snap->json;
+  snap.reset();
+  AsyncClient *slow = new AsyncClient;
+  slow->window = 100;
+  new AsyncWebServerRequest(&server, slow);
+  slow->feed("GET /scan HTTP/1.1\r\n\r\n");
+  scanWiFi.list.resize(10);
+  CHECK(publishScanResults(scanWiFi.list.size()), "publish while sending");
+  CHECK(currentScan()->json != held, "the buffer being sent was reused");
+  CHECK(!publishScanResults(scanWiFi.list.size()), "both buffers taken, yet published");
+  for (int k = 0; slow->inflight && k < 10000; k++)
+    slow->peerAck();
+  CHECK(splitReply(slow->wire).body == json, "slow reply changed underway");
+  slow->discCb(slow->discArg, slow);
+  CHECK(publishScanResults(scanWiFi.list.size()), "publish after the slow reply");
+
+  // the rescan timer
+  scanWiFi.scans = 0;
+  now = lastScanMillis + SCAN_REFRESH_MS - 1;
+  serviceWiFiScan();
+  CHECK(scanWiFi.scans == 0 && !scanRunning, "rescan before SCAN_REFRESH_MS");
+  now++;
+  serviceWiFiScan();
+  CHECK(scanWiFi.scans == 1 && scanRunning, "no rescan after SCAN_REFRESH_MS");
+  serviceWiFiScan();
+  CHECK(scanRunning, "rescan finished early");
+  scanWiFi.list.resize(5);
+  scanWiFi.state = scanWiFi.list.size();
+  serviceWiFiScan();
+  CHECK(!scanRunning && currentScan()->networks == 5, "%d networks", currentScan()->networks);
+  CHECK(lastScanMillis == now, "timer not restarted");
+
+  return checkResult("scan_test");
+}
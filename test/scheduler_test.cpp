@@ -0,0 +1,163 @@
+// The timer wheel scheduler cut from the sketch, run by a loop() on a virtual
+// micros(): an hour of the sketch's jobs with a slow fetch among them, from boot and
+// across the wrap of micros(), then re-arming, cancelling and ordering within a pass
+#include "check.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static uint32_t vt = 0; // what micros() reads
+static uint32_t micros() { return vt; }
+struct
+{
+  template <class... Args>
+  void printf(const char *format, Args... args) { ::printf(format, args...); }
+  void println(const char *s) { puts(s); }
+} Serial;
+void schedAt(int8_t id, uint32_t inMs);
+void schedAtUs(int8_t id, uint32_t inUs);
+void schedCancel(int8_t id);
+#include "sched.inc"
+
+static std::vector<std::pair<std::string, uint32_t>> ran; // job, when
+static uint32_t cost[SCHED_MAX_JOBS];                     // us a job takes
+static uint64_t passes;
+
+static void note(int id)
+{
+  ran.push_back({schedJobs[id].name, vt});
+  vt += cost[id];
+}
+static void job0() { note(0); }
+static void job1() { note(1); }
+static void job2() { note(2); }
+static void job3() { note(3); }
+static void job4() { note(4); }
+
+// loop(): a pass, then delay() until the next deadline, woken on a 1 ms tick
+static void runFor(uint64_t us)
+{
+  for (uint64_t t = 0; t < us;)
+  {
+    uint32_t before = vt;
+    uint32_t idle = schedRun();
+    passes++;
+    vt += idle ? (idle / 1000 + 1) * 1000 - rand() % 1000 : 0;
+    vt += 20 + rand() % 30; // the pass itself
+    t += vt - before;
+  }
+}
+
+static void reset(uint32_t start)
+{
+  schedJobCount = 0;
+  vt = start;
+  ran.clear();
+  memset(cost, 0, sizeof(cost));
+  passes = 0;
+}
+
+static int runs(const char *name)
+{
+  return std::count_if(ran.begin(), ran.end(), [name](const std::pair<std::string, uint32_t> &r)
+                       { return r.first == name; });
+}
+
+static uint32_t lastRun(const char *name)
+{
+  uint32_t at = 0;
+  for (auto &r : ran)
+    if (r.first == name)
+      at = r.second;
+  return at;
+}
+
+int main()
+{
+  srand(1);
+  for (uint32_t start : {1000000u, 0xFFFFFFFFu - 30000000u})
+  {
+    reset(start);
+    schedAdd("touch", job0, 10, 0);
+    schedAdd("clock", job1, 1000, 0);
+    schedAdd("rssi", job2, 1000, 0);
+    schedAdd("solar", job3, 15 * 60 * 1000, 15 * 60 * 1000);
+    int8_t backlight = schedAdd("backlight", job4, 0, 600000);
+    cost[0] = 80, cost[1] = 3000, cost[2] = 500, cost[3] = 1800000; // the fetch takes 1.8 s
+    runFor(3600ull * 1000000);
+    printf("from %08x: touch %d, clock %d, rssi %d, solar %d, backlight %d, %llu passes in an hour\n", start,
+           runs("touch"), runs("clock"), runs("rssi"), runs("solar"), runs("backlight"), (unsigned long long)passes);
+    schedReport();
+    CHECK(runs("solar") == 3 && runs("backlight") == 1, "from %08x: solar %d, backlight %d", start, runs("solar"),
+          runs("backlight"));
+    CHECK(!schedJobs[backlight].armed, "from %08x: a one-shot re-armed", start);
+    // the fetch makes the clock late three times, without losing a second or its phase
+    CHECK(runs("clock") == 3600 && schedJobs[1].missed == 0, "from %08x: clock ran %d times, missed %u", start,
+          runs("clock"), schedJobs[1].missed);
+    CHECK((schedJobs[1].due - start) % 1000000 == 0, "from %08x: the clock drifted", start);
+    // and the touch job skips the polls that fell into it
+    CHECK(schedJobs[0].missed >= 3 * 178 && schedJobs[0].missed <= 3 * 181, "from %08x: touch missed %u", start,
+          schedJobs[0].missed);
+    CHECK(runs("touch") + schedJobs[0].missed >= 359990 && runs("touch") + schedJobs[0].missed <= 360001,
+          "from %08x: touch ran %d times", start, runs("touch"));
+    // loop() only wakes for deadlines
+    CHECK(passes < 2 * 360000, "from %08x: %llu passes", start, (unsigned long long)passes);
+  }
+
+  // a one-shot armed again, and a cancelled job
+  reset(5000);
+  int8_t a = schedAdd("a", job0, 0, 100), b = schedAdd("b", job1, 50, 100);
+  runFor(150000);
+  schedAt(a, 10);
+  runFor(30000);
+  CHECK(runs("a") == 2, "one-shot ran %d times", runs("a"));
+  schedCancel(b);
+  int before = runs("b");
+  runFor(200000);
+  CHECK(runs("b") == before, "a cancelled job ran");
+
+  // a job moving another that is due in the same pass
+  reset(5000);
+  schedAdd("mover", []
+           { note(0); schedAt(1, 500); }, 0, 10);
+  schedAdd("moved", job1, 0, 11);
+  vt += 20000;
+  schedRun();
+  runFor(600000);
+  CHECK(runs("moved") == 1, "moved job ran %d times", runs("moved"));
+  CHECK(lastRun("moved") - lastRun("mover") >= 500000, "moved job ran %u us after the mover",
+        lastRun("moved") - lastRun("mover"));
+
+  // jobs cancelling and moving themselves
+  reset(5000);
+  schedAdd("self", []
+           { note(0); schedCancel(0); }, 10, 0);
+  runFor(100000);
+  CHECK(runs("self") == 1, "self-cancelled job ran %d times", runs("self"));
+  reset(5000);
+  schedAdd("selfmove", []
+           { note(0); schedAt(0, 100); }, 10, 0);
+  runFor(1000000);
+  CHECK(runs("selfmove") >= 9 && runs("selfmove") <= 10, "self-moved job ran %d times", runs("selfmove"));
+
+  // earliest deadline first within a pass, and a deadline turns of the wheel away
+  reset(5000);
+  const uint32_t FAR_MS = 5 * SCHED_SLOTS * SCHED_TICK_US / 1000 + 7;
+  schedAdd("late", job0, 0, 3);
+  schedAdd("early", job1, 0, 1);
+  schedAdd("far", job2, 0, FAR_MS);
+  vt += 50000;
+  schedRun();
+  CHECK(ran.size() == 2 && ran[0].first == "early", "%zu jobs ran, %s first", ran.size(),
+        ran.empty() ? "none" : ran[0].first.c_str());
+  runFor(5 * SCHED_SLOTS * SCHED_TICK_US);
+  uint32_t farAt = lastRun("far") - 5000;
+  CHECK(runs("far") == 1 && farAt >= FAR_MS * 1000 && farAt < (FAR_MS + 2) * 1000, "far job ran %d times, at %u us",
+        runs("far"), farAt);
+
+  return checkResult("scheduler_test");
+}
@@ -0,0 +1,79 @@
+#pragma once
+// Host stand-in for the parts of the Arduino core the web server uses
+#include <stdarg.h>
+#define vsnprintf_P vsnprintf
+#define ets_printf(...) ((void)0)
+#define Arduino_h
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include "WString.h"
+#ifndef ESP32
+#define ESP32
+#endif
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define ICACHE_FLASH_ATTR
+#define IRAM_ATTR
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+typedef uint8_t byte;
+uint32_t millis();
+#define ets_printf(...) ((void)0)
+uint32_t micros();
+void delay(uint32_t);
+void yield();
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) { size_t k = 0; while (n--) k += write(*b++); return k; }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t println(const char *s = "") { return print(s) + print("\r\n"); }
+};
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+struct HardwareSerial : public Print {
+  size_t write(uint8_t c) override { return fputc(c, stderr) != EOF; }
+};
+extern HardwareSerial Serial;
+struct IPAddress {
+  uint32_t a = 0;
+  IPAddress() {}
+  IPAddress(uint32_t v) : a(v) {}
+  IPAddress(uint8_t x, uint8_t y, uint8_t z, uint8_t w) : a(x | y << 8 | z << 16 | (uint32_t)w << 24) {}
+  operator uint32_t() const { return a; }
+  String toString() const { char b[20]; snprintf(b, 20, "%u.%u.%u.%u", a & 255, a >> 8 & 255, a >> 16 & 255, a >> 24); return String(b); }
+};
+typedef void *SemaphoreHandle_t;
+typedef void *QueueHandle_t;
+#define portMAX_DELAY 0xffffffff
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return (void *)1; }
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return (void *)1; }
+inline int xSemaphoreTake(SemaphoreHandle_t, uint32_t) { return 1; }
+inline int xSemaphoreGive(SemaphoreHandle_t) { return 1; }
+inline void vSemaphoreDelete(SemaphoreHandle_t) {}
+// size_t is 32 bits on the ESP32, make the library's mixed min() calls resolve on a 64-bit host
+namespace std {
+inline unsigned long min(unsigned long a, unsigned int b) { return a < b ? a : b; }
+inline unsigned long min(unsigned int a, unsigned long b) { return a < b ? a : b; }
+inline unsigned long max(unsigned long a, unsigned int b) { return a > b ? a : b; }
+inline unsigned long max(unsigned int a, unsigned long b) { return a > b ? a : b; }
+}
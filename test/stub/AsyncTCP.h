@@ -0,0 +1,60 @@
+#pragma once
+// Host stand-in for AsyncTCP
+#include "Arduino.h"
+#include <string>
+#define ASYNC_WRITE_FLAG_COPY 0x01
+class AsyncClient;
+typedef std::function<void(void *, AsyncClient *)> AcConnectHandler;
+typedef std::function<void(void *, AsyncClient *, size_t, uint32_t)> AcAckHandler;
+typedef std::function<void(void *, AsyncClient *, int8_t)> AcErrorHandler;
+typedef std::function<void(void *, AsyncClient *, void *, size_t)> AcDataHandler;
+typedef std::function<void(void *, AsyncClient *, uint32_t)> AcTimeoutHandler;
+// Fake client: bytes handed to add() land in `wire`, and `window` is the send space
+// until the peer acknowledges what is in flight
+class AsyncClient {
+ public:
+  std::string wire;
+  size_t window = 5744, inflight = 0, adds = 0, sends = 0;
+  bool closed = false;
+  void *ackArg = 0, *dataArg = 0, *discArg = 0, *pollArg = 0;
+  AcAckHandler ackCb; AcDataHandler dataCb; AcConnectHandler discCb, pollCb;
+  void onAck(AcAckHandler cb, void *a) { ackCb = cb; ackArg = a; }
+  void onError(AcErrorHandler, void *) {}
+  void onDisconnect(AcConnectHandler cb, void *a) { discCb = cb; discArg = a; }
+  void onTimeout(AcTimeoutHandler, void *) {}
+  void onData(AcDataHandler cb, void *a) { dataCb = cb; dataArg = a; }
+  void onPoll(AcConnectHandler cb, void *a) { pollCb = cb; pollArg = a; }
+  size_t space() const { return connected() ? window - inflight : 0; }
+  bool canSend() const { return space() > 0; }
+  size_t add(const char *d, size_t n, uint8_t = ASYNC_WRITE_FLAG_COPY) { n = std::min(n, space()); wire.append(d, n); inflight += n; adds++; return n; }
+  bool send() { sends++; return true; }
+  size_t write(const char *d) { return write(d, strlen(d)); }
+  size_t write(const char *d, size_t n, uint8_t f = ASYNC_WRITE_FLAG_COPY) { n = add(d, n, f); send(); return n; }
+  void close(bool = false) { closed = true; }
+  void abort() { closed = true; }
+  bool free() { return true; }
+  bool connected() const { return !closed; }
+  bool disconnecting() const { return false; }
+  bool freeable() const { return closed; }
+  void setRxTimeout(uint32_t) {}
+  void setNoDelay(bool) {}
+  void ackLater() {}
+  void ack(size_t) {}
+  IPAddress localIP() const { return IPAddress(192, 168, 4, 1); }
+  IPAddress remoteIP() const { return IPAddress(192, 168, 4, 2); }
+  uint16_t remotePort() const { return 50000; }
+  const char *stateToString() const { return "Established"; }
+  uint8_t state() const { return 4; }
+  // Acknowledge everything in flight, as the peer would
+  void peerAck() { size_t n = inflight; inflight = 0; if (ackCb && n) ackCb(ackArg, this, n, 0); }
+  // Deliver bytes from the peer; a copy, as the server may parse them in place
+  void feed(std::string d) { if (dataCb) dataCb(dataArg, this, &d[0], d.size()); }
+};
+class AsyncServer {
+ public:
+  AsyncServer(uint16_t) {}
+  void onClient(AcConnectHandler, void *) {}
+  void begin() {}
+  void end() {}
+  void setNoDelay(bool) {}
+};
@@ -0,0 +1,90 @@
+#pragma once
+// Arduino String over std::string; g_stringAllocs counts the copies that would allocate
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <cstdio>
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+extern size_t g_stringAllocs;
+class String {
+  std::string s;
+ public:
+  String() {}
+  String(const char *c) { if (c) s = c; if (c && *c) g_stringAllocs++; }
+  String(const std::string &x) : s(x) {}
+  String(const __FlashStringHelper *c) : String((const char *)c) {}
+  String(const String &o) : s(o.s) { if (!s.empty()) g_stringAllocs++; }
+  String(String &&o) : s(std::move(o.s)) {}
+  String &operator=(const String &o) { if (!o.s.empty() && o.s != s) g_stringAllocs++; s = o.s; return *this; }
+  String &operator=(String &&o) { s = std::move(o.s); return *this; }
+  explicit String(char c) : s(1, c) {}
+  String(int v, unsigned char base = 10) { char b[34]; snprintf(b, 34, base == 16 ? "%x" : "%d", v); s = b; }
+  String(unsigned v, unsigned char base = 10) { char b[34]; snprintf(b, 34, base == 16 ? "%x" : "%u", v); s = b; }
+  String(long v) { s = std::to_string(v); }
+  String(unsigned long v) { s = std::to_string(v); }
+  String(long long v) { s = std::to_string(v); }
+  String(unsigned long long v) { s = std::to_string(v); }
+  String(double v, unsigned char d = 2) { char b[64]; snprintf(b, 64, "%.*f", d, v); s = b; }
+  const char *c_str() const { return s.c_str(); }
+  unsigned length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  explicit operator bool() const { return true; }
+  bool reserve(unsigned n) { s.reserve(n); return true; }
+  bool concat(const String &o) { s += o.s; return true; }
+  bool concat(const char *c) { if (c) s += c; return true; }
+  bool concat(const char *c, unsigned n) { s.append(c, n); return true; }
+  bool concat(char c) { s += c; return true; }
+  bool concat(int v) { s += std::to_string(v); return true; }
+  bool concat(unsigned v) { s += std::to_string(v); return true; }
+  bool concat(long v) { s += std::to_string(v); return true; }
+  bool concat(unsigned long v) { s += std::to_string(v); return true; }
+  template <class T> String &operator+=(const T &v) { concat(v); return *this; }
+  String &operator+=(const char *c) { concat(c); return *this; }
+  char operator[](unsigned i) const { return i < s.size() ? s[i] : 0; }
+  char &operator[](unsigned i) { return s[i]; }
+  char charAt(unsigned i) const { return (*this)[i]; }
+  void setCharAt(unsigned i, char c) { if (i < s.size()) s[i] = c; }
+  bool equals(const String &o) const { return s == o.s; }
+  bool equals(const char *c) const { return s == (c ? c : ""); }
+  bool equalsIgnoreCase(const String &o) const { return strcasecmp(s.c_str(), o.s.c_str()) == 0; }
+  bool operator==(const String &o) const { return s == o.s; }
+  bool operator==(const char *c) const { return equals(c); }
+  bool operator!=(const String &o) const { return s != o.s; }
+  bool operator!=(const char *c) const { return !equals(c); }
+  bool operator<(const String &o) const { return s < o.s; }
+  int compareTo(const String &o) const { return s.compare(o.s); }
+  int indexOf(char c, unsigned from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const String &c, unsigned from = 0) const { auto p = s.find(c.s, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const char *c, unsigned from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(char c) const { auto p = s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(const String &c) const { auto p = s.rfind(c.s); return p == std::string::npos ? -1 : (int)p; }
+  String substring(unsigned a) const { return a >= s.size() ? String() : String(s.substr(a)); }
+  String substring(unsigned a, unsigned b) const { if (a > b) std::swap(a, b); if (a >= s.size()) return String(); return String(s.substr(a, b - a)); }
+  bool startsWith(const String &p) const { return s.compare(0, p.s.size(), p.s) == 0; }
+  bool startsWith(const String &p, unsigned off) const { return s.size() >= off && s.compare(off, p.s.size(), p.s) == 0; }
+  bool endsWith(const String &p) const { return s.size() >= p.s.size() && s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0; }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  void toLowerCase() { for (auto &c : s) c = tolower(c); }
+  void toUpperCase() { for (auto &c : s) c = toupper(c); }
+  void trim() { size_t a = s.find_first_not_of(" \t\r\n"); if (a == std::string::npos) { s.clear(); return; } size_t b = s.find_last_not_of(" \t\r\n"); s = s.substr(a, b - a + 1); }
+  void replace(const String &a, const String &b) { size_t p = 0; while (!a.s.empty() && (p = s.find(a.s, p)) != std::string::npos) { s.replace(p, a.s.size(), b.s); p += b.s.size(); } }
+  void replace(char a, char b) { for (auto &c : s) if (c == a) c = b; }
+  void remove(unsigned i) { if (i < s.size()) s.erase(i); }
+  void remove(unsigned i, unsigned n) { if (i < s.size()) s.erase(i, n); }
+  const char *begin() const { return s.data(); }
+  char *begin() { return &s[0]; }
+  const char *end() const { return s.data() + s.size(); }
+  void getBytes(unsigned char *b, unsigned n) const { if (!n) return; size_t k = std::min<size_t>(n - 1, s.size()); memcpy(b, s.data(), k); b[k] = 0; }
+  void toCharArray(char *b, unsigned n) const { getBytes((unsigned char *)b, n); }
+  friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+  friend String operator+(const String &a, const char *b) { return String(a.s + (b ? b : "")); }
+  friend String operator+(const char *a, const String &b) { return String(std::string(a) + b.s); }
+  friend String operator+(const String &a, char b) { return String(a.s + b); }
+  friend String operator+(const String &a, int b) { return String(a.s + std::to_string(b)); }
+  friend String operator+(const String &a, unsigned b) { return String(a.s + std::to_string(b)); }
+  friend String operator+(const String &a, long b) { return String(a.s + std::to_string(b)); }
+  friend String operator+(const String &a, unsigned long b) { return String(a.s + std::to_string(b)); }
+};
@@ -0,0 +1,10 @@
+#pragma once
+// Host stand-in for the Wi-Fi interface: addresses for the web server, a settable RSSI
+#include "Arduino.h"
+struct WiFiClass {
+  int8_t rssi = -60;
+  IPAddress localIP() { return IPAddress(192, 168, 1, 10); }
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+  int8_t RSSI() { return rssi; }
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,13 @@
+#pragma once
+// Host stand-in for the core's circular buffer
+#include <string>
+class cbuf {
+  std::string d;
+ public:
+  cbuf(size_t) {}
+  size_t room() const { return 1 << 20; }
+  size_t resizeAdd(size_t) { return 0; }
+  size_t write(const char *p, size_t n) { d.append(p, n); return n; }
+  size_t read(char *p, size_t n) { n = std::min(n, d.size()); memcpy(p, d.data(), n); d.erase(0, n); return n; }
+  size_t available() const { return d.size(); }
+};
@@ -0,0 +1,16 @@
+#pragma once
+// Host stand-in for libb64, enough for the WebSocket accept key
+typedef struct { int step; char result; int stepcount; } base64_encodestate;
+static inline void base64_init_encodestate(base64_encodestate *s) { s->step = 0; s->result = 0; s->stepcount = 0; }
+static inline int base64_encode_block(const char *in, int n, char *out, base64_encodestate *) {
+  static const char t[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  int o = 0;
+  for (int i = 0; i < n; i += 3) {
+    unsigned v = (unsigned char)in[i] << 16 | (i + 1 < n ? (unsigned char)in[i + 1] << 8 : 0) | (i + 2 < n ? (unsigned char)in[i + 2] : 0);
+    out[o++] = t[v >> 18 & 63]; out[o++] = t[v >> 12 & 63];
+    out[o++] = i + 1 < n ? t[v >> 6 & 63] : '='; out[o++] = i + 2 < n ? t[v & 63] : '=';
+  }
+  out[o] = 0;
+  return o;
+}
+static inline int base64_encode_blockend(char *, base64_encodestate *) { return 0; }
@@ -0,0 +1,3 @@
+#pragma once
+// Host stand-in for the mbedTLS version
+#define MBEDTLS_VERSION_NUMBER 0x03000000
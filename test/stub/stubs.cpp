@@ -0,0 +1,19 @@
+// Definitions behind the stub headers
+#include "Arduino.h"
+#include "WiFi.h"
+#include <cstdarg>
+#include <chrono>
+size_t g_stringAllocs = 0;
+HardwareSerial Serial;
+void *pxCurrentTCB = 0;
+static auto t0 = std::chrono::steady_clock::now();
+uint32_t micros() { return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count(); }
+uint32_t millis() { return micros() / 1000; }
+void delay(uint32_t) {}
+void yield() {}
+size_t Print::printf(const char *fmt, ...) { char b[512]; va_list a; va_start(a, fmt); int n = vsnprintf(b, sizeof b, fmt, a); va_end(a); return write((const uint8_t *)b, std::min(n, 511)); }
+bool checkBasicAuthentication(const char *, const char *, const char *) { return false; }
+String requestDigestAuthentication(const char *) { return String(); }
+bool checkDigestAuthentication(const char *, const char *, const char *, const char *, const char *, bool, const char *, const char *, const char *) { return false; }
+String generateDigestHash(const char *, const char *, const char *) { return String(); }
+WiFiClass WiFi;
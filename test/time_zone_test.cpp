@@ -0,0 +1,175 @@
+// The sketch's POSIX TZ rules and cached clock strings against glibc: eight rules
+// second by second through 2025, more sampled over 1971-2099 and around each change,
+// with the strings and the offset compared to gmtime_r() and localtime_r(). Also
+// what the parser turns down, and what a tick costs before and after the cache.
+#include "check.h"
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <initializer_list>
+#include <limits>
+#include "tz.inc"
+
+static void setTz(const char *tz)
+{
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+struct Tally
+{
+  uint64_t checked, wrong;
+};
+
+// HH:MM:SS of a struct tm; strftime() would take most of the test's time
+static void digits(const struct tm &tm, char *text)
+{
+  const int parts[3] = {tm.tm_hour, tm.tm_min, tm.tm_sec};
+  for (int i = 0; i < 3; i++)
+  {
+    text[i * 3] = '0' + parts[i] / 10;
+    text[i * 3 + 1] = '0' + parts[i] % 10;
+    text[i * 3 + 2] = i < 2 ? ':' : 0;
+  }
+}
+
+// formatClock() at t against the C library
+static void compareAt(const char *tz, time_t t, Tally &tally)
+{
+  formatClock(t);
+  struct tm local, utc;
+  char l[9], u[9];
+  localtime_r(&t, &local);
+  gmtime_r(&t, &utc);
+  digits(local, l);
+  digits(utc, u);
+  tally.checked++;
+  if (strcmp(l, clockText.localDigits) || strcmp(u, clockText.utcDigits) || local.tm_gmtoff != clockText.offset)
+    if (tally.wrong++ < 5)
+      printf("%s at %ld: %s local, %s UTC, offset %ld; expected %s, %s, %ld\n", tz, (long)t, clockText.localDigits,
+             clockText.utcDigits, (long)clockText.offset, l, u, (long)local.tm_gmtoff);
+}
+
+static bool useRule(const char *tz)
+{
+  bool parsed = parseTzRule(tz, tzRule);
+  CHECK(parsed, "\"%s\" not parsed", tz);
+  setTz(tz);
+  clockText.until = 0;
+  return parsed;
+}
+
+int main()
+{
+  const time_t Y2025 = 1735689600, Y2026 = 1767225600;
+
+  // Europe, North America, no summer time, the southern hemisphere, a quarter hour
+  // offset, changes at negative and past-24h times, and Julian and zero-based days
+  const char *everySecond[] = {"CET-1CEST,M3.5.0,M10.5.0/3",
+                               "EST5EDT,M3.2.0,M11.1.0",
+                               "IST-5:30",
+                               "AEST-10AEDT,M10.1.0,M4.1.0/3",
+                               "<+1245>-12:45<+1345>-13:45,M9.5.0/2:45,M4.1.0/3:45",
+                               "<-03>3<-02>2,M3.5.0/-2,M10.5.0/-1",
+                               "<+0330>-3:30<+0430>,J79/24,J263/24",
+                               "<+02>-2<+03>,80/0,300/0"};
+  for (const char *tz : everySecond)
+  {
+    if (!useRule(tz))
+      continue;
+    Tally tally = {};
+    for (time_t t = Y2025; t < Y2026; t++)
+      compareAt(tz, t, tally);
+    printf("%-52s %9llu s of 2025, %llu wrong\n", tz, (unsigned long long)tally.checked,
+           (unsigned long long)tally.wrong);
+    CHECK(tally.wrong == 0, "%s: %llu of %llu s of 2025 wrong", tz, (unsigned long long)tally.wrong,
+          (unsigned long long)tally.checked);
+  }
+
+  // these and more, every 9973 s from 1971 to 2099, which has formatClock() look up
+  // the offset each time, and second by second for 20 minutes around each change
+  const char *sampled[] = {"CET-1CEST,M3.5.0,M10.5.0/3",
+                           "<+01>-1<+02>-2,M3.5.0,M10.5.0/3",
+                           "EST5EDT,M3.2.0,M11.1.0",
+                           "<-0330>3:30<-0230>2:30,M3.2.0,M11.1.0",
+                           "IST-5:30",
+                           "<+0545>-5:45",
+                           "AEST-10AEDT,M10.1.0,M4.1.0/3",
+                           "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+                           "<+1245>-12:45<+1345>-13:45,M9.5.0/2:45,M4.1.0/3:45",
+                           "NZST-12NZDT,M9.5.0,M4.1.0/3",
+                           "<-04>4<-03>3,M9.1.6/24,M4.1.6/24",
+                           "GMT0BST,M3.5.0/1,M10.5.0",
+                           "<-03>3<-02>2,M3.5.0/-2,M10.5.0/-1",
+                           "<+0330>-3:30<+0430>,J79/24,J263/24",
+                           "<+02>-2<+03>,80/0,300/0",
+                           "<-02>2<-01>,M3.5.0/-2,M10.5.0/-1",
+                           "<+00>0",
+                           "<-05>5",
+                           "<+14>-14"};
+  const time_t Y1971 = 31536000, Y2100 = 4102444800LL;
+  for (const char *tz : sampled)
+  {
+    if (!useRule(tz))
+      continue;
+    Tally tally = {};
+    for (time_t t = Y1971; t < Y2100; t += 9973)
+      compareAt(tz, t, tally);
+    for (time_t t = Y1971; t < Y2100;)
+    {
+      time_t until;
+      tzOffsetAt(t, until);
+      if (until == std::numeric_limits<time_t>::max())
+        break;
+      for (time_t s = until - 600; s < until + 600; s++)
+        compareAt(tz, s, tally);
+      t = until;
+    }
+    CHECK(tally.wrong == 0, "%s: %llu of %llu s of 1971-2099 wrong", tz, (unsigned long long)tally.wrong,
+          (unsigned long long)tally.checked);
+  }
+
+  for (const char *bad : {"", "X-1", "CET", "CET-1CEST", "CET-1CEST,M13.1.0,M10.5.0", "CET-1CEST,M3.5.0", "<+01-1",
+                          "CET-1CEST,M3.5.0,M10.5.0/3x"})
+  {
+    TzRule rule;
+    CHECK(!parseTzRule(bad, rule), "\"%s\" parsed", bad);
+  }
+
+  // a tick before, with gmtime(), mktime() and two strftime(), against the cached digits
+  setTz("UTC0"); // as on the ESP32, where the sketch never sets TZ
+  parseTzRule("CET-1CEST,M3.5.0,M10.5.0/3", tzRule);
+  const time_t T0 = 1760000000;
+  const int TICKS = 5000000;
+  volatile unsigned sink = 0;
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < TICKS; i++)
+  {
+    time_t now = T0 + i;
+    struct tm *utc = gmtime(&now);
+    char utcStr[9], localStr[9];
+    strftime(utcStr, sizeof(utcStr), "%H:%M:%S", utc);
+    struct tm local = *utc;
+    local.tm_hour += 2;
+    mktime(&local);
+    strftime(localStr, sizeof(localStr), "%H:%M:%S", &local);
+    sink += utcStr[7] + localStr[7];
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  clockText.until = 0;
+  for (int i = 0; i < TICKS; i++)
+  {
+    formatClock(T0 + i);
+    sink += clockText.utcDigits[7] + clockText.localDigits[7];
+  }
+  auto t3 = std::chrono::steady_clock::now();
+  double before = std::chrono::duration<double, std::nano>(t2 - t1).count() / TICKS;
+  double cached = std::chrono::duration<double, std::nano>(t3 - t2).count() / TICKS;
+  printf("a tick: %.1f ns with gmtime(), mktime() and strftime(), %.1f ns cached\n", before, cached);
+
+  return checkResult("time_zone_test");
+}
@@ -0,0 +1,255 @@
+// The touch calibration matrix cut from the sketch: fitted from known point sets and
+// from a skewed panel in every rotation, Q16 against floating point, a stored matrix
+// loaded in another rotation, the library default it boots on, and the targets it
+// must turn down
+#include "check.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Preferences in memory, unlike touch_sim.h's, which never keeps anything
+struct Preferences
+{
+  std::map<std::string, std::vector<uint8_t>> store;
+  bool begin(const char *, bool) { return true; }
+  void end() {}
+  size_t getBytesLength(const char *key) { return store.count(key) ? store[key].size() : 0; }
+  size_t getBytes(const char *key, void *buf, size_t len)
+  {
+    std::vector<uint8_t> &v = store[key];
+    if (v.size() > len)
+      return 0;
+    memcpy(buf, v.data(), v.size());
+    return v.size();
+  }
+  size_t putBytes(const char *key, const void *buf, size_t len)
+  {
+    store[key].assign((const uint8_t *)buf, (const uint8_t *)buf + len);
+    return len;
+  }
+} prefs;
+
+// The 240x320 ILI9341 in any of TFT_eSPI's rotations, and convertRawXY() with the
+// sketch's touchCalibration {300, 3600, 300, 3600, rotate | invert y}
+struct MockTFT
+{
+  uint8_t rotation = 3;
+  int16_t width() { return rotation & 1 ? 320 : 240; }
+  int16_t height() { return rotation & 1 ? 240 : 320; }
+  uint8_t getRotation() { return rotation; }
+  void convertRawXY(uint16_t *x, uint16_t *y)
+  {
+    uint16_t rawX = *x, rawY = *y;
+    *x = (rawY - 300) * width() / 3600;
+    *y = height() - (rawX - 300) * height() / 3600;
+  }
+} tft;
+
+#include "touch_affine.inc"
+
+// The panel: a native pixel (column, page) to raw counts, with the foil a little
+// skewed and turned against the glass
+static void panelRaw(double c, double p, double &rx, double &ry)
+{
+  rx = 350 + c * 13.6 + p * 0.25;
+  ry = 3700 - p * 10.4 + c * 0.4;
+}
+
+// Screen coordinates in a rotation to native pixels
+static void toNative(int rotation, double x, double y, double &c, double &p)
+{
+  switch (rotation)
+  {
+  case 0:
+    c = 239 - x, p = y;
+    break;
+  case 1:
+    c = y, p = x;
+    break;
+  case 2:
+    c = x, p = 319 - y;
+    break;
+  default:
+    c = 239 - y, p = 319 - x;
+  }
+}
+
+static void screenRaw(int rotation, int x, int y, uint16_t &rx, uint16_t &ry)
+{
+  double c, p, dx, dy;
+  toNative(rotation, x, y, c, p);
+  panelRaw(c, p, dx, dy);
+  rx = lround(dx);
+  ry = lround(dy);
+}
+
+static std::mt19937 rng(7);
+
+// What calibrateTouch() does: three targets touched with `noise` raw counts of
+// error. Leaves the fit in touchAffine and gives the mean and worst error in px.
+static double fitPanel(int rotation, double noise, double &worst)
+{
+  tft.rotation = rotation;
+  int16_t w = tft.width(), h = tft.height();
+  const int16_t target[3][2] = {{(int16_t)(w / 10), (int16_t)(h / 10)},
+                                {(int16_t)(w * 9 / 10), (int16_t)(h / 2)},
+                                {(int16_t)(w / 10), (int16_t)(h * 9 / 10)}};
+  uint16_t raw[3][2];
+  std::normal_distribution<double> n(0, noise);
+  for (int i = 0; i < 3; i++)
+  {
+    double c, p, rx, ry;
+    toNative(rotation, target[i][0], target[i][1], c, p);
+    panelRaw(c, p, rx, ry);
+    raw[i][0] = lround(rx + n(rng));
+    raw[i][1] = lround(ry + n(rng));
+  }
+  TouchAffine m;
+  worst = 1e9;
+  CHECK(fitTouchAffine(raw, target, m), "rotation %d: fit failed", rotation);
+  m.rotation = rotation;
+  touchAffine = m;
+  double sum = 0;
+  int points = 0;
+  worst = 0;
+  for (int y = 0; y < h; y += 4)
+    for (int x = 0; x < w; x += 4)
+    {
+      uint16_t rx, ry;
+      screenRaw(rotation, x, y, rx, ry);
+      int32_t sx, sy;
+      applyTouchAffine(m, rx, ry, sx, sy);
+      double e = hypot(sx - x, sy - y);
+      sum += e;
+      points++;
+      worst = std::max(worst, e);
+    }
+  return sum / points;
+}
+
+int main()
+{
+  // known point sets, with the matrices they must give
+  {
+    const uint16_t raw[3][2] = {{0, 0}, {1000, 0}, {0, 2000}};
+    const int16_t scaled[3][2] = {{0, 300}, {100, 300}, {0, 100}}; // x = rawX / 10, y = 300 - rawY / 10
+    const int16_t swapped[3][2] = {{50, 0}, {50, 100}, {250, 0}};  // x = 50 + rawY / 10, y = rawX / 10
+    TouchAffine m;
+    CHECK(fitTouchAffine(raw, scaled, m) && m.a == 6554 && m.b == 0 && m.c == 0 && m.d == 0 && m.e == -6554 &&
+              m.f == 300 << 16,
+          "scaled: %d %d %d, %d %d %d", m.a, m.b, m.c, m.d, m.e, m.f);
+    for (int i = 0; i < 3; i++)
+    {
+      int32_t x, y;
+      applyTouchAffine(m, raw[i][0], raw[i][1], x, y);
+      CHECK(x == scaled[i][0] && y == scaled[i][1], "scaled: point %d at %d,%d", i, x, y);
+    }
+    CHECK(fitTouchAffine(raw, swapped, m) && m.a == 0 && m.b == 6554 && m.c == 50 << 16 && m.d == 6554 && m.e == 0 &&
+              m.f == 0,
+          "swapped: %d %d %d, %d %d %d", m.a, m.b, m.c, m.d, m.e, m.f);
+    for (int i = 0; i < 3; i++)
+    {
+      int32_t x, y;
+      applyTouchAffine(m, raw[i][0], raw[i][1], x, y);
+      CHECK(x == swapped[i][0] && y == swapped[i][1], "swapped: point %d at %d,%d", i, x, y);
+    }
+  }
+
+  // a skewed panel in every rotation, from exact and from noisy touches
+  for (int rotation = 0; rotation < 4; rotation++)
+  {
+    double worst, mean = fitPanel(rotation, 0, worst);
+    printf("rotation %d, exact touches:    %4.2f px off, %4.2f at worst\n", rotation, mean, worst);
+    CHECK(worst <= 1.0, "rotation %d: %.2f px off", rotation, worst);
+    double means = 0, worsts = 0;
+    for (int k = 0; k < 200; k++)
+    {
+      means += fitPanel(rotation, 8, worst);
+      worsts += worst;
+    }
+    printf("rotation %d, touches +-8 raw:  %4.2f px off, %4.2f at worst\n", rotation, means / 200, worsts / 200);
+    CHECK(means / 200 <= 3, "rotation %d: %.2f px off with noisy touches", rotation, means / 200);
+  }
+
+  // Q16 rounds to the nearest pixel of the exact mapping
+  {
+    double worst;
+    fitPanel(3, 0, worst);
+    const TouchAffine &m = touchAffine;
+    int off = 0;
+    for (int rx = 0; rx < 4096; rx += 7)
+      for (int ry = 0; ry < 4096; ry += 7)
+      {
+        int32_t x, y;
+        applyTouchAffine(m, rx, ry, x, y);
+        double dx = (m.a * (double)rx + m.b * (double)ry + m.c) / 65536;
+        double dy = (m.d * (double)rx + m.e * (double)ry + m.f) / 65536;
+        off += fabs(x - dx) > 0.5 + 1e-9 || fabs(y - dy) > 0.5 + 1e-9;
+      }
+    CHECK(off == 0, "Q16: %d points off by more than half a pixel", off);
+  }
+
+  // stored in one rotation, loaded in another: half a turn is worked out, a quarter
+  // turn falls back to the default
+  for (int from = 0; from < 4; from++)
+  {
+    double worst;
+    fitPanel(from, 0, worst);
+    prefs.putBytes("affine", &touchAffine, sizeof(touchAffine));
+    for (int to = 0; to < 4; to++)
+    {
+      tft.rotation = to;
+      bool loaded = loadTouchCalibration();
+      CHECK(loaded == (from == to || (from ^ to) == 2), "stored in rotation %d, loaded in %d: %d", from, to, loaded);
+      CHECK(touchAffine.rotation == to, "stored in rotation %d, loaded in %d: for rotation %d", from, to,
+            touchAffine.rotation);
+      if (!loaded)
+        continue;
+      worst = 0;
+      for (int y = 0; y < tft.height(); y += 8)
+        for (int x = 0; x < tft.width(); x += 8)
+        {
+          uint16_t rx, ry;
+          screenRaw(to, x, y, rx, ry);
+          worst = touchToScreen(rx, ry) ? std::max(worst, hypot(rx - x, ry - y)) : 1e9;
+        }
+      CHECK(worst <= 1.5, "stored in rotation %d, loaded in %d: %.2f px off", from, to, worst);
+    }
+  }
+
+  // nothing stored: the sketch boots on the library default, as convertRawXY() maps it
+  prefs.store.clear();
+  tft.rotation = 3;
+  CHECK(!loadTouchCalibration(), "a calibration loaded from empty Preferences");
+  int differ = 0;
+  for (uint16_t rx = 300; rx <= 3600; rx += 50)
+    for (uint16_t ry = 300; ry <= 3600; ry += 50)
+    {
+      uint16_t lx = rx, ly = ry, x = rx, y = ry;
+      tft.convertRawXY(&lx, &ly);
+      if (!touchToScreen(x, y))
+        differ += lx < tft.width() && ly < tft.height();
+      else
+        differ += abs(x - lx) > 1 || abs(y - ly) > 1;
+    }
+  CHECK(differ == 0, "default mapping: %d points more than 1 px from convertRawXY()", differ);
+
+  // targets the fit must turn down
+  {
+    const uint16_t collinear[3][2] = {{100, 100}, {200, 200}, {300, 300}};
+    const uint16_t close[3][2] = {{2000, 2000}, {2040, 2000}, {2000, 2040}};
+    const uint16_t thin[3][2] = {{0, 0}, {1, 0}, {0, 10000}};
+    const int16_t screen[3][2] = {{0, 0}, {10, 10}, {20, 30}};
+    const int16_t steep[3][2] = {{-20000, 0}, {20000, 0}, {-20000, 100}}; // 40000 px per raw count
+    TouchAffine m;
+    CHECK(!fitTouchAffine(collinear, screen, m), "collinear touches fitted");
+    CHECK(!fitTouchAffine(close, screen, m), "touches 40 raw apart fitted");
+    CHECK(!fitTouchAffine(thin, steep, m), "a matrix beyond Q16 fitted");
+  }
+  return checkResult("touch_affine_test");
+}
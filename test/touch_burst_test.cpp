@@ -0,0 +1,178 @@
+// TFT_eSPI's touch reads against an XPT2046 mocked byte by byte on the SPI bus: the
+// burst read gives the position and pressure the controller converts, in one
+// transaction and fewer bytes than the pressure, position, pressure reads it replaced,
+// and drops the spikes of a bad contact that those let through
+#include "check.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+
+static std::mt19937 rng(1);
+static double noise = 8, spikes = 0, settle = 80; // raw counts, share, raw counts
+static uint16_t fx, fy, fz;                       // where the finger is and how hard
+static uint64_t busBytes = 0, busTransactions = 0;
+
+// A command byte with the start bit starts a conversion of its channel, and its 12
+// bit result comes back in the next two bytes. The drivers settle after a switch of
+// axis, so the first conversion after one is off by up to `settle`.
+struct SPIClass
+{
+  std::deque<uint8_t> out;
+  int channel = -1;
+  double error = 0;
+  uint16_t convert(uint8_t command)
+  {
+    int ch = (command >> 4) & 7;
+    if (ch != channel)
+    {
+      channel = ch;
+      error = settle;
+    }
+    else
+      error *= 0.2;
+    std::normal_distribution<double> n(0, noise);
+    double v;
+    if (ch == 5 || ch == 1)
+    {
+      v = (ch == 5 ? fx : fy) + n(rng) - error;
+      if (std::uniform_real_distribution<double>()(rng) < spikes)
+        v += rng() & 1 ? 900 : -900;
+    }
+    else // Z1 and Z2, Z1 reads 0 and Z2 full scale while nothing presses
+      v = (ch == 3 ? (fz ? 400 : 0) : 400 + 4095 - fz) + n(rng) / 2;
+    return (uint16_t)std::min(4095.0, std::max(0.0, v));
+  }
+  uint8_t transfer(uint8_t b)
+  {
+    busBytes++;
+    uint8_t r = 0;
+    if (!out.empty())
+    {
+      r = out.front();
+      out.pop_front();
+    }
+    if (b & 0x80)
+    {
+      uint16_t v = convert(b);
+      out.clear();
+      out.push_back(v >> 5);
+      out.push_back((v & 0x1f) << 3);
+    }
+    return r;
+  }
+  uint16_t transfer16(uint16_t w)
+  {
+    uint16_t h = transfer(w >> 8);
+    return h << 8 | transfer(w & 0xff);
+  }
+  void transfer(void *buf, size_t n)
+  {
+    uint8_t *p = (uint8_t *)buf;
+    for (size_t i = 0; i < n; i++)
+      p[i] = transfer(p[i]);
+  }
+} spi;
+
+struct TFT_eSPI
+{
+  void begin_touch_read_write()
+  {
+    busTransactions++;
+    spi.out.clear();
+  }
+  void end_touch_read_write() {}
+  uint8_t getTouchRaw(uint16_t *x, uint16_t *y);
+  uint16_t getTouchRawZ(void);
+  uint16_t getTouchRawBurst(uint16_t *x, uint16_t *y, uint8_t samples = 4);
+};
+#include "touch_reads.inc"
+
+struct Stats
+{
+  double meanError, outliers, pressureOff, transactions, bytes;
+};
+
+// Polls of a pressed panel at random places: either how the touch engine polled
+// before, pressure then position then pressure, or one burst of `samples`
+static Stats poll(TFT_eSPI &tft, int samples, int polls = 100000)
+{
+  double error = 0;
+  int outliers = 0, pressureOff = 0;
+  busBytes = busTransactions = 0;
+  for (int i = 0; i < polls; i++)
+  {
+    fx = 300 + rng() % 3300;
+    fy = 300 + rng() % 3300;
+    fz = 600 + rng() % 1000;
+    uint16_t x, y, z;
+    if (samples == 0)
+    {
+      tft.getTouchRawZ();
+      tft.getTouchRaw(&x, &y);
+      z = tft.getTouchRawZ();
+    }
+    else
+      z = tft.getTouchRawBurst(&x, &y, samples);
+    double e = hypot(x - fx, y - fy);
+    error += e;
+    outliers += e > 50;
+    pressureOff += abs(z - fz) > 20;
+  }
+  return {error / polls, 100.0 * outliers / polls, 100.0 * pressureOff / polls, (double)busTransactions / polls,
+          (double)busBytes / polls};
+}
+
+int main()
+{
+  TFT_eSPI tft;
+
+  // a quiet controller: the burst gives back exactly what it converts
+  noise = settle = 0;
+  fx = 1234, fy = 2345, fz = 1000;
+  for (int samples : {1, 3, 4, 8})
+  {
+    uint16_t x, y;
+    busBytes = busTransactions = 0;
+    uint16_t z = tft.getTouchRawBurst(&x, &y, samples);
+    CHECK(x == fx && y == fy && z == fz, "%d samples: %u,%u z %u", samples, x, y, z);
+    CHECK(busTransactions == 1 && busBytes == 2 * (2 * (samples + 1) + 2) + 1u, "%d samples: %llu transactions, %llu bytes",
+          samples, (unsigned long long)busTransactions, (unsigned long long)busBytes);
+  }
+  fz = 0; // nobody presses: Z1 0 and Z2 full scale
+  uint16_t x, y;
+  CHECK(tft.getTouchRawBurst(&x, &y) < 20, "pressure without a finger");
+
+  // out of range sample counts are clamped to 1 and 8
+  fz = 1000;
+  busBytes = 0;
+  tft.getTouchRawBurst(&x, &y, 0);
+  CHECK(busBytes == 2 * (2 * 2 + 2) + 1u, "0 samples: %llu bytes", (unsigned long long)busBytes);
+  busBytes = 0;
+  tft.getTouchRawBurst(&x, &y, 20);
+  CHECK(busBytes == 2 * (2 * 9 + 2) + 1u, "20 samples: %llu bytes", (unsigned long long)busBytes);
+
+  // noise, settling and a spike in 20 conversions
+  noise = 8, settle = 80, spikes = 0.05;
+  Stats before = poll(tft, 0);
+  printf("Z, position, Z: %5.1f raw off, %5.2f%% over 50, pressure %4.2f%% off, %3.1f transactions, %4.1f bytes\n",
+         before.meanError, before.outliers, before.pressureOff, before.transactions, before.bytes);
+  for (int samples : {1, 3, 4, 5, 8})
+  {
+    Stats s = poll(tft, samples);
+    printf("burst of %d:     %5.1f raw off, %5.2f%% over 50, pressure %4.2f%% off, %3.1f transactions, %4.1f bytes\n",
+           samples, s.meanError, s.outliers, s.pressureOff, s.transactions, s.bytes);
+    CHECK(s.transactions == 1, "%d samples: %.1f transactions", samples, s.transactions);
+    CHECK(s.pressureOff <= before.pressureOff + 0.05, "%d samples: pressure %.2f%% off", samples, s.pressureOff);
+    if (samples == 4) // what the sketch reads
+    {
+      CHECK(s.bytes < before.bytes, "%.1f bytes, %.1f before", s.bytes, before.bytes);
+      CHECK(s.meanError < before.meanError / 4, "%.1f raw off, %.1f before", s.meanError, before.meanError);
+      CHECK(s.outliers < before.outliers / 4, "%.2f%% over 50, %.2f%% before", s.outliers, before.outliers);
+    }
+  }
+  return checkResult("touch_burst_test");
+}
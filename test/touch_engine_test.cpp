@@ -0,0 +1,174 @@
+// The touch engine against the blocking getTouch() it replaced, in virtual time with
+// a scripted finger: a minute of taps, how often loop() gets round and how long it
+// waits on the bus, and the event queue when nobody drains it
+#include "touch_sim.h"
+#include "check.h"
+#include <vector>
+#include "touch.inc"
+
+struct Tap
+{
+  uint64_t start, len;
+  uint16_t x, y; // raw
+};
+
+static std::vector<Tap> taps;
+
+// Taps with a bouncing edge as the finger lands and lifts, and some jitter
+static bool tapFinger(uint64_t now, uint16_t &x, uint16_t &y, uint16_t &z)
+{
+  for (auto &t : taps)
+    if (now >= t.start && now < t.start + t.len)
+    {
+      uint64_t edge = std::min(now - t.start, t.start + t.len - now);
+      if (edge < 6000 && rand() % 2)
+        return false;
+      z = edge < 15000 ? 300 + edge / 30 : 1200 + rand() % 200;
+      x = t.x + rand() % 9 - 4;
+      y = t.y + rand() % 9 - 4;
+      return true;
+    }
+  return false;
+}
+
+struct Run
+{
+  uint64_t passes, downs, ups, blockedUs;
+  int worstPx; // of a press from where its tap landed
+};
+
+// A minute of loop() passes that each spend WORK_US on other things
+static Run runMinute(bool engine)
+{
+  const uint64_t WORK_US = 40, END = vt_us + 60000000;
+  uint64_t bus0 = bus_us, sleep0 = sleep_us;
+  Run run = {};
+  while (vt_us < END)
+  {
+    vt_us += WORK_US;
+    if (!engine)
+    {
+      uint16_t x, y;
+      if (tft.getTouch(&x, &y))
+      {
+        delay(200); // the old debounce
+        run.downs++;
+      }
+    }
+    else
+    {
+      serviceTouch();
+      TouchEvent event;
+      while (readTouchEvent(event))
+      {
+        if (event.type == TOUCH_DOWN)
+        {
+          run.downs++;
+          for (auto &t : taps)
+            if (vt_us >= t.start && vt_us < t.start + t.len + 100000)
+            {
+              uint16_t sx = t.x, sy = t.y;
+              tft.convertRawXY(&sx, &sy);
+              run.worstPx = std::max({run.worstPx, abs(event.x - sx), abs(event.y - sy)});
+            }
+        }
+        else if (event.type == TOUCH_UP)
+          run.ups++;
+      }
+    }
+    run.passes++;
+  }
+  run.blockedUs = bus_us - bus0 + sleep_us - sleep0;
+  return run;
+}
+
+static void tapEvery3s(uint64_t from)
+{
+  taps.clear();
+  for (uint64_t t = from + 1000000; t < from + 59000000; t += 3000000)
+    taps.push_back({t, 80000 + (uint64_t)(rand() % 320000), (uint16_t)(500 + rand() % 3000), (uint16_t)(500 + rand() % 3000)});
+}
+
+int main()
+{
+  srand(1);
+  loadTouchCalibration();
+  finger = tapFinger;
+
+  tapEvery3s(vt_us);
+  Run old = runMinute(false);
+  tapEvery3s(vt_us);
+  Run engine = runMinute(true);
+  printf("getTouch(): %zu taps, %llu page turns, %6.0f passes/s, %4.1f%% of the time blocked\n", taps.size(),
+         (unsigned long long)old.downs, old.passes / 60.0, old.blockedUs / 600000.0);
+  printf("engine:     %zu taps, %llu presses,    %6.0f passes/s, %4.1f%% of the time blocked, %d px off at worst\n",
+         taps.size(), (unsigned long long)engine.downs, engine.passes / 60.0, engine.blockedUs / 600000.0, engine.worstPx);
+  CHECK(engine.downs == taps.size() && engine.ups == taps.size(), "%llu presses, %llu releases of %zu taps",
+        (unsigned long long)engine.downs, (unsigned long long)engine.ups, taps.size());
+  CHECK(engine.worstPx <= 3, "a press %d px from its tap", engine.worstPx);
+  CHECK(engine.blockedUs < 600000, "blocked %.1f%% of the time", engine.blockedUs / 600000.0);
+  CHECK(engine.passes > 10 * old.passes, "%llu passes, %llu with getTouch()", (unsigned long long)engine.passes,
+        (unsigned long long)old.passes);
+
+  // Nobody reads: the queue keeps the newest TOUCH_QUEUE_SIZE events, a press and a
+  // release per tap, in order
+  tapEvery3s(vt_us);
+  while (vt_us < taps.back().start + 1000000)
+  {
+    vt_us += 40;
+    serviceTouch();
+  }
+  CHECK(touchCount == TOUCH_QUEUE_SIZE, "%u events queued", touchCount);
+  std::vector<TouchEvent> queued;
+  TouchEvent event;
+  while (readTouchEvent(event))
+    queued.push_back(event);
+  size_t first = taps.size() - TOUCH_QUEUE_SIZE / 2;
+  for (size_t i = 0; i < queued.size(); i++)
+  {
+    const Tap &t = taps[first + i / 2];
+    uint64_t at = queued[i].ms * 1000ull;
+    CHECK(queued[i].type == (i % 2 ? TOUCH_UP : TOUCH_DOWN), "event %zu is of type %d", i, queued[i].type);
+    CHECK(at >= t.start && at < t.start + t.len + 50000, "event %zu at %llu ms, its tap at %llu ms", i,
+          (unsigned long long)queued[i].ms, (unsigned long long)t.start / 1000);
+  }
+
+  // A drag nobody reads leaves one move, with where the finger is now
+  uint64_t t0 = vt_us;
+  finger = [t0](uint64_t now, uint16_t &x, uint16_t &y, uint16_t &z)
+  {
+    if (now < t0 + 100000 || now > t0 + 1100000)
+      return false;
+    z = 1200;
+    x = 2100;
+    y = 1000 + (now - t0 - 100000) * 2000 / 1000000; // across the screen in a second
+    return true;
+  };
+  while (vt_us < t0 + 1050000)
+  {
+    vt_us += 40;
+    serviceTouch();
+  }
+  queued.clear();
+  while (readTouchEvent(event))
+    queued.push_back(event);
+  CHECK(queued.size() == 2 && queued[0].type == TOUCH_DOWN && queued[1].type == TOUCH_MOVE, "%zu events after a drag",
+        queued.size());
+  if (queued.size() == 2)
+  {
+    uint16_t sx = 2100, sy = 1000 + (vt_us - t0 - 100000) * 2000 / 1000000;
+    tft.convertRawXY(&sx, &sy);
+    CHECK(abs(queued[1].x - sx) <= TOUCH_MOVE_PX + 4, "last move at x %u, the finger at %u", queued[1].x, sx);
+  }
+  while (vt_us < t0 + 1300000)
+  {
+    vt_us += 40;
+    serviceTouch();
+  }
+  queued.clear();
+  while (readTouchEvent(event))
+    queued.push_back(event);
+  CHECK(!queued.empty() && queued.back().type == TOUCH_UP, "no release after the drag");
+
+  return checkResult("touch_engine_test");
+}
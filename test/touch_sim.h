@@ -0,0 +1,162 @@
+#pragma once
+// Host stand-in for the XPT2046 behind TFT_eSPI, in virtual time: every bus transfer
+// and delay() moves the clock on, and a scripted finger decides what the panel reads
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#define HIGH 1
+#define LOW 0
+static uint64_t vt_us = 0, bus_us = 0, sleep_us = 0, transactions = 0;
+static uint32_t millis() { return vt_us / 1000; }
+static uint32_t micros() { return vt_us; }
+static void delay(uint32_t ms)
+{
+  vt_us += ms * 1000ull;
+  sleep_us += ms * 1000ull;
+}
+// Pressure and raw position of the finger at a time, false while nothing touches
+static std::function<bool(uint64_t, uint16_t &, uint16_t &, uint16_t &)> finger;
+static double touchSpikes = 0; // share of conversions 900 off, as a bad contact gives
+
+struct MockTFT
+{
+  // 2.5 MHz touch clock and about 2 us to begin and end a transaction
+  void bus(int bytes)
+  {
+    uint64_t t = 2 + bytes * 8 / 2.5;
+    vt_us += t;
+    bus_us += t;
+    transactions++;
+  }
+  void spike(uint16_t &v)
+  {
+    if (rand() < touchSpikes * RAND_MAX)
+      v += rand() & 1 ? 900 : -900;
+  }
+  uint16_t getTouchRawZ()
+  {
+    bus(5);
+    uint16_t x, y, z;
+    return finger(vt_us, x, y, z) ? z : 0;
+  }
+  uint8_t getTouchRaw(uint16_t *x, uint16_t *y)
+  {
+    bus(16);
+    uint16_t z;
+    if (!finger(vt_us, *x, *y, z))
+    {
+      *x = rand() % 4096; // the lines float
+      *y = rand() % 4096;
+    }
+    spike(*x);
+    spike(*y);
+    return 1;
+  }
+  // One transaction of samples + 1 conversions per axis, the first dropped, then Z1
+  // and Z2; the extremes are dropped and the rest averaged as the library does
+  uint16_t getTouchRawBurst(uint16_t *x, uint16_t *y, uint8_t samples)
+  {
+    uint16_t vx[8], vy[8], fx, fy, z = 0;
+    bus(1 + 2 * (2 * (samples + 1) + 2));
+    for (int i = 0; i < samples; i++)
+    {
+      if (!finger(vt_us, fx, fy, z))
+      {
+        fx = rand() % 4096;
+        fy = rand() % 4096;
+      }
+      spike(fx);
+      spike(fy);
+      vx[i] = fx;
+      vy[i] = fy;
+    }
+    bool on = finger(vt_us, fx, fy, z);
+    std::sort(vx, vx + samples);
+    std::sort(vy, vy + samples);
+    int drop = samples > 2 ? (samples + 2) / 4 : 0, sx = 0, sy = 0, k = samples - 2 * drop;
+    for (int i = drop; i < samples - drop; i++)
+    {
+      sx += vx[i];
+      sy += vy[i];
+    }
+    *x = (sx + k / 2) / k;
+    *y = (sy + k / 2) / k;
+    return on ? z : 0;
+  }
+  // the library default calibration in rotation 3
+  void convertRawXY(uint16_t *x, uint16_t *y)
+  {
+    uint16_t xx = (*y - 300) * 320 / 3600, yy = (*x - 300) * 240 / 3600;
+    *x = xx;
+    *y = 240 - yy;
+  }
+  uint8_t getRotation() { return 3; }
+  int16_t width() { return 320; }
+  int16_t height() { return 240; }
+
+  // TFT_eSPI 2.5 getTouch() and validTouch(), with their bus use and delays
+  uint32_t _pressTime = 0;
+  uint8_t validTouch(uint16_t *x, uint16_t *y, uint16_t threshold)
+  {
+    uint16_t x1, y1, x2, y2, z1 = 1, z2 = 0;
+    while (z1 > z2)
+    {
+      z2 = z1;
+      z1 = getTouchRawZ();
+      delay(1);
+    }
+    if (z1 <= threshold)
+      return 0;
+    getTouchRaw(&x1, &y1);
+    delay(1);
+    if (getTouchRawZ() <= threshold)
+      return 0;
+    delay(2);
+    getTouchRaw(&x2, &y2);
+    if (abs(x1 - x2) > 20 || abs(y1 - y2) > 20)
+      return 0;
+    *x = x1;
+    *y = y1;
+    return 1;
+  }
+  uint8_t getTouch(uint16_t *x, uint16_t *y, uint16_t threshold = 600)
+  {
+    uint16_t xt, yt;
+    if (_pressTime > millis())
+      threshold = 20;
+    uint8_t n = 5, valid = 0;
+    while (n--)
+      if (validTouch(&xt, &yt, threshold))
+        valid++;
+    if (!valid)
+    {
+      _pressTime = 0;
+      return 0;
+    }
+    _pressTime = millis() + 50;
+    convertRawXY(&xt, &yt);
+    if (xt >= 320 || yt >= 240)
+      return 0;
+    *x = xt;
+    *y = yt;
+    return valid;
+  }
+} tft;
+
+static inline int digitalRead(int)
+{
+  uint16_t x, y, z;
+  return finger(vt_us, x, y, z) ? LOW : HIGH;
+}
+
+// Nothing saved, so the touch section falls back to the library default mapping
+struct Preferences
+{
+  bool begin(const char *, bool) { return true; }
+  void end() {}
+  size_t getBytesLength(const char *) { return 0; }
+  size_t getBytes(const char *, void *, size_t) { return 0; }
+} prefs;
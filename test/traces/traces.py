@@ -0,0 +1,38 @@
+# Writes the XPT2046 traces gesture_trace_test replays, made up as the panel would
+# record them: one line per ms, "z x y" (z=0: untouched), after a "# expect:" line
+# with the gestures. Run in this directory: python3 traces.py
+# Screen -> raw for the calibration {300,3600,300,3600,rotate|invert_y}:
+#   screen x = (rawY-300)*320/3600, screen y = 240 - (rawX-300)*240/3600
+import random, sys
+random.seed(int(sys.argv[1]) if len(sys.argv) > 1 else 1)
+def raw(sx, sy): return 300 + (240 - sy) * 3600 / 240, 300 + sx * 3600 / 320
+def press(out, pts, ms, spikes=0):
+    # pts: list of screen points the finger passes, linearly over ms
+    n = len(pts) - 1
+    for t in range(ms):
+        f = t / max(1, ms - 1) * n; i = min(int(f), n - 1); u = f - i
+        sx = pts[i][0] + (pts[i+1][0] - pts[i][0]) * u; sy = pts[i][1] + (pts[i+1][1] - pts[i][1]) * u
+        rx, ry = raw(sx, sy)
+        edge = min(t, ms - 1 - t)
+        if edge < 5 and random.random() < 0.5: out.append("0 0 0"); continue
+        z = 300 + edge * 60 if edge < 15 else random.randint(1100, 1400)
+        rx += random.gauss(0, 6); ry += random.gauss(0, 6)
+        if random.random() < spikes: rx += random.choice([-1, 1]) * 900
+        out.append("%d %d %d" % (z, rx, ry))
+def gap(out, ms): out.extend(["0 0 0"] * ms)
+cases = {
+ "tap":        (lambda o: press(o, [(160,120),(160,120)], 120), "TAP"),
+ "noisy_tap":  (lambda o: press(o, [(100,60),(101,61)], 150, spikes=0.05), "TAP"),
+ "double_tap": (lambda o: (press(o, [(200,100),(200,100)], 90), gap(o, 120), press(o, [(203,98),(203,98)], 90)), "DOUBLE_TAP"),
+ "two_taps":   (lambda o: (press(o, [(200,100),(200,100)], 90), gap(o, 600), press(o, [(200,100),(200,100)], 90)), "TAP TAP"),
+ "long_press": (lambda o: press(o, [(50,200),(52,201)], 1200, spikes=0.02), "LONG_PRESS"),
+ "swipe_left": (lambda o: press(o, [(260,120),(230,122),(120,126),(70,128)], 260), "SWIPE_LEFT"),
+ "swipe_right":(lambda o: press(o, [(60,150),(150,146),(250,140)], 220), "SWIPE_RIGHT"),
+ "slow_drag":  (lambda o: press(o, [(60,150),(250,150)], 1500), ""),
+ "scroll_up":  (lambda o: press(o, [(160,220),(165,40)], 250), ""),
+ "tap_swipe":  (lambda o: (press(o, [(160,120),(160,120)], 100), gap(o, 150), press(o, [(260,120),(80,120)], 200)), "TAP SWIPE_LEFT"),
+}
+for name, (fn, expect) in cases.items():
+    o = []; gap(o, 50); fn(o); gap(o, 1000)
+    with open("trace_%s.txt" % name, "w") as f:
+        f.write("# expect: %s\n" % expect); f.write("\n".join(o) + "\n")
@@ -0,0 +1,54 @@
+// Requests against an AsyncWebServer over the stub AsyncClient, acknowledged as a
+// peer with the given receive window would
+#pragma once
+#include "ESPAsyncWebServer.h"
+#include <string>
+
+struct Reply
+{
+  std::string head; // status line and headers, up to the blank line
+  std::string body;
+  size_t acks;
+};
+
+static inline Reply splitReply(const std::string &wire)
+{
+  Reply reply = {};
+  size_t end = wire.find("\r\n\r\n");
+  if (end == std::string::npos)
+  {
+    reply.head = wire;
+    return reply;
+  }
+  reply.head = wire.substr(0, end + 4);
+  reply.body = wire.substr(end + 4);
+  return reply;
+}
+
+// A new connection that sends the request in pieces of split bytes (all at once when
+// 0), then acknowledges until nothing is in flight and hangs up
+static inline Reply fetch(AsyncWebServer &server, const std::string &request, size_t window = 5744, size_t split = 0)
+{
+  AsyncClient *client = new AsyncClient;
+  client->window = window;
+  new AsyncWebServerRequest(&server, client);
+  if (split == 0)
+    split = request.size();
+  for (size_t i = 0; i < request.size() && client->connected(); i += split)
+    client->feed(request.substr(i, split));
+  size_t acks = 0;
+  while (client->inflight && acks < 100000)
+  {
+    client->peerAck();
+    acks++;
+  }
+  Reply reply = splitReply(client->wire);
+  reply.acks = acks;
+  client->discCb(client->discArg, client); // frees the request and the client
+  return reply;
+}
+
+static inline bool hasHeader(const Reply &reply, const std::string &line)
+{
+  return reply.head.find("\r\n" + line + "\r\n") != std::string::npos;
+}
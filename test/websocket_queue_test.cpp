@@ -0,0 +1,303 @@
+// The WebSocket send queues: an hour of keyed broadcasts to fast, slow and stalled
+// clients under each drop policy stays within the per client and server byte
+// budgets, each policy drops what it says it does, and every byte charged to the
+// budgets is given back once the messages are gone.
+#include <string>
+#include <vector>
+#define private public // the queued messages, to add up what they were charged
+#include "web.h"
+#undef private
+#include "check.h"
+
+static const char *policyName[] = {"newest", "oldest", "coalesce"};
+
+enum Kind { FAST, SLOW, STALLED };
+
+struct Peer
+{
+  AsyncClient *client;
+  Kind kind;
+  bool head = true;
+  std::string fragments;
+  std::vector<std::string> messages; // complete text messages, in order
+};
+
+static AsyncClient *connect(AsyncWebServer &server)
+{
+  AsyncClient *client = new AsyncClient;
+  new AsyncWebServerRequest(&server, client);
+  client->feed("GET /ws HTTP/1.1\r\nHost: d\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+               "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n");
+  client->peerAck(); // the 101 is acknowledged, the request becomes a socket client
+  return client;
+}
+
+static AsyncWebSocketClient *socketClient(AsyncWebSocket &ws, AsyncClient *client)
+{
+  for (auto c : ws.getClients())
+    if (c->client() == client)
+      return c;
+  return nullptr;
+}
+
+// Takes the complete frames off the wire, after the handshake's reply
+static void drain(Peer &p)
+{
+  std::string &wire = p.client->wire;
+  size_t at = 0;
+  if (p.head)
+  {
+    size_t end = wire.find("\r\n\r\n");
+    if (end == std::string::npos)
+      return;
+    at = end + 4;
+    p.head = false;
+  }
+  while (wire.size() - at >= 2)
+  {
+    size_t len = (uint8_t)wire[at + 1] & 0x7f, head = 2;
+    if (len == 126)
+    {
+      if (wire.size() - at < 4)
+        break;
+      len = (uint8_t)wire[at + 2] << 8 | (uint8_t)wire[at + 3];
+      head = 4;
+    }
+    if (wire.size() - at < head + len)
+      break;
+    p.fragments += wire.substr(at + head, len);
+    bool fin = (uint8_t)wire[at] & 0x80;
+    at += head + len;
+    if (fin)
+    {
+      p.messages.push_back(p.fragments);
+      p.fragments.clear();
+    }
+  }
+  wire.erase(0, at);
+}
+
+// The budgets hold exactly what the queued messages were charged
+static void checkBudgets(AsyncWebSocket &ws, const char *when)
+{
+  size_t total = 0;
+  for (auto c : ws.getClients())
+  {
+    size_t bytes = 0;
+    for (auto m : c->_messageQueue)
+    {
+      bytes += m->length();
+      total += m->charged();
+    }
+    CHECK(c->queuedBytes() == bytes, "%s: client %u counts %zu bytes, holds %zu", when, c->id(), c->queuedBytes(), bytes);
+    CHECK(c->queueLen() <= WS_MAX_QUEUED_MESSAGES, "%s: %zu queued", when, c->queueLen());
+    CHECK(c->queuedBytes() <= WS_MAX_QUEUED_BYTES, "%s: %zu bytes queued", when, c->queuedBytes());
+  }
+  CHECK(ws.queuedBytes() == total, "%s: server counts %zu bytes, charged %zu", when, ws.queuedBytes(), total);
+  CHECK(ws.queuedBytes() <= WS_MAX_TOTAL_QUEUED_BYTES, "%s: %zu bytes queued in all", when, ws.queuedBytes());
+}
+
+static void hangUp(std::vector<Peer> &peers)
+{
+  for (auto &p : peers)
+    p.client->discCb(p.client->discArg, p.client);
+  peers.clear();
+}
+
+static std::string clockMessage(int t)
+{
+  char msg[32];
+  snprintf(msg, sizeof(msg), "{\"utc\":\"%02d:%02d:%02d\"}", t / 3600, t / 60 % 60, t % 60);
+  return msg;
+}
+
+// An hour of a clock, a signal level and solar data every 15 minutes to 32 clients
+static void broadcastHour(AwsDropPolicy policy)
+{
+  AsyncWebServer server(80);
+  AsyncWebSocket ws("/ws");
+  ws.dropPolicy(policy);
+  server.addHandler(&ws);
+  server.begin();
+
+  std::vector<Peer> peers;
+  for (int i = 0; i < 32; i++)
+  {
+    Peer p = {connect(server), i % 4 == 3 ? STALLED : i % 4 == 2 ? SLOW : FAST};
+    if (p.kind == SLOW)
+      p.client->window = 700;
+    peers.push_back(p);
+  }
+  CHECK(ws.count() == peers.size(), "%zu clients", ws.count());
+
+  std::string solar = "{\"source\":\"N0NBH\",\"updated\":\"18 Oct 2026 0000 GMT\"";
+  while (solar.size() < 900)
+    solar += ",\"pad\":\"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\"";
+  solar += "}";
+  size_t fetch = solar.find(" GMT") - 1;
+  const int TICKS = 3600;
+  size_t peak = 0;
+  for (int t = 0; t < TICKS; t++)
+  {
+    std::string clock = clockMessage(t), rssi = "{\"rssi\":" + std::to_string(-50 - t % 20) + "}";
+    ws.textAll(clock.c_str(), clock.size(), 1);
+    ws.textAll(rssi.c_str(), rssi.size(), 2);
+    if (t % 900 == 899)
+    {
+      solar[fetch] = '1' + t / 900;
+      ws.textAll(solar.c_str(), solar.size(), 3);
+    }
+    peak = std::max(peak, ws.queuedBytes());
+    for (auto &p : peers)
+    {
+      // one message is in flight at a time, so a fast peer acknowledges a few times a tick
+      for (int a = 0; a < (p.kind == FAST ? 4 : p.kind == SLOW && t % 10 == 9 ? 1 : 0); a++)
+        p.client->peerAck();
+      drain(p);
+    }
+    checkBudgets(ws, policyName[policy]);
+  }
+  for (int r = 0; r < 200; r++)
+    for (auto &p : peers)
+      if (p.kind != STALLED)
+      {
+        p.client->peerAck();
+        drain(p);
+      }
+
+  uint32_t dropped[3] = {};
+  for (auto &p : peers)
+  {
+    AsyncWebSocketClient *c = socketClient(ws, p.client);
+    dropped[p.kind] += c->droppedMessages();
+    if (p.kind == STALLED)
+      continue;
+    CHECK(c->queueLen() == 0 && c->queuedBytes() == 0, "%s: %zu bytes left for a drained client", policyName[policy],
+          c->queuedBytes());
+    std::vector<std::string> clocks;
+    std::string lastSolar;
+    for (auto &m : p.messages)
+      if (m.rfind("{\"utc\"", 0) == 0)
+        clocks.push_back(m);
+      else if (m.rfind("{\"source\"", 0) == 0)
+        lastSolar = m;
+    if (p.kind == FAST)
+    {
+      CHECK(clocks.size() == (size_t)TICKS, "%s: fast client got %zu of %d seconds", policyName[policy], clocks.size(), TICKS);
+      CHECK(c->droppedMessages() == 0, "%s: fast client dropped %u", policyName[policy], c->droppedMessages());
+    }
+    CHECK(std::is_sorted(clocks.begin(), clocks.end()), "%s: clock out of order", policyName[policy]);
+    // keeping the newest is what the two policies besides the default are for
+    if (policy != WS_DROP_NEWEST)
+    {
+      CHECK(!clocks.empty() && clocks.back() == clockMessage(TICKS - 1), "%s: %s client ends at %s", policyName[policy],
+            p.kind == FAST ? "fast" : "slow", clocks.empty() ? "nothing" : clocks.back().c_str());
+      CHECK(lastSolar == solar, "%s: ends on old solar data", policyName[policy]);
+    }
+  }
+  CHECK(dropped[SLOW] > 0 && dropped[STALLED] > 0, "%s: slow clients dropped nothing", policyName[policy]);
+  printf("%-8s peak %5zu bytes queued, dropped per client: slow %5u, stalled %5u\n", policyName[policy], peak,
+         dropped[SLOW] / 8, dropped[STALLED] / 8);
+
+  hangUp(peers);
+  CHECK(ws.count() == 0, "%zu clients left", ws.count());
+  CHECK(ws.queuedBytes() == 0, "%s: %zu bytes still charged after all clients left", policyName[policy], ws.queuedBytes());
+}
+
+// What each policy keeps of 40 messages to a client that takes nothing
+static void dropPolicy(AwsDropPolicy policy, const std::vector<int> &kept)
+{
+  AsyncWebServer server(80);
+  AsyncWebSocket ws("/ws");
+  ws.dropPolicy(policy);
+  server.addHandler(&ws);
+  Peer p = {connect(server), STALLED};
+  p.client->window = 0;
+  AsyncWebSocketClient *c = socketClient(ws, p.client);
+  for (int i = 0; i < 40; i++)
+  {
+    std::string msg = "m" + std::to_string(i);
+    ws.textAll(msg.c_str(), msg.size(), 1 + i % 4);
+  }
+  checkBudgets(ws, policyName[policy]);
+  CHECK(c->queueLen() == kept.size(), "%s: %zu queued", policyName[policy], c->queueLen());
+  CHECK(c->droppedMessages() == 40 - kept.size(), "%s: %u dropped", policyName[policy], c->droppedMessages());
+
+  p.client->window = 5744;
+  c->_onPoll(); // as the TCP stack polls a connection with room again
+  for (int r = 0; r < 100; r++)
+    p.client->peerAck();
+  drain(p);
+  std::vector<std::string> expected;
+  for (int i : kept)
+    expected.push_back("m" + std::to_string(i));
+  CHECK(p.messages == expected, "%s: %zu messages, first %s", policyName[policy], p.messages.size(),
+        p.messages.empty() ? "none" : p.messages[0].c_str());
+  CHECK(c->queuedBytes() == 0 && ws.queuedBytes() == 0, "%s: %zu and %zu bytes left", policyName[policy], c->queuedBytes(),
+        ws.queuedBytes());
+  std::vector<Peer> peers = {p};
+  hangUp(peers);
+}
+
+static std::vector<int> range(int from, int to)
+{
+  std::vector<int> v;
+  for (int i = from; i < to; i++)
+    v.push_back(i);
+  return v;
+}
+
+int main()
+{
+  for (AwsDropPolicy policy : {WS_DROP_NEWEST, WS_DROP_OLDEST, WS_DROP_COALESCE})
+    broadcastHour(policy);
+
+  dropPolicy(WS_DROP_NEWEST, range(0, WS_MAX_QUEUED_MESSAGES));
+  dropPolicy(WS_DROP_OLDEST, range(40 - WS_MAX_QUEUED_MESSAGES, 40));
+  dropPolicy(WS_DROP_COALESCE, range(36, 40));
+
+  AsyncWebServer server(80);
+  AsyncWebSocket ws("/ws");
+  ws.dropPolicy(WS_DROP_OLDEST);
+  server.addHandler(&ws);
+  std::vector<Peer> peers;
+  for (int i = 0; i < 8; i++)
+  {
+    peers.push_back({connect(server), STALLED});
+    peers.back().client->window = 0;
+  }
+
+  // Copies of their own to stalled clients fill the server total before their
+  // queues, and a client cannot make room there by dropping its own messages
+  std::string big(1000, 'b');
+  for (int i = 0; i < 20; i++)
+    for (auto c : ws.getClients())
+      c->text(big.c_str(), big.size(), 0);
+  checkBudgets(ws, "own copies");
+  CHECK(ws.queuedBytes() > WS_MAX_TOTAL_QUEUED_BYTES - big.size(), "only %zu bytes queued in all", ws.queuedBytes());
+  CHECK(ws.droppedMessages() > 0, "nothing dropped at the server total");
+
+  // A buffer held by messages made before any of them was queued: what each was
+  // charged comes back when it goes, whichever goes last
+  hangUp(peers);
+  CHECK(ws.queuedBytes() == 0, "%zu bytes still charged", ws.queuedBytes());
+  for (int i = 0; i < 3; i++)
+    peers.push_back({connect(server), STALLED});
+  AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer((uint8_t *)big.data(), big.size());
+  std::vector<AsyncWebSocketMessage *> made;
+  for (size_t i = 0; i < peers.size(); i++)
+    made.push_back(new AsyncWebSocketMultiMessage(buffer));
+  size_t i = 0;
+  for (auto c : ws.getClients())
+    c->message(made[i++]);
+  checkBudgets(ws, "made before queueing");
+  peers[0].client->peerAck();
+  drain(peers[0]);
+  checkBudgets(ws, "one sent");
+  hangUp(peers);
+  CHECK(ws.queuedBytes() == 0, "%zu bytes still charged", ws.queuedBytes());
+  ws._cleanBuffers();
+  CHECK(ws._buffers.isEmpty(), "buffer not freed");
+
+  return checkResult("websocket_queue_test");
+}
@@ -0,0 +1,359 @@
+// The Wi-Fi connect paths and the lease job cut from the sketch, against a WiFi layer
+// and an lwIP DHCP client stood in for on a virtual clock, with one AP that may move
+// channel or BSSID or be off. Covers the first boot, the fast path on the kept lease,
+// a cold boot, the kept lease handed over to DHCP before it runs out and one that ran
+// out while the CPU was held in reset, the AP moving, off or replaced, and a cache
+// without a lease or dropped by the portal. The DHCP data is only read under the
+// tcpip core lock.
+#include "check.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+static uint32_t vms = 0; // what millis() reads
+static uint32_t millis() { return vms; }
+static void delay(uint32_t ms) { vms += ms; }
+
+// The system time: kept over a restart of the CPU, 0 after a power cycle
+static time_t vtime = 0;
+static time_t virtualTime(time_t *) { return vtime + vms / 1000; }
+
+// What the section needs of the sketch and the core
+struct
+{
+  bool quiet = true;
+  template <class... Args>
+  void printf(const char *format, Args... args)
+  {
+    if (!quiet)
+      ::printf(format, args...);
+  }
+  void println(const char *s)
+  {
+    if (!quiet)
+      puts(s);
+  }
+} Serial;
+struct String
+{
+  std::string s;
+  String(const char *c = "") : s(c) {}
+  const char *c_str() const { return s.c_str(); }
+};
+struct IPAddress
+{
+  uint32_t a = 0;
+  IPAddress() {}
+  IPAddress(uint32_t v) : a(v) {}
+  IPAddress(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3) : a(b0 | b1 << 8 | b2 << 16 | (uint32_t)b3 << 24) {}
+  operator uint32_t() const { return a; }
+  String toString() const
+  {
+    static char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", a & 255, a >> 8 & 255, a >> 16 & 255, a >> 24);
+    return String(text);
+  }
+};
+enum
+{
+  WL_IDLE_STATUS = 0,
+  WL_CONNECTED = 3,
+  WL_DISCONNECTED = 6
+};
+
+// lwIP's DHCP client of the station, which the tcpip task updates under the core lock
+#define DHCP_COARSE_TIMER_SECS 60
+enum
+{
+  DHCP_STATE_OFF = 0,
+  DHCP_STATE_REBINDING = 4,
+  DHCP_STATE_RENEWING = 5,
+  DHCP_STATE_BOUND = 10
+};
+struct dhcp
+{
+  uint8_t state;
+  uint16_t lease_used; // coarse timer ticks
+  uint32_t offered_t0_lease;
+};
+struct netif
+{
+  struct dhcp *dhcp;
+};
+typedef struct netif esp_netif_t;
+static struct dhcp staDhcp;
+static struct netif staNetif = {&staDhcp};
+static esp_netif_t *esp_netif_get_handle_from_ifkey(const char *) { return &staNetif; }
+static void *esp_netif_get_netif_impl(esp_netif_t *netif) { return netif; }
+static int tcpipLocks, tcpipUnlocks, unlockedReads;
+static bool tcpipLocked;
+#define LOCK_TCPIP_CORE() (tcpipLocks++, tcpipLocked = true)
+#define UNLOCK_TCPIP_CORE() (tcpipUnlocks++, tcpipLocked = false)
+static struct dhcp *netif_dhcp_data(struct netif *netif)
+{
+  unlockedReads += !tcpipLocked;
+  return netif->dhcp;
+}
+static const uint32_t LEASE_S = 86400;
+
+// The AP, and how long joining it takes
+struct Ap
+{
+  uint8_t bssid[6];
+  uint8_t channel;
+  bool up;
+  IPAddress lease; // what its DHCP server hands out
+} ap = {{0x24, 0x4b, 0xfe, 1, 2, 3}, 6, true, IPAddress(192, 168, 1, 57)};
+static const uint32_t SCAN_MS = 2200, ASSOC_MS = 250, DHCP_MS = 900;
+
+struct MockWiFi
+{
+  IPAddress staticIp, gateway, subnet, dns;
+  bool dhcp = true, joining = false;
+  uint32_t connectAt = 0;
+  int begins = 0, targeted = 0, dhcpBegins = 0;
+  uint8_t bssid[6] = {};
+  uint8_t joinedChannel = 0;
+  IPAddress ip;
+
+  bool config(IPAddress local, IPAddress gw, IPAddress mask, IPAddress dns1 = IPAddress())
+  {
+    staticIp = local, gateway = gw, subnet = mask, dns = dns1;
+    dhcp = !local;
+    if (dhcp && joining && vms >= connectAt)
+    {
+      // DHCP on the link that is up
+      dhcpBegins++;
+      connectAt = vms + DHCP_MS;
+    }
+    staDhcp = {};
+    return true;
+  }
+  int begin(const char *, const char *, int32_t channel = 0, const uint8_t *toBssid = nullptr)
+  {
+    begins++;
+    joining = false;
+    dhcpBegins += dhcp;
+    if (channel && toBssid)
+    {
+      targeted++;
+      if (!ap.up || channel != ap.channel || memcmp(toBssid, ap.bssid, 6))
+        return WL_DISCONNECTED; // never gets there
+      connectAt = vms + ASSOC_MS;
+    }
+    else
+    {
+      if (!ap.up)
+        return WL_DISCONNECTED;
+      connectAt = vms + SCAN_MS + ASSOC_MS;
+    }
+    connectAt += dhcp ? DHCP_MS : 0;
+    joining = true;
+    return WL_DISCONNECTED;
+  }
+  int status()
+  {
+    if (!joining || vms < connectAt)
+      return WL_DISCONNECTED;
+    memcpy(bssid, ap.bssid, 6);
+    joinedChannel = ap.channel;
+    ip = dhcp ? ap.lease : staticIp;
+    if (dhcp && staDhcp.state != DHCP_STATE_BOUND)
+      staDhcp = {DHCP_STATE_BOUND, 0, LEASE_S};
+    return WL_CONNECTED;
+  }
+  bool disconnect()
+  {
+    joining = false;
+    return true;
+  }
+  const uint8_t *BSSID() { return bssid; }
+  int32_t channel() { return joinedChannel; }
+  IPAddress localIP() { return ip; }
+  IPAddress gatewayIP() { return IPAddress(192, 168, 1, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+  IPAddress dnsIP(uint8_t) { return IPAddress(192, 168, 1, 1); }
+} WiFi;
+
+// Preferences over a map that outlives the boots, counting the writes
+static std::map<std::string, std::vector<uint8_t>> nvs;
+static int nvsWrites = 0;
+struct
+{
+  std::string space;
+  void begin(const char *name, bool) { space = name; }
+  void end() {}
+  size_t putBytes(const char *key, const void *value, size_t len)
+  {
+    nvsWrites++;
+    nvs[space + "/" + key].assign((const uint8_t *)value, (const uint8_t *)value + len);
+    return len;
+  }
+  size_t getBytes(const char *key, void *value, size_t len)
+  {
+    auto it = nvs.find(space + "/" + key);
+    if (it == nvs.end())
+      return 0;
+    len = std::min(len, it->second.size());
+    memcpy(value, it->second.data(), len);
+    return len;
+  }
+} prefs;
+
+uint32_t dhcpLeaseEnds();
+#define time virtualTime
+#include "wifi.inc"
+#undef time
+
+// A boot: 600 ms of setup before the connection, as with the splash screen. Warm keeps
+// the system time.
+static bool boot(const char *what, bool warm = true)
+{
+  if (!warm)
+    vtime = 0;
+  else if (!vtime)
+    vtime = 1760000000;
+  else
+    vtime += vms / 1000;
+  vms = 600;
+  WiFi = MockWiFi();
+  staDhcp = {};
+  int writes = nvsWrites;
+  bool ok = connectWiFi("shack", "secret");
+  printf("%-28s %-13s %-6s fast %4u ms, full %5u ms, connected %4u ms after boot, cache %s\n", what,
+         ok ? wifiPathNames[wifiStats.path] : "failed", wifiOnKeptLease ? "static" : "DHCP", wifiStats.fastMs,
+         wifiStats.fullMs, ok ? wifiStats.connectedMs : 0, nvsWrites != writes ? "written" : "kept");
+  return ok;
+}
+
+static WiFiCache cached()
+{
+  WiFiCache cache = {};
+  auto it = nvs.find("wifi/cache");
+  if (it != nvs.end())
+    memcpy(&cache, it->second.data(), std::min(sizeof(cache), it->second.size()));
+  return cache;
+}
+
+static uint32_t now() { return virtualTime(nullptr); }
+
+int main()
+{
+  // nothing kept: a scan and DHCP, after which the cache holds this AP and lease
+  CHECK(boot("first boot", false) && wifiStats.path == WIFI_FULL, "path %d", wifiStats.path);
+  WiFiCache cache = cached();
+  CHECK(cache.channel == 6 && !memcmp(cache.bssid, ap.bssid, 6) && cache.ip == ap.lease && cache.leaseEnds == 0,
+        "cached channel %u, lease end %u", cache.channel, cache.leaseEnds);
+  CHECK(WiFi.targeted == 0 && WiFi.dhcpBegins == 1, "%d targeted, %d DHCP", WiFi.targeted, WiFi.dhcpBegins);
+  int writes = nvsWrites;
+  leaseJob(); // the time is not known yet
+  CHECK(nvsWrites == writes && cached().leaseEnds == 0, "lease end %u kept without the time", cached().leaseEnds);
+  vtime = 1760000000 - vms / 1000; // NTP answers 5 s later
+  vms += 5000;
+  staDhcp.lease_used = 1; // a minute into the lease as lwIP counts
+  leaseJob();
+  CHECK(cached().leaseEnds == now() - 60 + LEASE_S, "lease end %u, expected %u", cached().leaseEnds,
+        now() - 60 + LEASE_S);
+  writes = nvsWrites;
+  leaseJob(); // nothing new to keep
+  CHECK(nvsWrites == writes, "%d writes with nothing new", nvsWrites - writes);
+  uint32_t fullBootMs = wifiStats.connectedMs;
+
+  // the fast path: straight to the AP on the kept lease, no DHCP, nothing rewritten
+  CHECK(boot("next boot") && wifiStats.path == WIFI_FAST, "path %d", wifiStats.path);
+  CHECK(wifiOnKeptLease && WiFi.begins == 1 && WiFi.dhcpBegins == 0 && WiFi.localIP() == ap.lease,
+        "%d begins, %d DHCP", WiFi.begins, WiFi.dhcpBegins);
+  CHECK(wifiStats.fastMs <= ASSOC_MS + WIFI_POLL_MS && wifiStats.fullMs == 0, "fast path took %u ms", wifiStats.fastMs);
+  printf("  connected %u ms after boot, from %u\n", wifiStats.connectedMs, fullBootMs);
+  uint32_t ends = cached().leaseEnds;
+  CHECK(ends > now(), "lease end %u in the past", ends);
+  leaseJob(); // the kept lease has long to go
+  CHECK(wifiOnKeptLease && WiFi.dhcpBegins == 0 && cached().leaseEnds == ends, "lease end %u, was %u",
+        cached().leaseEnds, ends);
+
+  // after a power cycle the time is not known: the cached AP, but DHCP
+  CHECK(boot("cold boot", false) && wifiStats.path == WIFI_FAST && !wifiOnKeptLease && WiFi.dhcpBegins == 1,
+        "path %d, %d DHCP", wifiStats.path, WiFi.dhcpBegins);
+  CHECK(wifiStats.fastMs >= ASSOC_MS + DHCP_MS && wifiStats.fastMs < WIFI_FAST_WAIT_MS, "fast path took %u ms",
+        wifiStats.fastMs);
+  vtime = 1760000000 + 3600 - vms / 1000; // NTP answers, an hour after the last boot
+  leaseJob();                             // the lease from this DHCP
+  CHECK(cached().leaseEnds == now() + LEASE_S, "lease end %u, expected %u", cached().leaseEnds, now() + LEASE_S);
+
+  // the kept lease nearly runs out while up: DHCP takes over before it does
+  CHECK(boot("warm boot") && wifiOnKeptLease, "not on the kept lease");
+  ends = cached().leaseEnds;
+  vtime = ends - WIFI_LEASE_MARGIN_S - vms / 1000 - 1;
+  leaseJob();
+  CHECK(wifiOnKeptLease && WiFi.dhcpBegins == 0, "handed over %u s early", WIFI_LEASE_MARGIN_S + 1);
+  vtime++;
+  leaseJob();
+  CHECK(!wifiOnKeptLease && WiFi.dhcpBegins == 1, "not handed over at the margin, %d DHCP", WiFi.dhcpBegins);
+  vms += DHCP_MS;
+  CHECK(WiFi.status() == WL_CONNECTED, "not connected after DHCP");
+  leaseJob(); // the new lease is kept
+  CHECK(cached().leaseEnds == now() + LEASE_S, "lease end %u, expected %u", cached().leaseEnds, now() + LEASE_S);
+
+  // a lease that ran out while the CPU was held in reset: the cached AP, but DHCP, and
+  // the new lease is kept at once
+  vtime = cached().leaseEnds + 100;
+  CHECK(boot("lease ran out") && wifiStats.path == WIFI_FAST && !wifiOnKeptLease && WiFi.dhcpBegins == 1,
+        "path %d, %s, %d DHCP", wifiStats.path, wifiOnKeptLease ? "static" : "DHCP", WiFi.dhcpBegins);
+  CHECK(WiFi.localIP() == ap.lease && cached().leaseEnds == now() + LEASE_S, "lease end %u, expected %u",
+        cached().leaseEnds, now() + LEASE_S);
+  CHECK(wifiLeaseEnds == cached().leaseEnds, "lease end %u, cached %u", wifiLeaseEnds, cached().leaseEnds);
+
+  // the AP moved to another channel: the fast path times out, the scan finds it, and
+  // the cache follows
+  ap.channel = 11;
+  CHECK(boot("AP moved to channel 11") && wifiStats.path == WIFI_FULL, "path %d", wifiStats.path);
+  CHECK(wifiStats.fastMs >= WIFI_FAST_WAIT_MS && wifiStats.fastMs < WIFI_FAST_WAIT_MS + WIFI_POLL_MS,
+        "fast path gave up after %u ms", wifiStats.fastMs);
+  CHECK(WiFi.begins == 2 && WiFi.targeted == 1 && WiFi.dhcpBegins == 1, "%d begins, %d targeted, %d DHCP", WiFi.begins,
+        WiFi.targeted, WiFi.dhcpBegins);
+  CHECK(cached().channel == 11, "cached channel %u", cached().channel);
+  CHECK(boot("after that") && wifiStats.path == WIFI_FAST, "path %d", wifiStats.path);
+
+  // a mesh node with another BSSID took over, and DHCP handed out another address
+  ap.bssid[5] = 9;
+  ap.lease = IPAddress(192, 168, 1, 80);
+  CHECK(boot("other BSSID, new lease") && wifiStats.path == WIFI_FULL && WiFi.localIP() == ap.lease, "path %d",
+        wifiStats.path);
+  CHECK(cached().bssid[5] == 9 && cached().ip == ap.lease, "cached %s", IPAddress(cached().ip).toString().c_str());
+  CHECK(boot("after that") && wifiStats.path == WIFI_FAST && WiFi.localIP() == ap.lease, "path %d", wifiStats.path);
+
+  // the AP off: both attempts run out, the caller opens the portal, the cache stays
+  ap.up = false;
+  writes = nvsWrites;
+  CHECK(!boot("AP off"), "connected to an AP that is off");
+  CHECK(wifiStats.fastMs >= WIFI_FAST_WAIT_MS && wifiStats.fullMs >= WIFI_FULL_WAIT_MS && nvsWrites == writes,
+        "gave up after %u and %u ms, %d writes", wifiStats.fastMs, wifiStats.fullMs, nvsWrites - writes);
+  ap.up = true;
+
+  // no lease kept: the fast path still skips the scan but asks DHCP
+  cache = cached();
+  cache.ip = 0;
+  prefs.begin("wifi", false);
+  prefs.putBytes("cache", &cache, sizeof(cache));
+  prefs.end();
+  CHECK(boot("cache without a lease") && wifiStats.path == WIFI_FAST && WiFi.dhcpBegins == 1, "path %d, %d DHCP",
+        wifiStats.path, WiFi.dhcpBegins);
+  CHECK(wifiStats.fastMs >= ASSOC_MS + DHCP_MS && wifiStats.fastMs < WIFI_FAST_WAIT_MS, "fast path took %u ms",
+        wifiStats.fastMs);
+
+  // the portal saved another network and dropped the cache
+  nvs.erase("wifi/cache");
+  CHECK(boot("new network from the portal") && wifiStats.path == WIFI_FULL && WiFi.targeted == 0, "path %d",
+        wifiStats.path);
+
+  printf("DHCP data read %d times, %d outside the tcpip core lock\n", tcpipLocks, unlockedReads);
+  CHECK(tcpipLocks > 0 && unlockedReads == 0 && tcpipLocks == tcpipUnlocks && !tcpipLocked,
+        "%d reads outside the lock, %d locks and %d unlocks", unlockedReads, tcpipLocks, tcpipUnlocks);
+
+  return checkResult("wifi_test");
+}